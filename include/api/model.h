@@ -151,6 +151,12 @@ class MS_API Model {
   /// \return Status.
   Status UpdateWeights(const std::vector<MSTensor> &new_weights);
 
+  /// \brief Drop the state kept by the model between predictions, such as the key/value cache of an incremental
+  /// decoding, so that the next prediction starts a new sequence.
+  ///
+  /// \return Status.
+  Status ResetState();
+
   /// \brief Inference model.
   ///
   /// \param[in] inputs A vector where model inputs are arranged in sequence.
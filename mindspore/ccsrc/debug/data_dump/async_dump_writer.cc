@@ -0,0 +1,200 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "debug/data_dump/async_dump_writer.h"
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <utility>
+#include "debug/data_dump/dump_json_parser.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+void AsyncDumpWriter::Init(size_t thread_num, size_t max_staging_size, bool drop_when_full) {
+  if (enabled() || thread_num == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_staging_size_ = max_staging_size;
+  drop_when_full_ = drop_when_full;
+  stop_ = false;
+  for (size_t i = 0; i < thread_num; ++i) {
+    (void)workers_.emplace_back(&AsyncDumpWriter::WorkerLoop, this);
+  }
+  MS_LOG(INFO) << "Async dump writer started, thread num: " << thread_num << ", max staging size: " << max_staging_size
+               << ", drop when full: " << drop_when_full;
+}
+
+void AsyncDumpWriter::Finalize() {
+  if (!enabled()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_cond_.notify_all();
+  // workers only exit once the queue is drained
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  workers_.clear();
+  free_buffers_.clear();
+  free_size_ = 0;
+  if (dropped_num_ > 0) {
+    MS_LOG(WARNING) << "Async dump writer dropped " << dropped_num_
+                    << " tensors because the disk could not keep up, enlarge max_staging_size or disable "
+                       "drop_when_full to dump all of them.";
+  }
+  dropped_num_ = 0;
+}
+
+bool AsyncDumpWriter::WaitForSpace(std::unique_lock<std::mutex> *lock, size_t size) {
+  // a task larger than the whole pool is still accepted when nothing else is staged
+  auto has_space = [this, size]() { return staging_size_ == 0 || staging_size_ + size <= max_staging_size_; };
+  if (!has_space()) {
+    if (drop_when_full_) {
+      if (dropped_num_ == 0) {
+        MS_LOG(WARNING) << "Async dump staging pool is full, tensors will be dropped until the writers catch up.";
+      }
+      ++dropped_num_;
+      return false;
+    }
+    space_cond_.wait(*lock, has_space);
+  }
+  staging_size_ += size;
+  return true;
+}
+
+void AsyncDumpWriter::Enqueue(Buffer &&data, size_t size, Task task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(StagedTask{std::move(data), size, std::move(task)});
+  }
+  task_cond_.notify_one();
+}
+
+bool AsyncDumpWriter::Submit(const void *data, size_t len, Task task) {
+  if (!enabled()) {
+    auto src = static_cast<const uint8_t *>(data);
+    task(Buffer(src, src + len));
+    return true;
+  }
+  Buffer buffer;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!WaitForSpace(&lock, len)) {
+      return false;
+    }
+    buffer = AcquireBuffer(len);
+  }
+  buffer.resize(len);
+  if (len > 0) {
+    (void)memcpy(buffer.data(), data, len);
+  }
+  Enqueue(std::move(buffer), len, std::move(task));
+  return true;
+}
+
+bool AsyncDumpWriter::Submit(size_t size, std::function<void()> task) {
+  if (!enabled()) {
+    task();
+    return true;
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!WaitForSpace(&lock, size)) {
+      return false;
+    }
+  }
+  Enqueue(Buffer(), size, [task = std::move(task)](const Buffer &) { task(); });
+  return true;
+}
+
+bool AsyncDumpWriter::DumpToFile(const std::string &file_name, const void *data, size_t len, const ShapeVector &shape,
+                                 TypeId type) {
+  return Submit(data, len, [file_name, shape, type](const Buffer &buffer) {
+    (void)DumpJsonParser::DumpToFile(file_name, buffer.data(), buffer.size(), shape, type);
+  });
+}
+
+void AsyncDumpWriter::Sync() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  space_cond_.wait(lock, [this]() { return tasks_.empty() && running_num_ == 0; });
+}
+
+size_t AsyncDumpWriter::dropped_num() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return dropped_num_;
+}
+
+void AsyncDumpWriter::WorkerLoop() {
+  while (true) {
+    StagedTask staged;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_cond_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      staged = std::move(tasks_.front());
+      tasks_.pop();
+      ++running_num_;
+    }
+    try {
+      staged.task(staged.data);
+    } catch (const std::exception &e) {
+      MS_LOG(ERROR) << "Async dump task failed: " << e.what();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --running_num_;
+      staging_size_ -= staged.size;
+      ReleaseBuffer(std::move(staged.data));
+    }
+    space_cond_.notify_all();
+  }
+}
+
+// The caller holds mutex_. Reuse the smallest free buffer that fits to avoid allocating for every tensor.
+AsyncDumpWriter::Buffer AsyncDumpWriter::AcquireBuffer(size_t len) {
+  auto best = free_buffers_.end();
+  for (auto iter = free_buffers_.begin(); iter != free_buffers_.end(); ++iter) {
+    if (iter->capacity() >= len && (best == free_buffers_.end() || iter->capacity() < best->capacity())) {
+      best = iter;
+    }
+  }
+  if (best == free_buffers_.end()) {
+    return Buffer();
+  }
+  Buffer buffer = std::move(*best);
+  free_size_ -= buffer.capacity();
+  (void)free_buffers_.erase(best);
+  return buffer;
+}
+
+// The caller holds mutex_. Free buffers are bounded by the staging size as well.
+void AsyncDumpWriter::ReleaseBuffer(Buffer &&buffer) {
+  if (buffer.capacity() == 0 || free_size_ + buffer.capacity() > max_staging_size_) {
+    return;
+  }
+  free_size_ += buffer.capacity();
+  buffer.clear();
+  free_buffers_.push_back(std::move(buffer));
+}
+}  // namespace mindspore
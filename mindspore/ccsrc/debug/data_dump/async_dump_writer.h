@@ -0,0 +1,99 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_ASYNC_DUMP_WRITER_H_
+#define MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_ASYNC_DUMP_WRITER_H_
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mindapi/base/shape_vector.h"
+#include "mindapi/base/type_id.h"
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+/*
+ * Writes dump files on background threads so that the execution thread only pays for a host copy of the tensor.
+ * Tensors are snapshotted into a staging pool bounded by max_staging_size bytes. When the pool is full the caller
+ * either waits for the writers (backpressure) or the task is dropped and counted, depending on drop_when_full.
+ */
+class BACKEND_EXPORT AsyncDumpWriter {
+ public:
+  using Buffer = std::vector<uint8_t>;
+  // A task gets the staged bytes, which are recycled into the pool after it returns.
+  using Task = std::function<void(const Buffer &)>;
+
+  static AsyncDumpWriter &GetInstance() {
+    static AsyncDumpWriter instance;
+    return instance;
+  }
+
+  ~AsyncDumpWriter() { Finalize(); }
+  DISABLE_COPY_AND_ASSIGN(AsyncDumpWriter)
+
+  // thread_num 0 keeps the writer disabled, in which case callers dump synchronously.
+  void Init(size_t thread_num, size_t max_staging_size, bool drop_when_full);
+  // Waits until all staged tasks are written and stops the writer threads.
+  void Finalize();
+  bool enabled() const { return !workers_.empty(); }
+
+  // Copies len bytes of data into the staging pool and queues task on it. Returns false if the task is dropped.
+  bool Submit(const void *data, size_t len, Task task);
+  // Queues a task whose data is owned by the task itself, size is still counted in the staging pool.
+  bool Submit(size_t size, std::function<void()> task);
+  // Snapshots a host tensor and writes it as npy to file_name + ".npy" on a writer thread.
+  bool DumpToFile(const std::string &file_name, const void *data, size_t len, const ShapeVector &shape, TypeId type);
+  // Blocks until every submitted task has been written.
+  void Sync();
+  size_t dropped_num() const;
+
+ private:
+  AsyncDumpWriter() = default;
+  void WorkerLoop();
+  Buffer AcquireBuffer(size_t len);
+  void ReleaseBuffer(Buffer &&buffer);
+  bool WaitForSpace(std::unique_lock<std::mutex> *lock, size_t size);
+  void Enqueue(Buffer &&data, size_t size, Task task);
+
+  struct StagedTask {
+    Buffer data;
+    size_t size{0};
+    Task task;
+  };
+
+  std::vector<std::thread> workers_;
+  std::queue<StagedTask> tasks_;
+  std::vector<Buffer> free_buffers_;
+  mutable std::mutex mutex_;
+  std::condition_variable task_cond_;
+  std::condition_variable space_cond_;
+  size_t max_staging_size_{0};
+  size_t staging_size_{0};
+  size_t free_size_{0};
+  size_t running_num_{0};
+  size_t dropped_num_{0};
+  bool drop_when_full_{false};
+  bool stop_{false};
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_ASYNC_DUMP_WRITER_H_
@@ -23,6 +23,7 @@
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "debug/data_dump/npy_header.h"
+#include "debug/data_dump/async_dump_writer.h"
 #include "include/common/debug/anf_dump_utils.h"
 #include "include/common/utils/comm_manager.h"
 #include "mindspore/core/utils/file_utils.h"
@@ -46,6 +47,12 @@ constexpr auto kStatisticDump = "statistic";
 constexpr auto kTensorDump = "tensor";
 constexpr auto kFullDump = "full";
 constexpr auto kFileFormat = "file_format";
+constexpr auto kAsyncWriter = "async_writer";
+constexpr auto kThreadNum = "thread_num";
+constexpr auto kMaxStagingSize = "max_staging_size";
+constexpr auto kDropWhenFull = "drop_when_full";
+constexpr size_t kDefaultMaxStagingSizeMB = 1024;
+constexpr size_t kMBToByte = 1024 * 1024;
 constexpr auto kDumpInputAndOutput = 0;
 constexpr auto kDumpInputOnly = 1;
 constexpr auto kDumpOutputOnly = 2;
@@ -140,6 +147,16 @@ void DumpJsonParser::Parse() {
   ParseE2eDumpSetting(j);
   ParseCommonDumpSetting(j);
   JudgeDumpEnabled();
+  if (e2e_dump_enabled_) {
+    AsyncDumpWriter::GetInstance().Init(async_writer_thread_num_, async_writer_max_staging_size_,
+                                        async_writer_drop_when_full_);
+  }
+}
+
+void DumpJsonParser::Finalize() {
+  // flush the tensors still staged in the async writer before the dump config goes away
+  AsyncDumpWriter::GetInstance().Finalize();
+  instance_ = nullptr;
 }
 
 void WriteJsonFile(const std::string &file_path, const std::ifstream &json_file) {
@@ -269,6 +286,9 @@ bool DumpJsonParser::DumpToFile(const std::string &filename, const void *data, s
   }
   std::string final_file_path = origin_file_path;
   if (need_map) {
+    // DumpToFile runs on the async dump writer threads as well
+    static std::mutex mapping_file_mutex;
+    std::lock_guard<std::mutex> mapping_lock(mapping_file_mutex);
     std::string origin_name_str = origin_name.value();
     std::string mapped_name_str = mapped_name.value();
     auto mapping_file = Common::CreatePrefixPath(prefix_path.value() + "/mapping.csv");
@@ -371,6 +391,7 @@ void DumpJsonParser::ParseE2eDumpSetting(const nlohmann::json &content) {
     MS_LOG(WARNING) << "Deprecated: Synchronous dump mode is deprecated and will be removed in a future release";
   }
   trans_flag_ = ParseEnable(*trans_flag);
+  ParseAsyncWriter(*e2e_dump_setting);  // Pass in the whole json string to parse because async_writer is optional.
 }
 
 void CheckJsonUnsignedType(const nlohmann::json &content, const std::string &key) {
@@ -649,6 +670,35 @@ void DumpJsonParser::JsonConfigToString() {
   MS_LOG(INFO) << cur_config;
 }
 
+/*
+ * Feature group: Dump.
+ * Target device group: CPU, GPU.
+ * Runtime category: Old runtime, MindRT.
+ * Description: Parse the optional async writer of e2e dump. With thread_num > 0 tensors and statistics are written by
+ * background threads, max_staging_size (MB) bounds the snapshotted data waiting for them and drop_when_full chooses
+ * between dropping tensors and blocking the execution when the pool is full.
+ */
+void DumpJsonParser::ParseAsyncWriter(const nlohmann::json &content) {
+  auto iter = content.find(kAsyncWriter);
+  if (iter == content.end()) {
+    return;
+  }
+  auto thread_num = CheckJsonKeyExist(*iter, kThreadNum);
+  CheckJsonUnsignedType(*thread_num, kThreadNum);
+  async_writer_thread_num_ = *thread_num;
+  size_t max_staging_size = kDefaultMaxStagingSizeMB;
+  auto staging_size_iter = iter->find(kMaxStagingSize);
+  if (staging_size_iter != iter->end()) {
+    CheckJsonUnsignedType(*staging_size_iter, kMaxStagingSize);
+    max_staging_size = *staging_size_iter;
+  }
+  async_writer_max_staging_size_ = max_staging_size * kMBToByte;
+  auto drop_iter = iter->find(kDropWhenFull);
+  if (drop_iter != iter->end()) {
+    async_writer_drop_when_full_ = ParseEnable(*drop_iter);
+  }
+}
+
 void DumpJsonParser::JudgeDumpEnabled() {
   auto context = MsContext::GetInstance();
   MS_EXCEPTION_IF_NULL(context);
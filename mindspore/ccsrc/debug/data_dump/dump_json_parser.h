@@ -39,7 +39,7 @@ class BACKEND_EXPORT DumpJsonParser {
     });
     return *instance_;
   }
-  static void Finalize() { instance_ = nullptr; }
+  static void Finalize();
 
   ~DumpJsonParser() = default;
   void Parse();
@@ -107,6 +107,9 @@ class BACKEND_EXPORT DumpJsonParser {
   uint32_t op_debug_mode_{0};
   JsonFileFormat file_format_{FORMAT_BIN};
   bool trans_flag_{false};
+  uint32_t async_writer_thread_num_{0};
+  size_t async_writer_max_staging_size_{0};
+  bool async_writer_drop_when_full_{false};
   uint32_t cur_dump_iter_{0};
   bool already_parsed_{false};
   bool dump_enabled_warning_printed_{false};
@@ -130,6 +133,7 @@ class BACKEND_EXPORT DumpJsonParser {
   bool ParseEnable(const nlohmann::json &content) const;
   void ParseOpDebugMode(const nlohmann::json &content);
   void ParseFileFormat(const nlohmann::json &content);
+  void ParseAsyncWriter(const nlohmann::json &content);
 
   void JudgeDumpEnabled();
   void JsonConfigToString();
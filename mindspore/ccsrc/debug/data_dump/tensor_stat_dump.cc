@@ -18,12 +18,14 @@
 
 #include <memory>
 #include <map>
+#include <sstream>
 #include "utils/system/env.h"
 #include "utils/system/file_system.h"
 #include "utils/file_utils.h"
 #include "include/common/debug/common.h"
 #include "debug/debug_services.h"
 #include "debug/debugger/debugger.h"
+#include "debug/data_dump/async_dump_writer.h"
 
 namespace {
 constexpr auto kInput = "input";
@@ -32,15 +34,22 @@ constexpr auto kCsvHeader =
   "Op Type,Op Name,Task ID,Stream ID,Timestamp,IO,Slot,Data Size,Data Type,Shape,Max Value,Min Value,Avg Value,"
   "Count,Negative Zero Count,Positive Zero Count,NaN Count,Negative Inf Count,Positive Inf Count,Zero Count\n";
 constexpr auto kCsvFileName = "statistic.csv";
+constexpr auto kSeparator = ",";
+constexpr auto kEndLine = "\n";
 }  // namespace
 
 namespace mindspore {
 bool CsvWriter::OpenFile(const std::string &path, const std::string &header) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return OpenFileLocked(path, header);
+}
+
+bool CsvWriter::OpenFileLocked(const std::string &path, const std::string &header) {
   if (file_.is_open() && path == file_path_str_) {
     return true;
   }
   if (file_.is_open()) {
-    CloseFile();
+    CloseFileLocked();
   }
   auto file_path = Common::CreatePrefixPath(path);
   if (!file_path.has_value()) {
@@ -66,13 +75,18 @@ bool CsvWriter::OpenFile(const std::string &path, const std::string &header) {
   if (first_time_opening) {
     file_ << header;
     (void)file_.flush();
-    file_path_str_ = path;
   }
+  file_path_str_ = path;
   MS_LOG(INFO) << "Opened file: " << file_path_value;
   return true;
 }
 
 void CsvWriter::CloseFile() noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CloseFileLocked();
+}
+
+void CsvWriter::CloseFileLocked() noexcept {
   if (file_.is_open()) {
     file_.close();
     ChangeFileMode(file_path_str_, S_IRUSR);
@@ -80,15 +94,14 @@ void CsvWriter::CloseFile() noexcept {
   }
 }
 
-template <typename T>
-void CsvWriter::WriteToCsv(const T &val, bool end_line) {
-  file_ << val;
-  if (end_line) {
-    file_ << kEndLine;
-    (void)file_.flush();
-  } else {
-    file_ << kSeparator;
+bool CsvWriter::WriteRow(const std::string &path, const std::string &header, const std::string &row) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!OpenFileLocked(path, header)) {
+    return false;
   }
+  file_ << row;
+  (void)file_.flush();
+  return true;
 }
 
 CsvWriter::~CsvWriter() { CloseFile(); }
@@ -161,49 +174,53 @@ bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const s
     MS_LOG(INFO) << "Tensor data is empty, skipping current statistics";
     return false;
   }
+  auto &async_writer = AsyncDumpWriter::GetInstance();
+  if (async_writer.enabled()) {
+    // The statistics are computed on the writer threads. The tensor data may point to a buffer which the caller frees
+    // once this returns, so its bytes are staged and the task only keeps a copy of the tensor info.
+    auto staged_data = std::make_shared<TensorData>(*data);
+    staged_data->SetDataPtr(nullptr);
+    staged_data->SetTensor(nullptr);
+    return async_writer.Submit(
+      data->GetDataPtr(), data->GetByteSize(),
+      [stat_dump = *this, dump_path, staged_data](const AsyncDumpWriter::Buffer &buffer) {
+        staged_data->SetDataPtr(const_cast<char *>(reinterpret_cast<const char *>(buffer.data())));
+        (void)stat_dump.WriteTensorStats(dump_path, staged_data);
+        // the staged buffer is recycled by the writer
+        staged_data->SetDataPtr(nullptr);
+      });
+  }
+  return WriteTensorStats(dump_path, data);
+}
+
+bool TensorStatDump::WriteTensorStats(const std::string &dump_path, const std::shared_ptr<TensorData> &data) const {
   std::string type = data->GetTypeString();
   if (type.empty()) {
     type = "unsupported(" + std::to_string(data->GetType()) + ")";
     MS_LOG(INFO) << "Unsupported tensor data_type " << type << " for tensor " << data->GetName();
   }
-  if (!OpenStatisticsFile(dump_path)) {
-    return false;
-  }
   const DebugServices::TensorStat &stat = DebugServices::GetTensorStatistics(data);
   // write tensor statistics to csv file
-  std::ostringstream shape;
-  shape << "\"(";
+  std::ostringstream row;
+  row << op_type_ << kSeparator << op_name_ << kSeparator << task_id_ << kSeparator << stream_id_ << kSeparator
+      << timestamp_ << kSeparator << io_ << kSeparator << slot_ << kSeparator << stat.data_size << kSeparator << type
+      << kSeparator << "\"(";
   for (size_t i = 0; i < stat.shape.size(); i++) {
-    shape << (i > 0 ? "," : "") << stat.shape[i];
+    row << (i > 0 ? "," : "") << stat.shape[i];
   }
-  shape << ")\"";
-  CsvWriter &csv = CsvWriter::GetInstance();
-  csv.WriteToCsv(op_type_);
-  csv.WriteToCsv(op_name_);
-  csv.WriteToCsv(task_id_);
-  csv.WriteToCsv(stream_id_);
-  csv.WriteToCsv(timestamp_);
-  csv.WriteToCsv(io_);
-  csv.WriteToCsv(slot_);
-  csv.WriteToCsv(stat.data_size);
-  csv.WriteToCsv(type);
-  csv.WriteToCsv(shape.str());
+  row << ")\"" << kSeparator;
   if (stat.count == stat.nan_count + stat.neg_inf_count + stat.pos_inf_count) {
-    csv.WriteToCsv("null");
-    csv.WriteToCsv("null");
-    csv.WriteToCsv("null");
+    row << "null" << kSeparator << "null" << kSeparator << "null" << kSeparator;
   } else {
-    csv.WriteToCsv(stat.max_value);
-    csv.WriteToCsv(stat.min_value);
-    csv.WriteToCsv(stat.avg_value);
-  }
-  csv.WriteToCsv(stat.count);
-  csv.WriteToCsv(stat.neg_zero_count);
-  csv.WriteToCsv(stat.pos_zero_count);
-  csv.WriteToCsv(stat.nan_count);
-  csv.WriteToCsv(stat.neg_inf_count);
-  csv.WriteToCsv(stat.pos_inf_count);
-  csv.WriteToCsv(stat.zero_count, true);
+    row << stat.max_value << kSeparator << stat.min_value << kSeparator << stat.avg_value << kSeparator;
+  }
+  row << stat.count << kSeparator << stat.neg_zero_count << kSeparator << stat.pos_zero_count << kSeparator
+      << stat.nan_count << kSeparator << stat.neg_inf_count << kSeparator << stat.pos_inf_count << kSeparator
+      << stat.zero_count << kEndLine;
+  if (!CsvWriter::GetInstance().WriteRow(dump_path + "/" + kCsvFileName, kCsvHeader, row.str())) {
+    MS_LOG(WARNING) << "Open statistic dump file failed, skipping current statistics";
+    return false;
+  }
   return true;
 }
 }  // namespace mindspore
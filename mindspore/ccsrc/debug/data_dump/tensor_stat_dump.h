@@ -40,12 +40,14 @@ class CsvWriter {
   DISABLE_COPY_AND_ASSIGN(CsvWriter)
   bool OpenFile(const std::string &path, const std::string &header = "");
   void CloseFile() noexcept;
-  template <typename T>
-  void WriteToCsv(const T &val, bool end_line = false);
+  // Rows may come from the async dump writer threads, a whole row is written to path under the lock.
+  bool WriteRow(const std::string &path, const std::string &header, const std::string &row);
 
  private:
-  const std::string kSeparator = ",";
-  const std::string kEndLine = "\n";
+  bool OpenFileLocked(const std::string &path, const std::string &header);
+  void CloseFileLocked() noexcept;
+
+  std::mutex mutex_;
   std::ofstream file_;
   std::string file_path_str_ = "";
 };
@@ -64,6 +66,8 @@ class BACKEND_EXPORT TensorStatDump {
                              const Debugger *debugger);
 
  private:
+  bool WriteTensorStats(const std::string &dump_path, const std::shared_ptr<TensorData> &data) const;
+
   const std::string op_type_;
   const std::string op_name_;
   const std::string task_id_;
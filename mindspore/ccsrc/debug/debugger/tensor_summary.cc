@@ -30,6 +30,54 @@
 namespace mindspore {
 using CONDITION_TYPE = DebugServices::CONDITION_TYPE;
 
+namespace {
+constexpr size_t kStatLaneNum = 8;
+
+// Branch free accumulation of the tensor statistics. kStatLaneNum of them are updated side by side so that the loop
+// over the tensor has no dependency between neighbouring elements and the compiler can vectorize it.
+struct StatAccumulator {
+  double max = std::numeric_limits<double>::lowest();
+  double min = std::numeric_limits<double>::max();
+  double sum = 0.0;
+  uint64_t finite = 0;
+  uint64_t positive = 0;
+  uint64_t negative = 0;
+  uint64_t zero = 0;
+  uint64_t nan = 0;
+  uint64_t pos_inf = 0;
+  uint64_t neg_inf = 0;
+
+  void Add(double value) {
+    bool is_nan = std::isnan(value);
+    bool is_inf = std::isinf(value);
+    bool is_finite = !(is_nan || is_inf);
+    nan += static_cast<uint64_t>(is_nan);
+    pos_inf += static_cast<uint64_t>(is_inf & (value > 0));
+    neg_inf += static_cast<uint64_t>(is_inf & (value < 0));
+    zero += static_cast<uint64_t>(value == 0.0);
+    positive += static_cast<uint64_t>(is_finite & (value > 0));
+    negative += static_cast<uint64_t>(is_finite & (value < 0));
+    finite += static_cast<uint64_t>(is_finite);
+    sum += is_finite ? value : 0.0;
+    max = (is_finite & (value > max)) ? value : max;
+    min = (is_finite & (value < min)) ? value : min;
+  }
+
+  void Merge(const StatAccumulator &other) {
+    max = std::max(max, other.max);
+    min = std::min(min, other.min);
+    sum += other.sum;
+    finite += other.finite;
+    positive += other.positive;
+    negative += other.negative;
+    zero += other.zero;
+    nan += other.nan;
+    pos_inf += other.pos_inf;
+    neg_inf += other.neg_inf;
+  }
+};
+}  // namespace
+
 RangeCountCalculator::RangeCountCalculator()
     : range_start_inclusive(-std::numeric_limits<double>::infinity()),
       range_end_inclusive(std::numeric_limits<double>::infinity()),
@@ -212,7 +260,7 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
     min_ = std::min(min_, cur_summary.min_);
     max_ = std::max(max_, cur_summary.max_);
     double avg_delta = cur_summary.avg_ - avg_;
-    avg_ += avg_delta * (cur_summary.num_elements_ / num_elements_);
+    avg_ += avg_delta * (static_cast<double>(cur_summary.num_elements_) / num_elements_);
     neg_zero_count_ += cur_summary.neg_zero_count_;
     pos_zero_count_ += cur_summary.pos_zero_count_;
     neg_inf_count_ += cur_summary.neg_inf_count_;
@@ -231,35 +279,30 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
  */
 template <typename T>
 void TensorSummary<T>::TensorStatisticsSingleThread() {
-  MeanCalculator mean_calc = MeanCalculator();
-  for (size_t i = 0; i < num_elements_; ++i) {
-    auto current_value = static_cast<double>(current_tensor_ptr_[i]);
-    if (std::isinf(current_value)) {
-      if (current_value > 0) {
-        pos_inf_count_ += 1;
-      } else {
-        neg_inf_count_ += 1;
-      }
-    }
-    if (current_value == 0.0) {
-      zero_count_ += 1;
-    }
-    if (std::isnan(current_value)) {
-      nan_count_ += 1;
-    }
-    if (!(std::isnan(current_value) || std::isinf(current_value))) {
-      // only considering tensor elements with value
-      if (std::signbit(current_value) && !(current_value == 0.0)) {
-        neg_zero_count_ += 1;
-      } else if (!(current_value == 0.0)) {
-        pos_zero_count_ += 1;
-      }
-      max_ = std::max(max_, current_value);
-      min_ = std::min(min_, current_value);
-      mean_calc.ProcessElement(current_value);
+  StatAccumulator lanes[kStatLaneNum];
+  size_t i = 0;
+  for (; i + kStatLaneNum <= num_elements_; i += kStatLaneNum) {
+    for (size_t lane = 0; lane < kStatLaneNum; ++lane) {
+      lanes[lane].Add(static_cast<double>(current_tensor_ptr_[i + lane]));
     }
   }
-  avg_ = mean_calc.GetMean();
+  for (; i < num_elements_; ++i) {
+    lanes[0].Add(static_cast<double>(current_tensor_ptr_[i]));
+  }
+  for (size_t lane = 1; lane < kStatLaneNum; ++lane) {
+    lanes[0].Merge(lanes[lane]);
+  }
+  // only finite elements count in max, min, avg and the signed counts
+  const auto &total = lanes[0];
+  max_ = std::max(max_, total.max);
+  min_ = std::min(min_, total.min);
+  avg_ = total.finite > 0 ? total.sum / total.finite : 0.0;
+  neg_zero_count_ += total.negative;
+  pos_zero_count_ += total.positive;
+  zero_count_ += total.zero;
+  nan_count_ += total.nan;
+  pos_inf_count_ += total.pos_inf;
+  neg_inf_count_ += total.neg_inf;
 }
 
 /*
@@ -54,6 +54,9 @@ constexpr char kUpdateEmbeddingCache[] = "UpdateEmbeddingCache";
 const std::vector<std::string> kEmbeddingCacheOps = {kLookupEmbeddingCache, kUpdateEmbeddingCache};
 // Message header of finalize mux recv actor.
 constexpr char kFinalizeMuxRecvActor[] = "FINALIZE_MUX_RECV_ACTOR";
+// The number of event loops receiving the requests from the clients of a mux recv actor, so that a request waiting to be
+// processed does not block reading the requests from the other clients.
+constexpr size_t kMuxRecvEventLoopNum = 4;
 
 // The distributed execution mode enum.
 // For each execution mode, different graph optimization, splitting strategy, device location, etc are applied. For
@@ -35,6 +35,15 @@ constexpr char kBlockMetaFilePrefix[] = "block_meta_";
 constexpr char kJsonSuffix[] = ".json";
 constexpr size_t JSON_SUFFIX_LENS = 5;
 
+// Sharded checkpoint related.
+constexpr char kCheckpointIndexFile[] = "checkpoint_index.json";
+constexpr char kShardNum[] = "shard_num";
+constexpr char kTensors[] = "tensors";
+constexpr char kTensorName[] = "name";
+constexpr char kTensorDataType[] = "data_type";
+constexpr char kTensorShape[] = "shape";
+constexpr char kTensorSize[] = "size";
+
 // Storage config related.
 constexpr char kFileStoragePath[] = "file_storage_path";
 constexpr char kMaxBlockLength[] = "max_block_length";
@@ -0,0 +1,346 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/persistent/storage/sharded_checkpoint.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <utility>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "utils/convert_utils_base.h"
+#include "utils/file_utils.h"
+#include "utils/log_adapter.h"
+#include "include/common/utils/utils.h"
+#include "distributed/persistent/storage/block.h"
+#include "distributed/persistent/storage/constants.h"
+#include "distributed/persistent/storage/file_io_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+namespace {
+constexpr size_t kMaxShardThreadNum = 8;
+// Tensors are aligned in the shard files, so a mapped shard can be read with aligned copies.
+constexpr size_t kTensorAlignment = 64;
+
+size_t AlignUp(size_t size) { return (size + kTensorAlignment - 1) / kTensorAlignment * kTensorAlignment; }
+
+std::string ShardFileName(const std::string &dir, size_t shard_index) {
+  return dir + "/" + kBlockFilePrefix + std::to_string(shard_index);
+}
+
+std::string ShardMetaFileName(const std::string &dir, size_t shard_index) {
+  return dir + "/" + kBlockMetaFilePrefix + std::to_string(shard_index) + kJsonSuffix;
+}
+
+// Run task(0) ... task(task_num - 1) on several threads, returns false if any of them failed.
+bool RunInParallel(size_t task_num, const std::function<bool(size_t)> &task) {
+  std::atomic<size_t> next_index{0};
+  std::atomic<bool> success{true};
+  auto worker = [&task_num, &task, &next_index, &success]() {
+    for (auto i = next_index++; i < task_num && success; i = next_index++) {
+      try {
+        if (!task(i)) {
+          success = false;
+        }
+      } catch (const std::exception &e) {
+        MS_LOG(ERROR) << e.what();
+        success = false;
+      }
+    }
+  };
+  size_t core_num = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1));
+  size_t thread_num = std::min({core_num, kMaxShardThreadNum, task_num});
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; ++i) {
+    (void)threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return success;
+}
+
+// Copy the data of a shard file into the tensors of the shard.
+bool ReadShardData(const std::string &file_name, const std::vector<CheckpointTensorMeta> &metas,
+                   const std::vector<tensor::TensorPtr> &tensors) {
+#ifndef _WIN32
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Open shard file failed, file name [" << file_name << "]";
+    return false;
+  }
+  off_t file_size = lseek(fd, 0, SEEK_END);
+  if (file_size <= 0) {
+    (void)close(fd);
+    return metas.empty();
+  }
+  auto addr = mmap(nullptr, LongToSize(file_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "Map shard file failed, file name [" << file_name << "]";
+    return false;
+  }
+  (void)madvise(addr, LongToSize(file_size), MADV_SEQUENTIAL);
+  bool success = true;
+  for (size_t i = 0; i < metas.size(); ++i) {
+    if (metas[i].offset + metas[i].size > LongToSize(file_size)) {
+      MS_LOG(ERROR) << "The data of tensor " << metas[i].name << " is out of the range of file " << file_name;
+      success = false;
+      break;
+    }
+    (void)memcpy(tensors[i]->data_c(), static_cast<const uint8_t *>(addr) + metas[i].offset, metas[i].size);
+  }
+  (void)munmap(addr, LongToSize(file_size));
+  return success;
+#else
+  std::vector<std::pair<void *, size_t>> outputs;
+  size_t offset = 0;
+  std::vector<uint8_t> padding(kTensorAlignment);
+  for (size_t i = 0; i < metas.size(); ++i) {
+    if (metas[i].offset > offset) {
+      (void)outputs.emplace_back(padding.data(), metas[i].offset - offset);
+    }
+    (void)outputs.emplace_back(tensors[i]->data_c(), metas[i].size);
+    offset = metas[i].offset + metas[i].size;
+  }
+  return FileIOUtils::Read(file_name, outputs);
+#endif
+}
+}  // namespace
+
+ShardedCheckpoint &ShardedCheckpoint::GetInstance() {
+  static ShardedCheckpoint instance;
+  return instance;
+}
+
+ShardedCheckpoint::~ShardedCheckpoint() { (void)Wait(); }
+
+std::vector<ShardedCheckpoint::Shard> ShardedCheckpoint::PartitionShards(const std::vector<std::string> &names,
+                                                                         const std::vector<tensor::TensorPtr> &tensors,
+                                                                         size_t max_shard_length) {
+  std::vector<Shard> shards(1);
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    const auto &tensor = tensors[i];
+    MS_EXCEPTION_IF_NULL(tensor);
+    tensor->data_sync();
+    auto size = LongToSize(tensor->data().nbytes());
+    if (shards.back().length > 0 && shards.back().length + size > max_shard_length) {
+      (void)shards.emplace_back();
+    }
+    auto &shard = shards.back();
+    CheckpointTensorMeta meta{names[i], tensor->data_type(), tensor->shape(), shards.size() - 1, shard.length, size};
+    shard.tensor_metas.push_back(std::move(meta));
+    shard.tensor_data.push_back(tensor->data_c());
+    shard.length = AlignUp(shard.length + size);
+  }
+  return shards;
+}
+
+bool ShardedCheckpoint::Save(const std::string &dir, const std::vector<std::string> &names,
+                             const std::vector<tensor::TensorPtr> &tensors, size_t max_shard_length, bool async) {
+  if (names.size() != tensors.size()) {
+    MS_LOG(ERROR) << "The number of names " << names.size() << " is not equal to the number of tensors "
+                  << tensors.size();
+    return false;
+  }
+  // Only one save at a time, so the staging buffers of the former save have been released.
+  if (!Wait()) {
+    MS_LOG(WARNING) << "The former asynchronous checkpoint save failed.";
+  }
+  FileIOUtils::CreateDirRecursive(dir, S_IRWXU);
+  // Remove the index first, so the checkpoint is incomplete until all the new shards are written.
+  auto index_file = dir + "/" + kCheckpointIndexFile;
+  if (FileIOUtils::IsFileOrDirExist(index_file)) {
+    (void)remove(index_file.c_str());
+  }
+
+  auto shards = std::make_shared<std::vector<Shard>>(
+    PartitionShards(names, tensors, max_shard_length == 0 ? DEFAULT_MAX_SHARD_LENGTH : max_shard_length));
+  if (!async) {
+    return WriteShards(dir, *shards);
+  }
+
+  // Copy the tensors into the staging buffers, so the caller can update them once this returns.
+  auto copy_shard = [&shards](size_t shard_index) {
+    auto &shard = (*shards)[shard_index];
+    shard.staging_buffer = std::make_unique<uint8_t[]>(shard.length);
+    for (size_t i = 0; i < shard.tensor_metas.size(); ++i) {
+      auto staging_data = shard.staging_buffer.get() + shard.tensor_metas[i].offset;
+      (void)memcpy(staging_data, shard.tensor_data[i], shard.tensor_metas[i].size);
+      shard.tensor_data[i] = staging_data;
+    }
+    return true;
+  };
+  if (!RunInParallel(shards->size(), copy_shard)) {
+    MS_LOG(ERROR) << "Copy tensors into staging buffers failed.";
+    return false;
+  }
+  writer_ = std::thread([this, dir, shards]() {
+    auto success = WriteShards(dir, *shards);
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_save_success_ = success;
+  });
+  return true;
+}
+
+bool ShardedCheckpoint::Wait() {
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto success = last_save_success_;
+  last_save_success_ = true;
+  return success;
+}
+
+bool ShardedCheckpoint::WriteShards(const std::string &dir, const std::vector<Shard> &shards) {
+  auto write_shard = [&dir, &shards](size_t shard_index) { return WriteOneShard(dir, shard_index, shards[shard_index]); };
+  if (!RunInParallel(shards.size(), write_shard)) {
+    MS_LOG(ERROR) << "Write checkpoint shards into " << dir << " failed.";
+    return false;
+  }
+  BlockMeta index(dir + "/" + kCheckpointIndexFile);
+  if (!index.Initialize()) {
+    MS_LOG(ERROR) << "Initialize checkpoint index failed, folder [" << dir << "]";
+    return false;
+  }
+  index.Insert(kShardNum, shards.size());
+  ChangeFileMode(dir + "/" + kCheckpointIndexFile, S_IRUSR | S_IWUSR);
+  MS_LOG(INFO) << "Save checkpoint into " << shards.size() << " shards in folder " << dir;
+  return true;
+}
+
+bool ShardedCheckpoint::WriteOneShard(const std::string &dir, size_t shard_index, const Shard &shard) {
+  std::vector<std::pair<const void *, size_t>> inputs;
+  std::vector<uint8_t> padding(kTensorAlignment);
+  nlohmann::json tensor_metas = nlohmann::json::array();
+  size_t offset = 0;
+  for (size_t i = 0; i < shard.tensor_metas.size(); ++i) {
+    const auto &meta = shard.tensor_metas[i];
+    if (meta.offset > offset) {
+      (void)inputs.emplace_back(padding.data(), meta.offset - offset);
+    }
+    if (meta.size > 0) {
+      (void)inputs.emplace_back(shard.tensor_data[i], meta.size);
+    }
+    offset = meta.offset + meta.size;
+    nlohmann::json tensor_meta;
+    tensor_meta[kTensorName] = meta.name;
+    tensor_meta[kTensorDataType] = static_cast<int>(meta.data_type);
+    tensor_meta[kTensorShape] = meta.shape;
+    tensor_meta[kOffset] = meta.offset;
+    tensor_meta[kTensorSize] = meta.size;
+    tensor_metas.push_back(tensor_meta);
+  }
+
+  const auto shard_file_name = ShardFileName(dir, shard_index);
+  if (!FileIOUtils::Write(shard_file_name, inputs)) {
+    MS_LOG(ERROR) << "Write to shard file[" << shard_file_name << "] failed.";
+    return false;
+  }
+  ChangeFileMode(shard_file_name, S_IRUSR | S_IWUSR);
+
+  // A shard file is a block, its meta holds the sha256 and the index of its tensors.
+  const auto meta_file_name = ShardMetaFileName(dir, shard_index);
+  (void)remove(meta_file_name.c_str());
+  auto block_meta = std::make_shared<BlockMeta>(meta_file_name);
+  if (!block_meta->Initialize()) {
+    MS_LOG(ERROR) << "Initialize block meta failed, file name [" << meta_file_name << "]";
+    return false;
+  }
+  block_meta->Insert(kTensors, tensor_metas);
+  Block block(shard_file_name);
+  block.set_block_meta(block_meta);
+  block.GenSha256Seq();
+  ChangeFileMode(meta_file_name, S_IRUSR | S_IWUSR);
+  return true;
+}
+
+bool ShardedCheckpoint::IsShardedCheckpoint(const std::string &dir) {
+  return !dir.empty() && FileIOUtils::IsFileOrDirExist(dir + "/" + kCheckpointIndexFile);
+}
+
+bool ShardedCheckpoint::Load(const std::string &dir, std::map<std::string, tensor::TensorPtr> *tensors) {
+  MS_EXCEPTION_IF_NULL(tensors);
+  if (!IsShardedCheckpoint(dir)) {
+    MS_LOG(ERROR) << "The folder [" << dir << "] does not contain a complete sharded checkpoint.";
+    return false;
+  }
+  BlockMeta index(dir + "/" + kCheckpointIndexFile);
+  if (!index.Initialize()) {
+    MS_LOG(ERROR) << "Initialize checkpoint index failed, folder [" << dir << "]";
+    return false;
+  }
+  auto shard_num = index.Get<size_t>(kShardNum);
+
+  std::vector<std::vector<CheckpointTensorMeta>> shard_metas(shard_num);
+  std::vector<std::vector<tensor::TensorPtr>> shard_tensors(shard_num);
+  auto load_shard = [&dir, &shard_metas, &shard_tensors](size_t shard_index) {
+    auto block_meta = std::make_shared<BlockMeta>(ShardMetaFileName(dir, shard_index));
+    if (!block_meta->Initialize()) {
+      MS_LOG(ERROR) << "Initialize block meta failed, file name [" << ShardMetaFileName(dir, shard_index) << "]";
+      return false;
+    }
+    Block block(ShardFileName(dir, shard_index));
+    block.set_block_meta(block_meta);
+    if (!block.CheckSha256Seq()) {
+      return false;
+    }
+    auto &metas = shard_metas[shard_index];
+    auto &shard_tensor = shard_tensors[shard_index];
+    for (const auto &tensor_meta : block_meta->Get<nlohmann::json>(kTensors)) {
+      CheckpointTensorMeta meta{tensor_meta[kTensorName].get<std::string>(),
+                                static_cast<TypeId>(tensor_meta[kTensorDataType].get<int>()),
+                                tensor_meta[kTensorShape].get<ShapeVector>(),
+                                shard_index,
+                                tensor_meta[kOffset].get<size_t>(),
+                                tensor_meta[kTensorSize].get<size_t>()};
+      auto tensor = std::make_shared<tensor::Tensor>(meta.data_type, meta.shape);
+      if (LongToSize(tensor->data().nbytes()) != meta.size) {
+        MS_LOG(ERROR) << "The size of tensor " << meta.name << " is " << meta.size << ", but its shape needs "
+                      << tensor->data().nbytes() << " bytes.";
+        return false;
+      }
+      metas.push_back(std::move(meta));
+      shard_tensor.push_back(tensor);
+    }
+    return ReadShardData(block.block_file_name(), metas, shard_tensor);
+  };
+  if (!RunInParallel(shard_num, load_shard)) {
+    MS_LOG(ERROR) << "Load checkpoint from folder " << dir << " failed.";
+    return false;
+  }
+  for (size_t shard_index = 0; shard_index < shard_num; ++shard_index) {
+    for (size_t i = 0; i < shard_metas[shard_index].size(); ++i) {
+      (*tensors)[shard_metas[shard_index][i].name] = shard_tensors[shard_index][i];
+    }
+  }
+  MS_LOG(INFO) << "Load " << tensors->size() << " tensors from " << shard_num << " shards in folder " << dir;
+  return true;
+}
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_SHARDED_CHECKPOINT_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_SHARDED_CHECKPOINT_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ir/tensor.h"
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+// The default maximum shard file length : 1GB.
+constexpr size_t DEFAULT_MAX_SHARD_LENGTH = 1 << 30;
+
+// Location of one tensor in the shard files of a checkpoint.
+struct CheckpointTensorMeta {
+  std::string name;
+  TypeId data_type;
+  ShapeVector shape;
+  size_t shard_index;
+  size_t offset;
+  size_t size;
+};
+
+// Checkpoint stored as a folder of shard files, each shard file is a Block whose BlockMeta holds the sha256 of the
+// shard and the index of the tensors in it. An index file, written after all the shards, records the shard number, so
+// a checkpoint interrupted while being written can not be loaded.
+class BACKEND_EXPORT ShardedCheckpoint {
+ public:
+  static ShardedCheckpoint &GetInstance();
+  ~ShardedCheckpoint();
+
+  // Save the tensors into the folder 'dir', tensors are packed into shards of at most 'max_shard_length' bytes unless
+  // a single tensor is larger. With 'async' set, the tensors are copied into staging buffers and the shards are
+  // written by the writer threads after returning, otherwise the shards are written before returning. A pending save
+  // is waited for before a new one starts.
+  bool Save(const std::string &dir, const std::vector<std::string> &names,
+            const std::vector<tensor::TensorPtr> &tensors, size_t max_shard_length, bool async);
+
+  // Wait for the pending asynchronous save, returns whether it succeeded.
+  bool Wait();
+
+  // Load all the tensors of the checkpoint in folder 'dir', the shards are checked and read in parallel.
+  static bool Load(const std::string &dir, std::map<std::string, tensor::TensorPtr> *tensors);
+
+  // Whether the folder 'dir' contains a completely written sharded checkpoint.
+  static bool IsShardedCheckpoint(const std::string &dir);
+
+ private:
+  ShardedCheckpoint() = default;
+  DISABLE_COPY_AND_ASSIGN(ShardedCheckpoint)
+
+  // Shard data to be written, either pointing into the tensors or into the staging buffer.
+  struct Shard {
+    std::vector<CheckpointTensorMeta> tensor_metas;
+    std::vector<const void *> tensor_data;
+    std::unique_ptr<uint8_t[]> staging_buffer;
+    size_t length{0};
+  };
+
+  static std::vector<Shard> PartitionShards(const std::vector<std::string> &names,
+                                            const std::vector<tensor::TensorPtr> &tensors, size_t max_shard_length);
+  static bool WriteShards(const std::string &dir, const std::vector<Shard> &shards);
+  static bool WriteOneShard(const std::string &dir, size_t shard_index, const Shard &shard);
+
+  std::mutex mutex_;
+  std::thread writer_;
+  bool last_save_success_{true};
+};
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_SHARDED_CHECKPOINT_H_
@@ -16,6 +16,8 @@
 
 #include "distributed/rpc/tcp/connection.h"
 
+#include <securec.h>
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -63,7 +65,12 @@ void SocketEventHandler(int fd, uint32_t events, void *context) {
   // Handle read event.
   if (events & EPOLLIN) {
     if (conn->read_callback != nullptr) {
+      auto recv_event_loop = conn->recv_event_loop;
       conn->read_callback(conn);
+      // The connection is deleted together with its event handler if it is disconnected while handling the messages.
+      if (!recv_event_loop->HasEventHandler(fd, context)) {
+        return;
+      }
     }
   }
 
@@ -135,12 +142,12 @@ Connection::Connection()
       send_event_loop(nullptr),
       recv_event_loop(nullptr),
       send_metrics(nullptr),
-      send_message(nullptr),
       recv_message(nullptr),
       recv_state(kMsgHeader),
       total_recv_len(0),
       total_send_len(0),
-      recv_len(0),
+      recv_buffer_begin(0),
+      recv_buffer_end(0),
       event_callback(nullptr),
       succ_callback(nullptr),
       write_callback(nullptr),
@@ -156,16 +163,8 @@ Connection::Connection()
   recv_kernel_msg.msg_iov = recv_io_vec;
   recv_kernel_msg.msg_iovlen = RECV_MSG_IO_VEC_LEN;
 
-  // Initialize the send message header.
   // This variable will be deleted in the `Close` method.
   send_metrics = new SendMetrics();
-  for (unsigned int i = 0; i < MAGICID_LEN; i++) {
-    if (i < sizeof(RPC_MAGICID) - 1) {
-      send_msg_header.magic[i] = RPC_MAGICID[i];
-    } else {
-      send_msg_header.magic[i] = '\0';
-    }
-  }
 
   // Initialize the send kernel message structure.
   send_kernel_msg.msg_control = nullptr;
@@ -174,7 +173,7 @@ Connection::Connection()
   send_kernel_msg.msg_name = nullptr;
   send_kernel_msg.msg_namelen = 0;
   send_kernel_msg.msg_iov = send_io_vec;
-  send_kernel_msg.msg_iovlen = SEND_MSG_IO_VEC_LEN;
+  send_kernel_msg.msg_iovlen = 0;
 }
 
 int Connection::Initialize() {
@@ -246,10 +245,12 @@ void Connection::Close() {
 
   // There's no need to release the recv_message because the lifecycle of this data is passed to the caller.
 
-  if (total_send_len != 0 && send_message != nullptr) {
-    delete send_message;
-    send_message = nullptr;
+  // The messages in the sending batch are not sent out completely.
+  for (auto &msg : send_messages) {
+    delete msg;
+    msg = nullptr;
   }
+  send_messages.clear();
 
   MessageBase *tmpMsg = nullptr;
   while (!send_message_queue.empty()) {
@@ -271,7 +272,8 @@ void Connection::Close() {
   }
 }
 
-int Connection::ReceiveMessage() {
+int Connection::ReceiveMessage(MessageBase **msg) {
+  MS_EXCEPTION_IF_NULL(msg);
   bool ok = ParseMessage();
   // If no message parsed, wait for next read
   if (!ok) {
@@ -280,18 +282,7 @@ int Connection::ReceiveMessage() {
     }
     return 0;
   }
-
-  // Call msg handler if set
-  if (message_handler) {
-    auto result = message_handler(recv_message);
-    if (result != rpc::NULL_MSG) {
-      // Send the result message back to the tcp client if any.
-      FillSendMessage(result, "", false);
-      (void)Flush();
-    }
-  } else {
-    MS_LOG(INFO) << "Message handler was not found";
-  }
+  *msg = recv_message;
   return 1;
 }
 
@@ -359,35 +350,41 @@ void Connection::FillSendMessage(MessageBase *msg, const std::string &advertiseU
     return;
   }
   if (msg->type == MessageBase::Type::KMSG) {
-    // The total len of array variable `send_io_vec` is `SEND_MSG_IO_VEC_LEN` whose value is 5 currently.
-    size_t index = 0;
+    // Start a new batch if the last one has been sent out.
+    if (send_messages.empty()) {
+      send_kernel_msg.msg_iov = send_io_vec;
+      send_kernel_msg.msg_iovlen = 0;
+      total_send_len = 0;
+    }
+    // Each message in the batch takes at most `SEND_MSG_IO_VEC_LEN` elements of the array variable `send_io_vec`.
+    size_t slot = send_messages.size();
+    size_t index = send_kernel_msg.msg_iovlen;
     if (!isHttpKmsg) {
-      send_to = msg->to;
-      send_from = msg->from;
-      FillMessageHeader(*msg, &send_msg_header);
+      send_to[slot] = msg->to;
+      send_from[slot] = msg->from;
+      FillMessageHeader(*msg, &send_msg_header[slot]);
 
-      send_io_vec[index].iov_base = &send_msg_header;
-      send_io_vec[index].iov_len = sizeof(send_msg_header);
+      send_io_vec[index].iov_base = &send_msg_header[slot];
+      send_io_vec[index].iov_len = sizeof(MessageHeader);
       ++index;
       send_io_vec[index].iov_base = const_cast<char *>(msg->name.data());
       send_io_vec[index].iov_len = msg->name.size();
       ++index;
-      send_io_vec[index].iov_base = const_cast<char *>(send_to.data());
-      send_io_vec[index].iov_len = send_to.size();
+      send_io_vec[index].iov_base = const_cast<char *>(send_to[slot].data());
+      send_io_vec[index].iov_len = send_to[slot].size();
       ++index;
-      send_io_vec[index].iov_base = const_cast<char *>(send_from.data());
-      send_io_vec[index].iov_len = send_from.size();
+      send_io_vec[index].iov_base = const_cast<char *>(send_from[slot].data());
+      send_io_vec[index].iov_len = send_from[slot].size();
       ++index;
       send_io_vec[index].iov_base = GetMessageBaseRealData(msg);
       // The real size of the data body.
       size_t real_data_size = GetMessageBaseRealDataSize(msg);
       send_io_vec[index].iov_len = real_data_size;
       ++index;
-      send_kernel_msg.msg_iov = send_io_vec;
       send_kernel_msg.msg_iovlen = index;
-      total_send_len =
-        UlongToUint(sizeof(send_msg_header)) + msg->name.size() + send_to.size() + send_from.size() + real_data_size;
-      send_message = msg;
+      total_send_len += UlongToUint(sizeof(MessageHeader)) + msg->name.size() + send_to[slot].size() +
+                        send_from[slot].size() + real_data_size;
+      send_messages.push_back(msg);
 
       // update metrics
       send_metrics->UpdateMax(real_data_size);
@@ -409,10 +406,9 @@ void Connection::FillSendMessage(MessageBase *msg, const std::string &advertiseU
     size_t real_data_size = GetMessageBaseRealDataSize(msg);
     send_io_vec[index].iov_len = real_data_size;
     ++index;
-    send_kernel_msg.msg_iov = send_io_vec;
     send_kernel_msg.msg_iovlen = index;
-    total_send_len = UlongToUint(real_data_size);
-    send_message = msg;
+    total_send_len += UlongToUint(real_data_size);
+    send_messages.push_back(msg);
 
     // update metrics
     send_metrics->UpdateMax(real_data_size);
@@ -481,8 +477,14 @@ size_t Connection::Flush() {
   size_t total_send_bytes = 0;
   while (!send_message_queue.empty() || total_send_len != 0) {
     if (total_send_len == 0) {
-      FillSendMessage(send_message_queue.front(), source, false);
-      send_message_queue.pop();
+      // Gather the queued messages so that they are sent out by one sendmsg call.
+      while (!send_message_queue.empty() && send_messages.size() < SEND_MSG_BATCH_LEN) {
+        FillSendMessage(send_message_queue.front(), source, false);
+        send_message_queue.pop();
+      }
+      if (total_send_len == 0) {
+        continue;
+      }
     }
     size_t sendLen = 0;
     int retval = socket_operation->SendMessage(this, &send_kernel_msg, total_send_len, &sendLen);
@@ -492,16 +494,18 @@ size_t Connection::Flush() {
         // update metrics
         send_metrics->UpdateError(false);
 
-        size_t real_data_size = GetMessageBaseRealDataSize(send_message);
-        output_buffer_size -= real_data_size;
-        total_send_bytes += real_data_size;
+        for (auto &msg : send_messages) {
+          size_t real_data_size = GetMessageBaseRealDataSize(msg);
+          output_buffer_size -= real_data_size;
+          total_send_bytes += real_data_size;
 
-        if (!FreeMessageMemory(send_message)) {
-          MS_LOG(ERROR) << "Failed to free memory of the send message.";
+          if (!FreeMessageMemory(msg)) {
+            MS_LOG(ERROR) << "Failed to free memory of the send message.";
+          }
+          delete msg;
+          msg = nullptr;
         }
-        delete send_message;
-        send_message = nullptr;
-        break;
+        send_messages.clear();
       }
     } else if (retval == IO_RW_OK && sendLen == 0) {
       // EAGAIN
@@ -526,23 +530,20 @@ int Connection::AddConnnectEventHandler() {
 bool Connection::ParseMessage() {
   int retval = 0;
   size_t recvLen = 0;
-  char *recvBuf = nullptr;
 
   switch (recv_state) {
     // Parse message header.
     case State::kMsgHeader:
-      recvBuf = reinterpret_cast<char *>(&recv_msg_header) + recv_len;
-      retval = socket_operation->Receive(this, recvBuf, sizeof(MessageHeader) - recv_len, &recvLen);
-      if (retval != IO_RW_OK) {
-        state = ConnectionState::kDisconnecting;
-        recv_len += recvLen;
+      if (!FillRecvBuffer(sizeof(MessageHeader))) {
         return false;
       }
-      if ((recvLen + recv_len) != sizeof(MessageHeader)) {
-        recv_len += recvLen;
+      if (memcpy_s(&recv_msg_header, sizeof(MessageHeader), recv_buffer.data() + recv_buffer_begin,
+                   sizeof(MessageHeader)) != EOK) {
+        MS_LOG(ERROR) << "Failed to copy the message header from the receive buffer.";
+        state = ConnectionState::kDisconnecting;
         return false;
       }
-      recv_len = 0;
+      recv_buffer_begin += sizeof(MessageHeader);
 
       if (strncmp(recv_msg_header.magic, RPC_MAGICID, sizeof(RPC_MAGICID) - 1) != 0) {
         MS_LOG(ERROR) << "Failed to check magicid, RPC_MAGICID: " << RPC_MAGICID
@@ -559,15 +560,23 @@ bool Connection::ParseMessage() {
 
     // Parse message body.
     case State::kBody:
-      recvLen = 0;
-      retval = socket_operation->ReceiveMessage(this, &recv_kernel_msg, total_recv_len, &recvLen);
-      if (recvLen != total_recv_len) {
-        if (retval != IO_RW_OK) {
-          state = ConnectionState::kDisconnecting;
+      // The buffered bytes belong to this message, and the rest of the message is received without buffering.
+      ConsumeRecvBuffer();
+      if (state == ConnectionState::kDisconnecting) {
+        return false;
+      }
+      if (total_recv_len > 0) {
+        recvLen = 0;
+        retval = socket_operation->ReceiveMessage(this, &recv_kernel_msg, total_recv_len, &recvLen);
+        if (recvLen != total_recv_len) {
+          if (retval != IO_RW_OK) {
+            state = ConnectionState::kDisconnecting;
+            return false;
+          }
+          total_recv_len -= recvLen;
           return false;
         }
-        total_recv_len -= recvLen;
-        return false;
+        total_recv_len = 0;
       }
       if (!SetUrlForRecvMessage()) {
         MS_LOG(ERROR) << "Set url info for recv message failed.";
@@ -581,6 +590,59 @@ bool Connection::ParseMessage() {
   return true;
 }
 
+bool Connection::FillRecvBuffer(size_t size) {
+  if (recv_buffer.empty()) {
+    recv_buffer.resize(RECV_BUFFER_SIZE);
+  }
+  size_t buffered_len = recv_buffer_end - recv_buffer_begin;
+  if (buffered_len >= size) {
+    return true;
+  }
+
+  // Move the bytes not parsed yet to the front of the buffer.
+  if (recv_buffer_begin > 0) {
+    if (buffered_len > 0 && memmove_s(recv_buffer.data(), recv_buffer.size(), recv_buffer.data() + recv_buffer_begin,
+                                      buffered_len) != EOK) {
+      MS_LOG(ERROR) << "Failed to move the bytes in the receive buffer.";
+      state = ConnectionState::kDisconnecting;
+      return false;
+    }
+    recv_buffer_begin = 0;
+    recv_buffer_end = buffered_len;
+  }
+
+  size_t recvLen = 0;
+  int retval = socket_operation->Receive(this, recv_buffer.data() + recv_buffer_end,
+                                         recv_buffer.size() - recv_buffer_end, &recvLen);
+  recv_buffer_end += recvLen;
+  if (retval != IO_RW_OK) {
+    state = ConnectionState::kDisconnecting;
+  }
+  return recv_buffer_end - recv_buffer_begin >= size;
+}
+
+void Connection::ConsumeRecvBuffer() {
+  while (total_recv_len > 0 && HasBufferedData() && recv_kernel_msg.msg_iovlen > 0) {
+    struct iovec *io_vec = recv_kernel_msg.msg_iov;
+    size_t copy_len = std::min(io_vec->iov_len, recv_buffer_end - recv_buffer_begin);
+    if (copy_len > 0) {
+      if (memcpy_s(io_vec->iov_base, io_vec->iov_len, recv_buffer.data() + recv_buffer_begin, copy_len) != EOK) {
+        MS_LOG(ERROR) << "Failed to copy the message body from the receive buffer.";
+        state = ConnectionState::kDisconnecting;
+        return;
+      }
+      recv_buffer_begin += copy_len;
+      total_recv_len -= copy_len;
+      io_vec->iov_base = reinterpret_cast<char *>(io_vec->iov_base) + copy_len;
+      io_vec->iov_len -= copy_len;
+    }
+    if (io_vec->iov_len == 0) {
+      recv_kernel_msg.msg_iov = io_vec + 1;
+      recv_kernel_msg.msg_iovlen -= 1;
+    }
+  }
+}
+
 bool Connection::SetUrlForRecvMessage() {
   auto recv_from_separator_pos = recv_from.find('@');
   auto recv_to_separator_pos = recv_to.find('@');
@@ -21,6 +21,7 @@
 #include <string>
 #include <mutex>
 #include <memory>
+#include <vector>
 
 #include "actor/msg.h"
 #include "distributed/rpc/tcp/constants.h"
@@ -97,10 +98,11 @@ struct Connection {
   // Close this connection.
   void Close();
 
-  int ReceiveMessage();
+  // Parse one message from the socket, the parsed message is returned in `msg` and owned by the caller.
+  int ReceiveMessage(MessageBase **msg);
   void CheckMessageType();
 
-  // Fill the message to be sent based on the input message.
+  // Append the input message to the batch of messages sent by one sendmsg call.
   void FillSendMessage(MessageBase *msg, const std::string &advertiseUrl, bool isHttpKmsg);
 
   void FillRecvMessage();
@@ -112,6 +114,9 @@ struct Connection {
   // Send all the messages in the message queue.
   size_t Flush();
 
+  // Whether there are received bytes not parsed yet in the receive buffer.
+  bool HasBufferedData() const { return recv_buffer_end > recv_buffer_begin; }
+
   /**
    * @description: Set callback to allocate memory for this connection when receiving message from the remote.
    * @param {MemAllocateCallback} &allocate_cb: The allocating memory callback.
@@ -178,7 +183,7 @@ struct Connection {
   SendMetrics *send_metrics;
 
   // The message data waiting to be sent and receive through this connection..
-  MessageBase *send_message;
+  std::vector<MessageBase *> send_messages;
   MessageBase *recv_message;
 
   // Owned by the tcp_comm.
@@ -192,15 +197,20 @@ struct Connection {
   // Total length of received and sent messages.
   size_t total_recv_len;
   size_t total_send_len;
-  size_t recv_len;
 
-  std::string send_to;
-  std::string send_from;
+  // The buffer reused for receiving, bytes in [recv_buffer_begin, recv_buffer_end) are not parsed yet.
+  std::vector<char> recv_buffer;
+  size_t recv_buffer_begin;
+  size_t recv_buffer_end;
+
+  // The destination and source urls of each message in the sending batch.
+  std::string send_to[SEND_MSG_BATCH_LEN];
+  std::string send_from[SEND_MSG_BATCH_LEN];
   std::string recv_to;
   std::string recv_from;
 
   // Message header.
-  MessageHeader send_msg_header;
+  MessageHeader send_msg_header[SEND_MSG_BATCH_LEN];
   MessageHeader recv_msg_header;
 
   // The message structure of kernel.
@@ -208,7 +218,7 @@ struct Connection {
   struct msghdr recv_kernel_msg;
 
   struct iovec recv_io_vec[RECV_MSG_IO_VEC_LEN];
-  struct iovec send_io_vec[SEND_MSG_IO_VEC_LEN];
+  struct iovec send_io_vec[SEND_MSG_IO_VEC_LEN * SEND_MSG_BATCH_LEN];
 
   ParseType recv_message_type{kTcpMsg};
 
@@ -242,6 +252,12 @@ struct Connection {
   // Parse message from socket recv buffer.
   bool ParseMessage();
 
+  // Receive from the socket until at least `size` bytes are buffered or no more data is readable.
+  bool FillRecvBuffer(size_t size);
+
+  // Move the buffered bytes to the message being received.
+  void ConsumeRecvBuffer();
+
   // After ParseMessage, set from url and to url into recv message.
   bool SetUrlForRecvMessage();
 
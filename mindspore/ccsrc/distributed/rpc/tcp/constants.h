@@ -51,6 +51,12 @@ using MemFreeCallback = std::function<bool(void *data)>;
 constexpr int SEND_MSG_IO_VEC_LEN = 5;
 constexpr int RECV_MSG_IO_VEC_LEN = 4;
 
+// The max number of queued messages gathered into one sendmsg call.
+constexpr int SEND_MSG_BATCH_LEN = 16;
+
+// The size of the buffer reused by a connection to receive the message headers and small message bodies.
+constexpr size_t RECV_BUFFER_SIZE = 64 * 1024;
+
 constexpr unsigned int MAGICID_LEN = 4;
 constexpr int SENDMSG_QUEUELEN = 1024;
 constexpr int SENDMSG_DROPED = -1;
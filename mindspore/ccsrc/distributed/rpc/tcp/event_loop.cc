@@ -338,6 +338,12 @@ int EventLoop::DeleteEpollEvent(int fd) {
   return RPC_OK;
 }
 
+bool EventLoop::HasEventHandler(int sock_fd, const void *data) {
+  std::lock_guard<std::mutex> lock(event_lock_);
+  Event *tev = FindEvent(sock_fd);
+  return tev != nullptr && tev->data == data;
+}
+
 int EventLoop::UpdateEpollEvent(int fd, uint32_t events) {
   struct epoll_event ev;
   Event *tev = nullptr;
@@ -79,6 +79,9 @@ class EventLoop {
   int UpdateEpollEvent(int fd, uint32_t events);
   int DeleteEpollEvent(int fd);
 
+  // Whether the event handler with the data is still set for the socket fd, it is false once the fd is deleted.
+  bool HasEventHandler(int sock_fd, const void *data);
+
  private:
   void AddEvent(Event *event);
 
@@ -276,7 +276,7 @@ void SSLSocketOperation::Handshake(int fd, Connection *conn) const {
     // Failed to handshake. Throw exception and catch it in main thread.
     try {
       MS_LOG(ERROR) << "ssl handshake info -- retval:" << retval << ", error:" << err << ", errno:" << errno
-                    << ", conn:" << conn->send_to.c_str();
+                    << ", conn:" << conn->destination.c_str();
       uint64_t error = 0;
       while ((error = ERR_get_error()) > 0) {
         MS_LOG(ERROR) << "ssl handshake errno: " << error << ", err info: " << ERR_reason_error_string(error);
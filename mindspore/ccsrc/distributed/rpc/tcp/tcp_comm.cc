@@ -76,7 +76,7 @@ void OnAccept(int server, uint32_t events, void *arg) {
   if (tcpmgr == nullptr || tcpmgr->conn_pool_ == nullptr) {
     return;
   }
-  if (tcpmgr->recv_event_loop_ == nullptr) {
+  if (tcpmgr->recv_event_loops_.empty()) {
     MS_LOG(ERROR) << "EventLoop is null, server fd: " << server << ", events: " << events;
     return;
   }
@@ -118,10 +118,10 @@ void OnAccept(int server, uint32_t events, void *arg) {
   conn->peer = conn->destination;
 
   conn->is_remote = true;
-  conn->recv_event_loop = tcpmgr->recv_event_loop_;
+  conn->recv_event_loop = tcpmgr->GetRecvEventLoop(acceptFd);
   conn->send_event_loop = tcpmgr->send_event_loop_;
 
-  conn->conn_mutex = tcpmgr->conn_mutex_;
+  conn->conn_mutex = tcpmgr->GetConnMutex();
   conn->message_handler = tcpmgr->message_handler_;
 
   conn->event_callback = std::bind(&TCPComm::EventCallBack, tcpmgr, std::placeholders::_1);
@@ -130,20 +130,18 @@ void OnAccept(int server, uint32_t events, void *arg) {
 
   conn->SetAllocateCallback(tcpmgr->allocate_cb());
 
+  // The connection must be in the pool before its fd is registered, otherwise another receiving event loop may handle
+  // its first event, e.g. a disconnection, and look it up before it is added.
+  std::lock_guard<std::mutex> lock(*tcpmgr->conn_mutex_);
+  tcpmgr->conn_pool_->AddConnection(conn);
   int retval = conn->Initialize();
   if (retval != RPC_OK) {
     MS_LOG(ERROR) << "Failed to add accept fd event, server fd: " << server << ", events: " << events
                   << ", accept fd: " << acceptFd;
-    if (close(acceptFd) != 0) {
-      MS_LOG(ERROR) << "Failed to close fd: " << acceptFd;
-    }
-    acceptFd = -1;
-    delete conn->send_metrics;
-    delete conn;
-    conn = nullptr;
+    // The connection is closed and released by the pool.
+    tcpmgr->conn_pool_->DeleteConnection(conn->destination);
     return;
   }
-  tcpmgr->conn_pool_->AddConnection(conn);
 }
 
 void TCPComm::SetMessageHandler(const MessageHandler &handler) { message_handler_ = handler; }
@@ -155,40 +153,57 @@ bool TCPComm::Initialize() {
   conn_mutex_ = std::make_shared<std::mutex>();
   MS_EXCEPTION_IF_NULL(conn_mutex_);
 
-  recv_event_loop_ = new (std::nothrow) EventLoop();
-  if (recv_event_loop_ == nullptr) {
-    MS_LOG(ERROR) << "Failed to create recv evLoop.";
-    return false;
-  }
-
-  bool ok = recv_event_loop_->Initialize(TCP_RECV_EVLOOP_THREADNAME);
-  if (!ok) {
-    MS_LOG(ERROR) << "Failed to init recv evLoop";
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
-    return false;
+  for (size_t i = 0; i < recv_event_loop_num_; ++i) {
+    auto recv_event_loop = new (std::nothrow) EventLoop();
+    if (recv_event_loop == nullptr) {
+      MS_LOG(ERROR) << "Failed to create recv evLoop.";
+      Finalize();
+      return false;
+    }
+    // The thread name is limited to 16 characters.
+    std::string thread_name = (i == 0) ? TCP_RECV_EVLOOP_THREADNAME : "RECV_EVLOOP_" + std::to_string(i);
+    bool ok = recv_event_loop->Initialize(thread_name);
+    if (!ok) {
+      MS_LOG(ERROR) << "Failed to init recv evLoop";
+      delete recv_event_loop;
+      Finalize();
+      return false;
+    }
+    recv_event_loops_.push_back(recv_event_loop);
   }
 
   send_event_loop_ = new (std::nothrow) EventLoop();
   if (send_event_loop_ == nullptr) {
     MS_LOG(ERROR) << "Failed to create send evLoop.";
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
+    Finalize();
     return false;
   }
-  ok = send_event_loop_->Initialize(TCP_SEND_EVLOOP_THREADNAME);
+  bool ok = send_event_loop_->Initialize(TCP_SEND_EVLOOP_THREADNAME);
   if (!ok) {
     MS_LOG(ERROR) << "Failed to init send evLoop";
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
     delete send_event_loop_;
     send_event_loop_ = nullptr;
+    Finalize();
     return false;
   }
 
   return true;
 }
 
+EventLoop *TCPComm::GetRecvEventLoop(int sock_fd) const {
+  if (recv_event_loops_.empty()) {
+    return nullptr;
+  }
+  return recv_event_loops_[IntToSize(sock_fd) % recv_event_loops_.size()];
+}
+
+std::shared_ptr<std::mutex> TCPComm::GetConnMutex() const {
+  if (recv_event_loops_.size() > 1) {
+    return std::make_shared<std::mutex>();
+  }
+  return conn_mutex_;
+}
+
 bool TCPComm::StartServerSocket(const std::string &url, const MemAllocateCallback &allocate_cb) {
   server_fd_ = SocketOperation::Listen(url);
   if (server_fd_ < 0) {
@@ -206,7 +221,7 @@ bool TCPComm::StartServerSocket(const std::string &url, const MemAllocateCallbac
   }
 
   // Register read event callback for server socket
-  int retval = recv_event_loop_->SetEventHandler(server_fd_, EPOLLIN | EPOLLHUP | EPOLLERR, OnAccept,
+  int retval = recv_event_loops_[0]->SetEventHandler(server_fd_, EPOLLIN | EPOLLHUP | EPOLLERR, OnAccept,
                                                  reinterpret_cast<void *>(this));
   if (retval != RPC_OK) {
     MS_LOG(ERROR) << "Failed to add server event, url: " << url.c_str();
@@ -233,10 +248,11 @@ void TCPComm::ReadCallBack(void *connection) {
   }
   int count = 0;
   int retval = 0;
+  // The messages left in the receive buffer must be parsed now, because epoll will not report them again.
   do {
     retval = ReceiveMessage(conn);
     ++count;
-  } while (retval > 0 && count < max_recv_count);
+  } while (retval > 0 && (count < max_recv_count || conn->HasBufferedData()));
 
   return;
 }
@@ -268,16 +284,59 @@ void TCPComm::WriteCallBack(void *connection) {
   }
 }
 
-/* static method */
 int TCPComm::ReceiveMessage(Connection *conn) {
-  std::lock_guard<std::mutex> lock(*conn->conn_mutex);
-  conn->CheckMessageType();
-  switch (conn->recv_message_type) {
-    case ParseType::kTcpMsg:
-      return conn->ReceiveMessage();
-    default:
+  MessageBase *msg = nullptr;
+  int retval = 0;
+  {
+    std::lock_guard<std::mutex> lock(*conn->conn_mutex);
+    conn->CheckMessageType();
+    if (conn->recv_message_type != ParseType::kTcpMsg) {
       return 0;
+    }
+    retval = conn->ReceiveMessage(&msg);
+  }
+  if (retval <= 0 || msg == nullptr) {
+    return retval;
+  }
+
+  // The message handler runs without the connection mutex, so that it does not block the sends to this connection and
+  // the other connections sharing the mutex, and it can send through this connection without deadlocking.
+  if (!conn->message_handler) {
+    MS_LOG(INFO) << "Message handler was not found";
+    return retval;
+  }
+  // The connection may be disconnected and deleted by other threads while the message handler runs, so it is looked up
+  // again by its destination and socket fd before being used.
+  const std::string destination = conn->destination;
+  const int socket_fd = conn->socket_fd;
+  auto result = conn->message_handler(msg);
+
+  std::lock_guard<std::mutex> lock(*conn_mutex_);
+  if (!IsConnectionAlive(conn, destination, socket_fd)) {
+    MS_LOG(WARNING) << "The connection to " << destination << " is closed while handling the message, fd: " << socket_fd;
+    if (result != rpc::NULL_MSG) {
+      DropMessage(result);
+    }
+    return -1;
+  }
+  if (result != rpc::NULL_MSG) {
+    // Send the result message back to the tcp client if any.
+    std::unique_lock<std::mutex> conn_lock;
+    if (conn->conn_mutex != conn_mutex_) {
+      conn_lock = std::unique_lock<std::mutex>(*conn->conn_mutex);
+    }
+    (void)conn->send_message_queue.emplace(result);
+    (void)conn->Flush();
   }
+  return retval;
+}
+
+bool TCPComm::IsConnectionAlive(const Connection *conn, const std::string &destination, int socket_fd) const {
+  if (conn_pool_ == nullptr) {
+    return false;
+  }
+  auto found_conn = conn_pool_->FindConnection(destination);
+  return found_conn == conn && found_conn->socket_fd == socket_fd;
 }
 
 /* static method */
@@ -344,6 +403,12 @@ bool TCPComm::Send(MessageBase *msg, size_t *const send_bytes, bool sync) {
       return false;
     }
 
+    // The connection has its own mutex in the multiple read event loops mode.
+    std::unique_lock<std::mutex> conn_lock;
+    if (conn->conn_mutex != conn_mutex_) {
+      conn_lock = std::unique_lock<std::mutex>(*conn->conn_mutex);
+    }
+
     if (conn->send_message_queue.size() >= SENDMSG_QUEUELEN) {
       MS_LOG(WARNING) << "The message queue is full(max len:" << SENDMSG_QUEUELEN
                       << ") and the name of dropped message is: " << msg->name.c_str() << ", fd: " << conn->socket_fd
@@ -366,11 +431,7 @@ bool TCPComm::Send(MessageBase *msg, size_t *const send_bytes, bool sync) {
       return false;
     }
 
-    if (conn->total_send_len == 0) {
-      conn->FillSendMessage(msg, url_, false);
-    } else {
-      (void)conn->send_message_queue.emplace(msg);
-    }
+    (void)conn->send_message_queue.emplace(msg);
     auto bytes = conn->Flush();
     if (send_bytes != nullptr) {
       *send_bytes = bytes;
@@ -386,12 +447,16 @@ bool TCPComm::Send(MessageBase *msg, size_t *const send_bytes, bool sync) {
 }
 
 bool TCPComm::Flush(const std::string &dst_url) {
+  std::lock_guard<std::mutex> lock(*conn_mutex_);
   Connection *conn = conn_pool_->FindConnection(dst_url);
   if (conn == nullptr) {
     MS_LOG(ERROR) << "Can not find the connection to url: " << dst_url;
     return false;
   } else {
-    std::lock_guard<std::mutex> lock(*(conn->conn_mutex));
+    std::unique_lock<std::mutex> conn_lock;
+    if (conn->conn_mutex != conn_mutex_) {
+      conn_lock = std::unique_lock<std::mutex>(*conn->conn_mutex);
+    }
     return (conn->Flush() > 0);
   }
 }
@@ -416,9 +481,8 @@ bool TCPComm::Connect(const std::string &dst_url, const MemFreeCallback &free_cb
       return false;
     }
     conn->enable_ssl = enable_ssl_;
-    conn->recv_event_loop = this->recv_event_loop_;
     conn->send_event_loop = this->send_event_loop_;
-    conn->conn_mutex = conn_mutex_;
+    conn->conn_mutex = GetConnMutex();
     conn->message_handler = message_handler_;
     conn->InitSocketOperation();
 
@@ -435,6 +499,7 @@ bool TCPComm::Connect(const std::string &dst_url, const MemFreeCallback &free_cb
     }
 
     conn->socket_fd = sock_fd;
+    conn->recv_event_loop = GetRecvEventLoop(sock_fd);
     conn->event_callback = std::bind(&TCPComm::EventCallBack, this, std::placeholders::_1);
     conn->write_callback = std::bind(&TCPComm::WriteCallBack, this, std::placeholders::_1);
     conn->read_callback = std::bind(&TCPComm::ReadCallBack, this, std::placeholders::_1);
@@ -483,16 +548,23 @@ bool TCPComm::IsConnected(const std::string &dst_url) {
 bool TCPComm::Disconnect(const std::string &dst_url) {
   MS_EXCEPTION_IF_NULL(conn_mutex_);
   MS_EXCEPTION_IF_NULL(conn_pool_);
-  MS_EXCEPTION_IF_NULL(recv_event_loop_);
   MS_EXCEPTION_IF_NULL(send_event_loop_);
 
+  auto recv_task_num = [this]() {
+    size_t task_num = 0;
+    for (auto recv_event_loop : recv_event_loops_) {
+      MS_EXCEPTION_IF_NULL(recv_event_loop);
+      task_num += recv_event_loop->RemainingTaskNum();
+    }
+    return task_num;
+  };
   unsigned int interval = 100000;
   size_t retry = 30;
-  while (recv_event_loop_->RemainingTaskNum() != 0 && send_event_loop_->RemainingTaskNum() != 0 && retry > 0) {
+  while (recv_task_num() != 0 && send_event_loop_->RemainingTaskNum() != 0 && retry > 0) {
     (void)usleep(interval);
     retry--;
   }
-  if (recv_event_loop_->RemainingTaskNum() > 0 || send_event_loop_->RemainingTaskNum() > 0) {
+  if (recv_task_num() > 0 || send_event_loop_->RemainingTaskNum() > 0) {
     MS_LOG(ERROR) << "Failed to disconnect from url " << dst_url
                   << ", because there are still pending tasks to be executed, please try later.";
     return false;
@@ -500,6 +572,12 @@ bool TCPComm::Disconnect(const std::string &dst_url) {
   std::lock_guard<std::mutex> lock(*conn_mutex_);
   auto conn = conn_pool_->FindConnection(dst_url);
   if (conn != nullptr) {
+    // Hold the mutex of the connection until it is deleted if the connection has its own mutex.
+    auto own_conn_mutex = conn->conn_mutex;
+    std::unique_lock<std::mutex> own_conn_lock;
+    if (own_conn_mutex != conn_mutex_) {
+      own_conn_lock = std::unique_lock<std::mutex>(*own_conn_mutex);
+    }
     std::lock_guard<std::mutex> conn_lock(conn->conn_owned_mutex_);
     conn_pool_->DeleteConnection(dst_url);
   }
@@ -515,9 +593,9 @@ Connection *TCPComm::CreateDefaultConn(const std::string &to) {
   conn->enable_ssl = enable_ssl_;
   conn->source = url_.data();
   conn->destination = to;
-  conn->recv_event_loop = this->recv_event_loop_;
+  conn->recv_event_loop = recv_event_loops_.empty() ? nullptr : recv_event_loops_[0];
   conn->send_event_loop = this->send_event_loop_;
-  conn->conn_mutex = conn_mutex_;
+  conn->conn_mutex = GetConnMutex();
   conn->message_handler = message_handler_;
   conn->InitSocketOperation();
   return conn;
@@ -531,12 +609,13 @@ void TCPComm::Finalize() {
     send_event_loop_ = nullptr;
   }
 
-  if (recv_event_loop_ != nullptr) {
+  for (auto &recv_event_loop : recv_event_loops_) {
     MS_LOG(INFO) << "Delete recv event loop";
-    recv_event_loop_->Finalize();
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
+    recv_event_loop->Finalize();
+    delete recv_event_loop;
+    recv_event_loop = nullptr;
   }
+  recv_event_loops_.clear();
 
   if (server_fd_ > 0) {
     if (close(server_fd_) != 0) {
@@ -20,6 +20,7 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "actor/msg.h"
 #include "distributed/rpc/tcp/connection.h"
@@ -38,8 +39,13 @@ void ConnectedEventHandler(int fd, uint32_t events, void *context);
 
 class TCPComm {
  public:
-  explicit TCPComm(bool enable_ssl = false)
-      : server_fd_(-1), recv_event_loop_(nullptr), send_event_loop_(nullptr), enable_ssl_(enable_ssl) {}
+  // With more than one recv event loop, the connections are distributed to the loops by their socket fds, and the
+  // message handler may be called from these loops concurrently.
+  explicit TCPComm(bool enable_ssl = false, size_t recv_event_loop_num = 1)
+      : server_fd_(-1),
+        recv_event_loop_num_(recv_event_loop_num == 0 ? 1 : recv_event_loop_num),
+        send_event_loop_(nullptr),
+        enable_ssl_(enable_ssl) {}
   TCPComm(const TCPComm &) = delete;
   TCPComm &operator=(const TCPComm &) = delete;
   ~TCPComm() = default;
@@ -88,8 +94,19 @@ class TCPComm {
   // Send a message.
   static void SendExitMsg(const std::string &from, const std::string &to);
 
-  // Called by ReadCallBack when new message arrived.
-  static int ReceiveMessage(Connection *conn);
+  // Called by ReadCallBack when new message arrived. Returns a negative value if the connection is deleted while the
+  // message handler runs, the connection must not be accessed any more in that case.
+  int ReceiveMessage(Connection *conn);
+
+  // Check whether the connection to the destination with the socket fd is still in the pool, the caller must hold
+  // `conn_mutex_`.
+  bool IsConnectionAlive(const Connection *conn, const std::string &destination, int socket_fd) const;
+
+  // Get the recv event loop which handles the events on the socket.
+  EventLoop *GetRecvEventLoop(int sock_fd) const;
+
+  // Get the mutex guarding a new connection.
+  std::shared_ptr<std::mutex> GetConnMutex() const;
 
   static int SetConnectedHandler(Connection *conn);
 
@@ -112,14 +129,17 @@ class TCPComm {
   // User defined handler for Handling received messages.
   MessageHandler message_handler_;
 
-  // All the connections share the same read and write event loop objects.
-  EventLoop *recv_event_loop_;
+  // The connections are distributed to the read event loops, and share the same write event loop object.
+  // The server socket is handled by the first read event loop.
+  size_t recv_event_loop_num_;
+  std::vector<EventLoop *> recv_event_loops_;
   EventLoop *send_event_loop_;
 
   // The connection pool used to store new connections.
   std::shared_ptr<ConnectionPool> conn_pool_;
 
-  // The mutex for connection operations.
+  // The mutex for connection operations. With multiple read event loops, each connection has its own mutex and this
+  // one only guards the connection pool.
   std::shared_ptr<std::mutex> conn_mutex_;
 
   // The method used to allocate memory when tcp servers of this TcpComm receive message from the remote.
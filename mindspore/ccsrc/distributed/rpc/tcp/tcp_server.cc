@@ -41,7 +41,7 @@ uint32_t TCPServer::GetPort() const { return port_; }
 
 bool TCPServer::InitializeImpl(const std::string &url, const MemAllocateCallback &allocate_cb) {
   if (tcp_comm_ == nullptr) {
-    tcp_comm_ = std::make_unique<TCPComm>(enable_ssl_);
+    tcp_comm_ = std::make_unique<TCPComm>(enable_ssl_, recv_event_loop_num_);
     MS_EXCEPTION_IF_NULL(tcp_comm_);
     bool rt = tcp_comm_->Initialize();
     if (!rt) {
@@ -29,7 +29,10 @@ namespace distributed {
 namespace rpc {
 class BACKEND_EXPORT TCPServer {
  public:
-  explicit TCPServer(bool enable_ssl = false) : enable_ssl_(enable_ssl) {}
+  // The accepted connections are handled by `recv_event_loop_num` event loops, and the message handler should be thread
+  // safe if there are more than one loops.
+  explicit TCPServer(bool enable_ssl = false, size_t recv_event_loop_num = 1)
+      : enable_ssl_(enable_ssl), recv_event_loop_num_(recv_event_loop_num) {}
   ~TCPServer() = default;
 
   // Init the tcp server using the specified url.
@@ -59,6 +62,8 @@ class BACKEND_EXPORT TCPServer {
 
   bool enable_ssl_;
 
+  size_t recv_event_loop_num_;
+
   DISABLE_COPY_AND_ASSIGN(TCPServer);
 };
 }  // namespace rpc
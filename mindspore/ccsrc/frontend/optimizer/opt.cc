@@ -19,6 +19,7 @@
 #include <deque>
 #include <memory>
 #include <algorithm>
+#include <set>
 #include <utility>
 
 #include "utils/hash_map.h"
@@ -33,7 +34,12 @@ namespace opt {
 SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std::string &name, const PrimitivePtr &prim,
                                  const RenormAction &renorm_action, bool has_priority_pattern) {
   auto fn = [prim](const AnfNodePtr &node) -> bool { return IsPrimitiveCNode(node, prim); };
-  return std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  auto substitution = std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  // A null primitive matches any primitive node, so it can not be indexed.
+  if (prim != nullptr) {
+    substitution->prims_ = {prim};
+  }
+  return substitution;
 }
 
 SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std::string &name,
@@ -54,7 +60,11 @@ SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std:
       return (prim->Hash() == hash) && (prim->name() == name);
     });
   };
-  return std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  auto substitution = std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  if (std::all_of(prims.begin(), prims.end(), [](const PrimitivePtr &prim) { return prim != nullptr; })) {
+    substitution->prims_ = prims;
+  }
+  return substitution;
 }
 
 SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std::string &name,
@@ -186,6 +196,53 @@ static void UpdateTransformingListWithUserNodes(const OptimizerPtr &optimizer, c
   }
 }
 
+SubstitutionList::SubstitutionList(const std::vector<SubstitutionPtr> &patterns, bool is_once, bool global_sensitive)
+    : list_(patterns), is_once_(is_once), global_sensitive_(global_sensitive) {
+  BuildPrimitiveIndex();
+}
+
+void SubstitutionList::BuildPrimitiveIndex() {
+  std::set<std::string> prim_names;
+  for (auto &substitution : list_) {
+    MS_EXCEPTION_IF_NULL(substitution);
+    if (substitution->prims_.empty()) {
+      (void)generic_substitutions_.emplace_back(substitution);
+      continue;
+    }
+    for (auto &prim : substitution->prims_) {
+      (void)prim_names.insert(prim->name());
+    }
+  }
+  for (auto &prim_name : prim_names) {
+    auto &candidates = prim_substitutions_[prim_name];
+    for (auto &substitution : list_) {
+      bool is_candidate =
+        substitution->prims_.empty() ||
+        std::any_of(substitution->prims_.begin(), substitution->prims_.end(),
+                    [&prim_name](const PrimitivePtr &prim) { return prim->name() == prim_name; });
+      if (is_candidate) {
+        (void)candidates.emplace_back(substitution);
+      }
+    }
+  }
+}
+
+const std::vector<SubstitutionPtr> &SubstitutionList::GetCandidateSubstitutions(const AnfNodePtr &node) const {
+  auto cnode = dyn_cast_ptr<CNode>(node);
+  if (cnode == nullptr || cnode->size() == 0) {
+    return generic_substitutions_;
+  }
+  auto prim = GetValuePtr<Primitive>(cnode->input(0));
+  if (prim == nullptr) {
+    return generic_substitutions_;
+  }
+  auto iter = prim_substitutions_.find(prim->name());
+  if (iter == prim_substitutions_.end()) {
+    return generic_substitutions_;
+  }
+  return iter->second;
+}
+
 bool SubstitutionList::ApplyIRToSubstitutions(const OptimizerPtr &optimizer, const FuncGraphPtr &func_graph) const {
 #ifdef ENABLE_PROFILE
   double start = GetTime();
@@ -195,6 +252,7 @@ bool SubstitutionList::ApplyIRToSubstitutions(const OptimizerPtr &optimizer, con
   std::deque<AnfNodePtr> todo;
   (void)todo.emplace_back(func_graph->output());
   bool changes = false;
+  size_t visits = 0;
   auto &all_nodes = manager->all_nodes();
   while (!todo.empty()) {
     AnfNodePtr node = std::move(todo.front());
@@ -204,9 +262,11 @@ bool SubstitutionList::ApplyIRToSubstitutions(const OptimizerPtr &optimizer, con
       continue;
     }
     node->seen_ = seen;
+    ++visits;
 
     bool change = false;
-    for (auto &substitution : list_) {
+    // Only the substitutions which may match the primitive of the node are tried.
+    for (auto &substitution : GetCandidateSubstitutions(node)) {
       auto res = DoTransform(optimizer, node, substitution);
       if (res != nullptr) {
         change = true;
@@ -218,6 +278,7 @@ bool SubstitutionList::ApplyIRToSubstitutions(const OptimizerPtr &optimizer, con
     UpdateTransformingListForSubstitutions(node, &todo, change);
     UpdateTransformingListWithUserNodes(optimizer, node, &todo, change, seen);
   }
+  optimizer->AddNodeVisits(visits);
 #ifdef ENABLE_PROFILE
   MsProfile::StatTime("opt.transforms." + optimizer->name(), GetTime() - start);
 #endif
@@ -235,6 +296,7 @@ bool SubstitutionList::ApplySubstitutionToIR(const OptimizerPtr &optimizer, cons
   std::deque<AnfNodePtr> todo;
   (void)todo.emplace_back(func_graph->output());
   bool changes = false;
+  size_t visits = 0;
 
   auto &all_nodes = manager->all_nodes();
   while (!todo.empty()) {
@@ -245,6 +307,7 @@ bool SubstitutionList::ApplySubstitutionToIR(const OptimizerPtr &optimizer, cons
       continue;
     }
     node->seen_ = seen;
+    ++visits;
 
     bool change = false;
     auto res = DoTransform(optimizer, node, substitution);
@@ -256,6 +319,7 @@ bool SubstitutionList::ApplySubstitutionToIR(const OptimizerPtr &optimizer, cons
     UpdateTransformingListForIR(node, &todo, change, substitution);
     UpdateTransformingListWithUserNodes(optimizer, node, &todo, change, seen);
   }
+  optimizer->AddNodeVisits(visits);
 
 #ifdef ENABLE_PROFILE
   MsProfile::StatTime("opt.transform." + optimizer->name(), GetTime() - start);
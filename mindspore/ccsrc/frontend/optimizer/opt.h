@@ -48,6 +48,8 @@ class Substitution {
   RenormAction renorm_action_;
   // Determine whether it is a priority substitution, that is, some patterns need to be matched prior to others.
   bool has_priority_pattern_{false};
+  // The primitives this substitution is restricted to, empty means the predicate may match any node.
+  std::vector<PrimitivePtr> prims_;
 
   Substitution(const OptimizerCallerPtr &transform, const std::string &name, const PredicateFuncType &predicate,
                const RenormAction &renorm_action, bool has_priority_pattern)
@@ -76,8 +78,7 @@ enum OptTraverseSubstitutionsMode { kOptTraverseFromIRToSubstitutions = 0, kOptT
 class SubstitutionList {
  public:
   explicit SubstitutionList(const std::vector<SubstitutionPtr> &patterns, bool is_once = false,
-                            bool global_sensitive = false)
-      : list_(patterns), is_once_(is_once), global_sensitive_(global_sensitive) {}
+                            bool global_sensitive = false);
   ~SubstitutionList() = default;
 
   bool operator()(const FuncGraphPtr &func_graph, const OptimizerPtr &optimizer) const;
@@ -89,8 +90,15 @@ class SubstitutionList {
   bool ApplySubstitutionsToIR(const OptimizerPtr &optimizer, const FuncGraphPtr &func_graph) const;
   void DisplayStatusOfSubstitution(const mindspore::HashMap<std::string, std::vector<bool>> &status,
                                    const OptimizerPtr &optimizer, size_t space) const;
+  void BuildPrimitiveIndex();
+  const std::vector<SubstitutionPtr> &GetCandidateSubstitutions(const AnfNodePtr &node) const;
 
   std::vector<SubstitutionPtr> list_;
+  // Substitutions indexed by the primitive name of the node they may match, each entry keeps the order of list_ and
+  // also contains the substitutions which are not restricted to any primitive.
+  mindspore::HashMap<std::string, std::vector<SubstitutionPtr>> prim_substitutions_;
+  // Substitutions which are not restricted to any primitive.
+  std::vector<SubstitutionPtr> generic_substitutions_;
   // a flag to mark this list of Substitution can only be executed only once
   bool is_once_{false};
   bool global_sensitive_{false};
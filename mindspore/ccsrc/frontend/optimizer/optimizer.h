@@ -18,12 +18,14 @@
 #define MINDSPORE_CCSRC_FRONTEND_OPTIMIZER_OPTIMIZER_H_
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
 #include <map>
+#include <sstream>
 #include <utility>
 #include <initializer_list>
 
@@ -35,6 +37,7 @@
 #include "pipeline/jit/resource.h"
 #include "pipeline/jit/action.h"
 #include "utils/ms_context.h"
+#include "utils/profile.h"
 
 namespace mindspore {
 namespace opt {
@@ -130,6 +133,7 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
     if (passes_.size() == 1) {
       run_only_once_ = true;
     }
+    pass_statistics_.resize(passes_.size());
   }
 
   static std::shared_ptr<Optimizer> MakeOptimizer(const std::string &name, const pipeline::ResourceBasePtr resource,
@@ -160,6 +164,7 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
     // Set the initial value to true, so the renormalization can be executed once if it's the
     // only pass.
     bool changes_since_last_renorm = true;
+    std::fill(pass_statistics_.begin(), pass_statistics_.end(), PassStatistic());
 
     while (changes) {
       changes = false;
@@ -167,7 +172,10 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
         for (size_t i = 0; i < passes_.size(); ++i) {
           const OptPass &opt = passes_[i];
           CurPass_ = {counter, pass_names_[i]};
-          auto opt_func = [&func_graph, &changes, &opt, &changes_since_last_renorm, this]() {
+          cur_pass_index_ = i;
+          auto &statistic = pass_statistics_[i];
+          auto start_time = GetTime();
+          auto opt_func = [&func_graph, &changes, &opt, &changes_since_last_renorm, &statistic, this]() {
             if (opt.is_renormalize()) {
               if (!changes_since_last_renorm) {
                 return;
@@ -198,9 +206,12 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
             } else if (opt(func_graph, shared_from_this())) {
               changes = true;
               changes_since_last_renorm = true;
+              ++statistic.change_count;
             }
           };
           use_profile ? (WITH(MsProfile::GetProfile()->Step(pass_names_[i])) opt_func) : opt_func();
+          ++statistic.run_count;
+          statistic.cost_time += GetTime() - start_time;
 #ifdef ENABLE_DUMP_IR
           static const auto enable_dump_pass_ir = GetDumpConfig().enable_dump_pass_ir;
           if (enable_dump_pass_ir && MsContext::GetInstance()->get_param<bool>(MS_CTX_SAVE_GRAPHS_FLAG)) {
@@ -228,9 +239,18 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
         break;
       }
     }
+    cur_pass_index_ = SIZE_MAX;
+    ReportPassStatistics(counter - 1);
     return func_graph;
   }
 
+  // Called by the substitutions of the running pass to record how many nodes they visited.
+  void AddNodeVisits(size_t visits) {
+    if (cur_pass_index_ < pass_statistics_.size()) {
+      pass_statistics_[cur_pass_index_].node_visits += visits;
+    }
+  }
+
   pipeline::ResourceBasePtr resource() const { return resource_; }
   FuncGraphManagerPtr manager() const {
     if (resource_ != nullptr) {
@@ -262,6 +282,30 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
   bool is_on_debug_{false};
 
  private:
+  // The statistics of a pass accumulated over all the rounds of one step.
+  struct PassStatistic {
+    size_t run_count{0};
+    size_t change_count{0};
+    size_t node_visits{0};
+    double cost_time{0};
+  };
+
+  void ReportPassStatistics(int rounds) const {
+    if (!IS_OUTPUT_ON(mindspore::kInfo)) {
+      return;
+    }
+    std::ostringstream oss;
+    constexpr double kSecondsToMicroseconds = 1e6;
+    oss << "Optimizer " << name_ << " finished in " << rounds << " round(s), pass statistics:";
+    for (size_t i = 0; i < pass_statistics_.size(); ++i) {
+      const auto &statistic = pass_statistics_[i];
+      oss << "\n  " << pass_names_[i] << ": run " << statistic.run_count << ", changed " << statistic.change_count
+          << ", visited nodes " << statistic.node_visits << ", cost "
+          << static_cast<int64_t>(statistic.cost_time * kSecondsToMicroseconds) << "us";
+    }
+    MS_LOG(INFO) << oss.str();
+  }
+
   const std::string name_;
   pipeline::ResourceBasePtr resource_;
   std::vector<OptPass> passes_;
@@ -273,6 +317,8 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
   bool traverse_nodes_first_;
   // A flag to indicate if it's the first order J or innermost J in GraphMode.
   bool is_first_order_j_;
+  std::vector<PassStatistic> pass_statistics_;
+  size_t cur_pass_index_{SIZE_MAX};
 };
 }  // namespace opt
 }  // namespace mindspore
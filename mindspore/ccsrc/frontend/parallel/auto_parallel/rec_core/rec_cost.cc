@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -26,16 +27,26 @@
 
 namespace mindspore {
 namespace parallel {
+void NodeNameToStrategy::push_back(const value_type &node_name_to_str) {
+  name_to_indices_[node_name_to_str.first].push_back(strategies_.size());
+  strategies_.push_back(node_name_to_str);
+}
+
+const std::vector<size_t> &NodeNameToStrategy::Find(const std::string &node_name) const {
+  static const std::vector<size_t> empty_indices;
+  auto iter = name_to_indices_.find(node_name);
+  if (iter == name_to_indices_.end()) {
+    return empty_indices;
+  }
+  return iter->second;
+}
+
 // Compute redistributed cost
-double CostRedis(const Graph::NodeType &node,
-                 const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+double CostRedis(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                  const std::vector<std::vector<float>> &mode, const Graph &graph) {
   // Store value of cost redist
   double cost_redis = 0;
 
-  // Number of current strategies.
-  size_t num_strategy = node_name_to_strategy.size();
-
   // Number of node-in and node-out
   size_t num_node_in = node.node_in.size();
   size_t num_node_out = node.node_out.size();
@@ -51,31 +62,34 @@ double CostRedis(const Graph::NodeType &node,
                          node.tensor_parm.tensor_shape.shape_h * node.tensor_parm.tensor_str.str_h *
                          node.tensor_parm.tensor_shape.shape_w * node.tensor_parm.tensor_str.str_w;
 
-  // For each strategy candidate.
-  for (size_t i_strategy = 0; i_strategy < num_strategy; i_strategy++) {
-    // Find its forward nodes
-    for (size_t i_node = 0; i_node < num_node_in; i_node++) {
-      if (graph.nodes[node.node_in[i_node]].name == node_name_to_strategy[i_strategy].first) {
-        bool is_search_forward = true;
-        cost_redis +=
-          CostRedisWithAdjacentNode(node_name_to_strategy, mode, i_strategy, i_node, input_tensor, is_search_forward);
-      }
+  // Collect the strategies of its forward and backward nodes as (strategy index, is backward, adjacent index).
+  std::vector<std::tuple<size_t, bool, size_t>> adjacent_strategies;
+  for (size_t i_node = 0; i_node < num_node_in; i_node++) {
+    for (size_t i_strategy : node_name_to_strategy.Find(graph.nodes[node.node_in[i_node]].name)) {
+      (void)adjacent_strategies.emplace_back(i_strategy, false, i_node);
     }
-
-    // Find its backward nodes
-    for (size_t i_node = 0; i_node < num_node_out; i_node++) {
-      if (graph.nodes[node.node_out[i_node]].name == node_name_to_strategy[i_strategy].first) {
-        bool is_search_forward = false;
-        cost_redis +=
-          CostRedisWithAdjacentNode(node_name_to_strategy, mode, i_strategy, i_node, output_tensor, is_search_forward);
-      }
+  }
+  for (size_t i_node = 0; i_node < num_node_out; i_node++) {
+    for (size_t i_strategy : node_name_to_strategy.Find(graph.nodes[node.node_out[i_node]].name)) {
+      (void)adjacent_strategies.emplace_back(i_strategy, true, i_node);
     }
   }
 
+  // Accumulate in strategy order, forward nodes first, the same order as scanning all the strategies.
+  std::sort(adjacent_strategies.begin(), adjacent_strategies.end());
+  for (const auto &adjacent_strategy : adjacent_strategies) {
+    size_t i_strategy = std::get<0>(adjacent_strategy);
+    bool is_search_forward = !std::get<1>(adjacent_strategy);
+    size_t i_node = std::get<2>(adjacent_strategy);
+    double tensor_size = is_search_forward ? input_tensor : output_tensor;
+    cost_redis +=
+      CostRedisWithAdjacentNode(node_name_to_strategy, mode, i_strategy, i_node, tensor_size, is_search_forward);
+  }
+
   return cost_redis;
 }
 
-double CostRedisWithAdjacentNode(const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+double CostRedisWithAdjacentNode(const NodeNameToStrategy &node_name_to_strategy,
                                  const std::vector<std::vector<float>> &mode, size_t i_strategy, size_t i_node,
                                  double tensor_size, bool search_forward) {
   double new_redis_cost = 0;
@@ -129,8 +143,7 @@ double CostRedisWithAdjacentNode(const std::vector<std::pair<std::string, Strate
 }
 
 // Get optimal strategy for MatMul
-StrategyRec CostMatMul::GetOptimalStr(const Graph::NodeType &node,
-                                      const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+StrategyRec CostMatMul::GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                                       const Graph &graph) {
   int64_t edge_i =
     static_cast<int64_t>(node.apply.arguments[0].tensor_shape.shape_h * node.apply.arguments[0].tensor_str.str_h);
@@ -216,9 +229,9 @@ StrategyRec CostMatMul::ChoseStr(const std::vector<double> &cost_op, StrategyRec
 }
 
 // Get optimal strategy for Conv
-StrategyRec CostConvolution::GetOptimalStr(
-  const Graph::NodeType &node, const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
-  const Graph &graph, bool channel_partition) {
+StrategyRec CostConvolution::GetOptimalStr(const Graph::NodeType &node,
+                                           const NodeNameToStrategy &node_name_to_strategy, const Graph &graph,
+                                           bool channel_partition) {
   const OperatorRec &op = node.apply;
 
   int64_t input_tensor_h =
@@ -379,8 +392,7 @@ StrategyRec CostConvolution::ChoseStr(const std::vector<double> &cost_op, Strate
 }
 
 // Get optimal strategy for Pooling
-StrategyRec CostPooling::GetOptimalStr(const Graph::NodeType &node,
-                                       const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+StrategyRec CostPooling::GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                                        const Graph &graph) const {
   int64_t tensor_n = static_cast<int64_t>(node.tensor_parm.tensor_shape.shape_n * node.tensor_parm.tensor_str.str_n);
   int64_t tensor_c = static_cast<int64_t>(node.tensor_parm.tensor_shape.shape_c * node.tensor_parm.tensor_str.str_c);
@@ -544,8 +556,7 @@ StrategyRec CostBiasAdd::ChoseStr(const std::vector<double> &cost_op, StrategyRe
 }
 
 // Get optimal strategy for Common OPs
-StrategyRec CostCommon::GetOptimalStr(const Graph::NodeType &node,
-                                      const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+StrategyRec CostCommon::GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                                       const Graph &graph) {
   const OperatorRec &op = node.apply;
   int64_t tensor_n = static_cast<int64_t>(op.arguments[0].tensor_shape.shape_n * op.arguments[0].tensor_str.str_n);
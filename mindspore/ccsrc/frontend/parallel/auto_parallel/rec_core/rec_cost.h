@@ -20,6 +20,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -33,19 +34,34 @@ namespace parallel {
 constexpr double MATMUL_MEM_COEF = 0.25;
 constexpr size_t REDIS_COEF = 16;
 
-double CostRedis(const Graph::NodeType &node,
-                 const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+// Strategies noted down in one partition loop, in the order the nodes were partitioned. The node name index lets
+// CostRedis visit only the strategies of the adjacent nodes instead of scanning all the noted strategies.
+class NodeNameToStrategy {
+ public:
+  using value_type = std::pair<std::string, StrategyRec>;
+
+  void push_back(const value_type &node_name_to_str);
+  size_t size() const { return strategies_.size(); }
+  const value_type &operator[](size_t index) const { return strategies_[index]; }
+  // Get the indices of the strategies noted down for node_name, in ascending order.
+  const std::vector<size_t> &Find(const std::string &node_name) const;
+
+ private:
+  std::vector<value_type> strategies_;
+  std::unordered_map<std::string, std::vector<size_t>> name_to_indices_;
+};
+
+double CostRedis(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                  const std::vector<std::vector<float>> &mode, const Graph &graph);
 
-double CostRedisWithAdjacentNode(const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+double CostRedisWithAdjacentNode(const NodeNameToStrategy &node_name_to_strategy,
                                  const std::vector<std::vector<float>> &mode, size_t i_strategy, size_t i_node,
                                  double tensor_size, bool is_search_forward);
 
 // class CostMatMul is used to compute the cost of MatMul operator.
 class CostMatMul {
  public:
-  StrategyRec GetOptimalStr(const Graph::NodeType &node,
-                            const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+  StrategyRec GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                             const Graph &graph);
 
   double GetMaxCostIn(const OperatorRec &op);
@@ -82,8 +98,7 @@ class CostMatMul {
 // class CostConvolution is used to compute the cost of Conv operator.
 class CostConvolution {
  public:
-  StrategyRec GetOptimalStr(const Graph::NodeType &node,
-                            const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+  StrategyRec GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                             const Graph &graph, bool channel_partition);
 
   double GetMinCostIn(const Graph::NodeType &node);
@@ -151,8 +166,7 @@ class CostConvolution {
 // class CostPooling is used to compute the cost of Pooling operator.
 class CostPooling {
  public:
-  StrategyRec GetOptimalStr(const Graph::NodeType &node,
-                            const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+  StrategyRec GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                             const Graph &graph) const;
 
   double GetMinCostIn() const { return cost_in_; }
@@ -181,8 +195,7 @@ class CostCommon {
  public:
   virtual ~CostCommon() = default;
 
-  virtual StrategyRec GetOptimalStr(const Graph::NodeType &node,
-                                    const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+  virtual StrategyRec GetOptimalStr(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                                     const Graph &graph);
 
   virtual double GetMinCostIn() const { return cost_in_; }
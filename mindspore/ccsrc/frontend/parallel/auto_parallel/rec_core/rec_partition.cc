@@ -16,7 +16,11 @@
 
 #include "frontend/parallel/auto_parallel/rec_core/rec_partition.h"
 #include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -24,6 +28,10 @@
 #include "ir/anf.h"
 #include "frontend/parallel/status.h"
 #include "frontend/parallel/ops_info/ops_utils.h"
+#include "include/common/debug/common.h"
+#include "include/common/utils/parallel_context.h"
+#include "utils/file_utils.h"
+#include "utils/system/sha256.h"
 
 namespace mindspore {
 namespace parallel {
@@ -121,8 +129,7 @@ std::vector<size_t> SortByWeight(const std::shared_ptr<Graph> &graph) {
 }
 
 // Get optimal strategy to partition the target node
-StrategyRec PartitionNode(const Graph::NodeType &node,
-                          const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+StrategyRec PartitionNode(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                           const std::shared_ptr<Graph> &graph) {
   bool enable_conv_chw_partition = false;
   MS_EXCEPTION_IF_NULL(graph);
@@ -204,6 +211,106 @@ StrategyRec GetOneLoopStrategy(size_t op_inputs_num, const StrategyRec &old_str,
   return new_str;
 }
 
+namespace {
+void WriteTensorStr(const TensorStr4D &tensor_str, std::ostream *stream) {
+  *stream << ' ' << tensor_str.str_n << ' ' << tensor_str.str_c << ' ' << tensor_str.str_h << ' ' << tensor_str.str_w;
+}
+
+bool ReadTensorStr(std::istream *stream, TensorStr4D *tensor_str) {
+  return static_cast<bool>(*stream >> tensor_str->str_n >> tensor_str->str_c >> tensor_str->str_h >> tensor_str->str_w);
+}
+
+void WriteTensorParam(const TensorParam &tensor, std::ostream *stream) {
+  *stream << ' ' << tensor.tensor_type << ' ' << tensor.tensor_shape.shape_n << ' ' << tensor.tensor_shape.shape_c << ' '
+          << tensor.tensor_shape.shape_h << ' ' << tensor.tensor_shape.shape_w;
+  WriteTensorStr(tensor.tensor_str, stream);
+}
+
+// The signature covers everything the strategy search reads, so a cached result is only reused by the same graph. It is
+// the sha256 of the description of the graph, which also names the cache file of the graph.
+std::string GetGraphSignature(const size_t num_device, const std::shared_ptr<Graph> &graph) {
+  std::ostringstream buffer;
+  buffer << std::setprecision(std::numeric_limits<float>::max_digits10) << num_device << ' ' << graph->nodes.size();
+  for (const auto &node : graph->nodes) {
+    buffer << '\n' << node.name << ' ' << node.info << ' ' << node.apply.op_type;
+    for (auto in_index : node.node_in) {
+      buffer << " i" << in_index;
+    }
+    for (auto out_index : node.node_out) {
+      buffer << " o" << out_index;
+    }
+    for (auto aux_index : node.node_in_aux) {
+      buffer << " a" << aux_index;
+    }
+    WriteTensorParam(node.tensor_parm, &buffer);
+    for (const auto &argument : node.apply.arguments) {
+      WriteTensorParam(argument, &buffer);
+    }
+  }
+  return system::sha256::GetHashFromString(buffer.str());
+}
+
+std::string GetRecStrategyCacheFile(const std::string &cache_dir, const std::string &signature) {
+  return cache_dir + "/rec_strategy_" + signature + ".cache";
+}
+
+// Load the strategies searched by a previous launch of the same graph, and apply them to the graph.
+bool LoadRecStrategyCache(const std::string &file, const std::string &signature, const std::shared_ptr<Graph> &graph) {
+  std::ifstream input(file);
+  if (!input.is_open()) {
+    return false;
+  }
+  std::string cached_signature;
+  size_t num_node = 0;
+  if (!(input >> cached_signature >> num_node) || cached_signature != signature || num_node != graph->nodes.size()) {
+    MS_LOG(INFO) << "The recursive programming strategy cache " << file << " does not match the current graph.";
+    return false;
+  }
+  std::vector<StrategyRec> strategies(num_node);
+  for (auto &str : strategies) {
+    bool success = std::all_of(std::begin(str.inputTensor), std::end(str.inputTensor),
+                               [&input](TensorStr4D &input_tensor) { return ReadTensorStr(&input, &input_tensor); });
+    if (!success || !ReadTensorStr(&input, &str.outputTensor) || !(input >> str.cut_counter >> str.cost)) {
+      MS_LOG(WARNING) << "The recursive programming strategy cache " << file << " is broken.";
+      return false;
+    }
+  }
+  for (size_t i = 0; i < num_node; i++) {
+    if (graph->nodes[i].info != kApplication) {
+      continue;
+    }
+    graph->nodes[i].apply.str = strategies[i];
+    graph->nodes[i] = ApplyStrToTensor(graph->nodes[i]);
+  }
+  return true;
+}
+
+void SaveRecStrategyCache(const std::string &file, const std::string &signature, const std::shared_ptr<Graph> &graph) {
+  auto realpath = Common::CreatePrefixPath(file, true);
+  if (!realpath.has_value()) {
+    MS_LOG(WARNING) << "Get real path of the recursive programming strategy cache failed, path=" << file;
+    return;
+  }
+  std::ofstream output(realpath.value(), std::ios::out | std::ios::trunc);
+  if (!output.is_open()) {
+    MS_LOG(WARNING) << "Open the recursive programming strategy cache " << realpath.value() << " failed.";
+    return;
+  }
+  output << std::setprecision(std::numeric_limits<double>::max_digits10) << signature << ' ' << graph->nodes.size();
+  for (const auto &node : graph->nodes) {
+    output << '\n';
+    for (const auto &input_tensor : node.apply.str.inputTensor) {
+      WriteTensorStr(input_tensor, &output);
+    }
+    WriteTensorStr(node.apply.str.outputTensor, &output);
+    output << ' ' << node.apply.str.cut_counter << ' ' << node.apply.str.cost;
+  }
+  output << '\n';
+  output.close();
+  ChangeFileMode(realpath.value(), S_IRUSR | S_IWUSR);
+}
+}  // namespace
+
 // Partition graph into all devices.
 Status PartitionForAllDevices(const size_t num_device, const double device_memory,
                               const std::shared_ptr<Graph> &graph) {
@@ -222,6 +329,16 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
   if (iter_times > 10) {
     MS_LOG(EXCEPTION) << "ERROR: Number of iter_times can't be larger than 10.";
   }
+  // Reuse the strategies searched by a previous launch of the same graph.
+  std::string cache_dir = ParallelContext::GetInstance()->rec_strategy_cache_dir();
+  std::string signature = cache_dir.empty() ? "" : GetGraphSignature(num_device, graph);
+  std::string cache_file = cache_dir.empty() ? "" : GetRecStrategyCacheFile(cache_dir, signature);
+  bool cache_hit = !cache_file.empty() && LoadRecStrategyCache(cache_file, signature, graph);
+  if (cache_hit) {
+    MS_LOG(INFO) << "Load the recursive programming strategies from " << cache_file << ", skip the search.";
+    iter_times = 0;
+  }
+
   // N-cuts loop
   for (int64_t loop = 0; loop < iter_times; loop++) {
     // Sort by weights
@@ -231,7 +348,7 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
     size_t iter_nodes = reorder_node_list.size();
 
     // temp vector to map nodename to its strategy.
-    std::vector<std::pair<std::string, StrategyRec>> node_name_to_strategy;
+    NodeNameToStrategy node_name_to_strategy;
 
     // Loop for all the nodes
     for (size_t i_node = 0; i_node < iter_nodes; i_node++) {
@@ -258,6 +375,9 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
       node_name_to_strategy.push_back(node_name_to_str);
     }
   }
+  if (!cache_file.empty() && !cache_hit) {
+    SaveRecStrategyCache(cache_file, signature, graph);
+  }
 
   if (DevicesMemoryControl(num_device, device_memory, graph) != SUCCESS) {
     return FAILED;
@@ -36,8 +36,7 @@ std::vector<size_t> SortByWeight(const std::shared_ptr<Graph> &graph);
 
 double GetWeights(const Graph::NodeType &node);
 
-StrategyRec PartitionNode(const Graph::NodeType &node,
-                          const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+StrategyRec PartitionNode(const Graph::NodeType &node, const NodeNameToStrategy &node_name_to_strategy,
                           const std::shared_ptr<Graph> &graph);
 
 Status PartitionForAllDevices(const size_t num_device, const double device_memory, const std::shared_ptr<Graph> &graph);
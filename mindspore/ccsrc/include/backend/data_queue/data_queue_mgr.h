@@ -137,6 +137,7 @@ class BACKEND_EXPORT DataQueueMgr {
   size_t default_capacity_{2};
 
   std::map<std::string, std::shared_ptr<BlockingQueue>> name_queue_map_;
+  mutable std::mutex queue_map_mutex_;
   // key: device name, value: DataQueueCreator
   std::map<std::string, DataQueueCreator> data_queue_creator_map_ = {};
 
@@ -153,6 +153,8 @@ class COMMON_EXPORT ParallelContext {
   std::string strategy_ckpt_save_file() const { return strategy_ckpt_save_file_; }
   void set_group_ckpt_save_file(const std::string &group_ckpt_save_file);
   std::string group_ckpt_save_file() const { return group_ckpt_save_file_; }
+  void set_rec_strategy_cache_dir(const std::string &rec_strategy_cache_dir);
+  std::string rec_strategy_cache_dir() const { return rec_strategy_cache_dir_; }
 
   void set_enable_parallel_optimizer(bool enable_parallel_optimizer) {
     enable_parallel_optimizer_ = enable_parallel_optimizer;
@@ -226,6 +228,7 @@ class COMMON_EXPORT ParallelContext {
   std::string strategy_ckpt_load_file_;
   std::string strategy_ckpt_save_file_;
   std::string group_ckpt_save_file_;
+  std::string rec_strategy_cache_dir_;
   bool enable_parallel_optimizer_;
   bool init_param_shape_;
   std::string communi_parallel_mode_;
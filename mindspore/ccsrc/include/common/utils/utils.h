@@ -453,6 +453,7 @@ constexpr auto kUpdateStateOpName = "UpdateState";
 constexpr auto kDynamicBroadcastToOpName = "DynamicBroadcastTo";
 constexpr auto kCheckValidOpName = "CheckValid";
 constexpr auto kSoftmaxGradFusionOpName = "SoftmaxGradFusion";
+constexpr auto kMultiTensorOptimizerOpName = "MultiTensorOptimizer";
 constexpr auto kZerosLikeOpName = "ZerosLike";
 
 // Communication world group
@@ -534,6 +535,8 @@ constexpr auto kAttrOutputPrecision = "output_precision";
 constexpr auto kAttrOutputUsedNum = "output_used_num";
 constexpr auto kAttrHasBias = "has_bias";
 constexpr auto kAttrN = "n";
+constexpr auto kAttrClipGlobalNorm = "clip_global_norm";
+constexpr auto kAttrGradAccumulationSteps = "grad_accumulation_steps";
 constexpr auto kAttrLabelForInsertStreamActive = "label_for_insert_stream_active";
 constexpr auto kAttrFpBpEnd = "fpbp_end";
 constexpr auto kAttrFusion = "fusion";
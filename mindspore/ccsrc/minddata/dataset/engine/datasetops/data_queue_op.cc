@@ -744,6 +744,20 @@ Status DataQueueOp::ClearDevice() {
 Status DataQueueOp::SendDataToCPU() {
   MS_LOG(INFO) << "Device queue, sending data to CPU.";
   int64_t total_batch = 0;
+  bool zero_copy = false;
+#ifdef WITH_BACKEND
+  // The rows are handed over to the data queue which the runtime creates for this channel, no row is fetched before.
+  RETURN_IF_NOT_OK(WaitCpuChannelCreated(&zero_copy));
+  if (!zero_copy) {
+    MS_LOG(INFO) << "Device queue is stopped before the data queue of channel " << channel_name_ << " is created.";
+    return Status::OK();
+  }
+  auto release_function = std::bind(&DataQueueOp::ReleaseCpuData, this, std::placeholders::_1, std::placeholders::_2);
+  auto ret = device::DataQueueMgr::GetInstance().Open(channel_name_, release_function);
+  if (ret != DataQueueStatus::SUCCESS) {
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] Failed to open channel for sending data.");
+  }
+#endif
 
   while (!(child_iterator_->EofHandled())) {
     TensorRow curr_row;
@@ -756,6 +770,9 @@ Status DataQueueOp::SendDataToCPU() {
       for (auto &tensor : curr_row) {
         MS_LOG(DEBUG) << "Feature size is " << tensor->SizeInBytes() << ".";
       }
+      if (zero_copy) {
+        RETURN_IF_NOT_OK(PushRowToCPU(std::move(curr_row)));
+      }
       total_batch++;
       if (stop_send_) {
         break;
@@ -764,10 +781,71 @@ Status DataQueueOp::SendDataToCPU() {
   }
 
   MS_LOG(INFO) << "Device queue total batch is " << total_batch << ".";
+#ifdef WITH_BACKEND
+  if (zero_copy) {
+    tree_->SetFinished();
+    device::DataQueueMgr::GetInstance().Close(channel_name_);
+    device::DataQueueMgr::GetInstance().CloseConfirm();
+  }
+#endif
+
+  return Status::OK();
+}
+
+Status DataQueueOp::WaitCpuChannelCreated(bool *created) {
+  RETURN_UNEXPECTED_IF_NULL(created);
+  *created = false;
+#ifdef WITH_BACKEND
+  // The device queue data source actor creates the data queue when the graph with GetNext is compiled, which usually
+  // happens after the pipeline is launched and may take arbitrarily long, so there is no timeout. The op waits until
+  // the queue is created or it is stopped, and only warns periodically.
+  constexpr int32_t check_interval = 100;
+  uint64_t start_time = ProfilingTime::GetCurMilliSecond();
+  uint64_t last_warning_time = start_time;
+  while (!stop_send_) {
+    if (device::DataQueueMgr::GetInstance().IsCreated(channel_name_)) {
+      *created = true;
+      break;
+    }
+    uint64_t cur_time = ProfilingTime::GetCurMilliSecond();
+    if (cur_time - last_warning_time > kTimeOutMilliSeconds) {
+      MS_LOG(WARNING) << "The data queue of channel " << channel_name_ << " has not been created by the runtime for "
+                      << (cur_time - start_time)
+                      << " ms, keep waiting. Please check whether the network which gets the data is compiled.";
+      last_warning_time = cur_time;
+    }
+    RETURN_IF_INTERRUPTED();
+    std::this_thread::sleep_for(std::chrono::milliseconds(check_interval));
+  }
+#endif
+  return Status::OK();
+}
 
+Status DataQueueOp::PushRowToCPU(TensorRow curr_row) {
+  RETURN_IF_NOT_OK(FilterMetadata(&curr_row));
+  RETURN_IF_NOT_OK(CheckExceptions(curr_row));
+  auto items = ConvertTensorRowToDataQueueItem(curr_row);
+  {
+    std::unique_lock<std::mutex> lock(cpu_inflight_mutex_);
+    for (size_t i = 0; i < items.size(); ++i) {
+      (void)cpu_inflight_tensors_.emplace(items[i].data_ptr, curr_row[i]);
+    }
+  }
+  PrintBeginInfoWhenFirstBatch(first_push_flag_);
+  uint64_t push_cost = 0;
+  RETURN_IF_NOT_OK(RetryPushData(items, false, &push_cost));
+  PrintEndInfoWhenFirstBatch(&first_push_flag_);
   return Status::OK();
 }
 
+void DataQueueOp::ReleaseCpuData(void *addr, int32_t) {
+  std::unique_lock<std::mutex> lock(cpu_inflight_mutex_);
+  auto iter = cpu_inflight_tensors_.find(addr);
+  if (iter != cpu_inflight_tensors_.end()) {
+    (void)cpu_inflight_tensors_.erase(iter);
+  }
+}
+
 void DataQueueOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
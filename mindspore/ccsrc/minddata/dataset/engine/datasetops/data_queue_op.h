@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -153,6 +154,15 @@ class DataQueueOp : public PipelineOp {
   uint32_t queue_capacity_;
 
   Status SendDataToCPU();
+  // Wait until the runtime creates the data queue of the channel, created is false only if the op is stopped before.
+  Status WaitCpuChannelCreated(bool *created);
+  // Hand the tensors of the row over to the CPU data queue without copying, the tensors are kept alive until the
+  // runtime pops them out of the queue and ReleaseCpuData is called back.
+  Status PushRowToCPU(TensorRow curr_row);
+  void ReleaseCpuData(void *addr, int32_t worker_id);
+
+  std::unordered_multimap<void *, std::shared_ptr<Tensor>> cpu_inflight_tensors_;
+  std::mutex cpu_inflight_mutex_;
 #ifndef ENABLE_SECURITY
   // Create async thread to detect whether it takes too long and unable to fetch first batch
   Status DetectFirstBatch();
@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
@@ -28,6 +30,53 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// The jagged connector pops one row from every worker in turn, and passes over a worker after popping its EOE.
+// Takes the first skip_rows rows in that order from the rows of the workers, and returns the worker that the next
+// row is popped from.
+int32_t SkipRowsOfWorkers(int64_t skip_rows, std::vector<int64_t> *worker_rows) {
+  auto &rows = *worker_rows;
+  auto num_workers = static_cast<int32_t>(rows.size());
+  std::vector<bool> finished(rows.size(), false);
+  int32_t active = num_workers;
+  int32_t pos = 0;
+  while (skip_rows > 0 && active > 0) {
+    int64_t min_rows = std::numeric_limits<int64_t>::max();
+    for (int32_t i = 0; i < num_workers; ++i) {
+      if (!finished[i]) {
+        min_rows = std::min(min_rows, rows[i]);
+      }
+    }
+    // no worker runs out of rows in whole rounds, so the position of the next pop does not move.
+    int64_t rounds = std::min(min_rows, skip_rows / active);
+    if (rounds > 0) {
+      for (int32_t i = 0; i < num_workers; ++i) {
+        if (!finished[i]) {
+          rows[i] -= rounds;
+        }
+      }
+      skip_rows -= rounds * active;
+      continue;
+    }
+    if (rows[pos] > 0) {
+      rows[pos]--;
+      skip_rows--;
+    } else {
+      finished[pos] = true;
+      active--;
+    }
+    for (int32_t offset = 1; offset <= num_workers; ++offset) {
+      int32_t next = (pos + offset) % num_workers;
+      if (!finished[next]) {
+        pos = next;
+        break;
+      }
+    }
+  }
+  return pos;
+}
+}  // namespace
+
 NonMappableLeafOp::NonMappableLeafOp(int32_t num_workers, int32_t worker_connector_size, int64_t total_num_rows,
                                      int32_t op_connector_size, bool shuffle_files, int32_t num_devices,
                                      int32_t device_id, const CompressionType &compression_type)
@@ -64,14 +113,26 @@ Status NonMappableLeafOp::operator()() {
   // data from disk into TensorRows
   RETURN_IF_NOT_OK(RegisterAndLaunchThreads());
 
+  // Initialize callback
+  RETURN_IF_NOT_OK(callback_manager_.Init(this));
+
   // must be called after launching workers. workers can't be spawned after this post,
   // so workers have to be kept alive until the end of the program
   TaskManager::FindMe()->Post();
 
   NotifyToFillIOBlockQueue();
+  int64_t ep_step = 0, total_step = 0;
+  RETURN_IF_NOT_OK(callback_manager_.Begin(CallbackParam(0, ep_step, total_step)));
+  // the skipped rows of the first epoch count in the rows of the epoch
+  int64_t rows_skipped = skip_rows_;
   while (!finished_reading_dataset_) {
     int32_t workers_done = 0;
-    int64_t rows_read = 0;
+    int64_t rows_read = rows_skipped;
+    rows_skipped = 0;
+    if (op_current_repeats_ % GetOpNumRepeatsPerEpoch() == 0) {
+      ep_step = 0;
+      RETURN_IF_NOT_OK(callback_manager_.EpochBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
+    }
     {
       std::unique_lock<std::mutex> lock(load_io_block_queue_mutex_);
       load_io_block_queue_ = true;
@@ -82,13 +143,22 @@ Status NonMappableLeafOp::operator()() {
       RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &fetched_row));
       if (fetched_row.eoe()) {
         workers_done++;
+      } else if (discard_rows_ > 0) {
+        // the rows could not be skipped by the offsets of the files, so they are dropped after reading
+        discard_rows_--;
       } else if (compression_type_ == CompressionType::None && (total_rows_ == 0 || rows_read < total_rows_)) {
         // we need to push a row
+        ep_step++;
+        total_step++;
+        RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
         RETURN_IF_NOT_OK(out_connector_->Add(std::move(fetched_row)));
         rows_read++;
       } else if (compression_type_ != CompressionType::None && (rows_read < total_rows_ * num_devices_)) {
         // for compressed version, total_rows_ is total rows that will be read per shard
         // we need to push a row
+        ep_step++;
+        total_step++;
+        RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
         RETURN_IF_NOT_OK(out_connector_->Add(std::move(fetched_row)));
         rows_read++;
       } else {
@@ -178,6 +248,10 @@ Status NonMappableLeafOp::PostEndOfData() {
 // Pushes a control indicator onto the IOBlockQueue for each worker to consume. When the worker
 // pops this control indicator, it will wait until the next epoch starts and then resume execution.
 Status NonMappableLeafOp::PostEndOfEpoch(int32_t queue_index) {
+  if (skip_rows_ > 0 && !io_blocks_skipped_) {
+    io_blocks_skipped_ = true;
+    RETURN_IF_NOT_OK(PushSkippedIoBlocks());
+  }
   for (int i = 0; i < num_workers_; ++i) {
     std::unique_ptr<FilenameBlock> eoe = std::make_unique<FilenameBlock>(IOBlock::kDeIoBlockFlagEoe);
     RETURN_IF_NOT_OK(PushIoBlockQueue((queue_index + i) % num_workers_, std::move(eoe)));
@@ -197,10 +271,76 @@ Status NonMappableLeafOp::PopIoBlockQueue(int32_t index, std::unique_ptr<Filenam
 
 // Pushes an element to a queue in io_block_queues
 Status NonMappableLeafOp::PushIoBlockQueue(int32_t index, std::unique_ptr<FilenameBlock> &&io_block) {
+  // the IOBlocks of the first epoch are held until all of them are known, see PushSkippedIoBlocks
+  if (skip_rows_ > 0 && !io_blocks_skipped_ && !io_block->eoe() && !io_block->eof()) {
+    (void)skip_io_blocks_.emplace_back(index, std::move(io_block));
+    return Status::OK();
+  }
   RETURN_IF_NOT_OK(io_block_queues_[index]->Add(std::move(io_block)));
   return Status::OK();
 }
 
+// The rows of a worker come from the blocks of its queue in order, and the master thread pops the workers in turn, so
+// the skipped rows of every worker can be worked out from the row counts of the blocks. The start offsets of the
+// blocks are moved past them, and the queues are rotated so that the rows are popped in the same order as before.
+Status NonMappableLeafOp::PushSkippedIoBlocks() {
+  auto io_blocks = std::move(skip_io_blocks_);
+  skip_io_blocks_.clear();
+  std::vector<std::vector<std::unique_ptr<FilenameBlock>>> worker_blocks(num_workers_);
+  bool has_offsets = compression_type_ == CompressionType::None;
+  for (auto &io_block : io_blocks) {
+    has_offsets = has_offsets && io_block.second->GetStartOffset() != kInvalidOffset &&
+                  io_block.second->GetEndOffset() >= io_block.second->GetStartOffset();
+    worker_blocks[io_block.first].push_back(std::move(io_block.second));
+  }
+  int32_t first_worker = 0;
+  if (!has_offsets) {
+    MS_LOG(INFO) << Name() << " has no row offsets in its files, the " << skip_rows_ << " skipped rows are read.";
+    discard_rows_ = skip_rows_;
+  } else {
+    std::vector<int64_t> worker_rows(num_workers_, 0);
+    for (int32_t i = 0; i < num_workers_; ++i) {
+      for (auto &io_block : worker_blocks[i]) {
+        worker_rows[i] += io_block->GetEndOffset() - io_block->GetStartOffset();
+      }
+    }
+    auto rest_rows = worker_rows;
+    first_worker = SkipRowsOfWorkers(skip_rows_, &rest_rows);
+    for (int32_t i = 0; i < num_workers_; ++i) {
+      int64_t skip = worker_rows[i] - rest_rows[i];
+      std::vector<std::unique_ptr<FilenameBlock>> blocks;
+      for (auto &io_block : worker_blocks[i]) {
+        int64_t start_offset = io_block->GetStartOffset();
+        int64_t end_offset = io_block->GetEndOffset();
+        if (skip >= end_offset - start_offset) {
+          skip -= end_offset - start_offset;
+          continue;
+        }
+        int64_t key = 0;
+        RETURN_IF_NOT_OK(io_block->GetKey(&key));
+        blocks.push_back(
+          std::make_unique<FilenameBlock>(key, start_offset + skip, end_offset, IOBlock::kDeIoBlockNone));
+        skip = 0;
+      }
+      worker_blocks[i] = std::move(blocks);
+    }
+  }
+  // the blocks are pushed by turns, so that a worker does not wait on a full queue of another worker
+  size_t max_blocks = 0;
+  for (auto &blocks : worker_blocks) {
+    max_blocks = std::max(max_blocks, blocks.size());
+  }
+  for (size_t j = 0; j < max_blocks; ++j) {
+    for (int32_t i = 0; i < num_workers_; ++i) {
+      auto &blocks = worker_blocks[(i + first_worker) % num_workers_];
+      if (j < blocks.size()) {
+        RETURN_IF_NOT_OK(PushIoBlockQueue(i, std::move(blocks[j])));
+      }
+    }
+  }
+  return Status::OK();
+}
+
 // Overrides base class reset method. Cleans up any state info from it's previous execution and
 // reinitializes itself so that it can be executed again, as if it was just created.
 Status NonMappableLeafOp::Reset() {
@@ -17,9 +17,11 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_NONMAPPABLE_LEAF_OP_H_
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -90,6 +92,11 @@ class NonMappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>
   // @return Status The status code returned
   Status PrepareOperator() override;
 
+  // Skips the first rows of the first epoch, which is used by the reset of the pipeline to resume in the middle of
+  // an epoch. The rows are skipped by moving the start offsets of the files, so they are not read at all.
+  // @param skip_rows - the number of rows to skip.
+  void SetSkipRows(int64_t skip_rows) { skip_rows_ = skip_rows; }
+
  protected:
   // The entry point for when workers are launched.
   // @param worker_id - the id of the worker that is executing this function.
@@ -174,8 +181,18 @@ class NonMappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>
   int64_t num_rows_;
 
  private:
+  // Pushes the IOBlocks of the first epoch after moving their start offsets past the skipped rows.
+  // @return Status - the error code returned.
+  Status PushSkippedIoBlocks();
+
   std::vector<int64_t> shuffled_keys_;  // to store shuffled filename indices
   uint32_t seed_;                       // used to shuffle filename indices
+  int64_t skip_rows_ = 0;               // rows to skip in the first epoch
+  bool io_blocks_skipped_ = false;      // whether the IOBlocks of the first epoch are pushed
+  // skipped rows the master thread drops after reading them, when the IOBlocks have no row offsets
+  std::atomic<int64_t> discard_rows_{0};
+  // the IOBlocks of the first epoch and the queues they are pushed to
+  std::vector<std::pair<int32_t, std::unique_ptr<FilenameBlock>>> skip_io_blocks_;
 };
 }  // namespace dataset
 }  // namespace mindspore
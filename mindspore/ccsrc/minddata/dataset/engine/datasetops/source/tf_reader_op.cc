@@ -178,6 +178,9 @@ Status TFReaderOp::HelperLoadNonCompFile(const std::string &filename, int64_t st
       break;
     }
     RETURN_IF_INTERRUPTED();
+    if (start_offset != kInvalidOffset && rows_total >= end_offset) {
+      break;
+    }
 
     // read length
     int64_t record_length = 0;
@@ -186,6 +189,13 @@ Status TFReaderOp::HelperLoadNonCompFile(const std::string &filename, int64_t st
     // ignore crc header
     (void)reader.ignore(static_cast<std::streamsize>(kTFRecordHeadFootSize));
 
+    // seek over the records before the start offset without reading them
+    if (start_offset != kInvalidOffset && rows_total < start_offset) {
+      (void)reader.seekg(static_cast<std::streamoff>(record_length + kTFRecordHeadFootSize), std::ios::cur);
+      rows_total++;
+      continue;
+    }
+
     // read serialized Example
     std::string serialized_example;
     serialized_example.resize(record_length);
@@ -17,6 +17,7 @@
 #include "minddata/dataset/engine/perf/auto_tune.h"
 
 #include <algorithm>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -27,11 +28,33 @@
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/serdes.h"
+#include "utils/system/sha256.h"
 #endif
 #include "minddata/dataset/util/task_manager.h"
 
 namespace mindspore {
 namespace dataset {
+#ifndef ENABLE_ANDROID
+namespace {
+void EraseTunedParams(nlohmann::json *node) {
+  (void)node->erase("num_parallel_workers");
+  (void)node->erase("connector_queue_size");
+  if (node->contains("children")) {
+    for (auto &child : (*node)["children"]) {
+      EraseTunedParams(&child);
+    }
+  }
+}
+
+// The fingerprint of a pipeline is the sha256 of its serialized IR tree without the parameters tuned by AutoTune, so a
+// saved config is only applied to the same pipeline.
+std::string GetPipelineFingerprint(nlohmann::json tree) {
+  EraseTunedParams(&tree);
+  return system::sha256::GetHashFromString(tree.dump());
+}
+}  // namespace
+#endif
+
 AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
     : tree_adapter_(tree_adap),
       profiling_manager_(profiling_mgr),
@@ -48,6 +71,7 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
       AT_change_(false),
       phase_1_best_time_(-1),
       phase_1_no_improve_count_(0),
+      phase_1_converge_count_(0),
       count_down_(0),
       phase_3_state_(AutoTuneMemPhase::kAutoTuneMemInit),
       phase_3_ID_(0),
@@ -75,6 +99,12 @@ Status AutoTune::Main() {
   }
   bool output_final_config = save_autoconfig_ && !nodes_offloaded;
   bool output_intermediate_config = save_intermediate_autoconfig_ && output_final_config;
+#ifndef ENABLE_ANDROID
+  if (output_final_config &&
+      LoadAutotuneConfig(autotune_json_filepath_ + "_" + profiling_manager_->GetRankID() + ".json").IsError()) {
+    MS_LOG(WARNING) << "Failed to load the autotune configuration of the previous run from disk";
+  }
+#endif
   RETURN_IF_NOT_OK(ATMainLoop(output_intermediate_config));
   RETURN_IF_NOT_OK(profiling_manager_->Stop());
   PostMainLogging();
@@ -160,6 +190,7 @@ Status AutoTune::SaveAutotuneConfig(const std::string &file_name) {
   RETURN_IF_NOT_OK(SummarizeTreeConfiguration(&summary));
   nlohmann::json out_json;
   out_json["summary"] = summary;
+  out_json["fingerprint"] = GetPipelineFingerprint(autotune_config_json_);
   out_json["tree"] = autotune_config_json_;
   std::string remark_value = "The following file has been auto-generated by the Dataset AutoTune.";
   if (tree_modifier_->GetRequestsCount() == 0) {
@@ -185,6 +216,43 @@ Status AutoTune::SetAutotuneConfigJson() {
   }
   return Status::OK();
 }
+
+Status AutoTune::LoadAutotuneConfig(const std::string &file_name) {
+  Path jsonpath(file_name);
+  if (!jsonpath.Exists()) {
+    return Status::OK();
+  }
+  std::ifstream in(file_name);
+  nlohmann::json saved_json = nlohmann::json::parse(in, nullptr, false);
+  if (saved_json.is_discarded() || !saved_json.contains("fingerprint") || !saved_json.contains("tree")) {
+    MS_LOG(INFO) << "File: <" << file_name << "> is not an autotune configuration, AutoTune starts from scratch.";
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(SetAutotuneConfigJson());
+  if (saved_json["fingerprint"] != GetPipelineFingerprint(autotune_config_json_)) {
+    MS_LOG(INFO) << "File: <" << file_name << "> is saved by another pipeline, AutoTune starts from scratch.";
+    return Status::OK();
+  }
+  std::map<int32_t, std::pair<int32_t, int32_t>> op_config;
+  RETURN_IF_NOT_OK(Serdes::GetOptimizedIRTreeConfig(saved_json["tree"], ops_, &op_config));
+  for (const auto &item : op_config) {
+    int32_t op_id = item.first;
+    if (SkipOpsCheck(op_id) || ops_[op_id]->Name() == "DataQueueOp") {
+      continue;
+    }
+    int32_t num_workers = ops_[op_id]->NumWorkers();
+    int32_t target_workers = item.second.first;
+    if (!IsWorkersFixed(op_id) && target_workers != num_workers) {
+      RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &target_workers));
+    }
+    int32_t queue_size = ops_[op_id]->ConnectorCapacity();
+    if (item.second.second != queue_size) {
+      RETURN_IF_NOT_OK(RequestConnectorCapacityChange(op_id, queue_size, item.second.second));
+    }
+  }
+  MS_LOG(INFO) << "Dataset AutoTune starts from the configuration in file: <" << file_name << ">.";
+  return Status::OK();
+}
 #endif
 
 Status AutoTune::SummarizeTreeConfiguration(std::vector<std::string> *out) {
@@ -419,7 +487,9 @@ Status AutoTune::ResetWorkersQueue() {
     if (!itr->inlined() && itr->Name() != "DataQueueOp") {
       int32_t target_workers = phase_1_best_workers[counter];
       int32_t target_queue = phase_1_best_queue[counter];
-      RETURN_IF_NOT_OK(RequestNumWorkerChange(itr->id(), -1, &target_workers));
+      if (!IsWorkersFixed(itr->id())) {
+        RETURN_IF_NOT_OK(RequestNumWorkerChange(itr->id(), -1, &target_workers));
+      }
       RETURN_IF_NOT_OK(RequestConnectorCapacityChange(itr->id(), -1, target_queue));
       counter++;
     }
@@ -552,6 +622,35 @@ Status AutoTune::IsDSaBottleneck(bool *isBottleneck) {
   return Status::OK();
 }
 
+Status AutoTune::IsMemoryBudgetExceeded(bool *exceeded) const {
+  *exceeded = false;
+#ifndef ENABLE_ANDROID
+  std::vector<float> used_memory;
+  std::vector<float> total_memory;
+  if (mode_ == AutoTuneMode::kAutoTuneModeEpoch) {
+    RETURN_IF_NOT_OK(
+      profiling_manager_->GetSystemMemoryInfoByEpoch(SystemMemoryMetric::kMemoryUsed, cur_epoch_running_, &used_memory));
+    RETURN_IF_NOT_OK(profiling_manager_->GetSystemMemoryInfoByEpoch(SystemMemoryMetric::kMemoryTotal,
+                                                                    cur_epoch_running_, &total_memory));
+  } else if (mode_ == AutoTuneMode::kAutoTuneModeStep) {
+    RETURN_IF_NOT_OK(profiling_manager_->GetSystemMemoryInfoByStep(
+      SystemMemoryMetric::kMemoryUsed, last_step_autotuned_, cur_step_running_ - 1, &used_memory));
+    RETURN_IF_NOT_OK(profiling_manager_->GetSystemMemoryInfoByStep(
+      SystemMemoryMetric::kMemoryTotal, last_step_autotuned_, cur_step_running_ - 1, &total_memory));
+  }
+  double avg_total = Mean(total_memory);
+  if (avg_total > 0) {
+    double used_percent = Mean(used_memory) / avg_total;
+    *exceeded = used_percent > MEMORY_BUDGET_PERCENT;
+    if (*exceeded) {
+      MS_LOG(INFO) << "Used system memory: " << (used_percent * TO_PERCENT) << "% > "
+                   << (MEMORY_BUDGET_PERCENT * TO_PERCENT) << "% memory budget of Dataset AutoTune.";
+    }
+  }
+#endif
+  return Status::OK();
+}
+
 Status AutoTune::RequestNumWorkerChange(int32_t op_id, int32_t old_workers, int32_t *num_workers_requested) {
   AT_change_ = true;
   int new_workers = std::min(*num_workers_requested, max_workers_);
@@ -588,7 +687,14 @@ bool AutoTune::SkipOpsCheck(int op_id) {
   if (ops_[op_id]->Name() == "GeneratorOp") {
     return true;
   }
-  //  NonMappableDataset is not supported in AutoTune
+  return false;
+}
+
+bool AutoTune::IsWorkersFixed(int op_id) {
+  if (ops_[op_id]->NumWorkers() == 0) {
+    return true;
+  }
+  // The workers of NonMappableDataset are bound to the files they read, only its read-ahead is tuned
 #ifndef ENABLE_ANDROID
   if (std::dynamic_pointer_cast<NonMappableLeafOp>(ops_[op_id]) != nullptr) {
     return true;
@@ -602,6 +708,21 @@ Status AutoTune::AnalyseTime() {
   bool isBottleneck = false;
   RETURN_IF_NOT_OK(IsDSaBottleneck(&isBottleneck));
   if (!isBottleneck) {
+    // The pipeline keeps up with the device, move on to the memory phase with the current config once it is steady
+    int32_t converge_threshold =
+      mode_ == AutoTuneMode::kAutoTuneModeEpoch ? CONVERGE_TRIAL_THRESHOLD_EPOCH : CONVERGE_TRIAL_THRESHOLD_STEP;
+    if (++phase_1_converge_count_ >= converge_threshold) {
+      MS_LOG(INFO) << "Dataset pipeline meets the throughput target, AutoTune moves on to tune the memory.";
+      AT_phase_ = AutoTunePhase::kAutoTunePhaseMemory;
+    }
+    return Status::OK();
+  }
+  phase_1_converge_count_ = 0;
+  bool memory_exceeded = false;
+  RETURN_IF_NOT_OK(IsMemoryBudgetExceeded(&memory_exceeded));
+  if (memory_exceeded) {
+    // Growing the workers and queues would go over the memory budget, shrink the queues instead
+    AT_phase_ = AutoTunePhase::kAutoTunePhaseMemory;
     return Status::OK();
   }
   // collect stats
@@ -632,16 +753,24 @@ Status AutoTune::AnalyseTime() {
     MS_LOG(DEBUG) << "Op (" << ops_[op_id]->NameWithID() << ") CPU=" << cpu_util / num_workers
                   << ", in=" << input_queue_util << "out=" << output_queue_util;
     // map decisions - queue
+    bool need_workers = false;
     if (queue_diff > INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD) {
       MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID()
                    << ") is slow, input connector utilization=" << input_queue_util
                    << ", output connector utilization=" << output_queue_util << ", diff= " << queue_diff << " > "
                    << INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD << " threshold.";
-      requested_workers = num_workers + INCREMENT_WORKER;
-      RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
+      need_workers = true;
     } else if ((cpu_util / num_workers) > MAP_OP_WORKER_HIGH_THRESHOLD) {
       MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID() << ") getting high average worker cpu utilization "
                    << (cpu_util / num_workers) << "% > " << MAP_OP_WORKER_HIGH_THRESHOLD << "% threshold.";
+      need_workers = true;
+    }
+    if (need_workers && IsWorkersFixed(op_id)) {
+      // a deeper read-ahead absorbs the stalls of reading when the workers cannot be added
+      RETURN_IF_NOT_OK(RequestConnectorCapacityChange(op_id, queue_capacity, queue_capacity + INCREMENT_QUEUE_SIZE));
+      continue;
+    }
+    if (need_workers) {
       requested_workers = num_workers + INCREMENT_WORKER;
       RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
     }
@@ -740,7 +869,10 @@ Status AutoTune::AnalyseMemory() {
     // Analyse impact on model from previous change made
     RETURN_IF_NOT_OK(GetConnectorUtil(&cur_avg, &connector_avg_size, &connector_avg_capacity));
     prev_avg = phase_3_prev_avg_;
-    comp_flag = MemoryPhaseCompareMetric(prev_avg, cur_avg);
+    bool memory_exceeded = false;
+    RETURN_IF_NOT_OK(IsMemoryBudgetExceeded(&memory_exceeded));
+    // The reduction is kept while the pipeline is over the memory budget, even if it costs throughput
+    comp_flag = memory_exceeded || MemoryPhaseCompareMetric(prev_avg, cur_avg);
     // Compare current avg against pre-change avg
     if (comp_flag == false) {
       int reset_val = OP_values[phase_3_ID_];
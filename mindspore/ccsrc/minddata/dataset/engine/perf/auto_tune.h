@@ -74,6 +74,11 @@ class AutoTune {
   /// Setter for autotune_config_json_
   /// \return Status code
   Status SetAutotuneConfigJson();
+
+  /// \brief Load the AT config saved by a previous run of the same pipeline and request it as the initial config
+  /// \param file_name Name of the file
+  /// \return Status object
+  Status LoadAutotuneConfig(const std::string &file_name);
 #endif
 
   /// Function to collect info from the tree
@@ -116,6 +121,11 @@ class AutoTune {
   /// \return Status code
   Status IsDSaBottleneck(bool *isBottleneck);
 
+  /// Check if the used system memory is over the memory budget of AutoTune
+  /// \param[out] exceeded bool
+  /// \return Status code
+  Status IsMemoryBudgetExceeded(bool *exceeded) const;
+
   /// Returns true if the pipeline is sink or non-sink
   /// \return bool
   bool IsSink() const;
@@ -151,8 +161,13 @@ class AutoTune {
   // Early stop specifics
   const int32_t EARLY_STOP_TRIAL_THRESHOLD_EPOCH = 4;
   const int32_t EARLY_STOP_TRIAL_THRESHOLD_STEP = 10;
+  // Convergence specifics, the number of runs in a row that the pipeline is not the bottleneck
+  const int32_t CONVERGE_TRIAL_THRESHOLD_EPOCH = 2;
+  const int32_t CONVERGE_TRIAL_THRESHOLD_STEP = 5;
   // Memory specifics
   const float MEMORY_COMPARISON_LOWER_BOUND_PERCENT = 0.02;
+  // Ratio of the used system memory over which AutoTune stops growing and shrinks the queues
+  const float MEMORY_BUDGET_PERCENT = 0.85;
   const float QUEUE_REDUCTION_PERCENTAGE_EPOCH = 0.5;
   const float QUEUE_REDUCTION_PERCENTAGE_STEP = 0.8;
 
@@ -184,6 +199,11 @@ class AutoTune {
   /// \return bool to skip or not
   bool SkipOpsCheck(int op_id);
 
+  /// Check whether the number of workers of an op is fixed, only its queue size is tuned
+  /// \param op_id ID to check
+  /// \return bool whether the workers are fixed
+  bool IsWorkersFixed(int op_id);
+
   /// Main AutoTune algorithm
   /// \return Status code
   Status AnalyseTime();
@@ -278,6 +298,7 @@ class AutoTune {
   // Phase 1 - Analyse Time
   double phase_1_best_time_;
   int32_t phase_1_no_improve_count_;
+  int32_t phase_1_converge_count_;
   std::vector<int32_t> phase_1_best_workers;
   std::vector<int32_t> phase_1_best_queue;
 
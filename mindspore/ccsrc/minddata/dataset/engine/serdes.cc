@@ -465,6 +465,41 @@ Status Serdes::RecurseUpdateOptimizedIRTreeJSON(nlohmann::json *serialized_json,
   return Status::OK();
 }
 
+Status Serdes::GetOptimizedIRTreeConfig(const nlohmann::json &serialized_json,
+                                        const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map,
+                                        std::map<int32_t, std::pair<int32_t, int32_t>> *op_config) {
+  RETURN_UNEXPECTED_IF_NULL(op_config);
+  int32_t op_id = 0;
+  return RecurseGetOptimizedIRTreeConfig(serialized_json, &op_id, op_map, op_config);
+}
+
+Status Serdes::RecurseGetOptimizedIRTreeConfig(const nlohmann::json &serialized_json, int32_t *op_id,
+                                               const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map,
+                                               std::map<int32_t, std::pair<int32_t, int32_t>> *op_config) {
+  RETURN_UNEXPECTED_IF_NULL(op_id);
+  RETURN_UNEXPECTED_IF_NULL(op_config);
+  CHECK_FAIL_RETURN_UNEXPECTED(serialized_json.contains("op_type"), "Failed to find op_type in the IR tree json.");
+  std::string ir_node_name = serialized_json["op_type"];
+  CHECK_FAIL_RETURN_UNEXPECTED(*op_id < op_map.size(), "op_id is out of bounds");
+  // Skip the dataset ops inserted during the construction of execution tree, the same as the update of the json
+  while (!IsDatasetOpMatchIRNode(ir_node_name, op_map.find(*op_id)->second->Name())) {
+    ++(*op_id);
+    CHECK_FAIL_RETURN_UNEXPECTED(*op_id < op_map.size(), "op_id is out of bounds");
+  }
+  if (!op_map.find(*op_id)->second->inlined() && serialized_json.contains("num_parallel_workers") &&
+      serialized_json.contains("connector_queue_size")) {
+    (*op_config)[*op_id] = std::make_pair(serialized_json["num_parallel_workers"].get<int32_t>(),
+                                          serialized_json["connector_queue_size"].get<int32_t>());
+  }
+  ++(*op_id);
+  if (serialized_json.contains("children")) {
+    for (const auto &child : serialized_json["children"]) {
+      RETURN_IF_NOT_OK(RecurseGetOptimizedIRTreeConfig(child, op_id, op_map, op_config));
+    }
+  }
+  return Status::OK();
+}
+
 // In the current stage, there is a cyclic dependency between libmindspore.so and c_dataengine.so,
 // we make a C function here and dlopen by libminspore.so to avoid linking explicitly,
 // will be fix after decouling libminspore.so into multi submodules
@@ -161,6 +161,15 @@ class Serdes {
   static Status UpdateOptimizedIRTreeJSON(nlohmann::json *serialized_json,
                                           const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map);
 
+  /// \brief Function to get the parameters [num_parallel_workers, connector_queue_size] of each dataset op from the
+  /// serialized JSON object of the optimized IR tree, which is the reverse of UpdateOptimizedIRTreeJSON
+  /// \param[in] serialized_json The optimized ir tree json node
+  /// \param[in] op_map An ID to DatasetOp mapping
+  /// \param[out] op_config An ID to [num_parallel_workers, connector_queue_size] mapping
+  static Status GetOptimizedIRTreeConfig(const nlohmann::json &serialized_json,
+                                         const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map,
+                                         std::map<int32_t, std::pair<int32_t, int32_t>> *op_config);
+
   /// \brief function to de-serialize JSON file to IR tree
   /// \param[in] json_filepath input path of json file
   /// \param[out] ds The deserialized dataset
@@ -237,6 +246,15 @@ class Serdes {
   static Status RecurseUpdateOptimizedIRTreeJSON(nlohmann::json *serialized_json, int32_t *op_id,
                                                  const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map);
 
+  /// \brief Helper function to perform recursive DFS on the optimized IR tree to get the parameters of each dataset op
+  /// \param [in] serialized_json The optimized ir tree json node
+  /// \param [in, out] op_id The id in execution tree from where to continue the IR Node - DatasetOp matching search
+  /// \param [in] op_map An ID to DatasetOp mapping
+  /// \param [out] op_config An ID to [num_parallel_workers, connector_queue_size] mapping
+  static Status RecurseGetOptimizedIRTreeConfig(const nlohmann::json &serialized_json, int32_t *op_id,
+                                                const std::map<int32_t, std::shared_ptr<DatasetOp>> &op_map,
+                                                std::map<int32_t, std::pair<int32_t, int32_t>> *op_config);
+
  private:
   static std::map<std::string, Status (*)(nlohmann::json json_obj, std::shared_ptr<TensorOperation> *operation)>
     func_ptr_;
@@ -18,7 +18,9 @@
 
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/engine/ir/datasetops/root_node.h"
+#include "minddata/dataset/engine/ir/datasetops/skip_node.h"
 #ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/opt/pre/cache_transform_pass.h"
 #include "minddata/dataset/engine/opt/pre/node_offload_pass.h"
@@ -142,23 +144,65 @@ Status TreeAdapter::PostPass(std::shared_ptr<DatasetNode> ir) {
   return Status::OK();
 }
 
+Status TreeAdapter::BuildOps(const std::shared_ptr<DatasetNode> &ir, std::vector<std::shared_ptr<DatasetOp>> *ops) {
+  RETURN_IF_NOT_OK(ir->Build(ops));
+
+  CHECK_FAIL_RETURN_UNEXPECTED(!ops->empty(), "Unable to build node: " + ir->Name());
+
+  RETURN_IF_NOT_OK(tree_->AssociateNode(ops->front()));
+  for (size_t i = 1; i < ops->size(); i++) {
+    RETURN_IF_NOT_OK(tree_->AssociateNode((*ops)[i]));
+    RETURN_IF_NOT_OK((*ops)[i - 1]->AddChild((*ops)[i]));
+  }
+  return Status::OK();
+}
+
+Status TreeAdapter::BuildSkipIntoLeaf(const std::shared_ptr<DatasetNode> &ir, std::shared_ptr<DatasetOp> *const op,
+                                      bool *done) {
+  *done = false;
+#ifndef ENABLE_ANDROID
+  // The skip of the reset is pushed down right above a non-mappable leaf, which can skip the rows by the offsets of its
+  // files instead of reading them. The IR tree keeps the skip node, only the skip op is folded into the leaf op.
+  auto skip_node = std::dynamic_pointer_cast<SkipNode>(ir);
+  if (skip_node == nullptr || !skip_node->OnceOnly() || skip_node->Children().size() != 1 ||
+      std::dynamic_pointer_cast<NonMappableSourceNode>(skip_node->Children()[0]) == nullptr) {
+    return Status::OK();
+  }
+  std::shared_ptr<DatasetOp> child_op;
+  RETURN_IF_NOT_OK(BuildExecutionTreeRecur(skip_node->Children()[0], &child_op));
+  auto leaf_op = std::dynamic_pointer_cast<NonMappableLeafOp>(child_op);
+  if (leaf_op != nullptr) {
+    leaf_op->SetSkipRows(skip_node->Count());
+    *op = child_op;
+  } else {
+    // a shuffle op or a cache op is built above the leaf, the rows are skipped after them
+    MS_LOG(WARNING) << "The reset of the pipeline reads the first " << skip_node->Count() << " rows of "
+                    << skip_node->Children()[0]->Name() << " again to skip them, as " << child_op->Name()
+                    << " is built above it, whose buffer can not be restored without the rows. Set shuffle of the "
+                    << "dataset to Shuffle.FILES or False to skip the rows by the file offsets instead.";
+    std::vector<std::shared_ptr<DatasetOp>> ops;
+    RETURN_IF_NOT_OK(BuildOps(ir, &ops));
+    RETURN_IF_NOT_OK(ops.back()->AddChild(child_op));
+    *op = ops.front();
+  }
+  *done = true;
+#endif
+  return Status::OK();
+}
+
 Status TreeAdapter::BuildExecutionTreeRecur(std::shared_ptr<DatasetNode> ir, std::shared_ptr<DatasetOp> *const op) {
   RETURN_UNEXPECTED_IF_NULL(ir);
   RETURN_UNEXPECTED_IF_NULL(op);
   RETURN_UNEXPECTED_IF_NULL(tree_);
+  bool done = false;
+  RETURN_IF_NOT_OK(BuildSkipIntoLeaf(ir, op, &done));
+  if (done) {
+    return Status::OK();
+  }
   // Build the DatasetOp ExecutionTree from the optimized IR tree
   std::vector<std::shared_ptr<DatasetOp>> ops;
-  RETURN_IF_NOT_OK(ir->Build(&ops));
-
-  CHECK_FAIL_RETURN_UNEXPECTED(!ops.empty(), "Unable to build node: " + ir->Name());
-
+  RETURN_IF_NOT_OK(BuildOps(ir, &ops));
   (*op) = ops.front();  // return the first op to be added as child by the caller of this function
-  RETURN_IF_NOT_OK(tree_->AssociateNode(*op));
-
-  for (size_t i = 1; i < ops.size(); i++) {
-    RETURN_IF_NOT_OK(tree_->AssociateNode(ops[i]));
-    RETURN_IF_NOT_OK(ops[i - 1]->AddChild(ops[i]));
-  }
 
   // Build the children of IR, once they return, add the return value to *op
   for (const std::shared_ptr<DatasetNode> &child_ir : ir->Children()) {
@@ -121,6 +121,12 @@ class TreeAdapter {
   // This RECURSIVE function walks the (optimized) IR tree in DFS to build its corresponding Execution tree.
   Status BuildExecutionTreeRecur(std::shared_ptr<DatasetNode> ir, std::shared_ptr<DatasetOp> *op);
 
+  // Build the DatasetOps of one IR node and chain them
+  Status BuildOps(const std::shared_ptr<DatasetNode> &ir, std::vector<std::shared_ptr<DatasetOp>> *ops);
+
+  // Build a once only skip node right above a non-mappable leaf by setting the skipped rows to the leaf op
+  Status BuildSkipIntoLeaf(const std::shared_ptr<DatasetNode> &ir, std::shared_ptr<DatasetOp> *op, bool *done);
+
   // Adjust the pipeline (eg, move rng_ forward) if in reset mode
   Status AdjustReset(const int64_t epoch_num);
 
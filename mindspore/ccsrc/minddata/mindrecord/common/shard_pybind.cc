@@ -123,6 +123,11 @@ void BindShardWriter(py::module *m) {
            THROW_IF_ERROR(s.SetPageSize(page_size));
            return SUCCESS;
          })
+    .def("set_typed_raw_data",
+         [](ShardWriter &s, bool typed_raw_data) {
+           THROW_IF_ERROR(s.SetTypedRawData(typed_raw_data));
+           return SUCCESS;
+         })
     .def("set_shard_header",
          [](ShardWriter &s, std::shared_ptr<ShardHeader> header_data) {
            THROW_IF_ERROR(s.SetShardHeader(header_data));
@@ -192,8 +197,13 @@ void BindShardIndexGenerator(const py::module *m) {
            THROW_IF_ERROR(s.Build());
            return SUCCESS;
          })
-    .def("write_to_db", [](ShardIndexGenerator &s) {
-      THROW_IF_ERROR(s.WriteToDatabase());
+    .def("write_to_db",
+         [](ShardIndexGenerator &s) {
+           THROW_IF_ERROR(s.WriteToDatabase());
+           return SUCCESS;
+         })
+    .def("convert_to_sorted_index", [](ShardIndexGenerator &s) {
+      THROW_IF_ERROR(s.ConvertToSortedIndex());
       return SUCCESS;
     });
 }
@@ -73,7 +73,11 @@ const int kUnsignedInt4 = 4;
 enum LabelCategory { kSchemaLabel, kStatisticsLabel, kIndexLabel };
 
 const char kVersion[] = "3.0";
-const std::vector<std::string> kSupportedVersion = {"2.0", kVersion};
+// raw fields may be stored in the typed layout of ShardColumn::EncodeRawRow since version 3.1, which is only written
+// when the layout is enabled by ShardWriter::SetTypedRawData, the readers of the earlier versions reject these files
+// as an unsupported version instead of misreading them
+const char kTypedRawVersion[] = "3.1";
+const std::vector<std::string> kSupportedVersion = {"2.0", kVersion, kTypedRawVersion};
 
 enum ShardType {
   kNLP = 0,
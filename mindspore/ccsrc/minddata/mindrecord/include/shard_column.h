@@ -33,6 +33,8 @@ const uint64_t kNumDataOfByte = 4;
 const uint64_t kBytesOfColumnLen = 4;
 const uint64_t kDataTypeBitMask = 3;
 const uint64_t kDataTypes = 6;
+// Leading byte of a raw row stored in the typed layout, msgpack never uses it.
+const uint8_t kTypedRawRowMarker = 0xc1;
 
 enum IntegerType { kInt8Type = 0, kInt16Type, kInt32Type, kInt64Type };
 
@@ -103,6 +105,32 @@ class MINDRECORD_API ShardColumn {
   Status GetColumnFromJson(const std::string &column_name, const json &columns_json,
                            std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes);
 
+  /// \brief encode the raw fields of a row in the typed layout: the marker, then the values of all raw columns in
+  ///        schema order, fixed size little-endian numbers narrowed to the column type and length prefixed strings
+  /// \param[in] row raw fields of a row
+  /// \param[out] bytes encoded row
+  /// \return false if the row does not match the schema exactly, it is then stored as msgpack
+  bool EncodeRawRow(const json &row, std::vector<uint8_t> *bytes) const;
+
+  /// \brief decode a raw row stored in the typed layout or as msgpack
+  /// \param[in] bytes raw row read from a raw page
+  /// \param[in] columns columns to keep, all of them if empty
+  /// \param[out] row raw fields of the row
+  /// \return Status
+  Status DecodeRawRow(const std::vector<uint8_t> &bytes, const std::vector<std::string> &columns, json *row) const;
+
+  /// \brief decode a numeric raw column of several rows into one contiguous buffer, the rows stored in the typed
+  ///        layout are read in place without building json
+  /// \param[in] rows raw rows read from a raw page
+  /// \param[in] column_name name of an int32, int64, float32 or float64 raw column
+  /// \param[out] data_ptr values of the column, one per row
+  /// \param[out] n_bytes size of the values in bytes
+  /// \param[out] column_data_type type of the values
+  /// \return Status
+  Status DecodeRawColumn(const std::vector<std::vector<uint8_t>> &rows, const std::string &column_name,
+                         std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes,
+                         ColumnDataType *column_data_type) const;
+
  private:
   /// \brief initialization
   void Init(const json &schema_json, bool compress_integer = true);
@@ -115,6 +143,11 @@ class MINDRECORD_API ShardColumn {
   template <typename T>
   Status GetInt(std::unique_ptr<unsigned char[]> *data_ptr, const json &json_column_value);
 
+  /// \brief decode the values of a numeric raw column of several rows
+  template <typename T>
+  Status DecodeRawColumnValues(const std::vector<std::vector<uint8_t>> &rows, uint64_t column_id,
+                               unsigned char *data) const;
+
   /// \brief get column offset address and size from blob
   Status GetColumnAddressInBlock(const uint64_t &column_id, const std::vector<uint8_t> &columns_blob,
                                  uint64_t *num_bytes, uint64_t *shift_idx);
@@ -166,6 +199,7 @@ class MINDRECORD_API ShardColumn {
   std::unordered_map<string, uint64_t> column_name_id_;       // column name id map
   std::vector<std::string> blob_column_;                      // blob column list
   std::unordered_map<std::string, uint64_t> blob_column_id_;  // blob column name id map
+  std::vector<uint64_t> raw_column_id_;                       // raw column id list in schema order
   bool has_compress_blob_;                                    // if has compress blob
   uint64_t num_blob_column_;                                  // number of blob columns
 };
@@ -124,12 +124,16 @@ class MINDRECORD_API ShardHeader {
 
   uint64_t GetCompressionSize() const { return compression_size_; }
 
+  const std::string &GetVersion() const { return version_; }
+
   void SetHeaderSize(const uint64_t &header_size) { header_size_ = header_size; }
 
   void SetPageSize(const uint64_t &page_size) { page_size_ = page_size; }
 
   void SetCompressionSize(const uint64_t &compression_size) { compression_size_ = compression_size; }
 
+  void SetVersion(const std::string &version) { version_ = version; }
+
   std::vector<std::string> SerializeHeader();
 
   Status PagesToFile(const std::string dump_file_name);
@@ -190,6 +194,7 @@ class MINDRECORD_API ShardHeader {
   uint64_t header_size_;
   uint64_t page_size_;
   uint64_t compression_size_;
+  std::string version_;
 
   std::shared_ptr<Index> index_;
   std::vector<std::string> shard_addresses_;
@@ -25,7 +25,9 @@
 #include <tuple>
 #include <utility>
 #include <vector>
+#include "minddata/mindrecord/include/shard_column.h"
 #include "minddata/mindrecord/include/shard_header.h"
+#include "minddata/mindrecord/include/shard_sorted_index.h"
 #include "./sqlite3.h"
 
 namespace mindspore {
@@ -58,6 +60,9 @@ class MINDRECORD_API ShardIndexGenerator {
   /// \brief create databases for indexes
   Status WriteToDatabase();
 
+  /// \brief convert the existing databases to sorted index files, which the reader loads instead of them
+  Status ConvertToSortedIndex();
+
   static Status Finalize(const std::vector<std::string> file_names);
 
  private:
@@ -108,12 +113,15 @@ class MINDRECORD_API ShardIndexGenerator {
 
   void DatabaseWriter();  // worker thread
 
+  void SortedIndexConverter();  // worker thread
+
   std::string file_path_;
   bool append_;
   ShardHeader shard_header_;
   uint64_t page_size_;
   uint64_t header_size_;
   int schema_count_;
+  std::shared_ptr<ShardColumn> shard_column_;
   std::atomic_int task_;
   std::atomic_bool write_success_;
   std::vector<std::pair<uint64_t, std::string>> fields_;
@@ -52,6 +52,7 @@
 #include "minddata/mindrecord/include/shard_reader.h"
 #include "minddata/mindrecord/include/shard_sample.h"
 #include "minddata/mindrecord/include/shard_shuffle.h"
+#include "minddata/mindrecord/include/shard_sorted_index.h"
 
 namespace mindspore {
 namespace mindrecord {
@@ -168,6 +169,18 @@ class MINDRECORD_API ShardReader {
                               const std::vector<std::string> &columns,
                               std::shared_ptr<ROW_GROUP_BRIEF> *row_group_brief_ptr);
 
+  /// \brief Read a numeric raw column of 1 row group into one contiguous buffer, without json per row
+  /// \param[in] group_id row group ID
+  /// \param[in] shard_id sharding ID
+  /// \param[in] column name of an int32, int64, float32 or float64 raw column
+  /// \param[out] data_ptr values of the column, one per row in the order of ReadRowGroupBrief
+  /// \param[out] n_bytes size of the values in bytes
+  /// \param[out] column_data_type type of the values
+  /// \return MSRStatus the status of MSRStatus
+  Status ReadRowGroupColumn(int group_id, int shard_id, const std::string &column,
+                            std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes,
+                            ColumnDataType *column_data_type);
+
   /// \brief return a batch, given that one is ready
   /// \return a batch of images and image data
   std::vector<std::tuple<std::vector<uint8_t>, json>> GetNext();
@@ -204,6 +217,9 @@ class MINDRECORD_API ShardReader {
   /// \brief sqlite call back function
   static int SelectCallback(void *p_data, int num_fields, char **p_fields, char **p_col_names);
 
+  /// \brief open the meta files not opened yet, which are skipped while sorted index files are used
+  Status OpenDatabases();
+
  private:
   /// \brief wrap up labels to json format
   Status ConvertLabelToJson(const std::vector<std::vector<std::string>> &labels, std::shared_ptr<std::fstream> fs,
@@ -222,6 +238,21 @@ class MINDRECORD_API ShardReader {
   Status ReadRowGroupByShardIDAndSampleID(const std::vector<std::string> &columns, const uint32_t &shard_id,
                                           const uint32_t &sample_id, std::shared_ptr<ROW_GROUPS> *row_group_ptr);
 
+  /// \brief read rows in [row_begin, row_end) of one shard from its sorted index
+  Status ReadRowsFromSortedIndex(int shard_id, uint64_t row_begin, uint64_t row_end,
+                                 const std::vector<std::string> &columns,
+                                 std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
+                                 std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
+
+  /// \brief load sorted index files of all shards, they should match the shard headers
+  Status LoadSortedIndexes();
+
+  /// \brief get ids of rows in blob page which match the criteria from the sorted index
+  std::vector<uint64_t> GetRowsInPage(int page_id, int shard_id, const std::pair<std::string, std::string> &criteria);
+
+  /// \brief get distinct values of index field from the sorted indexes
+  void GetClassesFromSortedIndex(const std::string &field_name, std::shared_ptr<std::set<std::string>> category_ptr);
+
   /// \brief read all rows in one shard
   Status ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
                             std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
@@ -243,8 +274,9 @@ class MINDRECORD_API ShardReader {
   /// \brief get page id by category
   Status GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                             std::shared_ptr<std::vector<uint64_t>> *pages_ptr);
-  /// \brief execute sqlite query with prepare statement
-  Status QueryWithCriteria(sqlite3 *db, const string &sql, const string &criteria,
+  /// \brief execute sqlite query with prepare statement, the criteria value is bound to :criteria as the type of
+  ///        its field, so a numeric field is compared by number
+  Status QueryWithCriteria(sqlite3 *db, const string &sql, const std::pair<std::string, std::string> &criteria,
                            std::shared_ptr<std::vector<std::vector<std::string>>> labels_ptr);
   /// \brief verify the validity of dataset
   Status VerifyDataset(sqlite3 **db, const string &file);
@@ -253,6 +285,10 @@ class MINDRECORD_API ShardReader {
   Status GetLabels(int page_id, int shard_id, const std::vector<std::string> &columns,
                    const std::pair<std::string, std::string> &criteria, std::shared_ptr<std::vector<json>> *labels_ptr);
 
+  /// \brief get the raw data offsets of the rows in a page
+  Status GetLabelOffsetsInPage(int page_id, int shard_id, const std::pair<std::string, std::string> &criteria,
+                               std::vector<std::vector<std::string>> *label_offsets);
+
   /// \brief get column values from raw data page
   Status GetLabelsFromPage(int page_id, int shard_id, const std::vector<std::string> &columns,
                            const std::pair<std::string, std::string> &criteria,
@@ -282,6 +318,10 @@ class MINDRECORD_API ShardReader {
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief read raw rows from binary file
+  Status ReadRawRowsFromBinaryFile(int shard_id, const std::vector<std::vector<std::string>> &label_offsets,
+                                   std::vector<std::vector<uint8_t>> *raw_rows);
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
@@ -306,6 +346,7 @@ class MINDRECORD_API ShardReader {
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
+  std::vector<std::shared_ptr<ShardSortedIndex>> sorted_indexes_;                // empty if not all files have one
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
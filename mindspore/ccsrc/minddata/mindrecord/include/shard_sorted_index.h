@@ -0,0 +1,124 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_SORTED_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_SORTED_INDEX_H_
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+
+namespace mindspore {
+namespace mindrecord {
+const char kSortedIndexSuffix[] = ".idx";
+
+/// \brief how the values of an index field are sorted and compared, as the column affinity in table INDEXES
+enum class SortedIndexFieldType : uint64_t { kText = 0, kInteger = 1, kReal = 2 };
+
+/// \brief location of one row, the same as the columns of table INDEXES in the meta file
+struct SortedIndexRow {
+  uint64_t row_group_id;
+  uint64_t page_id_blob;
+  uint64_t page_offset_blob;
+  uint64_t page_offset_blob_end;
+  uint64_t page_id_raw;
+  uint64_t page_offset_raw;
+  uint64_t page_offset_raw_end;
+};
+
+/// \brief binary index of a mindrecord file, stored beside the sqlite meta file. It holds the rows in ROW_ID order
+///        and, for each index field, the values in ROW_ID order and the row ids sorted by value. Values of INTEGER and
+///        NUMERIC fields are also stored as numbers and sorted by number, like sqlite compares them. All sections are
+///        8 bytes aligned, the file is loaded with one read and queried without parsing.
+class MINDRECORD_API ShardSortedIndex {
+ public:
+  ShardSortedIndex() = default;
+
+  ~ShardSortedIndex() = default;
+
+  /// \brief write the index of a mindrecord file
+  /// \param[in] file path of the mindrecord file
+  /// \param[in] shard_name file name of the mindrecord file
+  /// \param[in] fields names of the index fields in table INDEXES
+  /// \param[in] field_types types of the index fields
+  /// \param[in] rows locations of the rows in ROW_ID order
+  /// \param[in] field_values values of each index field in ROW_ID order, as text like sqlite returns
+  /// \return Status
+  static Status Write(const std::string &file, const std::string &shard_name, const std::vector<std::string> &fields,
+                      const std::vector<SortedIndexFieldType> &field_types, const std::vector<SortedIndexRow> &rows,
+                      const std::vector<std::vector<std::string>> &field_values);
+
+  /// \brief convert the sqlite meta file of a mindrecord file to the index
+  /// \param[in] file path of the mindrecord file
+  /// \return Status
+  static Status ConvertFromDatabase(const std::string &file);
+
+  /// \brief load the index of a mindrecord file
+  /// \param[in] file path of the mindrecord file
+  /// \param[out] index the loaded index
+  /// \return Status
+  static Status Load(const std::string &file, std::shared_ptr<ShardSortedIndex> *index);
+
+  /// \brief whether the mindrecord file has an index
+  static bool Exists(const std::string &file);
+
+  const std::string &GetShardName() const { return shard_name_; }
+
+  uint64_t GetRowCount() const { return row_count_; }
+
+  /// \brief get the location of a row, row_id should be less than the row count
+  SortedIndexRow GetRow(uint64_t row_id) const;
+
+  /// \brief get the id of an index field, -1 if not found
+  int GetFieldId(const std::string &field) const;
+
+  /// \brief get the value of an index field of a row
+  std::string GetValue(int field_id, uint64_t row_id) const;
+
+  /// \brief binary search the rows whose value of the index field equals value, a numeric field is matched by number
+  /// \return row ids in ascending order
+  std::vector<uint64_t> FindRows(int field_id, const std::string &value) const;
+
+  /// \brief scan the distinct values of the index field in sorted order
+  void GetDistinctValues(int field_id, std::set<std::string> *values) const;
+
+ private:
+  struct FieldSection {
+    SortedIndexFieldType type;
+    const uint64_t *value_offsets;  // row_count + 1 offsets into the value pool
+    const uint64_t *sorted_rows;    // row ids sorted by value
+    const uint64_t *keys;           // int64 or double values in row order, nullptr for a text field
+    const char *pool;
+  };
+
+  int CompareValue(const FieldSection &section, uint64_t row_id, const std::string &value) const;
+
+  static int CompareKey(SortedIndexFieldType type, uint64_t lhs, uint64_t rhs);
+
+  std::unique_ptr<uint64_t[]> buffer_;  // 8 bytes aligned file content
+  uint64_t row_count_ = 0;
+  std::string shard_name_;
+  std::vector<std::string> fields_;
+  const uint64_t *rows_ = nullptr;
+  std::vector<FieldSection> sections_;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_SORTED_INDEX_H_
@@ -80,6 +80,12 @@ class MINDRECORD_API ShardWriter {
   /// \return MSRStatus the status of MSRStatus
   Status SetPageSize(const uint64_t &page_size);
 
+  /// \brief Set whether the raw fields are stored in the typed layout
+  /// \param[in] typed_raw_data store the raw fields matching the schema in the typed layout if true, the files are then
+  ///        written in version 3.1 which the earlier versions can not read
+  /// \return MSRStatus the status of MSRStatus
+  Status SetTypedRawData(bool typed_raw_data);
+
   /// \brief Set shard header
   /// \param[in] header_data the info of header
   ///        WARNING, only called when file is empty
@@ -243,6 +249,7 @@ class MINDRECORD_API ShardWriter {
   uint64_t page_size_;     // page size
   uint32_t row_count_;     // count of rows
   uint32_t schema_count_;  // count of schemas
+  bool typed_raw_data_;    // store raw fields in the typed layout
 
   std::vector<uint64_t> raw_data_size_;   // Raw data size
   std::vector<uint64_t> blob_data_size_;  // Blob data size
@@ -275,8 +275,10 @@ Status ShardIndexGenerator::GetSchemaDetails(const std::vector<uint64_t> &schema
         in.close();
         RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
       }
-      auto j = json::from_msgpack(std::string(schema_detail.begin(), schema_detail.end()));
-      (*detail_ptr)->emplace_back(j);
+      json j;
+      RETURN_IF_NOT_OK_MR(
+        shard_column_->DecodeRawRow(std::vector<uint8_t>(schema_detail.begin(), schema_detail.end()), {}, &j));
+      (*detail_ptr)->emplace_back(std::move(j));
     }
   }
   return Status::OK();
@@ -535,6 +537,7 @@ Status ShardIndexGenerator::WriteToDatabase() {
   page_size_ = shard_header_.GetPageSize();
   header_size_ = shard_header_.GetHeaderSize();
   schema_count_ = shard_header_.GetSchemaCount();
+  shard_column_ = std::make_shared<ShardColumn>(shard_header_.GetSchemas()[0]->GetSchema());
   CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_header_.GetShardCount() <= kMaxShardCount,
                                   "[Internal ERROR] 'shard_count': " + std::to_string(shard_header_.GetShardCount()) +
                                     "is not in range (0, " + std::to_string(kMaxShardCount) + "].");
@@ -563,6 +566,8 @@ Status ShardIndexGenerator::WriteToDatabase() {
 void ShardIndexGenerator::DatabaseWriter() {
   int shard_no = task_++;
   while (shard_no < shard_header_.GetShardCount()) {
+    // a sorted index of the old database must not outlive it
+    (void)std::remove((shard_header_.GetShardAddressByID(shard_no) + kSortedIndexSuffix).c_str());
     sqlite3 *db = nullptr;
     if (CreateDatabase(shard_no, &db).IsError()) {
       write_success_ = false;
@@ -592,9 +597,44 @@ void ShardIndexGenerator::DatabaseWriter() {
       return;
     }
     MS_LOG(INFO) << "Generate index db for shard: " << shard_no << " successfully.";
+    // the sorted index only speeds up opening, the reader falls back to the database without it
+    auto rc = ShardSortedIndex::ConvertFromDatabase(shard_header_.GetShardAddressByID(shard_no));
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << "Failed to generate sorted index for shard: " << shard_no << ", " << rc.ToString();
+    }
     shard_no = task_++;
   }
 }
+Status ShardIndexGenerator::ConvertToSortedIndex() {
+  task_ = 0;
+  write_success_ = true;
+  const unsigned int num_workers =
+    std::min(std::thread::hardware_concurrency() / 2 + 1, static_cast<unsigned int>(shard_header_.GetShardCount()));
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers);
+  for (size_t t = 0; t < threads.capacity(); t++) {
+    threads.emplace_back(std::thread(&ShardIndexGenerator::SortedIndexConverter, this));
+  }
+  for (size_t t = 0; t < threads.capacity(); t++) {
+    threads[t].join();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(write_success_, "Failed to convert mindrecord meta files to sorted index files.");
+  return Status::OK();
+}
+
+void ShardIndexGenerator::SortedIndexConverter() {
+  int shard_no = task_++;
+  while (shard_no < shard_header_.GetShardCount()) {
+    auto rc = ShardSortedIndex::ConvertFromDatabase(shard_header_.GetShardAddressByID(shard_no));
+    if (rc.IsError()) {
+      MS_LOG(ERROR) << "Failed to convert meta file of shard: " << shard_no << ", " << rc.ToString();
+      write_success_ = false;
+      return;
+    }
+    shard_no = task_++;
+  }
+}
+
 Status ShardIndexGenerator::Finalize(const std::vector<std::string> file_names) {
   CHECK_FAIL_RETURN_UNEXPECTED_MR(!file_names.empty(), "[Internal ERROR] the size of mindrecord files is 0.");
   ShardIndexGenerator sg{file_names[0]};
@@ -76,6 +76,9 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
   } else {
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] The values of 'load_dataset' and 'file_paths' are not as expected.");
   }
+  // the meta files are not opened when all the mindrecord files have sorted index files
+  bool use_sorted_index = std::all_of(file_paths_.begin(), file_paths_.end(),
+                                      [](const std::string &file) { return ShardSortedIndex::Exists(file); });
   for (const auto &file : file_paths_) {
     auto meta_data_ptr = std::make_shared<json>();
     RETURN_IF_NOT_OK_MR(GetMeta(file, meta_data_ptr, &addresses_ptr));
@@ -84,7 +87,9 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
       "Invalid file, the metadata of mindrecord file: " + file +
         " is different from others, please make sure all the mindrecord files generated by the same script.");
     sqlite3 *db = nullptr;
-    RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    if (!use_sorted_index) {
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    }
     database_paths_.push_back(db);
   }
   ShardHeader sh = ShardHeader();
@@ -101,6 +106,15 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
   num_rows_ = 0;
   auto row_group_summary = ReadRowGroupSummary();
 
+  if (use_sorted_index) {
+    auto rc = LoadSortedIndexes();
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << "Failed to load sorted index files, read the meta files instead. " << rc.ToString();
+      sorted_indexes_.clear();
+      RETURN_IF_NOT_OK_MR(OpenDatabases());
+    }
+  }
+
   // clear the shard_sample_count_, because it will be insert when Launch func
   shard_sample_count_.clear();
 
@@ -169,6 +183,56 @@ Status ShardReader::VerifyDataset(sqlite3 **db, const string &file) {
   return Status::OK();
 }
 
+Status ShardReader::OpenDatabases() {
+  for (size_t i = 0; i < file_paths_.size() && i < database_paths_.size(); ++i) {
+    if (database_paths_[i] == nullptr) {
+      sqlite3 *db = nullptr;
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file_paths_[i]));
+      database_paths_[i] = db;
+    }
+  }
+  return Status::OK();
+}
+
+Status ShardReader::LoadSortedIndexes() {
+  size_t shard_count = file_paths_.size();
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_sample_count_.size() == shard_count,
+                                  "[Internal ERROR] The number of samples in mindrecord files is unknown.");
+  std::vector<std::shared_ptr<ShardSortedIndex>> indexes(shard_count);
+  std::vector<Status> rets(shard_count);
+  std::atomic<size_t> next_shard{0};
+  auto load = [this, shard_count, &indexes, &rets, &next_shard]() {
+    for (auto i = next_shard++; i < shard_count; i = next_shard++) {
+      rets[i] = ShardSortedIndex::Load(file_paths_[i], &indexes[i]);
+    }
+  };
+  size_t num_workers = std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)), shard_count);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_workers; ++i) {
+    threads.emplace_back(load);
+  }
+  load();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < shard_count; ++i) {
+    RETURN_IF_NOT_OK_MR(rets[i]);
+    std::shared_ptr<std::string> fn_ptr;
+    RETURN_IF_NOT_OK_MR(GetFileName(file_paths_[i], &fn_ptr));
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(indexes[i]->GetShardName() == *fn_ptr,
+                                    "Invalid file, sorted index file: " + file_paths_[i] + kSortedIndexSuffix +
+                                      " and mindrecord file: " + file_paths_[i] + " can not match.");
+    uint64_t num_rows = shard_sample_count_[i] - (i == 0 ? 0 : shard_sample_count_[i - 1]);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(indexes[i]->GetRowCount() == num_rows,
+                                    "Invalid file, the number of samples in sorted index file: " + file_paths_[i] +
+                                      kSortedIndexSuffix + " is different from the mindrecord file.");
+  }
+  sorted_indexes_ = std::move(indexes);
+  MS_LOG(INFO) << "Succeed to load sorted index files of " << shard_count << " mindrecord files.";
+  return Status::OK();
+}
+
 Status ShardReader::CheckColumnList(const std::vector<std::string> &selected_columns) {
   auto schema_ptr = GetShardHeader()->GetSchemas()[0];
   auto schema = schema_ptr->GetSchema()["schema"];
@@ -414,18 +478,13 @@ Status ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::string
           fs->close();
           RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
         }
-        json label_json = json::from_msgpack(label_raw);
         json tmp;
-        if (!columns.empty()) {
-          for (const auto &col : columns) {
-            if (label_json.find(col) != label_json.end()) {
-              tmp[col] = label_json[col];
-            }
-          }
-        } else {
-          tmp = label_json;
+        auto rc = shard_column_->DecodeRawRow(label_raw, columns, &tmp);
+        if (rc.IsError()) {
+          fs->close();
+          return rc;
         }
-        (*col_val_ptr)[shard_id].emplace_back(tmp);
+        (*col_val_ptr)[shard_id].emplace_back(std::move(tmp));
       } else {
         json construct_json;
         RETURN_IF_NOT_OK_MR(ConvertJsonValue(labels[i], columns, schema, &construct_json));
@@ -466,6 +525,62 @@ Status ShardReader::ConvertJsonValue(const std::vector<std::string> &label, cons
   }
   return Status::OK();
 }
+Status ShardReader::ReadRowsFromSortedIndex(int shard_id, uint64_t row_begin, uint64_t row_end,
+                                            const std::vector<std::string> &columns,
+                                            std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
+                                            std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
+  const auto &index = sorted_indexes_[shard_id];
+  row_end = std::min(row_end, index->GetRowCount());
+  std::vector<int> field_ids;
+  if (all_in_index_) {
+    for (const auto &column : columns) {
+      auto it = column_schema_id_.find(column);
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(it != column_schema_id_.end(),
+                                      "[Internal ERROR] 'column': " + column + " can not found in index fields.");
+      std::shared_ptr<std::string> fn_ptr;
+      RETURN_IF_NOT_OK_MR(ShardIndexGenerator::GenerateFieldName(std::make_pair(it->second, column), &fn_ptr));
+      auto field_id = index->GetFieldId(*fn_ptr);
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(field_id >= 0, "[Internal ERROR] 'column': " + column +
+                                                       " can not found in sorted index of shard " +
+                                                       std::to_string(shard_id));
+      field_ids.push_back(field_id);
+    }
+  }
+
+  // the same columns as the sql in ReadAllRowGroup
+  std::vector<std::vector<std::string>> labels;
+  for (auto row_id = row_begin; row_id < row_end; ++row_id) {
+    auto row = index->GetRow(row_id);
+    std::vector<std::string> label{std::to_string(row.row_group_id), std::to_string(row.page_offset_blob),
+                                   std::to_string(row.page_offset_blob_end)};
+    if (all_in_index_) {
+      for (auto field_id : field_ids) {
+        label.push_back(index->GetValue(field_id, row_id));
+      }
+    } else {
+      label.push_back(std::to_string(row.page_id_raw));
+      label.push_back(std::to_string(row.page_offset_raw));
+      label.push_back(std::to_string(row.page_offset_raw_end));
+    }
+    labels.push_back(std::move(label));
+  }
+
+  std::shared_ptr<std::fstream> fs = std::make_shared<std::fstream>();
+  if (!all_in_index_) {
+    std::string file_name = file_paths_[shard_id];
+    auto realpath = FileUtils::GetRealPath(file_name.c_str());
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      realpath.has_value(),
+      "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file_name);
+    fs->open(realpath.value(), std::ios::in | std::ios::binary);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(fs->good(),
+                                    "Invalid file, failed to open files for reading mindrecord files. Please check "
+                                    "file path, permission and open files limit(ulimit -a): " +
+                                      file_name);
+  }
+  return ConvertLabelToJson(labels, fs, offset_ptr, shard_id, columns, col_val_ptr);
+}
+
 Status ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
                                        std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                                        std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
@@ -521,6 +636,10 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   std::shared_ptr<std::string> fn_ptr;
   RETURN_IF_NOT_OK_MR(
     ShardIndexGenerator::GenerateFieldName(std::make_pair(index_columns[category_field], category_field), &fn_ptr));
+  if (!sorted_indexes_.empty()) {
+    GetClassesFromSortedIndex(*fn_ptr, category_ptr);
+    return Status::OK();
+  }
   std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
@@ -533,6 +652,16 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   return Status::OK();
 }
 
+void ShardReader::GetClassesFromSortedIndex(const std::string &field_name,
+                                            std::shared_ptr<std::set<std::string>> category_ptr) {
+  for (const auto &index : sorted_indexes_) {
+    auto field_id = index->GetFieldId(field_name);
+    if (field_id >= 0) {
+      index->GetDistinctValues(field_id, category_ptr.get());
+    }
+  }
+}
+
 void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
                                     std::shared_ptr<std::set<std::string>> category_ptr) {
   if (db == nullptr) {
@@ -582,7 +711,13 @@ Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
 
   std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x] = std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, offset_ptr, col_val_ptr);
+    if (!sorted_indexes_.empty()) {
+      thread_read_db[x] = std::thread(&ShardReader::ReadRowsFromSortedIndex, this, x, 0,
+                                      std::numeric_limits<uint64_t>::max(), columns, offset_ptr, col_val_ptr);
+    } else {
+      thread_read_db[x] =
+        std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, offset_ptr, col_val_ptr);
+    }
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -614,7 +749,11 @@ Status ShardReader::ReadRowGroupByShardIDAndSampleID(const std::vector<std::stri
 
   std::string sql = "SELECT " + fields + " FROM INDEXES WHERE ROW_ID = " + std::to_string(sample_id);
 
-  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, sql, columns, offset_ptr, col_val_ptr));
+  if (!sorted_indexes_.empty()) {
+    RETURN_IF_NOT_OK_MR(ReadRowsFromSortedIndex(shard_id, sample_id, sample_id + 1, columns, offset_ptr, col_val_ptr));
+  } else {
+    RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, sql, columns, offset_ptr, col_val_ptr));
+  }
   *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
   return Status::OK();
 }
@@ -658,6 +797,18 @@ Status ShardReader::ReadRowGroupCriteria(int group_id, int shard_id,
   return Status::OK();
 }
 
+Status ShardReader::ReadRowGroupColumn(int group_id, int shard_id, const std::string &column,
+                                       std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes,
+                                       ColumnDataType *column_data_type) {
+  std::shared_ptr<Page> page_ptr;
+  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, shard_id, &page_ptr));
+  std::vector<std::vector<std::string>> label_offsets;
+  RETURN_IF_NOT_OK_MR(GetLabelOffsetsInPage(page_ptr->GetPageID(), shard_id, {"", ""}, &label_offsets));
+  std::vector<std::vector<uint8_t>> raw_rows;
+  RETURN_IF_NOT_OK_MR(ReadRawRowsFromBinaryFile(shard_id, label_offsets, &raw_rows));
+  return shard_column_->DecodeRawColumn(raw_rows, column, data_ptr, n_bytes, column_data_type);
+}
+
 int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, char **p_col_names) {
   auto *records = static_cast<std::vector<std::vector<std::string>> *>(p_data);
   if (num_fields > 0 && num_fields <= kMaxFieldCount) {
@@ -671,88 +822,121 @@ int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, c
   return 0;
 }
 
+std::vector<uint64_t> ShardReader::GetRowsInPage(int page_id, int shard_id,
+                                                 const std::pair<std::string, std::string> &criteria) {
+  // page_id -1 matches all the pages
+  const auto &index = sorted_indexes_[shard_id];
+  auto in_page = [&index, page_id](uint64_t row_id) {
+    return page_id < 0 || index->GetRow(row_id).page_id_blob == static_cast<uint64_t>(page_id);
+  };
+  std::vector<uint64_t> row_ids;
+  if (criteria.first.empty()) {
+    for (uint64_t row_id = 0; row_id < index->GetRowCount(); ++row_id) {
+      if (in_page(row_id)) {
+        row_ids.push_back(row_id);
+      }
+    }
+    return row_ids;
+  }
+  auto field_id = index->GetFieldId(criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]));
+  if (field_id < 0) {
+    MS_LOG(ERROR) << "[Internal ERROR] 'field': " << criteria.first << " can not found in sorted index of shard "
+                  << shard_id;
+    return row_ids;
+  }
+  for (auto row_id : index->FindRows(field_id, criteria.second)) {
+    if (in_page(row_id)) {
+      row_ids.push_back(row_id);
+    }
+  }
+  return row_ids;
+}
+
 std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int shard_id,
                                                                const std::pair<std::string, std::string> &criteria) {
+  if (!sorted_indexes_.empty()) {
+    std::vector<std::vector<uint64_t>> res;
+    for (auto row_id : GetRowsInPage(page_id, shard_id, criteria)) {
+      auto row = sorted_indexes_[shard_id]->GetRow(row_id);
+      res.emplace_back(std::vector<uint64_t>{row.page_offset_blob + kInt64Len, row.page_offset_blob_end});
+    }
+    return res;
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql =
     "SELECT PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
 
   // whether use index search
+  auto image_offsets = std::make_shared<std::vector<std::vector<std::string>>>();
   if (!criteria.first.empty()) {
-    auto schema = shard_header_->GetSchemas()[0]->GetSchema();
-
-    // not number field should add '' in sql
-    if (kNumberFieldTypeSet.find(schema["schema"][criteria.first]["type"]) != kNumberFieldTypeSet.end()) {
-      sql +=
-        " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + criteria.second;
-    } else {
-      sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = '" +
-             criteria.second + "'";
+    sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
+    auto rc = QueryWithCriteria(db, sql, criteria, image_offsets);
+    if (rc.IsError()) {
+      MS_LOG(ERROR) << rc.ToString();
+      return std::vector<std::vector<uint64_t>>();
     }
-  }
-  sql += ";";
-  std::vector<std::vector<std::string>> image_offsets;
-  char *errmsg = nullptr;
-  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &image_offsets, &errmsg);
-  if (rc != SQLITE_OK) {
-    MS_LOG(ERROR) << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
-                  << " ] while reading meta file, " << errmsg;
-    sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
-    return std::vector<std::vector<uint64_t>>();
   } else {
-    MS_LOG(DEBUG) << "Succeed to get " << image_offsets.size() << " records from index.";
+    sql += ";";
+    char *errmsg = nullptr;
+    int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, image_offsets.get(), &errmsg);
+    if (rc != SQLITE_OK) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
+                    << " ] while reading meta file, " << errmsg;
+      sqlite3_free(errmsg);
+      sqlite3_close(db);
+      db = nullptr;
+      return std::vector<std::vector<uint64_t>>();
+    }
+    sqlite3_free(errmsg);
   }
+  MS_LOG(DEBUG) << "Succeed to get " << image_offsets->size() << " records from index.";
   std::vector<std::vector<uint64_t>> res;
-  for (int i = static_cast<int>(image_offsets.size()) - 1; i >= 0; i--) {
-    res.emplace_back(std::vector<uint64_t>{0, 0});
+  for (const auto &image_offset : *image_offsets) {
+    res.emplace_back(std::vector<uint64_t>{std::stoull(image_offset[0]) + kInt64Len, std::stoull(image_offset[1])});
   }
-  for (int i = 0; i < static_cast<int>(image_offsets.size()); i++) {
-    const auto &image_offset = image_offsets[i];
-    res[i][0] = std::stoull(image_offset[0]) + kInt64Len;
-    res[i][1] = std::stoull(image_offset[1]);
-  }
-  sqlite3_free(errmsg);
   return res;
 }
 
 Status ShardReader::GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                                        std::shared_ptr<std::vector<uint64_t>> *pages_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(pages_ptr);
+  if (!sorted_indexes_.empty()) {
+    std::set<uint64_t> page_ids;
+    for (auto row_id : GetRowsInPage(-1, shard_id, criteria)) {
+      auto page_id = sorted_indexes_[shard_id]->GetRow(row_id).page_id_blob;
+      if (page_ids.insert(page_id).second) {
+        (*pages_ptr)->emplace_back(page_id);
+      }
+    }
+    return Status::OK();
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql = "SELECT DISTINCT PAGE_ID_BLOB FROM INDEXES WHERE 1 = 1 ";
 
+  auto page_ids = std::make_shared<std::vector<std::vector<std::string>>>();
   if (!criteria.first.empty()) {
-    auto schema = shard_header_->GetSchemas()[0]->GetSchema();
-    if (kNumberFieldTypeSet.find(schema["schema"][criteria.first]["type"]) != kNumberFieldTypeSet.end()) {
-      sql +=
-        " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + criteria.second;
-    } else {
-      sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = '" +
-             criteria.second + "'";
+    sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
+    RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria, page_ids));
+  } else {
+    sql += ";";
+    char *errmsg = nullptr;
+    int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, page_ids.get(), &errmsg);
+    if (rc != SQLITE_OK) {
+      string ss(errmsg);
+      sqlite3_free(errmsg);
+      sqlite3_close(db);
+      db = nullptr;
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to execute the sql [ " + sql +
+                                  " ] while reading meta file, " + ss);
     }
-  }
-  sql += ";";
-  std::vector<std::vector<std::string>> page_ids;
-  char *errmsg = nullptr;
-  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &page_ids, &errmsg);
-  if (rc != SQLITE_OK) {
-    string ss(errmsg);
     sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to execute the sql [ " + sql + " ] while reading meta file, " +
-                                ss);
-  } else {
-    MS_LOG(DEBUG) << "Succeed to get " << page_ids.size() << "pages from index.";
   }
-  for (int i = 0; i < static_cast<int>(page_ids.size()); ++i) {
-    (*pages_ptr)->emplace_back(std::stoull(page_ids[i][0]));
+  MS_LOG(DEBUG) << "Succeed to get " << page_ids->size() << "pages from index.";
+  for (const auto &page_id : *page_ids) {
+    (*pages_ptr)->emplace_back(std::stoull(page_id[0]));
   }
-  sqlite3_free(errmsg);
   return Status::OK();
 }
 
@@ -784,19 +968,51 @@ void ShardReader::CheckIfColumnInIndex(const std::vector<std::string> &columns)
   }
 }
 
-Status ShardReader::QueryWithCriteria(sqlite3 *db, const string &sql, const string &criteria,
+Status ShardReader::QueryWithCriteria(sqlite3 *db, const string &sql,
+                                      const std::pair<std::string, std::string> &criteria,
                                       std::shared_ptr<std::vector<std::vector<std::string>>> labels_ptr) {
   sqlite3_stmt *stmt = nullptr;
   if (sqlite3_prepare_v2(db, common::SafeCStr(sql), -1, &stmt, 0) != SQLITE_OK) {
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to prepare statement [ " + sql + " ].");
   }
   int index = sqlite3_bind_parameter_index(stmt, ":criteria");
-  if (sqlite3_bind_text(stmt, index, common::SafeCStr(criteria), -1, SQLITE_STATIC) != SQLITE_OK) {
+  const auto &value = criteria.second;
+  // bind a number to a numeric field, so it is compared by number. A value which is not a number is bound as text,
+  // which never equals the numbers stored in the field.
+  std::string field_type;
+  try {
+    field_type = shard_header_->GetSchemas()[0]->GetSchema()["schema"][criteria.first]["type"];
+  } catch (std::exception &) {
+    MS_LOG(WARNING) << "Failed to get the type of field: " << criteria.first << ", its criteria is bound as text.";
+  }
+  int rc = SQLITE_ERROR;
+  if (kNumberFieldTypeSet.find(field_type) != kNumberFieldTypeSet.end()) {
+    size_t pos = 0;
+    try {
+      auto number = std::stoll(value, &pos);
+      if (pos == value.size() && (field_type == "int32" || field_type == "int64")) {
+        rc = sqlite3_bind_int64(stmt, index, number);
+      }
+    } catch (std::exception &) {
+    }
+    try {
+      auto number = std::stod(value, &pos);
+      if (rc != SQLITE_OK && pos == value.size()) {
+        rc = sqlite3_bind_double(stmt, index, number);
+      }
+    } catch (std::exception &) {
+    }
+  }
+  if (rc != SQLITE_OK) {
+    rc = sqlite3_bind_text(stmt, index, common::SafeCStr(value), -1, SQLITE_STATIC);
+  }
+  if (rc != SQLITE_OK) {
+    (void)sqlite3_finalize(stmt);
     RETURN_STATUS_UNEXPECTED_MR(
-      "[Internal ERROR] Failed to bind parameter of sql, key index: " + std::to_string(index) + ", value: " + criteria);
+      "[Internal ERROR] Failed to bind parameter of sql, key index: " + std::to_string(index) + ", value: " + value);
   }
-  int rc = sqlite3_step(stmt);
-  while (rc != SQLITE_DONE) {
+  rc = sqlite3_step(stmt);
+  while (rc == SQLITE_ROW) {
     vector<string> tmp;
     int ncols = sqlite3_column_count(stmt);
     for (int i = 0; i < ncols; i++) {
@@ -805,14 +1021,17 @@ Status ShardReader::QueryWithCriteria(sqlite3 *db, const string &sql, const stri
     labels_ptr->push_back(tmp);
     rc = sqlite3_step(stmt);
   }
+  if (rc != SQLITE_DONE) {
+    (void)sqlite3_finalize(stmt);
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to execute the sql [ " + sql + " ] while reading meta file.");
+  }
   (void)sqlite3_finalize(stmt);
   return Status::OK();
 }
 
-Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
-                                            const std::vector<std::vector<std::string>> &label_offsets,
-                                            std::shared_ptr<std::vector<json>> *labels_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
+Status ShardReader::ReadRawRowsFromBinaryFile(int shard_id, const std::vector<std::vector<std::string>> &label_offsets,
+                                              std::vector<std::vector<uint8_t>> *raw_rows) {
+  RETURN_UNEXPECTED_IF_NULL_MR(raw_rows);
   std::string file_name = file_paths_[shard_id];
   auto realpath = FileUtils::GetRealPath(file_name.c_str());
   CHECK_FAIL_RETURN_UNEXPECTED_MR(
@@ -825,11 +1044,8 @@ Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std:
                                   "Invalid file, failed to open files for reading mindrecord files. Please check file "
                                   "path, permission and open files limit(ulimit -a): " +
                                     file_name);
-  // init the return
-  for (unsigned int i = 0; i < label_offsets.size(); ++i) {
-    (*labels_ptr)->emplace_back(json{});
-  }
-
+  raw_rows->clear();
+  raw_rows->reserve(label_offsets.size());
   for (unsigned int i = 0; i < label_offsets.size(); ++i) {
     const auto &labelOffset = label_offsets[i];
     if (labelOffset.size() < 3) {
@@ -853,22 +1069,38 @@ Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std:
       fs->close();
       RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file, path: " + file_name);
     }
-
-    json label_json = json::from_msgpack(label_raw);
-    json tmp = label_json;
-    for (auto &col : columns) {
-      if (label_json.find(col) != label_json.end()) {
-        tmp[col] = label_json[col];
-      }
-    }
-    (*(*labels_ptr))[i] = tmp;
+    raw_rows->push_back(std::move(label_raw));
   }
+  fs->close();
   return Status::OK();
 }
-Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vector<std::string> &columns,
-                                      const std::pair<std::string, std::string> &criteria,
-                                      std::shared_ptr<std::vector<json>> *labels_ptr) {
+
+Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
+                                            const std::vector<std::vector<std::string>> &label_offsets,
+                                            std::shared_ptr<std::vector<json>> *labels_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
+  std::vector<std::vector<uint8_t>> raw_rows;
+  RETURN_IF_NOT_OK_MR(ReadRawRowsFromBinaryFile(shard_id, label_offsets, &raw_rows));
+  for (const auto &label_raw : raw_rows) {
+    json tmp;
+    RETURN_IF_NOT_OK_MR(shard_column_->DecodeRawRow(label_raw, {}, &tmp));
+    (*labels_ptr)->push_back(std::move(tmp));
+  }
+  return Status::OK();
+}
+
+Status ShardReader::GetLabelOffsetsInPage(int page_id, int shard_id,
+                                          const std::pair<std::string, std::string> &criteria,
+                                          std::vector<std::vector<std::string>> *label_offsets) {
+  RETURN_UNEXPECTED_IF_NULL_MR(label_offsets);
+  if (!sorted_indexes_.empty()) {
+    for (auto row_id : GetRowsInPage(page_id, shard_id, criteria)) {
+      auto row = sorted_indexes_[shard_id]->GetRow(row_id);
+      label_offsets->push_back({std::to_string(row.page_id_raw), std::to_string(row.page_offset_raw),
+                                std::to_string(row.page_offset_raw_end)});
+    }
+    return Status::OK();
+  }
   // get page info from sqlite
   auto db = database_paths_[shard_id];
   std::string sql = "SELECT PAGE_ID_RAW, PAGE_OFFSET_RAW,PAGE_OFFSET_RAW_END FROM INDEXES WHERE PAGE_ID_BLOB = " +
@@ -876,7 +1108,7 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
   auto label_offset_ptr = std::make_shared<std::vector<std::vector<std::string>>>();
   if (!criteria.first.empty()) {
     sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
-    RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, label_offset_ptr));
+    RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria, label_offset_ptr));
   } else {
     sql += ";";
     char *errmsg = nullptr;
@@ -893,8 +1125,18 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
     MS_LOG(DEBUG) << "Succeed to get " << label_offset_ptr->size() << " records from index.";
     sqlite3_free(errmsg);
   }
+  *label_offsets = std::move(*label_offset_ptr);
+  return Status::OK();
+}
+
+Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vector<std::string> &columns,
+                                      const std::pair<std::string, std::string> &criteria,
+                                      std::shared_ptr<std::vector<json>> *labels_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
+  std::vector<std::vector<std::string>> label_offsets;
+  RETURN_IF_NOT_OK_MR(GetLabelOffsetsInPage(page_id, shard_id, criteria, &label_offsets));
   // get labels from binary file
-  return GetLabelsFromBinaryFile(shard_id, columns, *label_offset_ptr, labels_ptr);
+  return GetLabelsFromBinaryFile(shard_id, columns, label_offsets, labels_ptr);
 }
 
 Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::string> &columns,
@@ -916,9 +1158,26 @@ Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::
     }
     auto labels = std::make_shared<std::vector<std::vector<std::string>>>();
     std::string sql = "SELECT " + fields + " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
-    if (!criteria.first.empty()) {
+    if (!sorted_indexes_.empty()) {
+      const auto &index = sorted_indexes_[shard_id];
+      std::vector<int> field_ids;
+      for (const auto &column : columns) {
+        auto field_id = index->GetFieldId(column + "_" + std::to_string(column_schema_id_[column]));
+        CHECK_FAIL_RETURN_UNEXPECTED_MR(field_id >= 0, "[Internal ERROR] 'column': " + column +
+                                                         " can not found in sorted index of shard " +
+                                                         std::to_string(shard_id));
+        field_ids.push_back(field_id);
+      }
+      for (auto row_id : GetRowsInPage(page_id, shard_id, criteria)) {
+        std::vector<std::string> label;
+        for (auto field_id : field_ids) {
+          label.push_back(index->GetValue(field_id, row_id));
+        }
+        labels->push_back(std::move(label));
+      }
+    } else if (!criteria.first.empty()) {
       sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + ":criteria";
-      RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, labels));
+      RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria, labels));
     } else {
       sql += ";";
       char *errmsg = nullptr;
@@ -986,9 +1245,13 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   std::shared_ptr<std::string> fn_ptr;
   (void)ShardIndexGenerator::GenerateFieldName(std::make_pair(map_schema_id_fields[category_field], category_field),
                                                &fn_ptr);
+  auto category_ptr = std::make_shared<std::set<std::string>>();
+  if (!sorted_indexes_.empty()) {
+    GetClassesFromSortedIndex(*fn_ptr, category_ptr);
+    return category_ptr->size();
+  }
   std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count);
-  auto category_ptr = std::make_shared<std::set<std::string>>();
   sqlite3 *db = nullptr;
   for (int x = 0; x < shard_count; x++) {
     std::string path_utf8 = "";
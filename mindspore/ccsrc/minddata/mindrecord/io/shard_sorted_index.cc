@@ -0,0 +1,522 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_sorted_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include "utils/file_utils.h"
+#include "utils/ms_utils.h"
+#include "./sqlite3.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+const char kSortedIndexMagic[] = "MRSORTIX";
+const uint64_t kSortedIndexFormatVersion = 2;
+const uint64_t kSortedIndexAlign = sizeof(uint64_t);
+const uint64_t kRowWords = sizeof(SortedIndexRow) / sizeof(uint64_t);
+// ROW_ID and the columns of SortedIndexRow
+const uint64_t kFixedColumnCount = 1 + kRowWords;
+
+class IndexWriter {
+ public:
+  explicit IndexWriter(std::ofstream *out) : out_(out) {}
+
+  void WriteWord(uint64_t value) { (void)out_->write(reinterpret_cast<const char *>(&value), sizeof(value)); }
+
+  void WriteWords(const uint64_t *values, uint64_t count) {
+    (void)out_->write(reinterpret_cast<const char *>(values), static_cast<std::streamsize>(count * sizeof(uint64_t)));
+  }
+
+  // length followed by the bytes padded to 8 bytes
+  void WriteBytes(const std::string &bytes) {
+    WriteWord(bytes.size());
+    (void)out_->write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    Pad(bytes.size());
+  }
+
+  void Pad(uint64_t size) {
+    static const char zeros[kSortedIndexAlign] = {0};
+    auto remain = size % kSortedIndexAlign;
+    if (remain != 0) {
+      (void)out_->write(zeros, static_cast<std::streamsize>(kSortedIndexAlign - remain));
+    }
+  }
+
+ private:
+  std::ofstream *out_;
+};
+
+class IndexParser {
+ public:
+  IndexParser(const uint64_t *words, uint64_t word_count) : words_(words), word_count_(word_count) {}
+
+  bool ReadWord(uint64_t *value) {
+    if (pos_ >= word_count_) {
+      return false;
+    }
+    *value = words_[pos_++];
+    return true;
+  }
+
+  bool ReadWords(uint64_t count, const uint64_t **values) {
+    if (count > word_count_ - pos_) {
+      return false;
+    }
+    *values = words_ + pos_;
+    pos_ += count;
+    return true;
+  }
+
+  bool ReadBytes(uint64_t size, const char **bytes) {
+    uint64_t count = (size + kSortedIndexAlign - 1) / kSortedIndexAlign;
+    const uint64_t *values = nullptr;
+    if (!ReadWords(count, &values)) {
+      return false;
+    }
+    *bytes = reinterpret_cast<const char *>(values);
+    return true;
+  }
+
+  bool ReadString(std::string *str) {
+    uint64_t size = 0;
+    const char *bytes = nullptr;
+    if (!ReadWord(&size) || !ReadBytes(size, &bytes)) {
+      return false;
+    }
+    str->assign(bytes, size);
+    return true;
+  }
+
+  bool Finished() const { return pos_ == word_count_; }
+
+ private:
+  const uint64_t *words_;
+  uint64_t word_count_;
+  uint64_t pos_ = 0;
+};
+
+bool ParseReal(const std::string &text, double *value) {
+  try {
+    size_t pos = 0;
+    auto result = std::stod(text, &pos);
+    if (pos == text.size()) {
+      *value = result;
+      return true;
+    }
+  } catch (std::exception &) {
+  }
+  return false;
+}
+
+// an integer field also matches a real value without fraction, like sqlite compares them
+bool ParseInteger(const std::string &text, int64_t *value) {
+  try {
+    size_t pos = 0;
+    auto result = std::stoll(text, &pos);
+    if (pos == text.size()) {
+      *value = result;
+      return true;
+    }
+  } catch (std::exception &) {
+  }
+  double real = 0;
+  // the upper bound 2^63 is not an int64
+  const auto bound = -static_cast<double>(std::numeric_limits<int64_t>::min());
+  if (!ParseReal(text, &real) || std::trunc(real) != real || real < -bound || real >= bound) {
+    return false;
+  }
+  *value = static_cast<int64_t>(real);
+  return true;
+}
+
+// the key of a numeric value is the bits of its int64 or double
+bool ParseKey(SortedIndexFieldType type, const std::string &text, uint64_t *key) {
+  if (type == SortedIndexFieldType::kInteger) {
+    int64_t value = 0;
+    if (!ParseInteger(text, &value)) {
+      return false;
+    }
+    *key = static_cast<uint64_t>(value);
+    return true;
+  }
+  double value = 0;
+  if (!ParseReal(text, &value)) {
+    return false;
+  }
+  (void)memcpy(key, &value, sizeof(value));
+  return true;
+}
+
+// the declared type of an index field, see kDbJsonMap
+SortedIndexFieldType GetFieldType(const std::string &sql_type) {
+  if (sql_type == "INTEGER") {
+    return SortedIndexFieldType::kInteger;
+  }
+  if (sql_type == "NUMERIC") {
+    return SortedIndexFieldType::kReal;
+  }
+  return SortedIndexFieldType::kText;
+}
+
+std::string GetDatabasePath(const std::string &file) {
+  std::string path_utf8 = "";
+#if defined(_WIN32) || defined(_WIN64)
+  path_utf8 = FileUtils::GB2312ToUTF_8((file + ".db").data());
+#endif
+  if (path_utf8.empty()) {
+    path_utf8 = file + ".db";
+  }
+  return path_utf8;
+}
+
+Status QueryDatabase(sqlite3 *db, const std::string &sql, std::vector<std::vector<std::string>> *records) {
+  auto callback = [](void *p_data, int num_fields, char **p_fields, char **) -> int {
+    auto *result = static_cast<std::vector<std::vector<std::string>> *>(p_data);
+    std::vector<std::string> record;
+    for (int i = 0; i < num_fields; ++i) {
+      record.emplace_back(p_fields[i] == nullptr ? "" : p_fields[i]);
+    }
+    result->emplace_back(std::move(record));
+    return 0;
+  };
+  char *errmsg = nullptr;
+  if (sqlite3_exec(db, common::SafeCStr(sql), callback, records, &errmsg) != SQLITE_OK) {
+    std::string msg = errmsg == nullptr ? "" : errmsg;
+    sqlite3_free(errmsg);
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to execute the sql [ " + sql + " ] while reading meta file, " +
+                                msg);
+  }
+  return Status::OK();
+}
+
+Status ReadDatabase(sqlite3 *db, std::string *shard_name, std::vector<std::string> *fields,
+                    std::vector<SortedIndexFieldType> *field_types, std::vector<SortedIndexRow> *rows,
+                    std::vector<std::vector<std::string>> *field_values) {
+  std::vector<std::vector<std::string>> records;
+  RETURN_IF_NOT_OK_MR(QueryDatabase(db, "SELECT NAME from SHARD_NAME;", &records));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(!records.empty() && !records[0].empty(),
+                                  "[Internal ERROR] The shard name is not found in meta file.");
+  *shard_name = records[0][0];
+
+  // the index fields follow the fixed columns, each one after its INC_ column
+  records.clear();
+  RETURN_IF_NOT_OK_MR(QueryDatabase(db, "PRAGMA table_info(INDEXES);", &records));
+  for (uint64_t i = kFixedColumnCount + 1; i < records.size(); i += 2) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(records[i].size() > 2, "[Internal ERROR] Invalid table info of meta file.");
+    fields->push_back(records[i][1]);
+    field_types->push_back(GetFieldType(records[i][2]));
+  }
+
+  std::string sql =
+    "SELECT ROW_ID, ROW_GROUP_ID, PAGE_ID_BLOB, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END, PAGE_ID_RAW, PAGE_OFFSET_RAW, "
+    "PAGE_OFFSET_RAW_END";
+  for (const auto &field : *fields) {
+    sql += "," + field;
+  }
+  sql += " FROM INDEXES ORDER BY ROW_ID;";
+  records.clear();
+  RETURN_IF_NOT_OK_MR(QueryDatabase(db, sql, &records));
+
+  field_values->assign(fields->size(), std::vector<std::string>(records.size()));
+  rows->resize(records.size());
+  try {
+    for (uint64_t i = 0; i < records.size(); ++i) {
+      auto &record = records[i];
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(record.size() == kFixedColumnCount + fields->size(),
+                                      "[Internal ERROR] Invalid row in meta file.");
+      // rows are addressed by ROW_ID, which runs from 0 in every shard
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(std::stoull(record[0]) == i,
+                                      "[Internal ERROR] ROW_ID in meta file is not continuous: " + record[0]);
+      auto *words = reinterpret_cast<uint64_t *>(&(*rows)[i]);
+      for (uint64_t j = 0; j < kRowWords; ++j) {
+        words[j] = std::stoull(record[j + 1]);
+      }
+      for (uint64_t f = 0; f < fields->size(); ++f) {
+        (*field_values)[f][i] = std::move(record[kFixedColumnCount + f]);
+      }
+    }
+  } catch (std::exception &e) {
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Invalid row in meta file, " + std::string(e.what()));
+  }
+  return Status::OK();
+}
+}  // namespace
+
+Status ShardSortedIndex::Write(const std::string &file, const std::string &shard_name,
+                               const std::vector<std::string> &fields,
+                               const std::vector<SortedIndexFieldType> &field_types,
+                               const std::vector<SortedIndexRow> &rows,
+                               const std::vector<std::vector<std::string>> &field_values) {
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fields.size() == field_values.size() && fields.size() == field_types.size(),
+                                  "[Internal ERROR] The number of index fields, types and values are different.");
+  for (const auto &values : field_values) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(values.size() == rows.size(),
+                                    "[Internal ERROR] The number of rows and values are different.");
+  }
+  // parse the numeric values before anything is written
+  std::vector<std::vector<uint64_t>> field_keys(fields.size());
+  for (uint64_t f = 0; f < fields.size(); ++f) {
+    if (field_types[f] == SortedIndexFieldType::kText) {
+      continue;
+    }
+    field_keys[f].resize(rows.size());
+    for (uint64_t i = 0; i < rows.size(); ++i) {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(ParseKey(field_types[f], field_values[f][i], &field_keys[f][i]),
+                                      "[Internal ERROR] The value of numeric index field: " + fields[f] +
+                                        " is not a number: " + field_values[f][i]);
+    }
+  }
+  std::string path = file + kSortedIndexSuffix;
+  std::string tmp_path = path + ".tmp";
+  std::ofstream out(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(out.good(), "Invalid file, failed to open index file for writing: " + tmp_path);
+
+  IndexWriter writer(&out);
+  (void)out.write(kSortedIndexMagic, kSortedIndexAlign);
+  writer.WriteWord(kSortedIndexFormatVersion);
+  writer.WriteWord(rows.size());
+  writer.WriteWord(fields.size());
+  writer.WriteBytes(shard_name);
+  for (uint64_t f = 0; f < fields.size(); ++f) {
+    writer.WriteBytes(fields[f]);
+    writer.WriteWord(static_cast<uint64_t>(field_types[f]));
+  }
+  writer.WriteWords(reinterpret_cast<const uint64_t *>(rows.data()), rows.size() * kRowWords);
+
+  for (uint64_t f = 0; f < fields.size(); ++f) {
+    const auto &values = field_values[f];
+    const auto &keys = field_keys[f];
+    auto type = field_types[f];
+    std::vector<uint64_t> offsets(rows.size() + 1, 0);
+    for (uint64_t i = 0; i < values.size(); ++i) {
+      offsets[i + 1] = offsets[i] + values[i].size();
+    }
+    std::vector<uint64_t> sorted_rows(rows.size());
+    std::iota(sorted_rows.begin(), sorted_rows.end(), 0);
+    if (type == SortedIndexFieldType::kText) {
+      std::stable_sort(sorted_rows.begin(), sorted_rows.end(),
+                       [&values](uint64_t a, uint64_t b) { return values[a] < values[b]; });
+    } else {
+      std::stable_sort(sorted_rows.begin(), sorted_rows.end(),
+                       [&keys, type](uint64_t a, uint64_t b) { return CompareKey(type, keys[a], keys[b]) < 0; });
+    }
+    writer.WriteWords(offsets.data(), offsets.size());
+    writer.WriteWords(sorted_rows.data(), sorted_rows.size());
+    writer.WriteWords(keys.data(), keys.size());
+    writer.WriteWord(offsets.back());
+    for (const auto &value : values) {
+      (void)out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+    writer.Pad(offsets.back());
+  }
+  out.close();
+  if (!out.good()) {
+    (void)std::remove(tmp_path.c_str());
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to write index file: " + tmp_path);
+  }
+  // replace the old index only after the new one is complete
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    (void)std::remove(tmp_path.c_str());
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to rename index file: " + tmp_path);
+  }
+  return Status::OK();
+}
+
+Status ShardSortedIndex::ConvertFromDatabase(const std::string &file) {
+  // an index not matching the meta file must not be left behind
+  (void)std::remove((file + kSortedIndexSuffix).c_str());
+
+  sqlite3 *db = nullptr;
+  if (sqlite3_open_v2(GetDatabasePath(file).data(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+    sqlite3_close(db);
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to open mindrecord meta file: " + file + ".db");
+  }
+  std::string shard_name;
+  std::vector<std::string> fields;
+  std::vector<SortedIndexFieldType> field_types;
+  std::vector<SortedIndexRow> rows;
+  std::vector<std::vector<std::string>> field_values;
+  auto rc = ReadDatabase(db, &shard_name, &fields, &field_types, &rows, &field_values);
+  sqlite3_close(db);
+  RETURN_IF_NOT_OK_MR(rc);
+  RETURN_IF_NOT_OK_MR(Write(file, shard_name, fields, field_types, rows, field_values));
+  MS_LOG(INFO) << "Succeed to convert meta file to index file, path: " << file << kSortedIndexSuffix
+               << ", rows: " << rows.size();
+  return Status::OK();
+}
+
+bool ShardSortedIndex::Exists(const std::string &file) { return std::ifstream(file + kSortedIndexSuffix).good(); }
+
+Status ShardSortedIndex::Load(const std::string &file, std::shared_ptr<ShardSortedIndex> *index) {
+  RETURN_UNEXPECTED_IF_NULL_MR(index);
+  std::string path = file + kSortedIndexSuffix;
+  std::ifstream in(path, std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to open index file: " + path);
+  auto file_size = static_cast<uint64_t>(in.tellg());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(file_size % kSortedIndexAlign == 0,
+                                  "Invalid file, the size of index file is not aligned: " + path);
+  auto result = std::make_shared<ShardSortedIndex>();
+  uint64_t word_count = file_size / kSortedIndexAlign;
+  result->buffer_ = std::make_unique<uint64_t[]>(word_count);
+  (void)in.seekg(0, std::ios::beg);
+  (void)in.read(reinterpret_cast<char *>(result->buffer_.get()), static_cast<std::streamsize>(file_size));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to read index file: " + path);
+  in.close();
+
+  const std::string invalid_msg = "Invalid file, the index file is corrupted: " + path;
+  IndexParser parser(result->buffer_.get(), word_count);
+  const char *magic = nullptr;
+  uint64_t version = 0;
+  uint64_t field_count = 0;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadBytes(kSortedIndexAlign, &magic) &&
+                                    memcmp(magic, kSortedIndexMagic, kSortedIndexAlign) == 0,
+                                  invalid_msg);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadWord(&version) && version == kSortedIndexFormatVersion,
+                                  "Invalid file, the version of index file is not supported: " + path);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadWord(&result->row_count_) && parser.ReadWord(&field_count) &&
+                                    parser.ReadString(&result->shard_name_),
+                                  invalid_msg);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(field_count <= word_count, invalid_msg);
+  result->fields_.resize(field_count);
+  std::vector<uint64_t> field_types(field_count);
+  for (uint64_t i = 0; i < field_count; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadString(&result->fields_[i]) && parser.ReadWord(&field_types[i]) &&
+                                      field_types[i] <= static_cast<uint64_t>(SortedIndexFieldType::kReal),
+                                    invalid_msg);
+  }
+  auto row_count = result->row_count_;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(row_count <= word_count && parser.ReadWords(row_count * kRowWords, &result->rows_),
+                                  invalid_msg);
+  for (uint64_t i = 0; i < field_count; ++i) {
+    FieldSection section;
+    section.type = static_cast<SortedIndexFieldType>(field_types[i]);
+    section.keys = nullptr;
+    uint64_t pool_size = 0;
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadWords(row_count + 1, &section.value_offsets) &&
+                                      parser.ReadWords(row_count, &section.sorted_rows),
+                                    invalid_msg);
+    if (section.type != SortedIndexFieldType::kText) {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadWords(row_count, &section.keys), invalid_msg);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.ReadWord(&pool_size) && parser.ReadBytes(pool_size, &section.pool),
+                                    invalid_msg);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(section.value_offsets[row_count] == pool_size, invalid_msg);
+    for (uint64_t r = 0; r < row_count; ++r) {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(
+        section.value_offsets[r] <= section.value_offsets[r + 1] && section.sorted_rows[r] < row_count, invalid_msg);
+    }
+    result->sections_.push_back(section);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.Finished(), invalid_msg);
+  *index = result;
+  return Status::OK();
+}
+
+SortedIndexRow ShardSortedIndex::GetRow(uint64_t row_id) const {
+  SortedIndexRow row;
+  (void)memcpy(&row, rows_ + row_id * kRowWords, sizeof(row));
+  return row;
+}
+
+int ShardSortedIndex::GetFieldId(const std::string &field) const {
+  auto it = std::find(fields_.begin(), fields_.end(), field);
+  return it == fields_.end() ? -1 : static_cast<int>(it - fields_.begin());
+}
+
+std::string ShardSortedIndex::GetValue(int field_id, uint64_t row_id) const {
+  const auto &section = sections_[field_id];
+  auto begin = section.value_offsets[row_id];
+  return std::string(section.pool + begin, section.value_offsets[row_id + 1] - begin);
+}
+
+int ShardSortedIndex::CompareValue(const FieldSection &section, uint64_t row_id, const std::string &value) const {
+  auto begin = section.value_offsets[row_id];
+  auto size = section.value_offsets[row_id + 1] - begin;
+  int ret = memcmp(section.pool + begin, value.data(), std::min<uint64_t>(size, value.size()));
+  if (ret != 0) {
+    return ret;
+  }
+  return size < value.size() ? -1 : (size > value.size() ? 1 : 0);
+}
+
+int ShardSortedIndex::CompareKey(SortedIndexFieldType type, uint64_t lhs, uint64_t rhs) {
+  if (type == SortedIndexFieldType::kInteger) {
+    auto l = static_cast<int64_t>(lhs);
+    auto r = static_cast<int64_t>(rhs);
+    return l < r ? -1 : (l > r ? 1 : 0);
+  }
+  double l = 0;
+  double r = 0;
+  (void)memcpy(&l, &lhs, sizeof(l));
+  (void)memcpy(&r, &rhs, sizeof(r));
+  return l < r ? -1 : (l > r ? 1 : 0);
+}
+
+std::vector<uint64_t> ShardSortedIndex::FindRows(int field_id, const std::string &value) const {
+  const auto &section = sections_[field_id];
+  const uint64_t *first = section.sorted_rows;
+  const uint64_t *last = section.sorted_rows + row_count_;
+  if (section.type != SortedIndexFieldType::kText) {
+    uint64_t key = 0;
+    // a value which is not a number never equals a number
+    if (!ParseKey(section.type, value, &key)) {
+      return {};
+    }
+    auto type = section.type;
+    const uint64_t *keys = section.keys;
+    auto lower = std::lower_bound(first, last, key, [type, keys](uint64_t row_id, uint64_t k) {
+      return CompareKey(type, keys[row_id], k) < 0;
+    });
+    auto upper = std::upper_bound(lower, last, key, [type, keys](uint64_t k, uint64_t row_id) {
+      return CompareKey(type, keys[row_id], k) > 0;
+    });
+    return std::vector<uint64_t>(lower, upper);
+  }
+  auto lower = std::lower_bound(first, last, value, [this, &section](uint64_t row_id, const std::string &v) {
+    return CompareValue(section, row_id, v) < 0;
+  });
+  auto upper = std::upper_bound(lower, last, value, [this, &section](const std::string &v, uint64_t row_id) {
+    return CompareValue(section, row_id, v) > 0;
+  });
+  // rows with the same value are sorted by row id
+  return std::vector<uint64_t>(lower, upper);
+}
+
+void ShardSortedIndex::GetDistinctValues(int field_id, std::set<std::string> *values) const {
+  const auto &section = sections_[field_id];
+  std::string last;
+  for (uint64_t i = 0; i < row_count_; ++i) {
+    auto row_id = section.sorted_rows[i];
+    if (i > 0 && section.type != SortedIndexFieldType::kText) {
+      if (CompareKey(section.type, section.keys[row_id], section.keys[section.sorted_rows[i - 1]]) == 0) {
+        continue;
+      }
+    } else if (i > 0 && CompareValue(section, row_id, last) == 0) {
+      continue;
+    }
+    last = GetValue(field_id, row_id);
+    (void)values->emplace_hint(values->end(), last);
+  }
+}
+}  // namespace mindrecord
+}  // namespace mindspore
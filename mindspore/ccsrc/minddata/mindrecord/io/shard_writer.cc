@@ -18,12 +18,18 @@
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_sorted_index.h"
 #include "./securec.h"
 
 namespace mindspore {
 namespace mindrecord {
 ShardWriter::ShardWriter()
-    : shard_count_(1), header_size_(kDefaultHeaderSize), page_size_(kDefaultPageSize), row_count_(0), schema_count_(1) {
+    : shard_count_(1),
+      header_size_(kDefaultHeaderSize),
+      page_size_(kDefaultPageSize),
+      row_count_(0),
+      schema_count_(1),
+      typed_raw_data_(false) {
   compression_size_ = 0;
 }
 
@@ -103,6 +109,8 @@ Status ShardWriter::OpenDataFiles(bool append, bool overwrite) {
           if (res2 == 0) {
             MS_LOG(WARNING) << "Succeed to remove the old mindrecord metadata files, path: " << file + ".db";
           }
+          // the sorted index is generated again with the meta file
+          (void)std::remove((whole_path.value() + kSortedIndexSuffix).c_str());
         } else {
           RETURN_STATUS_UNEXPECTED_MR(
             "Invalid file, mindrecord files already exist. Please check file path: " + file +
@@ -187,6 +195,8 @@ Status ShardWriter::OpenForAppend(const std::string &path) {
   RETURN_IF_NOT_OK_MR(SetHeaderSize(shard_header_->GetHeaderSize()));
   RETURN_IF_NOT_OK_MR(SetPageSize(shard_header_->GetPageSize()));
   compression_size_ = shard_header_->GetCompressionSize();
+  // keep appending in the typed layout if the files are already written in it
+  typed_raw_data_ = shard_header_->GetVersion() == kTypedRawVersion;
   RETURN_IF_NOT_OK_MR(Open(*ds, true));
   shard_column_ = std::make_shared<ShardColumn>(shard_header_);
   return Status::OK();
@@ -266,6 +276,11 @@ Status ShardWriter::SetPageSize(const uint64_t &page_size) {
   return Status::OK();
 }
 
+Status ShardWriter::SetTypedRawData(bool typed_raw_data) {
+  typed_raw_data_ = typed_raw_data;
+  return Status::OK();
+}
+
 void ShardWriter::DeleteErrorData(std::map<uint64_t, std::vector<json>> &raw_data,
                                   std::vector<std::vector<uint8_t>> &blob_data) {
   // get wrong data location
@@ -481,7 +496,11 @@ void ShardWriter::FillArray(int start, int end, std::map<uint64_t, vector<json>>
     int cnt = 0;
     for (rawdata_iter = raw_data.begin(); rawdata_iter != raw_data.end(); ++rawdata_iter) {
       const json &line = raw_data.at(rawdata_iter->first)[x];
-      std::vector<std::uint8_t> bline = json::to_msgpack(line);
+      std::vector<std::uint8_t> bline;
+      // rows not matching the schema exactly fall back to msgpack
+      if (!typed_raw_data_ || !shard_column_->EncodeRawRow(line, &bline)) {
+        bline = json::to_msgpack(line);
+      }
 
       // Storage form is [Sample1-Schema1, Sample1-Schema2, Sample2-Schema1, Sample2-Schema2]
       bin_data[x * schema_count + cnt] = bline;
@@ -1058,6 +1077,9 @@ Status ShardWriter::WriteShardHeader() {
   int64_t compression_temp = compression_size_;
   uint64_t compression_size = compression_temp > 0 ? compression_temp : 0;
   shard_header_->SetCompressionSize(compression_size);
+  if (typed_raw_data_) {
+    shard_header_->SetVersion(kTypedRawVersion);
+  }
 
   auto shard_header = shard_header_->SerializeHeader();
   // Write header data to multi files
@@ -16,6 +16,9 @@
 
 #include "minddata/mindrecord/include/shard_column.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "utils/ms_utils.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_error.h"
@@ -68,6 +71,12 @@ void ShardColumn::Init(const json &schema_json, bool compress_integer) {
     blob_column_id_[blob_column_[i]] = i;
   }
 
+  for (uint64_t i = 0; i < column_name_.size(); i++) {
+    if (blob_column_id_.find(column_name_[i]) == blob_column_id_.end()) {
+      raw_column_id_.push_back(i);
+    }
+  }
+
   has_compress_blob_ = (compress_integer && has_integer_array);
   num_blob_column_ = blob_column_.size();
 }
@@ -267,6 +276,272 @@ Status ShardColumn::GetColumnFromBlob(const std::string &column_name, const std:
   return Status::OK();
 }
 
+namespace {
+// the numbers of the typed layout are little-endian whatever the byte order of the host
+template <size_t kSize>
+struct RawBits;
+template <>
+struct RawBits<sizeof(uint32_t)> {
+  using type = uint32_t;
+};
+template <>
+struct RawBits<sizeof(uint64_t)> {
+  using type = uint64_t;
+};
+
+template <typename T>
+void AppendRawValue(T value, std::vector<uint8_t> *bytes) {
+  typename RawBits<sizeof(T)>::type bits = 0;
+  (void)memcpy_s(&bits, sizeof(bits), &value, sizeof(T));
+  for (uint64_t i = 0; i < sizeof(T); i++) {
+    bytes->push_back(static_cast<uint8_t>(bits >> (i * kBitsOfByte)));
+  }
+}
+
+template <typename T>
+bool ReadRawValue(const std::vector<uint8_t> &bytes, uint64_t *pos, T *value) {
+  if (*pos + sizeof(T) > bytes.size()) {
+    return false;
+  }
+  typename RawBits<sizeof(T)>::type bits = 0;
+  for (uint64_t i = 0; i < sizeof(T); i++) {
+    bits |= static_cast<decltype(bits)>(bytes[*pos + i]) << (i * kBitsOfByte);
+  }
+  *pos += sizeof(T);
+  return memcpy_s(value, sizeof(T), &bits, sizeof(bits)) == EOK;
+}
+
+template <typename T>
+bool AppendRawInt(const json &value, std::vector<uint8_t> *bytes) {
+  if (!value.is_number_integer()) {
+    return false;
+  }
+  if (value.is_number_unsigned()) {
+    auto unsigned_value = value.get<uint64_t>();
+    if (unsigned_value > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+      return false;
+    }
+    AppendRawValue(static_cast<T>(unsigned_value), bytes);
+    return true;
+  }
+  auto signed_value = value.get<int64_t>();
+  if (signed_value < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+      signed_value > static_cast<int64_t>(std::numeric_limits<T>::max())) {
+    return false;
+  }
+  AppendRawValue(static_cast<T>(signed_value), bytes);
+  return true;
+}
+}  // namespace
+
+bool ShardColumn::EncodeRawRow(const json &row, std::vector<uint8_t> *bytes) const {
+  if (bytes == nullptr || raw_column_id_.empty() || !row.is_object() || row.size() != raw_column_id_.size()) {
+    return false;
+  }
+  bytes->clear();
+  bytes->push_back(kTypedRawRowMarker);
+  for (auto column_id : raw_column_id_) {
+    auto it = row.find(column_name_[column_id]);
+    if (it == row.end()) {
+      return false;
+    }
+    const auto &value = it.value();
+    switch (column_data_type_[column_id]) {
+      case ColumnInt32: {
+        if (!AppendRawInt<int32_t>(value, bytes)) {
+          return false;
+        }
+        break;
+      }
+      case ColumnInt64: {
+        if (!AppendRawInt<int64_t>(value, bytes)) {
+          return false;
+        }
+        break;
+      }
+      case ColumnFloat32: {
+        // narrowed to the schema type, as the float32 values in blob are
+        if (!value.is_number()) {
+          return false;
+        }
+        AppendRawValue(static_cast<float>(value.get<double>()), bytes);
+        break;
+      }
+      case ColumnFloat64: {
+        if (!value.is_number()) {
+          return false;
+        }
+        AppendRawValue(value.get<double>(), bytes);
+        break;
+      }
+      case ColumnString: {
+        if (!value.is_string()) {
+          return false;
+        }
+        const auto &str = value.get_ref<const std::string &>();
+        if (str.size() > std::numeric_limits<uint32_t>::max()) {
+          return false;
+        }
+        AppendRawValue(static_cast<uint32_t>(str.size()), bytes);
+        (void)bytes->insert(bytes->end(), str.begin(), str.end());
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+Status ShardColumn::DecodeRawRow(const std::vector<uint8_t> &bytes, const std::vector<std::string> &columns,
+                                 json *row) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(row);
+  if (bytes.empty() || bytes[0] != kTypedRawRowMarker) {
+    json label_json = json::from_msgpack(bytes);
+    if (columns.empty()) {
+      *row = std::move(label_json);
+      return Status::OK();
+    }
+    *row = json::object();
+    for (const auto &col : columns) {
+      auto it = label_json.find(col);
+      if (it != label_json.end()) {
+        (*row)[col] = std::move(it.value());
+      }
+    }
+    return Status::OK();
+  }
+
+  *row = json::object();
+  uint64_t pos = 1;
+  for (auto column_id : raw_column_id_) {
+    const auto &column_name = column_name_[column_id];
+    bool selected = columns.empty() || std::find(columns.begin(), columns.end(), column_name) != columns.end();
+    bool success = false;
+    switch (column_data_type_[column_id]) {
+      case ColumnInt32: {
+        int32_t value = 0;
+        success = ReadRawValue(bytes, &pos, &value);
+        if (selected) {
+          (*row)[column_name] = value;
+        }
+        break;
+      }
+      case ColumnInt64: {
+        int64_t value = 0;
+        success = ReadRawValue(bytes, &pos, &value);
+        if (selected) {
+          (*row)[column_name] = value;
+        }
+        break;
+      }
+      case ColumnFloat32: {
+        float value = 0;
+        success = ReadRawValue(bytes, &pos, &value);
+        if (selected) {
+          (*row)[column_name] = static_cast<double>(value);
+        }
+        break;
+      }
+      case ColumnFloat64: {
+        double value = 0;
+        success = ReadRawValue(bytes, &pos, &value);
+        if (selected) {
+          (*row)[column_name] = value;
+        }
+        break;
+      }
+      case ColumnString: {
+        uint32_t len = 0;
+        success = ReadRawValue(bytes, &pos, &len) && pos + len <= bytes.size();
+        if (success && selected) {
+          (*row)[column_name] = std::string(bytes.begin() + pos, bytes.begin() + pos + len);
+        }
+        pos += len;
+        break;
+      }
+      default:
+        break;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(success, "Invalid data, failed to decode column: " + column_name +
+                                               " of the raw data, the mindrecord file may be corrupted.");
+  }
+  return Status::OK();
+}
+
+template <typename T>
+Status ShardColumn::DecodeRawColumnValues(const std::vector<std::vector<uint8_t>> &rows, uint64_t column_id,
+                                          unsigned char *data) const {
+  const auto &column_name = column_name_[column_id];
+  for (uint64_t i = 0; i < rows.size(); i++) {
+    const auto &bytes = rows[i];
+    T value = 0;
+    bool success = false;
+    if (bytes.empty() || bytes[0] != kTypedRawRowMarker) {
+      json row = json::from_msgpack(bytes);
+      auto it = row.find(column_name);
+      success = it != row.end() && it->is_number();
+      if (success) {
+        value = it->get<T>();
+      }
+    } else {
+      // skip the columns stored before this one
+      uint64_t pos = 1;
+      success = true;
+      for (auto id : raw_column_id_) {
+        if (id == column_id) {
+          break;
+        }
+        if (column_data_type_[id] == ColumnString) {
+          uint32_t len = 0;
+          success = ReadRawValue(bytes, &pos, &len);
+          pos += len;
+        } else {
+          pos += ColumnDataTypeSize[column_data_type_[id]];
+        }
+        if (!success) {
+          break;
+        }
+      }
+      success = success && ReadRawValue(bytes, &pos, &value);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(success, "Invalid data, failed to decode column: " + column_name +
+                                               " of the raw data, the mindrecord file may be corrupted.");
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(memcpy_s(data + i * sizeof(T), sizeof(T), &value, sizeof(T)) == EOK,
+                                    "[Internal ERROR] Failed to copy column: " + column_name + ".");
+  }
+  return Status::OK();
+}
+
+Status ShardColumn::DecodeRawColumn(const std::vector<std::vector<uint8_t>> &rows, const std::string &column_name,
+                                    std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes,
+                                    ColumnDataType *column_data_type) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(data_ptr);
+  RETURN_UNEXPECTED_IF_NULL_MR(n_bytes);
+  RETURN_UNEXPECTED_IF_NULL_MR(column_data_type);
+  auto it = column_name_id_.find(column_name);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(it != column_name_id_.end() && blob_column_id_.count(column_name) == 0,
+                                  "Invalid data, column: " + column_name + " is not a raw column of the schema.");
+  auto column_id = it->second;
+  *column_data_type = column_data_type_[column_id];
+  uint64_t type_size = ColumnDataTypeSize[*column_data_type];
+  *n_bytes = rows.size() * type_size;
+  *data_ptr = std::make_unique<unsigned char[]>(*n_bytes);
+  switch (*column_data_type) {
+    case ColumnInt32:
+      return DecodeRawColumnValues<int32_t>(rows, column_id, data_ptr->get());
+    case ColumnInt64:
+      return DecodeRawColumnValues<int64_t>(rows, column_id, data_ptr->get());
+    case ColumnFloat32:
+      return DecodeRawColumnValues<float>(rows, column_id, data_ptr->get());
+    case ColumnFloat64:
+      return DecodeRawColumnValues<double>(rows, column_id, data_ptr->get());
+    default:
+      RETURN_STATUS_UNEXPECTED_MR("Invalid data, column: " + column_name +
+                                  " should be of type int32, int64, float32 or float64 to be read by column.");
+  }
+}
+
 ColumnCategory ShardColumn::CheckColumnName(const std::string &column_name) {
   auto it_column = column_name_id_.find(column_name);
   if (it_column == column_name_id_.end()) {
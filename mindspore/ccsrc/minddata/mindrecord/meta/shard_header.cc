@@ -30,7 +30,7 @@
 namespace mindspore {
 namespace mindrecord {
 std::atomic<bool> thread_status(false);
-ShardHeader::ShardHeader() : shard_count_(0), header_size_(0), page_size_(0), compression_size_(0) {
+ShardHeader::ShardHeader() : shard_count_(0), header_size_(0), page_size_(0), compression_size_(0), version_(kVersion) {
   index_ = std::make_shared<Index>();
 }
 
@@ -48,6 +48,7 @@ Status ShardHeader::InitializeHeader(const std::vector<json> &headers, bool load
       header_size_ = header["header_size"].get<uint64_t>();
       page_size_ = header["page_size"].get<uint64_t>();
       compression_size_ = header.contains("compression_size") ? header["compression_size"].get<uint64_t>() : 0;
+      version_ = header.contains("version") ? header["version"].get<std::string>() : kVersion;
     }
     RETURN_IF_NOT_OK_MR(ParsePage(header["page"], shard_index, load_dataset));
     shard_index++;
@@ -331,7 +332,7 @@ std::vector<std::string> ShardHeader::SerializeHeader() {
       s += "\"shard_addresses\":" + address + ",";
       s += "\"shard_id\":" + std::to_string(shardId) + ",";
       s += "\"statistics\":" + stats + ",";
-      s += "\"version\":\"" + std::string(kVersion) + "\"";
+      s += "\"version\":\"" + version_ + "\"";
       s += "}";
       header.emplace_back(s);
     }
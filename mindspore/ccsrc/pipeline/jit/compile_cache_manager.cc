@@ -46,6 +46,7 @@ constexpr char kRoleServer[] = "server_";
 constexpr char kRolePServer[] = "pserver_";
 constexpr char kRolePScheduler[] = "pscheduler_";
 constexpr char kGroupCkptFileName[] = "group.ckpt";
+constexpr char kRecStrategyCacheDirName[] = "rec_strategy";
 
 std::string GetUserDefinedCachePath() {
   auto user_defined_path = MsContext::GetInstance()->get_param<std::string>(MS_CTX_COMPILE_CACHE_PATH);
@@ -94,6 +95,8 @@ std::string GetDepFilesHashPath() {
 
 std::string GetGroupCkptSavePath() { return GetCompileCacheDir() + "/" + kGroupCkptFileName; }
 
+std::string GetRecStrategyCacheDir() { return GetCompileCacheDir() + "/" + kRecStrategyCacheDirName; }
+
 std::string GetCompileDepFilesHash(const py::list &dep_files) {
   MS_LOG(DEBUG) << "Dependency files size: " << dep_files.size();
   std::vector<std::string> dep_files_path;
@@ -284,5 +287,12 @@ void CompileCacheManager::InitParallelGroupCkptSaveFile() {
     parallel::ParallelContext::GetInstance()->set_group_ckpt_save_file(GetGroupCkptSavePath());
   }
 }
+
+void CompileCacheManager::InitParallelRecStrategyCacheDir() {
+  std::string parallel_mode = parallel::ParallelContext::GetInstance()->parallel_mode();
+  if ((parallel_mode == parallel::kAutoParallel) || (parallel_mode == parallel::kSemiAutoParallel)) {
+    parallel::ParallelContext::GetInstance()->set_rec_strategy_cache_dir(GetRecStrategyCacheDir());
+  }
+}
 }  // namespace pipeline
 }  // namespace mindspore
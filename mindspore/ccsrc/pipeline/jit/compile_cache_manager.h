@@ -37,6 +37,8 @@ class CompileCacheManager {
   void InitCompileCacheHash(const py::list &compile_cache_dep_files);
   // Init group checkpoint file path for parallel mode.
   static void InitParallelGroupCkptSaveFile();
+  // Init the file path of the strategies searched by the recursive programming in parallel mode.
+  static void InitParallelRecStrategyCacheDir();
   // Compare the dependency files hash.
   bool CheckDepFilesHashConsistency();
   // Load the cached func_graph from mindir file.
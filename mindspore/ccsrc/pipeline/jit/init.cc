@@ -517,6 +517,14 @@ PYBIND11_MODULE(_c_expression, m) {
   (void)m.def("_encrypt", &mindspore::pipeline::PyEncrypt, "Encrypt the data.");
   (void)m.def("_decrypt", &mindspore::pipeline::PyDecrypt, "Decrypt the data.");
   (void)m.def("_is_cipher_file", &mindspore::pipeline::PyIsCipherFile, "Determine whether the file is encrypted");
+  (void)m.def("_save_sharded_checkpoint", &mindspore::pipeline::PySaveShardedCheckpoint,
+              "Save tensors into the shard files of a folder.");
+  (void)m.def("_wait_sharded_checkpoint", &mindspore::pipeline::PyWaitShardedCheckpoint,
+              "Wait for the asynchronous sharded checkpoint save.");
+  (void)m.def("_load_sharded_checkpoint", &mindspore::pipeline::PyLoadShardedCheckpoint,
+              "Load tensors from the shard files of a folder.");
+  (void)m.def("_is_sharded_checkpoint", &mindspore::pipeline::PyIsShardedCheckpoint,
+              "Determine whether the folder contains a sharded checkpoint.");
 
   (void)py::class_<RecoveryContext, std::shared_ptr<RecoveryContext>>(m, "RecoveryContext")
     .def_static("get_instance", &RecoveryContext::GetInstance, "Get recovery context instance.")
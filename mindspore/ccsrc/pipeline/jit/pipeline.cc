@@ -71,6 +71,7 @@
 #include "mindspore/ccsrc/utils/dynamic_obfuscation/registry_opaque_predicate.h"
 #include "mindspore/ccsrc/plugin/device/cpu/kernel/pyexecute/py_execute_cpu_kernel.h"
 #include "distributed/init.h"
+#include "distributed/persistent/storage/sharded_checkpoint.h"
 #include "profiler/device/profiling.h"
 #include "kernel/akg/akg_kernel_build_manager.h"
 #include "kernel/graph_kernel_info.h"
@@ -2042,6 +2043,38 @@ py::bytes PyDecrypt(const std::string &encrypt_data_path, char *key, size_t key_
 
 bool PyIsCipherFile(const std::string &file_path) { return mindspore::IsCipherFile(file_path); }
 
+bool PySaveShardedCheckpoint(const std::string &dir, const std::vector<std::string> &names,
+                             const std::vector<tensor::TensorPtr> &tensors, size_t max_shard_length, bool async) {
+  py::gil_scoped_release release;
+  return distributed::storage::ShardedCheckpoint::GetInstance().Save(dir, names, tensors, max_shard_length, async);
+}
+
+bool PyWaitShardedCheckpoint() {
+  py::gil_scoped_release release;
+  return distributed::storage::ShardedCheckpoint::GetInstance().Wait();
+}
+
+py::dict PyLoadShardedCheckpoint(const std::string &dir) {
+  std::map<std::string, tensor::TensorPtr> tensors;
+  bool success = false;
+  {
+    py::gil_scoped_release release;
+    success = distributed::storage::ShardedCheckpoint::Load(dir, &tensors);
+  }
+  if (!success) {
+    MS_EXCEPTION(ValueError) << "Load sharded checkpoint from " << dir << " failed.";
+  }
+  py::dict result;
+  for (const auto &[name, tensor] : tensors) {
+    result[py::str(name)] = tensor;
+  }
+  return result;
+}
+
+bool PyIsShardedCheckpoint(const std::string &dir) {
+  return distributed::storage::ShardedCheckpoint::IsShardedCheckpoint(dir);
+}
+
 void FinalizeCluster() {
 #if defined(__linux__) && defined(WITH_BACKEND)
   if (distributed::cluster::ClusterContext::instance()->initialized()) {
@@ -205,6 +205,11 @@ void ProcessVmArgInner(const py::tuple &args, const ResourcePtr &res, VectorRef
 py::bytes PyEncrypt(char *plain_data, size_t plain_len, char *key, size_t key_len, const std::string &enc_mode);
 py::bytes PyDecrypt(const std::string &encrypt_data_path, char *key, size_t key_len, const std::string &dec_mode);
 bool PyIsCipherFile(const std::string &file_path);
+bool PySaveShardedCheckpoint(const std::string &dir, const std::vector<std::string> &names,
+                             const std::vector<tensor::TensorPtr> &tensors, size_t max_shard_length, bool async);
+bool PyWaitShardedCheckpoint();
+py::dict PyLoadShardedCheckpoint(const std::string &dir);
+bool PyIsShardedCheckpoint(const std::string &dir);
 void FinalizeCluster();
 FuncGraphPtr DynamicObfuscateMindIR(const std::string &file_name, float obf_ratio, int obf_password,
                                     int append_password, char *dec_key, const size_t key_len,
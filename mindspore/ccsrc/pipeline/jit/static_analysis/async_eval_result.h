@@ -28,6 +28,7 @@
 #include <list>
 #include <set>
 #include <unordered_map>
+#include <array>
 #include <fstream>
 #include <chrono>
 #include <mutex>
@@ -165,6 +166,69 @@ class MultiThreadCache {
   CacheType cache_;
 };
 
+// A thread safe cache which is split into shards by the hash of the key. Every shard has its own lock, so threads
+// accessing different keys seldom contend with each other.
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual, size_t kShardNum = 16>
+class ShardedMultiThreadCache {
+ public:
+  using CacheType = mindspore::HashMap<KeyType, ValueType, Hasher, KeyEqual>;
+
+  ValueType get(const KeyType &key) {
+    auto &shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.lock_);
+    auto it = shard.cache_.find(key);
+    if (it != shard.cache_.end()) {
+      return it->second;
+    }
+    return nullptr;
+  }
+
+  void set(const KeyType &key, const ValueType &data) {
+    auto &shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.lock_);
+    shard.cache_[key] = data;
+  }
+
+  void clear() {
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.lock_);
+      shard.cache_.clear();
+    }
+  }
+
+  size_t size() {
+    size_t total_size = 0;
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.lock_);
+      total_size += shard.cache_.size();
+    }
+    return total_size;
+  }
+
+  bool empty() { return size() == 0; }
+
+  std::string dump() {
+    std::ostringstream buf;
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.lock_);
+      for (auto &item : shard.cache_) {
+        buf << "{" << item.first->ToString() << ": " << item.second->ToString() << "}" << std::endl;
+      }
+    }
+    return buf.str();
+  }
+
+ private:
+  struct Shard {
+    std::mutex lock_;
+    CacheType cache_;
+  };
+
+  Shard &GetShard(const KeyType &key) { return shards_[Hasher{}(key) % kShardNum]; }
+
+  std::array<Shard, kShardNum> shards_;
+};
+
 template <typename KeyType, typename ValueType, typename CacheType>
 class NormalCache {
  public:
@@ -438,10 +502,8 @@ class AnalysisResultCacheMgr {
   const PrimitiveEvalCachePtr &prim_eval_cache() const { return prim_eval_cache_; }
 
  private:
-  using AnalysisConfigAsyncResultMap =
-    mindspore::HashMap<AnfNodeConfigPtr, AsyncAbstractPtr, AnfNodeConfigHasher, AnfNodeConfigEqual>;
   using AnalysisConfigAsyncResultCache =
-    MultiThreadCache<AnfNodeConfigPtr, AsyncAbstractPtr, AnalysisConfigAsyncResultMap>;
+    ShardedMultiThreadCache<AnfNodeConfigPtr, AsyncAbstractPtr, AnfNodeConfigHasher, AnfNodeConfigEqual>;
   AnalysisResultCacheMgr() = default;
   void SetCacheValue(const AnfNodeConfigPtr &conf, const AbstractBasePtr &current_abs,
                      AnalysisConfigAsyncResultCache *cache);
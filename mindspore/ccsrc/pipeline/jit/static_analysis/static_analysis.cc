@@ -85,9 +85,11 @@ size_t StackFrameMaxDepth() { return stack_frame_max_depth; }
 
 EvalResultPtr PrimitiveEvalCache::Get(const PrimitivePtr &prim, const AbstractBasePtrList &args) const {
   MS_EXCEPTION_IF_NULL(prim);
-  std::lock_guard<std::mutex> guard(mutex_);
-  auto cache_iter = prim_cache_.find(prim->name());
-  if (cache_iter == prim_cache_.end()) {
+  const auto &prim_name = prim->name();
+  auto &shard = GetShard(prim_name);
+  std::lock_guard<std::mutex> guard(shard.mutex_);
+  auto cache_iter = shard.prim_cache_.find(prim_name);
+  if (cache_iter == shard.prim_cache_.end()) {
     return nullptr;
   }
   auto &cache = cache_iter->second;
@@ -101,13 +103,17 @@ EvalResultPtr PrimitiveEvalCache::Get(const PrimitivePtr &prim, const AbstractBa
 void PrimitiveEvalCache::Put(const PrimitivePtr &prim, AttrValueMap &&attrs, const AbstractBasePtrList &args,
                              const EvalResultPtr &result) {
   MS_EXCEPTION_IF_NULL(prim);
-  std::lock_guard<std::mutex> guard(mutex_);
-  (void)prim_cache_[prim->name()].emplace(PrimitiveEvalCacheKey{std::move(attrs), args}, result);
+  const auto &prim_name = prim->name();
+  auto &shard = GetShard(prim_name);
+  std::lock_guard<std::mutex> guard(shard.mutex_);
+  (void)shard.prim_cache_[prim_name].emplace(PrimitiveEvalCacheKey{std::move(attrs), args}, result);
 }
 
 void PrimitiveEvalCache::Clear() {
-  std::lock_guard<std::mutex> guard(mutex_);
-  prim_cache_.clear();
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> guard(shard.mutex_);
+    shard.prim_cache_.clear();
+  }
 }
 
 AnalysisResult AnalysisEngine::Run(const FuncGraphPtr &func_graph, const AbstractBasePtrList &args_spec_list) {
@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <mutex>
+#include <array>
 #include "utils/ms_utils.h"
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
@@ -278,8 +279,19 @@ class PrimitiveEvalCache {
   void Clear();
 
  private:
-  mutable std::mutex mutex_;
-  PrimToEvalCache prim_cache_;
+  // The cache is split into shards by the primitive name, so the evaluations of different primitives seldom wait for
+  // each other.
+  static constexpr size_t kShardNum = 16;
+  struct Shard {
+    mutable std::mutex mutex_;
+    PrimToEvalCache prim_cache_;
+  };
+  const Shard &GetShard(const std::string &prim_name) const {
+    return shards_[std::hash<std::string>{}(prim_name) % kShardNum];
+  }
+  Shard &GetShard(const std::string &prim_name) { return shards_[std::hash<std::string>{}(prim_name) % kShardNum]; }
+
+  std::array<Shard, kShardNum> shards_;
 };
 
 using PrimitiveEvalCachePtr = std::shared_ptr<PrimitiveEvalCache>;
@@ -0,0 +1,143 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/hal/device/cpu_data_queue.h"
+#include <utility>
+#include "include/backend/data_queue/blocking_queue.h"
+#include "include/backend/data_queue/data_queue_mgr.h"
+#include "utils/log_adapter.h"
+#include "utils/ms_context.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace device {
+namespace {
+constexpr size_t kDefaultCpuQueueCapacity = 2;
+// The size of the ring buffer created for the CPU runtime, the prefetch depth is bounded by it.
+constexpr size_t kCpuDataQueueCapacity = 8;
+constexpr char kCpuDataQueuePrefetchDepthEnv[] = "MS_DEV_CPU_DATA_QUEUE_PREFETCH_DEPTH";
+
+size_t GetCpuDataQueuePrefetchDepth() {
+  auto depth_env = common::GetEnv(kCpuDataQueuePrefetchDepthEnv);
+  if (depth_env.empty()) {
+    return kDefaultCpuQueueCapacity;
+  }
+  try {
+    return std::stoul(depth_env);
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Invalid value of env " << kCpuDataQueuePrefetchDepthEnv << ": " << depth_env
+                    << ", use the default prefetch depth " << kDefaultCpuQueueCapacity << " instead.";
+    return kDefaultCpuQueueCapacity;
+  }
+}
+}  // namespace
+
+CpuDataQueue::CpuDataQueue(const std::string &channel_name, size_t capacity)
+    : DataQueue(channel_name, capacity == 0 ? kDefaultCpuQueueCapacity : capacity), node_info_(nullptr) {
+  node_info_ = std::make_unique<std::vector<DataQueueItem>[]>(capacity_);
+  prefetch_depth_ = capacity_;
+}
+
+void CpuDataQueue::set_prefetch_depth(size_t prefetch_depth) {
+  if (prefetch_depth == 0 || prefetch_depth > capacity_) {
+    MS_LOG(WARNING) << "The prefetch depth " << prefetch_depth << " of data queue " << channel_name_
+                    << " is out of range [1, " << capacity_ << "], use " << capacity_ << " instead.";
+    prefetch_depth_ = capacity_;
+    return;
+  }
+  prefetch_depth_ = prefetch_depth;
+}
+
+DataQueueStatus CpuDataQueue::Push(std::vector<DataQueueItem> data) {
+  if (data.empty()) {
+    return DataQueueStatus::SUCCESS;
+  }
+  if (IsFull()) {
+    return DataQueueStatus::TIMEOUT;
+  }
+
+  for (auto &item : data) {
+    if (item.data_ptr == nullptr && item.data_len != 0) {
+      MS_LOG(ERROR) << "Invalid Input: ptr: " << item.data_ptr << ", len: " << item.data_len;
+      return DataQueueStatus::ERROR_INPUT;
+    }
+    // The host buffer is used by the CPU kernels directly, no copy is needed.
+    item.device_addr = item.data_ptr;
+  }
+
+  node_info_[tail_] = std::move(data);
+  tail_ = (tail_ + 1) % capacity_;
+  ++size_;
+  return DataQueueStatus::SUCCESS;
+}
+
+DataQueueStatus CpuDataQueue::Front(std::vector<DataQueueItem> *data) const {
+  MS_EXCEPTION_IF_NULL(data);
+  if (IsEmpty()) {
+    return DataQueueStatus::INTERNAL_ERROR;
+  }
+  *data = node_info_[head_];
+  return DataQueueStatus::SUCCESS;
+}
+
+DataQueueStatus CpuDataQueue::FrontAsync(std::vector<DataQueueItem> *data) const { return Front(data); }
+
+DataQueueStatus CpuDataQueue::Pop() {
+  if (IsEmpty()) {
+    return DataQueueStatus::INTERNAL_ERROR;
+  }
+  // The consumer shares the buffers with the producer, so they can only be given back after the item is popped.
+  auto &items = node_info_[head_];
+  if (host_release_ != nullptr) {
+    for (auto &item : items) {
+      host_release_(item.data_ptr, item.worker_id);
+    }
+  }
+  items.clear();
+  head_ = (head_ + 1) % capacity_;
+  --size_;
+  return DataQueueStatus::SUCCESS;
+}
+
+void InitCpuDataQueue(const std::string &channel_name) {
+  auto &data_queue_mgr = DataQueueMgr::GetInstance();
+  if (!data_queue_mgr.IsCreated(channel_name)) {
+    auto ret = data_queue_mgr.Create(channel_name, {}, kCpuDataQueueCapacity);
+    if (ret != DataQueueStatus::SUCCESS && ret != DataQueueStatus::QUEUE_EXIST) {
+      MS_LOG(EXCEPTION) << "Create the data queue of channel " << channel_name << " failed: " << ret;
+    }
+  }
+  const auto &blocking_queue = data_queue_mgr.GetDataQueue(channel_name);
+  MS_EXCEPTION_IF_NULL(blocking_queue);
+  auto cpu_data_queue = std::dynamic_pointer_cast<CpuDataQueue>(blocking_queue->Queue());
+  if (cpu_data_queue == nullptr) {
+    MS_LOG(EXCEPTION) << "The data queue of channel " << channel_name << " is not created for CPU.";
+  }
+  cpu_data_queue->set_prefetch_depth(GetCpuDataQueuePrefetchDepth());
+  MS_LOG(INFO) << "The data queue of channel " << channel_name << " is ready, capacity: " << cpu_data_queue->Capacity()
+               << ", prefetch depth: " << cpu_data_queue->prefetch_depth();
+}
+
+namespace {
+std::shared_ptr<DataQueue> CreateCpuDataQueue(const std::string &channel_name, bool, size_t capacity,
+                                              const std::vector<size_t> &) {
+  return std::make_shared<CpuDataQueue>(channel_name, capacity);
+}
+
+REGISTER_DATA_QUEUE_CREATOR(kCPUDevice, CreateCpuDataQueue);
+}  // namespace
+}  // namespace device
+}  // namespace mindspore
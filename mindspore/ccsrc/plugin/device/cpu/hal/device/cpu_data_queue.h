@@ -0,0 +1,58 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_DEVICE_CPU_DATA_QUEUE_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_DEVICE_CPU_DATA_QUEUE_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "include/backend/data_queue/data_queue.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace device {
+// The data queue of CPU target. Host memory is directly addressable by the CPU kernels, so the queue does not copy
+// the pushed data: the buffers filled by the dataset pipeline are handed over to the consumer as they are, and the
+// ownership is given back to the producer through the release function once the item has been popped.
+class BACKEND_EXPORT CpuDataQueue : public DataQueue {
+ public:
+  CpuDataQueue(const std::string &channel_name, size_t capacity);
+  ~CpuDataQueue() override = default;
+
+  // The prefetch depth limits how many batches the producer can run ahead of the consumer, it can not be greater
+  // than the capacity of the ring buffer.
+  void set_prefetch_depth(size_t prefetch_depth);
+  size_t prefetch_depth() const { return prefetch_depth_; }
+
+  bool IsFull() const override { return size_ >= prefetch_depth_; }
+  DataQueueStatus Push(std::vector<DataQueueItem> data) override;
+  DataQueueStatus Front(std::vector<DataQueueItem> *data) const override;
+  DataQueueStatus FrontAsync(std::vector<DataQueueItem> *data) const override;
+  DataQueueStatus Pop() override;
+
+ private:
+  std::unique_ptr<std::vector<DataQueueItem>[]> node_info_;
+  size_t prefetch_depth_;
+};
+
+// Create the data queue of the channel consumed by the CPU runtime if it does not exist yet. The ring buffer is sized
+// by kCpuDataQueueCapacity, and the prefetch depth can be changed by env MS_DEV_CPU_DATA_QUEUE_PREFETCH_DEPTH.
+BACKEND_EXPORT void InitCpuDataQueue(const std::string &channel_name);
+}  // namespace device
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_DEVICE_CPU_DATA_QUEUE_H_
@@ -20,6 +20,7 @@
 #include "plugin/device/cpu/hal/hardware/cpu_memory_pool.h"
 #ifndef ENABLE_SECURITY
 #include "debug/data_dump/dump_json_parser.h"
+#include "debug/data_dump/async_dump_writer.h"
 #endif
 
 namespace mindspore {
@@ -70,7 +71,14 @@ bool CPUDeviceAddress::DumpMemToFile(const std::string &filepath, const std::str
   }
   std::string path = filepath + '.' + format_;
   MS_LOG(DEBUG) << "E2E Dump path is " << path;
-  ret = DumpJsonParser::DumpToFile(path, ptr_, size_, host_shape, host_type);
+  auto &async_writer = AsyncDumpWriter::GetInstance();
+  if (async_writer.enabled()) {
+    // tensors dropped by a full staging pool are reported by the writer, they are not a dump failure
+    (void)async_writer.DumpToFile(path, ptr_, size_, host_shape, host_type);
+    ret = true;
+  } else {
+    ret = DumpJsonParser::DumpToFile(path, ptr_, size_, host_shape, host_type);
+  }
 #endif
   return ret;
 }
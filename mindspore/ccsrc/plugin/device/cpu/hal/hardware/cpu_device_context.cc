@@ -38,6 +38,7 @@
 #include "plugin/device/cpu/optimizer/insert_cast_cpu.h"
 #include "plugin/device/cpu/optimizer/insert_format_transform_op.h"
 #include "plugin/device/cpu/optimizer/softmax_grad_fusion.h"
+#include "plugin/device/cpu/optimizer/multi_tensor_optimizer_fusion.h"
 #include "backend/common/pass/communication_op_fusion.h"
 #include "backend/common/pass/replace_node_by_proxy.h"
 #include "backend/common/pass/erase_visit_attr.h"
@@ -51,6 +52,7 @@
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "plugin/device/cpu/hal/profiler/cpu_profiling.h"
+#include "plugin/device/cpu/hal/profiler/cpu_op_trace.h"
 #if defined(__linux__) && defined(WITH_BACKEND)
 #include "plugin/device/cpu/hal/hardware/ms_collective_comm_lib.h"
 #endif
@@ -181,6 +183,7 @@ void CPUKernelExecutor::OptimizeMindIR(const KernelGraphPtr &graph) const {
   auto optimizer = std::make_shared<opt::GraphOptimizer>();
   auto pm = std::make_shared<opt::PassManager>();
   pm->AddPass(std::make_shared<opt::SoftmaxGradFusionCpu>("softmax_grad_fusion_cpu"));
+  pm->AddPass(std::make_shared<opt::MultiTensorOptimizerFusion>());
   optimizer->AddPassManager(pm);
   (void)optimizer->Optimize(graph);
   graph->SetExecOrderByDefault();
@@ -450,12 +453,27 @@ bool CPUKernelExecutor::LaunchKernelWithProfiling(const CNodePtr &kernel, const
                                                   const std::vector<AddressPtr> &outputs) const {
   MS_EXCEPTION_IF_NULL(kernel);
 
-  auto profiler_inst = profiler::cpu::CPUProfiler::GetInstance();
-  MS_EXCEPTION_IF_NULL(profiler_inst);
-
   auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
   MS_EXCEPTION_IF_NULL(kernel_mod);
 
+  // Op trace mode only times the sampled launches and keeps strings and locks off the launch path.
+  auto &op_trace = profiler::cpu::CpuOpTraceRecorder::GetInstance();
+  if (op_trace.enabled()) {
+    if (!op_trace.Sample()) {
+      return DoLaunchKernel(kernel_mod, inputs, workspace, outputs);
+    }
+    auto start = profiler::cpu::CpuOpTraceRecorder::Now();
+    bool ret = DoLaunchKernel(kernel_mod, inputs, workspace, outputs);
+    auto end = profiler::cpu::CpuOpTraceRecorder::Now();
+    if (!op_trace.Record(kernel.get(), start, end)) {
+      op_trace.RecordNew(kernel.get(), kernel->fullname_with_scope(), start, end);
+    }
+    return ret;
+  }
+
+  auto profiler_inst = profiler::cpu::CPUProfiler::GetInstance();
+  MS_EXCEPTION_IF_NULL(profiler_inst);
+
   uint32_t pid = IntToUint(getpid());
   // cpu support multi-thread with mindrt for profiling.
   profiler_inst->OpDataProducerBeginParallel(kernel->fullname_with_scope(), pid);
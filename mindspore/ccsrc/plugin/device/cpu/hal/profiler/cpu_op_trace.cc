@@ -0,0 +1,300 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/hal/profiler/cpu_op_trace.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include "plugin/device/cpu/hal/profiler/cpu_profiling.h"
+#include "actor/actormgr.h"
+#include "include/common/debug/common.h"
+#include "utils/log_adapter.h"
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace profiler {
+namespace cpu {
+namespace {
+constexpr char kOpTraceMagic[8] = "MSOPTRC";
+constexpr uint32_t kOpTraceVersion = 1;
+// 64K records, 1.5MB per launching thread
+constexpr size_t kOpTraceRingCapacity = 1 << 16;
+constexpr auto kOpTraceDrainInterval = std::chrono::milliseconds(10);
+}  // namespace
+
+OpTraceRing::OpTraceRing(size_t capacity) : records_(capacity), mask_(capacity - 1) {
+  if ((capacity & mask_) != 0) {
+    MS_LOG(EXCEPTION) << "Op trace ring capacity should be a power of 2, but got " << capacity;
+  }
+}
+
+bool OpTraceRing::Push(const OpTraceRecord &record) {
+  auto tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_.load(std::memory_order_acquire) == records_.size()) {
+    return false;
+  }
+  records_[tail & mask_] = record;
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+void OpTraceRing::PopAll(std::vector<OpTraceRecord> *records) {
+  auto head = head_.load(std::memory_order_relaxed);
+  auto tail = tail_.load(std::memory_order_acquire);
+  for (; head != tail; ++head) {
+    records->push_back(records_[head & mask_]);
+  }
+  head_.store(head, std::memory_order_release);
+}
+
+struct CpuOpTraceRecorder::ThreadState {
+  uint64_t generation = 0;
+  uint32_t launch_count = 0;
+  uint32_t tid = 0;
+  std::shared_ptr<OpTraceRing> ring;
+  // kernels are not freed while profiling, so the address identifies the op on this thread
+  std::unordered_map<const void *, uint32_t> op_ids;
+};
+
+CpuOpTraceRecorder &CpuOpTraceRecorder::GetInstance() {
+  static CpuOpTraceRecorder instance;
+  return instance;
+}
+
+CpuOpTraceRecorder::~CpuOpTraceRecorder() { Stop(); }
+
+CpuOpTraceRecorder::ThreadState &CpuOpTraceRecorder::GetThreadState() {
+  thread_local ThreadState state;
+  return state;
+}
+
+uint64_t CpuOpTraceRecorder::Now() {
+  // the same clock as Profiler::GetHostMonoTimeStamp
+  auto now = std::chrono::steady_clock::now();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+}
+
+bool CpuOpTraceRecorder::Start(const std::string &trace_file, const std::string &name_file, uint32_t sample_interval) {
+  if (enabled()) {
+    return true;
+  }
+  trace_file_ = fopen(trace_file.c_str(), "wb");
+  if (trace_file_ == nullptr) {
+    MS_LOG(WARNING) << "Open op trace file " << trace_file << " failed: " << ErrnoToString(errno);
+    return false;
+  }
+  OpTraceHeader header{};
+  (void)memcpy(header.magic, kOpTraceMagic, sizeof(header.magic));
+  header.version = kOpTraceVersion;
+  header.sample_interval = sample_interval;
+  (void)fwrite(&header, sizeof(header), 1, trace_file_);
+  name_file_ = name_file;
+  sample_interval_ = sample_interval == 0 ? 1 : sample_interval;
+  {
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    rings_.clear();
+  }
+  {
+    std::lock_guard<std::mutex> lock(op_mutex_);
+    op_ids_.clear();
+    op_names_.clear();
+  }
+  dropped_num_ = 0;
+  stop_ = false;
+  // threads pick up a new ring and drop their op ids of the former run
+  ++generation_;
+  drain_thread_ = std::thread(&CpuOpTraceRecorder::DrainLoop, this);
+  enabled_ = true;
+  MS_LOG(INFO) << "Start cpu op trace, sample interval: " << sample_interval_ << ", trace file: " << trace_file;
+  return true;
+}
+
+void CpuOpTraceRecorder::Stop() {
+  if (!enabled()) {
+    return;
+  }
+  enabled_ = false;
+  {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    stop_ = true;
+  }
+  drain_cond_.notify_all();
+  if (drain_thread_.joinable()) {
+    drain_thread_.join();
+  }
+  Drain();
+  (void)fclose(trace_file_);
+  trace_file_ = nullptr;
+  SaveNames();
+  if (dropped_num_ > 0) {
+    MS_LOG(WARNING) << "Cpu op trace dropped " << dropped_num_
+                    << " launches because the ring buffers were full, set a larger sample interval to keep all of them.";
+  }
+}
+
+bool CpuOpTraceRecorder::Sample() {
+  auto &state = GetThreadState();
+  return (state.launch_count++ % sample_interval_) == 0;
+}
+
+bool CpuOpTraceRecorder::Record(const void *kernel, uint64_t start, uint64_t end) {
+  auto &state = GetThreadState();
+  if (state.generation != generation_.load(std::memory_order_relaxed)) {
+    RegisterThread(&state);
+  }
+  auto iter = state.op_ids.find(kernel);
+  if (iter == state.op_ids.end()) {
+    return false;
+  }
+  Push(&state, iter->second, start, end);
+  return true;
+}
+
+void CpuOpTraceRecorder::RecordNew(const void *kernel, const std::string &op_name, uint64_t start, uint64_t end) {
+  auto &state = GetThreadState();
+  if (state.generation != generation_.load(std::memory_order_relaxed)) {
+    RegisterThread(&state);
+  }
+  auto op_id = InternOp(op_name);
+  state.op_ids[kernel] = op_id;
+  Push(&state, op_id, start, end);
+}
+
+void CpuOpTraceRecorder::Push(ThreadState *state, uint32_t op_id, uint64_t start, uint64_t end) {
+  if (!state->ring->Push(OpTraceRecord{op_id, state->tid, start, end - start})) {
+    (void)dropped_num_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void CpuOpTraceRecorder::RegisterThread(ThreadState *state) {
+  state->generation = generation_.load();
+  state->op_ids.clear();
+  state->ring = std::make_shared<OpTraceRing>(kOpTraceRingCapacity);
+  // the same thread id as the legacy mode, the worker index of the actor thread pool
+  state->tid = 0;
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+  if (actor_manager != nullptr && actor_manager->GetActorThreadPool() != nullptr) {
+    const auto &worker_ids_map = actor_manager->GetActorThreadPool()->GetWorkerIdMap();
+    auto id_iter = worker_ids_map.find(std::this_thread::get_id());
+    if (id_iter != worker_ids_map.end()) {
+      state->tid = static_cast<uint32_t>(id_iter->second);
+    }
+  }
+  std::lock_guard<std::mutex> lock(ring_mutex_);
+  rings_.push_back(state->ring);
+}
+
+uint32_t CpuOpTraceRecorder::InternOp(const std::string &op_name) {
+  std::lock_guard<std::mutex> lock(op_mutex_);
+  auto iter = op_ids_.find(op_name);
+  if (iter != op_ids_.end()) {
+    return iter->second;
+  }
+  auto op_id = static_cast<uint32_t>(op_names_.size());
+  op_names_.push_back(op_name);
+  (void)op_ids_.emplace(op_name, op_id);
+  return op_id;
+}
+
+void CpuOpTraceRecorder::DrainLoop() {
+  std::unique_lock<std::mutex> lock(drain_mutex_);
+  while (!stop_) {
+    (void)drain_cond_.wait_for(lock, kOpTraceDrainInterval, [this]() { return stop_; });
+    Drain();
+  }
+}
+
+void CpuOpTraceRecorder::Drain() {
+  std::vector<std::shared_ptr<OpTraceRing>> rings;
+  {
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    rings = rings_;
+  }
+  drain_buffer_.clear();
+  for (auto &ring : rings) {
+    ring->PopAll(&drain_buffer_);
+  }
+  if (!drain_buffer_.empty() && trace_file_ != nullptr) {
+    (void)fwrite(drain_buffer_.data(), sizeof(OpTraceRecord), drain_buffer_.size(), trace_file_);
+  }
+}
+
+void CpuOpTraceRecorder::SaveNames() {
+  std::ofstream ofs(name_file_);
+  if (!ofs.is_open()) {
+    MS_LOG(WARNING) << "Open op trace name file " << name_file_ << " failed.";
+    return;
+  }
+  std::lock_guard<std::mutex> lock(op_mutex_);
+  for (size_t i = 0; i < op_names_.size(); ++i) {
+    ofs << i << ',' << op_names_[i] << '\n';
+  }
+  ofs.close();
+  ChangeFileMode(name_file_, S_IRUSR | S_IWUSR);
+}
+
+bool CpuOpTraceRecorder::Convert(const std::string &trace_file, const std::string &name_file, uint32_t pid,
+                                 OpInfoMap *op_info_map) {
+  MS_EXCEPTION_IF_NULL(op_info_map);
+  std::vector<std::string> op_names;
+  std::ifstream name_ifs(name_file);
+  if (!name_ifs.is_open()) {
+    MS_LOG(WARNING) << "Open op trace name file " << name_file << " failed.";
+    return false;
+  }
+  std::string line;
+  while (std::getline(name_ifs, line)) {
+    auto pos = line.find(',');
+    if (pos == std::string::npos) {
+      continue;
+    }
+    auto op_id = std::stoul(line.substr(0, pos));
+    if (op_id >= op_names.size()) {
+      op_names.resize(op_id + 1);
+    }
+    op_names[op_id] = line.substr(pos + 1);
+  }
+
+  std::ifstream trace_ifs(trace_file, std::ios::binary);
+  OpTraceHeader header{};
+  if (!trace_ifs.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      memcmp(header.magic, kOpTraceMagic, sizeof(header.magic)) != 0 || header.version != kOpTraceVersion) {
+    MS_LOG(WARNING) << "Op trace file " << trace_file << " is invalid.";
+    return false;
+  }
+  auto interval = header.sample_interval == 0 ? 1 : header.sample_interval;
+  OpTraceRecord record{};
+  while (trace_ifs.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+    if (record.op_id >= op_names.size() || op_names[record.op_id].empty()) {
+      MS_LOG(WARNING) << "Unknown op id " << record.op_id << " in op trace file " << trace_file;
+      continue;
+    }
+    const auto &op_name = op_names[record.op_id];
+    auto &op_info = (*op_info_map)[op_name];
+    if (op_info.op_count == 0) {
+      op_info.op_name = op_name;
+      op_info.pid = pid;
+    }
+    float duration = record.duration / kNanosecondToMillisecond;
+    op_info.op_count += static_cast<int>(interval);
+    op_info.op_host_cost_time += duration * interval;
+    op_info.start_duration.push_back(StartDuration{record.start, duration, record.tid});
+  }
+  return true;
+}
+}  // namespace cpu
+}  // namespace profiler
+}  // namespace mindspore
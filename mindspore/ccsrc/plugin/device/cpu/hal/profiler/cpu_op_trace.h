@@ -0,0 +1,125 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_PROFILER_CPU_OP_TRACE_H
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_PROFILER_CPU_OP_TRACE_H
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "profiler/device/data_saver.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace profiler {
+namespace cpu {
+// One sampled kernel launch, times are steady clock nanoseconds.
+struct OpTraceRecord {
+  uint32_t op_id;
+  uint32_t tid;
+  uint64_t start;
+  uint64_t duration;
+};
+
+struct OpTraceHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t sample_interval;
+};
+
+// Fixed size ring with a single producer, the launching thread, and a single consumer, the drain thread.
+class OpTraceRing {
+ public:
+  explicit OpTraceRing(size_t capacity);
+  // Returns false and drops the record if the ring is full.
+  bool Push(const OpTraceRecord &record);
+  void PopAll(std::vector<OpTraceRecord> *records);
+
+ private:
+  std::vector<OpTraceRecord> records_;
+  size_t mask_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+};
+
+/*
+ * Op trace mode of the cpu profiler. Every launching thread records into its own ring keyed by an op id interned at
+ * the first launch of a kernel, so no string is copied and no lock is taken per launch. Only one in sample_interval
+ * launches of a thread is timed. A drain thread appends the rings to a binary trace file, which Convert turns into the
+ * op information of the profiler afterwards, so the usual cpu profiler files are written from it.
+ */
+class BACKEND_EXPORT CpuOpTraceRecorder {
+ public:
+  static CpuOpTraceRecorder &GetInstance();
+  ~CpuOpTraceRecorder();
+
+  bool Start(const std::string &trace_file, const std::string &name_file, uint32_t sample_interval);
+  void Stop();
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Counts a launch of the calling thread and returns true if it is sampled.
+  bool Sample();
+  // Records a sampled launch. Returns false if the kernel has not been seen on the calling thread, then the launch
+  // has to be recorded by RecordNew, so the op name is only built at the first launch.
+  bool Record(const void *kernel, uint64_t start, uint64_t end);
+  void RecordNew(const void *kernel, const std::string &op_name, uint64_t start, uint64_t end);
+  static uint64_t Now();
+
+  // Accumulates the launches of a trace into op_info_map, sampled launches stand for sample_interval launches.
+  static bool Convert(const std::string &trace_file, const std::string &name_file, uint32_t pid,
+                      OpInfoMap *op_info_map);
+
+ private:
+  CpuOpTraceRecorder() = default;
+  struct ThreadState;
+  static ThreadState &GetThreadState();
+  void RegisterThread(ThreadState *state);
+  void Push(ThreadState *state, uint32_t op_id, uint64_t start, uint64_t end);
+  uint32_t InternOp(const std::string &op_name);
+  void DrainLoop();
+  void Drain();
+  void SaveNames();
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<uint64_t> generation_{0};
+  std::atomic<uint64_t> dropped_num_{0};
+  uint32_t sample_interval_{1};
+  std::string name_file_;
+
+  std::mutex op_mutex_;
+  std::unordered_map<std::string, uint32_t> op_ids_;
+  std::vector<std::string> op_names_;
+
+  std::mutex ring_mutex_;
+  std::vector<std::shared_ptr<OpTraceRing>> rings_;
+
+  std::mutex drain_mutex_;
+  std::condition_variable drain_cond_;
+  std::thread drain_thread_;
+  bool stop_{false};
+  FILE *trace_file_{nullptr};
+  std::vector<OpTraceRecord> drain_buffer_;
+};
+}  // namespace cpu
+}  // namespace profiler
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_PROFILER_CPU_OP_TRACE_H
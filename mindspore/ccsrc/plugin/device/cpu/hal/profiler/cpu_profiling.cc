@@ -15,16 +15,25 @@
  */
 
 #include "plugin/device/cpu/hal/profiler/cpu_profiling.h"
+#include <unistd.h>
 #include "plugin/device/cpu/hal/profiler/cpu_data_saver.h"
+#include "plugin/device/cpu/hal/profiler/cpu_op_trace.h"
+#include "profiler/device/perf_counter.h"
 #include "utils/log_adapter.h"
 #include "include/common/utils/utils.h"
 #include "utils/ms_context.h"
+#include "utils/ms_utils.h"
+#include "utils/convert_utils_base.h"
 
 namespace mindspore {
 namespace profiler {
 namespace cpu {
 namespace {
 PROFILER_REG(kCPUDevice, CPUProfiler);
+// Sample interval of the op trace mode, 1 traces every launch. The legacy mode is used if it is not set.
+constexpr char kCpuOpTraceEnv[] = "MS_CPU_PROFILER_OP_TRACE";
+// Collects hardware counters around every kernel launch if set to 1, which needs perf_event_open to be permitted.
+constexpr char kCpuPerfCounterEnv[] = "MS_CPU_PROFILER_PERF_COUNTER";
 }  // namespace
 std::shared_ptr<CPUProfiler> CPUProfiler::GetInstance() {
   auto instance = Profiler::GetInstance(kCPUDevice);
@@ -37,11 +46,51 @@ void CPUProfiler::Init(const std::string &profiling_path, uint32_t, const std::s
   base_time_ = GetHostMonoTimeStamp();
   profile_data_path_ = profiling_path;
   MS_LOG(INFO) << " Host start time(ns): " << base_time_ << " profile data path: " << profile_data_path_;
+  op_trace_interval_ = 0;
+  auto op_trace_env = common::GetEnv(kCpuOpTraceEnv);
+  if (!op_trace_env.empty()) {
+    try {
+      op_trace_interval_ = static_cast<uint32_t>(std::stoul(op_trace_env));
+    } catch (const std::exception &) {
+      MS_LOG(WARNING) << "Env " << kCpuOpTraceEnv << " should be a positive sample interval, but got " << op_trace_env
+                      << ", use the legacy cpu profiler.";
+    }
+  }
+  perf_counter_enable_ = common::GetEnv(kCpuPerfCounterEnv) == "1";
 }
 
 void CPUProfiler::StepProfilingEnable(const bool enable_flag) {
   MS_LOG(INFO) << "CPU Profiler enable flag: " << enable_flag;
   enable_flag_ = enable_flag;
+  KernelPerfCounter::GetInstance().Enable(enable_flag && perf_counter_enable_);
+  if (op_trace_interval_ == 0 || profile_data_path_.empty()) {
+    return;
+  }
+  auto &recorder = CpuOpTraceRecorder::GetInstance();
+  if (!enable_flag) {
+    // every start rewrites the trace and renumbers the ops, so a segment is converted as soon as it stops, and the
+    // segments accumulate in the op information like in the legacy mode
+    LoadOpTrace();
+    return;
+  }
+  auto pid = std::to_string(getpid());
+  op_trace_file_ = profile_data_path_ + "/cpu_op_trace_" + pid + ".bin";
+  op_trace_name_file_ = profile_data_path_ + "/cpu_op_trace_name_" + pid + ".txt";
+  if (!recorder.Start(op_trace_file_, op_trace_name_file_, op_trace_interval_)) {
+    op_trace_file_.clear();
+  }
+}
+
+void CPUProfiler::LoadOpTrace() {
+  CpuOpTraceRecorder::GetInstance().Stop();
+  if (op_trace_file_.empty()) {
+    return;
+  }
+  std::unique_lock<std::shared_mutex> lock(op_map_mutex_);
+  if (!CpuOpTraceRecorder::Convert(op_trace_file_, op_trace_name_file_, IntToUint(getpid()), &op_info_map_)) {
+    MS_LOG(WARNING) << "Convert cpu op trace " << op_trace_file_ << " failed.";
+  }
+  op_trace_file_.clear();
 }
 
 void CPUProfiler::SetRunTimeData(const std::string &op_name, const uint32_t pid, bool is_parallel) {
@@ -159,6 +208,7 @@ void CPUProfiler::OpDataProducerEnd() {
 
 void CPUProfiler::Stop() {
   MS_LOG(INFO) << "Stop CPU Profiling";
+  LoadOpTrace();
   SaveProfileData();
   ClearInst();
 }
@@ -171,6 +221,12 @@ void CPUProfiler::SaveProfileData() {
     MS_EXCEPTION_IF_NULL(cpu_data_saver_inst);
     cpu_data_saver_inst->ParseOpInfo(op_info_map_);
     cpu_data_saver_inst->WriteFile(profile_data_path_);
+    if (perf_counter_enable_) {
+      auto &perf_counter = KernelPerfCounter::GetInstance();
+      perf_counter.Enable(false);
+      (void)perf_counter.Save(profile_data_path_ + "/cpu_op_perf_counter_" + std::to_string(getpid()) + ".csv");
+      perf_counter.Clear();
+    }
     if (!all_kernel_info_.empty()) {
       cpu_data_saver_inst->WriteFrameWork(profile_data_path_, all_kernel_info_);
     }
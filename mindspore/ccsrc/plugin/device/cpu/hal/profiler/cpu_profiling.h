@@ -64,6 +64,8 @@ class CPUProfiler : public Profiler {
   void ClearInst() override;
   void SetGpuHeteroStatus();
   void RecordGpuOneStepStartEndInfo();
+  // Turns the binary trace of the op trace mode into op_info_map_.
+  void LoadOpTrace();
 
   uint64_t base_time_;
   std::string op_name_;
@@ -74,6 +76,11 @@ class CPUProfiler : public Profiler {
   uint64_t op_time_stop_;
 
   std::optional<bool> is_gpu_hetero_ = {};
+
+  bool perf_counter_enable_{false};
+  uint32_t op_trace_interval_{0};
+  std::string op_trace_file_;
+  std::string op_trace_name_file_;
 };
 }  // namespace cpu
 }  // namespace profiler
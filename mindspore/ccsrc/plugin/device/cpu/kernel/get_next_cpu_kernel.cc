@@ -0,0 +1,78 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/get_next_cpu_kernel.h"
+#include "include/backend/data_queue/data_queue_mgr.h"
+#include "plugin/device/cpu/hal/device/cpu_data_queue.h"
+
+namespace mindspore {
+namespace kernel {
+using mindspore::device::DataQueueMgr;
+
+bool GetNextCpuKernelMod::Init(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &,
+                               const std::vector<KernelTensorPtr> &) {
+  MS_EXCEPTION_IF_NULL(base_operator);
+  kernel_name_ = base_operator->name();
+  auto prim = base_operator->GetPrim();
+  MS_EXCEPTION_IF_NULL(prim);
+  auto shared_name = prim->GetAttr("shared_name");
+  if (shared_name == nullptr) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the attr 'shared_name' is not found.";
+    return false;
+  }
+  queue_name_ = GetValue<std::string>(shared_name);
+  device::InitCpuDataQueue(queue_name_);
+  return true;
+}
+
+bool GetNextCpuKernelMod::Launch(const std::vector<AddressPtr> &, const std::vector<AddressPtr> &,
+                                 const std::vector<AddressPtr> &outputs) {
+  auto &data_queue_mgr = DataQueueMgr::GetInstance();
+  std::vector<device::DataQueueItem> data;
+  auto ret = data_queue_mgr.Front(queue_name_, &data);
+  if (ret != device::DataQueueStatus::SUCCESS) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', get data from queue " << queue_name_
+                  << " failed, error code: " << static_cast<int>(ret);
+    return false;
+  }
+  if (data.size() != outputs.size()) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the data number " << data.size() << " of queue " << queue_name_
+                  << " is not equal to the outputs number " << outputs.size();
+    return false;
+  }
+  for (size_t i = 0; i < data.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(outputs[i]);
+    if (data[i].data_len == 0) {
+      continue;
+    }
+    auto cp_ret = memcpy_s(outputs[i]->addr, outputs[i]->size, data[i].data_ptr, data[i].data_len);
+    if (cp_ret != EOK) {
+      MS_LOG(ERROR) << "For '" << kernel_name_ << "', memcpy_s for output " << i << " failed, ret code: " << cp_ret;
+      return false;
+    }
+  }
+  (void)data_queue_mgr.Pop(queue_name_);
+  return true;
+}
+
+std::vector<KernelAttr> GetNextCpuKernelMod::GetOpSupport() {
+  static std::vector<KernelAttr> support_list = {KernelAttr().AddSkipCheckAttr(true)};
+  return support_list;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, GetNext, GetNextCpuKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
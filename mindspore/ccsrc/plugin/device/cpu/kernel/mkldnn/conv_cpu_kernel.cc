@@ -18,6 +18,8 @@
 
 #include <string>
 #include <algorithm>
+#include <utility>
+#include "plugin/device/cpu/kernel/mkldnn/mkl_tuning_db.h"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
@@ -102,11 +104,52 @@ int ConvCpuKernelMod::Resize(const BaseOperatorPtr &base_operator, const std::ve
   PaddingInfo padding_info{pad_mode_, kernel_size, strides, dilation, &padding_l, &padding_r};
   GetPadding(base_operator, src_shape, padding_info);
 
-  const auto desc = CreateDesc<dnnl::convolution_forward::desc>(
-    dnnl::prop_kind::forward_training, dnnl::algorithm::convolution_auto, src_desc, weights_desc, dst_desc, strides,
-    dilates, padding_l, padding_r);
-  const auto prim_desc = CreateDesc<dnnl::convolution_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::convolution_forward>(prim_desc);
+  auto tuning_key =
+    MKLTuningDB::BuildKey(kernel_name_, {src_shape, weight_shape, dst_shape, strides, dilates, padding_l, padding_r},
+                          "f32");
+  auto create_candidates = [&, this](const std::vector<std::pair<std::string, dnnl::algorithm>> &algorithms) {
+    std::vector<MKLTuningCandidate> candidates;
+    for (const auto &[algorithm_name, algorithm] : algorithms) {
+      try {
+        const auto desc = CreateDesc<dnnl::convolution_forward::desc>(dnnl::prop_kind::forward_training, algorithm,
+                                                                      src_desc, weights_desc, dst_desc, strides,
+                                                                      dilates, padding_l, padding_r);
+        const auto prim_desc = CreateDesc<dnnl::convolution_forward::primitive_desc>(desc, engine_);
+        (void)candidates.emplace_back(
+          MKLTuningCandidate{algorithm_name, CreatePrimitive<dnnl::convolution_forward>(prim_desc)});
+      } catch (const dnnl::error &e) {
+        // The winograd algorithm only supports some shapes and instruction sets.
+        MS_LOG(DEBUG) << kernel_name_ << " does not support the algorithm " << algorithm_name
+                      << ", error: " << e.what();
+      }
+    }
+    return candidates;
+  };
+
+  // Tune the direct and winograd algorithms if the tuning database is enabled, otherwise let onednn choose one.
+  std::vector<std::pair<std::string, dnnl::algorithm>> algorithms = {{"auto", dnnl::algorithm::convolution_auto}};
+  std::vector<MKLTuningCandidate> candidates;
+  if (MKLTuningDB::GetInstance().enabled()) {
+    algorithms = {{"direct", dnnl::algorithm::convolution_direct},
+                  {"winograd", dnnl::algorithm::convolution_winograd}};
+    // A tuned kernel only creates the primitive of its tuned algorithm.
+    MKLTuningRecord record;
+    if (FindTuningRecord(tuning_key, &record)) {
+      std::vector<std::pair<std::string, dnnl::algorithm>> tuned_algorithms;
+      (void)std::copy_if(algorithms.begin(), algorithms.end(), std::back_inserter(tuned_algorithms),
+                         [&record](const auto &algorithm) { return algorithm.first == record.algorithm; });
+      candidates = create_candidates(tuned_algorithms);
+    }
+  }
+  if (candidates.empty()) {
+    candidates = create_candidates(algorithms);
+  }
+  if (candidates.empty()) {
+    MS_LOG(ERROR) << kernel_name_ << " creates the convolution primitive failed, input shape: " << src_shape
+                  << ", weight shape: " << weight_shape;
+    return KRET_RESIZE_FAILED;
+  }
+  SetTuningCandidates(tuning_key, std::move(candidates));
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_WEIGHTS, weights_desc);
   AddArgument(DNNL_ARG_DST, dst_desc);
@@ -17,6 +17,8 @@
 #include "plugin/device/cpu/kernel/mkldnn/matmul_cpu_kernel_func.h"
 #include <utility>
 #include <map>
+#include <string>
+#include "plugin/device/cpu/kernel/mkldnn/mkl_tuning_db.h"
 #include "include/common/thread_pool.h"
 #include "plugin/device/cpu/kernel/nnacl/op_base.h"
 #include "plugin/device/cpu/kernel/nnacl/matmul_parameter.h"
@@ -92,7 +94,10 @@ int MatMulCpuKernelFunc::Resize(const BaseOperatorPtr &base_operator, const std:
   auto dst_md = CreateDesc<dnnl::memory::desc>(dst_dims, dnnl::memory::data_type::f32, o_strides);
   auto matmul_desc = CreateDesc<dnnl::matmul::desc>(src_md, weights_md, dst_md);
   auto prim_desc = CreateDesc<dnnl::matmul::primitive_desc>(matmul_desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::matmul>(prim_desc);
+  // The matmul has only one algorithm, so the tuning selects the thread number.
+  std::vector<MKLTuningCandidate> candidates = {{"matmul", CreatePrimitive<dnnl::matmul>(prim_desc)}};
+  auto tuning_key = MKLTuningDB::BuildKey(kernel_name_, {src_dims, weights_dims, a_strides, b_strides}, "f32");
+  SetTuningCandidates(tuning_key, std::move(candidates));
 
   AddArgument(DNNL_ARG_SRC, src_md);
   AddArgument(DNNL_ARG_WEIGHTS, weights_md);
@@ -15,16 +15,28 @@
  */
 
 #include "plugin/device/cpu/kernel/mkldnn/mkl_cpu_kernel.h"
+#include <array>
+#include <cfloat>
 #include <vector>
 #include <string>
 #include <algorithm>
 #include <map>
+#include <mutex>
+#include "plugin/device/cpu/kernel/mkldnn/mkl_tuning_db.h"
 #include "utils/ms_utils.h"
 #include "utils/profile.h"
 
 namespace mindspore {
 namespace kernel {
 namespace {
+#ifdef USE_MS_THREADPOOL_FOR_DNNL
+constexpr std::array<size_t, 5> kSearchThreadList{4, 8, 16, 24, 32};
+constexpr size_t kAvgCount = 5;
+#endif
+// The number of the timed executions of each candidate in the kernel tuning.
+constexpr size_t kTuningRepeatNum = 5;
+constexpr double kSecondToUs = 1e6;
+
 void GeneratePaddingForPadMode(const PaddingInfo &padding_info, std::vector<int64_t> shape_exclude_nc,
                                std::vector<int64_t> pad) {
   if (padding_info.ceil_mode) {
@@ -390,10 +402,11 @@ void MKLCpuKernelMod::SetArgumentHandle(int arg_key, void *ptr) {
 
 void MKLCpuKernelMod::ExecutePrimitive() {
   MS_EXCEPTION_IF_NULL(primitive_);
+  if (!tuning_candidates_.empty()) {
+    TunePrimitive();
+  }
 #ifdef USE_MS_THREADPOOL_FOR_DNNL
   // add auto search
-  const std::vector<size_t> kSearchThreadList{4, 8, 16, 24, 32};
-  const size_t kAvgCount = 5;
   const size_t kDiff = 2;
   size_t current_pow = parallel_search_info_.search_count / kAvgCount;
   auto mkl_pool = dynamic_cast<mkl_threadpool *>(mkl_threadpool_.get());
@@ -443,6 +456,128 @@ void MKLCpuKernelMod::ExecutePrimitive() {
   (void)stream_.wait();
 }
 
+std::string MKLCpuKernelMod::GetMachineTuningKey(const std::string &tuning_key) const {
+  // The best primitive depends on the instruction set and the threads of the machine.
+  auto machine_tuning_key = tuning_key + "|isa:" + std::to_string(static_cast<int>(dnnl::get_effective_cpu_isa()));
+#ifdef USE_MS_THREADPOOL_FOR_DNNL
+  auto mkl_pool = dynamic_cast<mkl_threadpool *>(mkl_threadpool_.get());
+  MS_EXCEPTION_IF_NULL(mkl_pool);
+  machine_tuning_key += "|threads:" + std::to_string(mkl_pool->get_max_num_threads());
+#endif
+  return machine_tuning_key;
+}
+
+bool MKLCpuKernelMod::FindTuningRecord(const std::string &tuning_key, MKLTuningRecord *const record) const {
+  auto &tuning_db = MKLTuningDB::GetInstance();
+  return tuning_db.enabled() && tuning_db.Find(GetMachineTuningKey(tuning_key), record);
+}
+
+void MKLCpuKernelMod::SetTuningCandidates(const std::string &tuning_key,
+                                          std::vector<MKLTuningCandidate> &&candidates) {
+  if (candidates.empty()) {
+    MS_LOG(EXCEPTION) << "The tuning candidates of " << tuning_key << " is empty.";
+  }
+  primitive_ = candidates.front().primitive;
+  tuning_candidates_.clear();
+  auto &tuning_db = MKLTuningDB::GetInstance();
+  if (!tuning_db.enabled()) {
+    return;
+  }
+
+  tuning_key_ = GetMachineTuningKey(tuning_key);
+  MKLTuningRecord record;
+  if (tuning_db.Find(tuning_key_, &record)) {
+    auto iter = std::find_if(candidates.begin(), candidates.end(), [&record](const MKLTuningCandidate &candidate) {
+      return candidate.algorithm == record.algorithm;
+    });
+    if (iter != candidates.end() && SetBestThreadNum(record.thread_num)) {
+      MS_LOG(DEBUG) << "Use the tuned algorithm " << record.algorithm << " and thread num " << record.thread_num
+                    << " for " << tuning_key_;
+      primitive_ = iter->primitive;
+      return;
+    }
+    MS_LOG(INFO) << "The tuning record of " << tuning_key_ << " does not match the candidates, tune it again.";
+  }
+  tuning_candidates_ = std::move(candidates);
+}
+
+void MKLCpuKernelMod::TunePrimitive() {
+  // Tune one kernel at a time, so the kernels launched in parallel do not disturb the benchmark of each other.
+  static std::mutex tuning_mutex;
+  std::lock_guard<std::mutex> lock(tuning_mutex);
+  MKLTuningRecord best_record;
+  best_record.cost_us = DBL_MAX;
+  for (const auto &candidate : tuning_candidates_) {
+    MS_EXCEPTION_IF_NULL(candidate.primitive);
+    for (auto thread_num : GetTuningThreadNums()) {
+      auto cost_us = BenchmarkPrimitive(candidate.primitive, thread_num);
+      MS_LOG(DEBUG) << "Tune " << tuning_key_ << ", algorithm: " << candidate.algorithm
+                    << ", thread num: " << thread_num << ", cost: " << cost_us << " us";
+      if (cost_us < best_record.cost_us) {
+        best_record.algorithm = candidate.algorithm;
+        best_record.thread_num = thread_num;
+        best_record.cost_us = cost_us;
+        primitive_ = candidate.primitive;
+      }
+    }
+  }
+  MS_LOG(INFO) << "Tune " << tuning_key_ << " finish, best algorithm: " << best_record.algorithm
+               << ", thread num: " << best_record.thread_num << ", cost: " << best_record.cost_us << " us";
+  (void)SetBestThreadNum(best_record.thread_num);
+  MKLTuningDB::GetInstance().Update(tuning_key_, best_record);
+  tuning_candidates_.clear();
+}
+
+double MKLCpuKernelMod::BenchmarkPrimitive(const std::shared_ptr<dnnl::primitive> &primitive, size_t thread_num) {
+#ifdef USE_MS_THREADPOOL_FOR_DNNL
+  auto mkl_pool = dynamic_cast<mkl_threadpool *>(mkl_threadpool_.get());
+  MS_EXCEPTION_IF_NULL(mkl_pool);
+  mkl_pool->set_num_threads(SizeToInt(thread_num));
+#endif
+  // Skip the first execution to warm up.
+  primitive->execute(stream_, arguments_);
+  (void)stream_.wait();
+  double start_time = GetTime();
+  for (size_t i = 0; i < kTuningRepeatNum; ++i) {
+    primitive->execute(stream_, arguments_);
+  }
+  (void)stream_.wait();
+  return (GetTime() - start_time) * kSecondToUs / kTuningRepeatNum;
+}
+
+std::vector<size_t> MKLCpuKernelMod::GetTuningThreadNums() const {
+#ifdef USE_MS_THREADPOOL_FOR_DNNL
+  auto mkl_pool = dynamic_cast<mkl_threadpool *>(mkl_threadpool_.get());
+  MS_EXCEPTION_IF_NULL(mkl_pool);
+  // The thread numbers greater than the pool size run the same as the pool size, so only keep the first of them.
+  std::vector<size_t> thread_nums;
+  for (auto thread_num : kSearchThreadList) {
+    (void)thread_nums.emplace_back(thread_num);
+    if (thread_num >= mkl_pool->get_max_num_threads()) {
+      break;
+    }
+  }
+  return thread_nums;
+#else
+  return {0};
+#endif
+}
+
+bool MKLCpuKernelMod::SetBestThreadNum(size_t thread_num) {
+#ifdef USE_MS_THREADPOOL_FOR_DNNL
+  // Finish the thread number search of the execution by the tuned thread number.
+  auto iter = std::find(kSearchThreadList.begin(), kSearchThreadList.end(), thread_num);
+  if (iter == kSearchThreadList.end()) {
+    return false;
+  }
+  parallel_search_info_.best_pow = LongToSize(std::distance(kSearchThreadList.begin(), iter));
+  parallel_search_info_.search_count = kAvgCount * kSearchThreadList.size();
+  return true;
+#else
+  return thread_num == 0;
+#endif
+}
+
 void MKLCpuKernelMod::SetDataHandle(dnnl::memory mem, void *ptr) {
   MS_LOG(DEBUG) << "begin to invoke dnnl::memory::set_data_handle";
   mem.set_data_handle(ptr);
@@ -26,6 +26,7 @@
 #include "dnnl.hpp"
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
 #include "plugin/factory/ms_factory.h"
+#include "plugin/device/cpu/kernel/mkldnn/mkl_tuning_db.h"
 #ifdef USE_MS_THREADPOOL_FOR_DNNL
 #include "dnnl_threadpool.hpp"
 #include "dnnl_threadpool_iface.hpp"
@@ -139,6 +140,7 @@ class mkl_threadpool : public dnnl::threadpool_interop::threadpool_iface {
  public:
   explicit mkl_threadpool(ThreadPool *tp) : tp_(tp) {}
   void set_num_threads(int num) { thread_num_ = num; }
+  size_t get_max_num_threads() const { return tp_->GetKernelThreadNum(); }
   int get_num_threads() const override { return std::min(SizeToInt(tp_->GetKernelThreadNum()), thread_num_); }
   bool get_in_parallel() const override { return !first_parallel; }
   uint64_t get_flags() const override { return 0; }
@@ -172,6 +174,12 @@ struct PaddingInfo {
   bool ceil_mode{false};
 };
 
+// A candidate primitive of the kernel tuning, all the candidates of one kernel compute the same result.
+struct MKLTuningCandidate {
+  std::string algorithm;
+  std::shared_ptr<dnnl::primitive> primitive;
+};
+
 class DeprecatedMKLCpuKernelMod : public DeprecatedNativeCpuKernelMod {
  public:
 #ifdef USE_MS_THREADPOOL_FOR_DNNL
@@ -266,6 +274,11 @@ class MKLCpuKernelMod : public NativeCpuKernelMod {
   dnnl::memory::data_type GetDnnlDataType(TypeId ms_type_id) const;
   void SetDataHandle(dnnl::memory mem, void *ptr);
   void *GetDataHandle(const dnnl::memory &mem) const;
+  // Select the primitive from the candidates. If the tuning database is enabled, the fastest candidate and thread
+  // number are tuned at the first execution and saved in the database, otherwise the first candidate is used.
+  void SetTuningCandidates(const std::string &tuning_key, std::vector<MKLTuningCandidate> &&candidates);
+  // Find the tuning record of the kernel, so a tuned kernel only needs to create the candidate of the record.
+  bool FindTuningRecord(const std::string &tuning_key, MKLTuningRecord *const record) const;
   std::unordered_map<int, dnnl::memory> arguments_;
   std::shared_ptr<dnnl::primitive> primitive_{nullptr};
   dnnl::engine engine_;
@@ -273,6 +286,16 @@ class MKLCpuKernelMod : public NativeCpuKernelMod {
 #ifdef USE_MS_THREADPOOL_FOR_DNNL
   std::shared_ptr<dnnl::threadpool_interop::threadpool_iface> mkl_threadpool_{nullptr};
 #endif
+
+ private:
+  std::string GetMachineTuningKey(const std::string &tuning_key) const;
+  void TunePrimitive();
+  double BenchmarkPrimitive(const std::shared_ptr<dnnl::primitive> &primitive, size_t thread_num);
+  std::vector<size_t> GetTuningThreadNums() const;
+  bool SetBestThreadNum(size_t thread_num);
+
+  std::string tuning_key_;
+  std::vector<MKLTuningCandidate> tuning_candidates_;
 };
 }  // namespace kernel
 }  // namespace mindspore
@@ -0,0 +1,175 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/mkldnn/mkl_tuning_db.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/file.h>
+#endif
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "nlohmann/json.hpp"
+#include "include/common/debug/common.h"
+#include "utils/ms_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr char kCpuKernelTuneDBEnv[] = "MS_DEV_CPU_KERNEL_TUNE_DB";
+constexpr char kTuningDBVersion[] = "1";
+constexpr char kVersion[] = "version";
+constexpr char kRecords[] = "records";
+constexpr char kAlgorithm[] = "algorithm";
+constexpr char kThreadNum[] = "thread_num";
+constexpr char kCostUs[] = "cost_us";
+}  // namespace
+
+MKLTuningDB::MKLTuningDB(const std::string &db_path) {
+  if (db_path.empty()) {
+    return;
+  }
+  auto real_path = Common::CreatePrefixPath(db_path);
+  if (!real_path.has_value()) {
+    MS_LOG(WARNING) << "Get real path of the kernel tuning database failed, path: " << db_path
+                    << ", the kernel tuning is disabled.";
+    return;
+  }
+  db_path_ = real_path.value();
+  std::lock_guard<std::mutex> lock(mutex_);
+  Load();
+  MS_LOG(INFO) << "Load " << records_.size() << " records from the kernel tuning database " << db_path_;
+}
+
+MKLTuningDB &MKLTuningDB::GetInstance() {
+  static MKLTuningDB instance(common::GetEnv(kCpuKernelTuneDBEnv));
+  return instance;
+}
+
+std::string MKLTuningDB::BuildKey(const std::string &op_name, const std::vector<std::vector<int64_t>> &shapes,
+                                  const std::string &extra) {
+  std::ostringstream key;
+  key << op_name;
+  for (const auto &shape : shapes) {
+    key << "|";
+    for (size_t i = 0; i < shape.size(); ++i) {
+      key << (i == 0 ? "" : ",") << shape[i];
+    }
+  }
+  key << "|" << extra;
+  return key.str();
+}
+
+bool MKLTuningDB::Find(const std::string &key, MKLTuningRecord *const record) {
+  MS_EXCEPTION_IF_NULL(record);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = records_.find(key);
+  if (iter == records_.end()) {
+    return false;
+  }
+  *record = iter->second;
+  return true;
+}
+
+void MKLTuningDB::Update(const std::string &key, const MKLTuningRecord &record) {
+  if (!enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+#if !defined(_WIN32) && !defined(_WIN64)
+  // Lock the database against the other processes from the loading to the renaming, otherwise the records saved by
+  // one of them in between are lost.
+  auto lock_path = db_path_ + ".lock";
+  int fd = open(lock_path.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    MS_LOG(WARNING) << "Open file [" << lock_path << "] failed, errno: " << errno
+                    << ", the kernel tuning database is updated without locking.";
+  } else if (flock(fd, LOCK_EX) != 0) {
+    MS_LOG(WARNING) << "Lock file [" << lock_path << "] failed, errno: " << errno
+                    << ", the kernel tuning database is updated without locking.";
+  }
+#endif
+  // Merge the records saved by the other processes since the last loading.
+  Load();
+  records_[key] = record;
+  Save();
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (fd >= 0) {
+    (void)flock(fd, LOCK_UN);
+    (void)close(fd);
+  }
+#endif
+}
+
+size_t MKLTuningDB::size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return records_.size();
+}
+
+void MKLTuningDB::Load() {
+  std::ifstream ifs(db_path_);
+  if (!ifs.is_open()) {
+    return;
+  }
+  nlohmann::json db_json;
+  try {
+    ifs >> db_json;
+    if (db_json.at(kVersion).get<std::string>() != kTuningDBVersion) {
+      MS_LOG(WARNING) << "The version of the kernel tuning database " << db_path_ << " is not " << kTuningDBVersion
+                      << ", ignore the records in it.";
+      return;
+    }
+    for (const auto &item : db_json.at(kRecords).items()) {
+      MKLTuningRecord record;
+      record.algorithm = item.value().at(kAlgorithm).get<std::string>();
+      record.thread_num = item.value().at(kThreadNum).get<size_t>();
+      record.cost_us = item.value().at(kCostUs).get<double>();
+      records_[item.key()] = record;
+    }
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Parse the kernel tuning database " << db_path_ << " failed, error: " << e.what();
+  }
+}
+
+void MKLTuningDB::Save() {
+  nlohmann::json db_json;
+  db_json[kVersion] = kTuningDBVersion;
+  auto &records_json = db_json[kRecords];
+  records_json = nlohmann::json::object();
+  for (const auto &[key, record] : records_) {
+    records_json[key] = {{kAlgorithm, record.algorithm}, {kThreadNum, record.thread_num}, {kCostUs, record.cost_us}};
+  }
+
+  // Write a temporary file and rename it, so the other processes never read a partial file.
+  auto tmp_path = db_path_ + "." + std::to_string(getpid()) + ".tmp";
+  {
+    std::ofstream ofs(tmp_path, std::ios::out | std::ios::trunc);
+    if (!ofs.is_open()) {
+      MS_LOG(WARNING) << "Open file [" << tmp_path << "] failed, the kernel tuning records are not saved.";
+      return;
+    }
+    ofs << db_json.dump(1);
+  }
+  if (std::rename(tmp_path.c_str(), db_path_.c_str()) != 0) {
+    MS_LOG(WARNING) << "Rename " << tmp_path << " to " << db_path_ << " failed, errno: " << errno;
+    (void)std::remove(tmp_path.c_str());
+  }
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MKLDNN_MKL_TUNING_DB_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MKLDNN_MKL_TUNING_DB_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace kernel {
+// The tuned primitive of one kernel, thread_num 0 means the default thread number.
+struct MKLTuningRecord {
+  std::string algorithm;
+  size_t thread_num{0};
+  double cost_us{0};
+};
+
+// The persistent database of the tuned primitives, keyed by the operator, shapes, data type and cpu isa. The database
+// is a json file which is shared by the processes. An update holds the lock file "<db_path>.lock", merges the records of
+// the other processes and replaces the file by renaming.
+class BACKEND_EXPORT MKLTuningDB {
+ public:
+  explicit MKLTuningDB(const std::string &db_path);
+  ~MKLTuningDB() = default;
+
+  // The database set by the environment variable MS_DEV_CPU_KERNEL_TUNE_DB, the tuning is disabled if it is not set.
+  static MKLTuningDB &GetInstance();
+
+  static std::string BuildKey(const std::string &op_name, const std::vector<std::vector<int64_t>> &shapes,
+                              const std::string &extra);
+
+  bool enabled() const { return !db_path_.empty(); }
+  bool Find(const std::string &key, MKLTuningRecord *const record);
+  void Update(const std::string &key, const MKLTuningRecord &record);
+  size_t size();
+
+ private:
+  void Load();
+  void Save();
+
+  std::string db_path_;
+  std::mutex mutex_;
+  std::map<std::string, MKLTuningRecord> records_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MKLDNN_MKL_TUNING_DB_H_
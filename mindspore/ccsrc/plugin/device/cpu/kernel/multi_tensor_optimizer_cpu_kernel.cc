@@ -0,0 +1,366 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/multi_tensor_optimizer_cpu_kernel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include "mindspore/core/ops/adam.h"
+#include "mindspore/core/ops/adam_weight_decay.h"
+#include "mindspore/core/ops/apply_momentum.h"
+#include "mindspore/core/ops/op_name.h"
+#include "plugin/device/cpu/kernel/nnacl/errorcode.h"
+#include "plugin/device/cpu/kernel/nnacl/fp32/adam_fp32.h"
+#include "include/common/utils/utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kMultiTensorOptimizerOutputsNum = 1;
+// The number of elements in one chunk, so the parameter, gradient and states of a chunk stay in the cache together.
+constexpr size_t kChunkSize = 16384;
+constexpr size_t kScalarIndex = 0;
+
+// The input indexes of Adam: var, m, v, beta1_power, beta2_power, lr, beta1, beta2, epsilon, grad.
+constexpr size_t kAdamInputsNum = 10;
+constexpr size_t kAdamBeta1PowerIndex = 3;
+constexpr size_t kAdamBeta2PowerIndex = 4;
+constexpr size_t kAdamLrIndex = 5;
+constexpr size_t kAdamBeta1Index = 6;
+constexpr size_t kAdamBeta2Index = 7;
+constexpr size_t kAdamEpsilonIndex = 8;
+constexpr size_t kAdamGradIndex = 9;
+
+// The input indexes of AdamWeightDecay: var, m, v, lr, beta1, beta2, epsilon, decay, grad.
+constexpr size_t kAdamWeightDecayInputsNum = 9;
+constexpr size_t kAdamWeightDecayLrIndex = 3;
+constexpr size_t kAdamWeightDecayBeta1Index = 4;
+constexpr size_t kAdamWeightDecayBeta2Index = 5;
+constexpr size_t kAdamWeightDecayEpsilonIndex = 6;
+constexpr size_t kAdamWeightDecayDecayIndex = 7;
+constexpr size_t kAdamWeightDecayGradIndex = 8;
+
+// The input indexes of ApplyMomentum: var, accumulation, lr, grad, momentum.
+constexpr size_t kApplyMomentumInputsNum = 5;
+constexpr size_t kApplyMomentumLrIndex = 2;
+constexpr size_t kApplyMomentumGradIndex = 3;
+constexpr size_t kApplyMomentumMomentumIndex = 4;
+
+// The var, m and v (or accumulation) are the first inputs of all the supported optimizers.
+constexpr size_t kVarIndex = 0;
+constexpr size_t kMIndex = 1;
+constexpr size_t kVIndex = 2;
+
+bool IsUnitScale(float grad_scale) { return std::fabs(grad_scale - 1.0f) <= std::numeric_limits<float>::epsilon(); }
+}  // namespace
+
+bool MultiTensorOptimizerCpuKernelMod::Init(const BaseOperatorPtr &base_operator,
+                                            const std::vector<KernelTensorPtr> &inputs,
+                                            const std::vector<KernelTensorPtr> &outputs) {
+  MS_EXCEPTION_IF_NULL(base_operator);
+  kernel_name_ = base_operator->name();
+  auto prim = base_operator->GetPrim();
+  MS_EXCEPTION_IF_NULL(prim);
+  if (!prim->HasAttr(kAttrN) || !prim->HasAttr(kAttrOptimizerType)) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the attr '" << kAttrN << "' and '" << kAttrOptimizerType
+                  << "' must be set.";
+    return false;
+  }
+  param_num_ = LongToSize(GetValue<int64_t>(prim->GetAttr(kAttrN)));
+  optimizer_type_ = GetValue<std::string>(prim->GetAttr(kAttrOptimizerType));
+  if (optimizer_type_ == ops::kNameAdam) {
+    input_num_per_param_ = kAdamInputsNum;
+    grad_index_ = kAdamGradIndex;
+  } else if (optimizer_type_ == ops::kAdamWeightDecay) {
+    input_num_per_param_ = kAdamWeightDecayInputsNum;
+    grad_index_ = kAdamWeightDecayGradIndex;
+  } else if (optimizer_type_ == ops::kNameApplyMomentum) {
+    input_num_per_param_ = kApplyMomentumInputsNum;
+    grad_index_ = kApplyMomentumGradIndex;
+  } else {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the optimizer type must be one of Adam, AdamWeightDecay and "
+                  << "ApplyMomentum, but got " << optimizer_type_;
+    return false;
+  }
+  use_nesterov_ = prim->HasAttr(ops::kUseNesterov) && GetValue<bool>(prim->GetAttr(ops::kUseNesterov));
+  clip_global_norm_ = prim->HasAttr(kAttrClipGlobalNorm) ? GetValue<float>(prim->GetAttr(kAttrClipGlobalNorm)) : 0.0f;
+  grad_accumulation_steps_ =
+    prim->HasAttr(kAttrGradAccumulationSteps) ? GetValue<int64_t>(prim->GetAttr(kAttrGradAccumulationSteps)) : 1;
+  if (grad_accumulation_steps_ < 1) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the gradient accumulation steps must be positive, but got "
+                  << grad_accumulation_steps_;
+    return false;
+  }
+  // The beta powers of Adam are advanced by the graph on every launch, so they would not match the number of the
+  // updates when the gradients are accumulated.
+  if (grad_accumulation_steps_ > 1 && optimizer_type_ == ops::kNameAdam) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the gradient accumulation is not supported by Adam, but got "
+                  << "the gradient accumulation steps " << grad_accumulation_steps_;
+    return false;
+  }
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), param_num_ * input_num_per_param_, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMultiTensorOptimizerOutputsNum, kernel_name_);
+
+  auto kernel_attr = GetKernelAttrFromTensors(inputs, outputs);
+  auto [is_match, index] = MatchKernelAttr(kernel_attr, GetOpSupport());
+  if (!is_match) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', it does not support this kernel data type: " << kernel_attr;
+    return false;
+  }
+  (void)index;
+  return true;
+}
+
+int MultiTensorOptimizerCpuKernelMod::Resize(const BaseOperatorPtr &base_operator,
+                                             const std::vector<KernelTensorPtr> &inputs,
+                                             const std::vector<KernelTensorPtr> &outputs,
+                                             const std::map<uint32_t, tensor::TensorPtr> &inputsOnHost) {
+  int ret = KernelMod::Resize(base_operator, inputs, outputs, inputsOnHost);
+  if (ret != KRET_OK) {
+    return ret;
+  }
+  elem_nums_.clear();
+  for (size_t i = 0; i < param_num_; ++i) {
+    const auto &var_shape = inputs[i * input_num_per_param_ + kVarIndex]->GetShapeVector();
+    const auto &grad_shape = inputs[i * input_num_per_param_ + grad_index_]->GetShapeVector();
+    if (!IsSameShape(var_shape, grad_shape)) {
+      MS_LOG(ERROR) << "For '" << kernel_name_ << "', the shape of 'grad' must be the same as 'var' of parameter " << i
+                    << ", but got the shape of 'grad': " << Vector2Str(grad_shape)
+                    << " and 'var': " << Vector2Str(var_shape);
+      return KRET_RESIZE_FAILED;
+    }
+    (void)elem_nums_.emplace_back(SizeOf(var_shape));
+  }
+  InitChunks();
+  accumulated_steps_ = 0;
+  accumulated_grads_.clear();
+  if (grad_accumulation_steps_ > 1) {
+    (void)std::transform(elem_nums_.begin(), elem_nums_.end(), std::back_inserter(accumulated_grads_),
+                         [](size_t elem_num) { return std::vector<float>(elem_num, 0.0f); });
+  }
+  return KRET_OK;
+}
+
+void MultiTensorOptimizerCpuKernelMod::InitChunks() {
+  chunks_.clear();
+  for (size_t i = 0; i < elem_nums_.size(); ++i) {
+    for (size_t start = 0; start < elem_nums_[i]; start += kChunkSize) {
+      (void)chunks_.emplace_back(Chunk{i, start, std::min(start + kChunkSize, elem_nums_[i])});
+    }
+  }
+}
+
+const float *MultiTensorOptimizerCpuKernelMod::GetGradient(const std::vector<AddressPtr> &inputs,
+                                                           size_t param_index) const {
+  if (!accumulated_grads_.empty()) {
+    return accumulated_grads_[param_index].data();
+  }
+  return reinterpret_cast<float *>(inputs[param_index * input_num_per_param_ + grad_index_]->addr);
+}
+
+void MultiTensorOptimizerCpuKernelMod::AccumulateGradients(const std::vector<AddressPtr> &inputs) {
+  auto task = [this, &inputs](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      const auto &chunk = chunks_[i];
+      auto grad = reinterpret_cast<float *>(inputs[chunk.param_index * input_num_per_param_ + grad_index_]->addr);
+      auto accumulated_grad = accumulated_grads_[chunk.param_index].data();
+      for (size_t j = chunk.start; j < chunk.end; ++j) {
+        accumulated_grad[j] += grad[j];
+      }
+    }
+  };
+  ParallelLaunch(task, chunks_.size(), 1, this);
+}
+
+float MultiTensorOptimizerCpuKernelMod::ComputeGlobalNorm(const std::vector<AddressPtr> &inputs, float grad_scale) {
+  // Sum the chunks in order after the parallel launch, so the norm does not depend on the thread number.
+  std::vector<double> square_sums(chunks_.size(), 0.0);
+  auto task = [this, &inputs, &square_sums](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      const auto &chunk = chunks_[i];
+      auto grad = GetGradient(inputs, chunk.param_index);
+      double square_sum = 0.0;
+      for (size_t j = chunk.start; j < chunk.end; ++j) {
+        square_sum += static_cast<double>(grad[j]) * grad[j];
+      }
+      square_sums[i] = square_sum;
+    }
+  };
+  ParallelLaunch(task, chunks_.size(), 1, this);
+  double square_sum = 0.0;
+  for (auto sum : square_sums) {
+    square_sum += sum;
+  }
+  return static_cast<float>(std::sqrt(square_sum)) * grad_scale;
+}
+
+void MultiTensorOptimizerCpuKernelMod::LaunchAdam(const std::vector<AddressPtr> &inputs, const Chunk &chunk,
+                                                  float grad_scale) const {
+  auto input = [this, &inputs, &chunk](size_t index) {
+    return reinterpret_cast<float *>(inputs[chunk.param_index * input_num_per_param_ + index]->addr);
+  };
+  auto var = input(kVarIndex);
+  auto m = input(kMIndex);
+  auto v = input(kVIndex);
+  auto beta1_power = input(kAdamBeta1PowerIndex)[kScalarIndex];
+  auto beta2_power = input(kAdamBeta2PowerIndex)[kScalarIndex];
+  auto lr = input(kAdamLrIndex)[kScalarIndex];
+  auto beta1 = input(kAdamBeta1Index)[kScalarIndex];
+  auto beta2 = input(kAdamBeta2Index)[kScalarIndex];
+  auto epsilon = input(kAdamEpsilonIndex)[kScalarIndex];
+  auto gradient = GetGradient(inputs, chunk.param_index);
+  constexpr float ONE = 1.0;
+  float new_lr = lr * std::sqrt(ONE - beta2_power) / (ONE - beta1_power);
+  if (IsUnitScale(grad_scale)) {
+    int ret = AdamFp32(var, m, v, new_lr, beta1, beta2, epsilon, gradient, chunk.start, chunk.end, use_nesterov_);
+    if (ret != NNACL_OK) {
+      MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', AdamFp32 failed. Error no: " << ret;
+    }
+    return;
+  }
+  size_t i = chunk.start;
+  if (!use_nesterov_) {
+    // Adam is AdamWeightDecay with the bias corrected learning rate and zero decay.
+    i = FusedCastAdamFp32Fp32(var, gradient, m, v, new_lr, beta1, beta2, epsilon, 0.0f, grad_scale, chunk.start,
+                              chunk.end);
+  }
+  for (; i < chunk.end; ++i) {
+    auto grad = gradient[i] * grad_scale;
+    m[i] += (grad - m[i]) * (ONE - beta1);
+    v[i] += (grad * grad - v[i]) * (ONE - beta2);
+    if (use_nesterov_) {
+      var[i] -= new_lr * (m[i] * beta1 + (ONE - beta1) * grad) / (std::sqrt(v[i]) + epsilon);
+    } else {
+      var[i] -= new_lr * m[i] / (std::sqrt(v[i]) + epsilon);
+    }
+  }
+}
+
+void MultiTensorOptimizerCpuKernelMod::LaunchAdamWeightDecay(const std::vector<AddressPtr> &inputs,
+                                                             const Chunk &chunk, float grad_scale) const {
+  auto input = [this, &inputs, &chunk](size_t index) {
+    return reinterpret_cast<float *>(inputs[chunk.param_index * input_num_per_param_ + index]->addr);
+  };
+  auto var = input(kVarIndex);
+  auto m = input(kMIndex);
+  auto v = input(kVIndex);
+  auto lr = input(kAdamWeightDecayLrIndex)[kScalarIndex];
+  auto beta1 = input(kAdamWeightDecayBeta1Index)[kScalarIndex];
+  auto beta2 = input(kAdamWeightDecayBeta2Index)[kScalarIndex];
+  auto epsilon = input(kAdamWeightDecayEpsilonIndex)[kScalarIndex];
+  auto decay = input(kAdamWeightDecayDecayIndex)[kScalarIndex];
+  auto gradient = GetGradient(inputs, chunk.param_index);
+  if (IsUnitScale(grad_scale)) {
+    int ret = AdamWeightDecayFp32(var, m, v, lr, beta1, beta2, epsilon, decay, gradient, chunk.start, chunk.end);
+    if (ret != NNACL_OK) {
+      MS_LOG(EXCEPTION) << "For '" << kernel_name_ << "', AdamWeightDecayFp32 failed. Error no: " << ret;
+    }
+    return;
+  }
+  size_t i = FusedCastAdamFp32Fp32(var, gradient, m, v, lr, beta1, beta2, epsilon, decay, grad_scale, chunk.start,
+                                   chunk.end);
+  const auto beta1_minus = 1 - beta1;
+  const auto beta2_minus = 1 - beta2;
+  for (; i < chunk.end; ++i) {
+    auto grad = gradient[i] * grad_scale;
+    m[i] += (grad - m[i]) * beta1_minus;
+    v[i] += (grad * grad - v[i]) * beta2_minus;
+    var[i] -= lr * (m[i] / (std::sqrt(v[i]) + epsilon) + decay * var[i]);
+  }
+}
+
+void MultiTensorOptimizerCpuKernelMod::LaunchApplyMomentum(const std::vector<AddressPtr> &inputs, const Chunk &chunk,
+                                                           float grad_scale) const {
+  auto input = [this, &inputs, &chunk](size_t index) {
+    return reinterpret_cast<float *>(inputs[chunk.param_index * input_num_per_param_ + index]->addr);
+  };
+  auto var = input(kVarIndex);
+  auto accumulation = input(kMIndex);
+  auto lr = input(kApplyMomentumLrIndex)[kScalarIndex];
+  auto momentum = input(kApplyMomentumMomentumIndex)[kScalarIndex];
+  auto gradient = GetGradient(inputs, chunk.param_index);
+  for (size_t i = chunk.start; i < chunk.end; ++i) {
+    auto grad = gradient[i] * grad_scale;
+    accumulation[i] = accumulation[i] * momentum + grad;
+    if (use_nesterov_) {
+      var[i] -= (grad + accumulation[i] * momentum) * lr;
+    } else {
+      var[i] -= accumulation[i] * lr;
+    }
+  }
+}
+
+void MultiTensorOptimizerCpuKernelMod::UpdateChunk(const std::vector<AddressPtr> &inputs, const Chunk &chunk,
+                                                   float grad_scale) const {
+  if (optimizer_type_ == ops::kNameAdam) {
+    LaunchAdam(inputs, chunk, grad_scale);
+  } else if (optimizer_type_ == ops::kAdamWeightDecay) {
+    LaunchAdamWeightDecay(inputs, chunk, grad_scale);
+  } else {
+    LaunchApplyMomentum(inputs, chunk, grad_scale);
+  }
+}
+
+bool MultiTensorOptimizerCpuKernelMod::Launch(const std::vector<kernel::AddressPtr> &inputs,
+                                              const std::vector<kernel::AddressPtr> &,
+                                              const std::vector<kernel::AddressPtr> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), param_num_ * input_num_per_param_, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMultiTensorOptimizerOutputsNum, kernel_name_);
+  auto global_norm = reinterpret_cast<float *>(outputs[kIndex0]->addr);
+  MS_EXCEPTION_IF_NULL(global_norm);
+  global_norm[kScalarIndex] = 0.0f;
+
+  float grad_scale = 1.0f;
+  if (grad_accumulation_steps_ > 1) {
+    AccumulateGradients(inputs);
+    if (++accumulated_steps_ < grad_accumulation_steps_) {
+      return true;
+    }
+    accumulated_steps_ = 0;
+    grad_scale = 1.0f / static_cast<float>(grad_accumulation_steps_);
+  }
+  if (clip_global_norm_ > 0.0f) {
+    global_norm[kScalarIndex] = ComputeGlobalNorm(inputs, grad_scale);
+    if (global_norm[kScalarIndex] > clip_global_norm_) {
+      grad_scale *= clip_global_norm_ / global_norm[kScalarIndex];
+    }
+  }
+
+  auto task = [this, &inputs, grad_scale](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      const auto &chunk = chunks_[i];
+      UpdateChunk(inputs, chunk, grad_scale);
+      if (!accumulated_grads_.empty()) {
+        auto accumulated_grad = accumulated_grads_[chunk.param_index].begin();
+        std::fill(accumulated_grad + SizeToLong(chunk.start), accumulated_grad + SizeToLong(chunk.end), 0.0f);
+      }
+    }
+  };
+  ParallelLaunch(task, chunks_.size(), 1, this);
+  return true;
+}
+
+std::vector<KernelAttr> MultiTensorOptimizerCpuKernelMod::GetOpSupport() {
+  static std::vector<KernelAttr> support_list = {
+    KernelAttr().AddAllSameAttr(true).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32)};
+  return support_list;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, MultiTensorOptimizer, MultiTensorOptimizerCpuKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
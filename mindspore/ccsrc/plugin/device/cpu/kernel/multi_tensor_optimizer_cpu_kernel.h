@@ -0,0 +1,82 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MULTI_TENSOR_OPTIMIZER_CPU_KERNEL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MULTI_TENSOR_OPTIMIZER_CPU_KERNEL_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/factory/ms_factory.h"
+
+namespace mindspore {
+namespace kernel {
+// Update the parameters of n optimizer nodes of the same type (Adam, AdamWeightDecay or ApplyMomentum) in one launch.
+// The inputs are the inputs of the original nodes one after another, and the parameters are split into chunks which
+// run in the thread pool together. The gradients can be clipped by the global norm of all the gradients, and be
+// accumulated in the kernel for several steps before the update. The output is the global norm of the gradients.
+class MultiTensorOptimizerCpuKernelMod : public NativeCpuKernelMod {
+ public:
+  MultiTensorOptimizerCpuKernelMod() = default;
+  ~MultiTensorOptimizerCpuKernelMod() override = default;
+
+  bool Init(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+            const std::vector<KernelTensorPtr> &outputs) override;
+
+  int Resize(
+    const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+    const std::vector<KernelTensorPtr> &outputs,
+    const std::map<uint32_t, tensor::TensorPtr> &inputsOnHost = std::map<uint32_t, tensor::TensorPtr>()) override;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs) override;
+
+  std::vector<KernelAttr> GetOpSupport() override;
+
+ private:
+  struct Chunk {
+    size_t param_index;
+    size_t start;
+    size_t end;
+  };
+
+  void InitChunks();
+  const float *GetGradient(const std::vector<AddressPtr> &inputs, size_t param_index) const;
+  void AccumulateGradients(const std::vector<AddressPtr> &inputs);
+  float ComputeGlobalNorm(const std::vector<AddressPtr> &inputs, float grad_scale);
+  void UpdateChunk(const std::vector<AddressPtr> &inputs, const Chunk &chunk, float grad_scale) const;
+  void LaunchAdam(const std::vector<AddressPtr> &inputs, const Chunk &chunk, float grad_scale) const;
+  void LaunchAdamWeightDecay(const std::vector<AddressPtr> &inputs, const Chunk &chunk, float grad_scale) const;
+  void LaunchApplyMomentum(const std::vector<AddressPtr> &inputs, const Chunk &chunk, float grad_scale) const;
+
+  std::string optimizer_type_;
+  size_t param_num_{0};
+  size_t input_num_per_param_{0};
+  size_t grad_index_{0};
+  bool use_nesterov_{false};
+  float clip_global_norm_{0.0f};
+  int64_t grad_accumulation_steps_{1};
+  int64_t accumulated_steps_{0};
+  std::vector<size_t> elem_nums_;
+  std::vector<Chunk> chunks_;
+  // The gradients accumulated between the updates, which live across the steps so they are owned by the kernel.
+  std::vector<std::vector<float>> accumulated_grads_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MULTI_TENSOR_OPTIMIZER_CPU_KERNEL_H_
@@ -23,6 +23,12 @@ typedef struct AttentionParameter {
   int head_num_;
   int head_size_;
   bool cross_;
+  // args for compute
+  int batch_;       // batch of query
+  int q_seq_;       // length of sequence of the tokens of this step
+  int max_seq_;     // capacity of the key/value cache on the sequence dim
+  int cache_len_;   // number of tokens already in the key/value cache
+  bool is_causal_;  // token i of this step only attends to the cache and tokens [0, i] of this step
 } AttentionParameter;
 
 typedef struct RelativePositionAttentionParameter {
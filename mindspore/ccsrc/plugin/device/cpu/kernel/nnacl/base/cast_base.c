@@ -36,3 +36,15 @@ void Float32ToInt32(const float *input, int32_t *output, int number) {
     output[index] = (int32_t)input[index];
   }
 }
+
+void Float32ToBFloat16(const float *input, uint16_t *output, int number) {
+  for (int i = 0; i < number; ++i) {
+    output[i] = Float32ToBFloat16Value(input[i]);
+  }
+}
+
+void BFloat16ToFloat32(const uint16_t *input, float *output, int number) {
+  for (int i = 0; i < number; ++i) {
+    output[i] = BFloat16ToFloat32Value(input[i]);
+  }
+}
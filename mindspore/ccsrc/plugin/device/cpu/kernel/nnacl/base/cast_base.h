@@ -125,6 +125,27 @@ inline void Float32ToBool(const float *input, bool *output, int number) {
   }
 }
 
+/* bfloat16 keeps the high 16 bits of float32, the conversion rounds to nearest even and keeps nan quiet */
+static inline uint16_t Float32ToBFloat16Value(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000) {
+    return (uint16_t)((bits >> 16) | 0x40);
+  }
+  bits += 0x7fff + ((bits >> 16) & 1);
+  return (uint16_t)(bits >> 16);
+}
+
+static inline float BFloat16ToFloat32Value(uint16_t value) {
+  uint32_t bits = (uint32_t)value << 16;
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+void Float32ToBFloat16(const float *input, uint16_t *output, int number);
+void BFloat16ToFloat32(const uint16_t *input, float *output, int number);
+
 #ifdef __cplusplus
 }
 #endif
@@ -567,3 +567,75 @@ void RelPosAttention(RelativePositionAttentionParameter *param, Matrix *logits_m
               logits2v_trans_mat->row_, wo_mat->col_, wo_mat->col_, OutType_Nhwc);
   }
 }
+
+void PackAttentionInput(const float *src, float *dst, int row, int deep, int row_tile) {
+  switch (row_tile) {
+    case C6NUM:
+      RowMajor2Col6Major(src, dst, row, deep);
+      break;
+    case C4NUM:
+      RowMajor2Col4Major(src, dst, row, deep);
+      break;
+    default:
+      RowMajor2Col12Major(src, dst, row, deep);
+      break;
+  }
+}
+
+void KVCacheAppend(const AttentionParameter *param, const float *src, int src_stride, float *cache) {
+  int head_num = param->head_num_;
+  int head_size = param->head_size_;
+  for (int b = 0; b < param->batch_; b++) {
+    for (int h = 0; h < head_num; h++) {
+      float *dst = cache + ((b * head_num + h) * param->max_seq_ + param->cache_len_) * head_size;
+      const float *cur_src = src + b * param->q_seq_ * src_stride + h * head_size;
+      for (int i = 0; i < param->q_seq_; i++) {
+        memcpy(dst + i * head_size, cur_src + i * src_stride, head_size * sizeof(float));
+      }
+    }
+  }
+}
+
+void KVCacheAttention(const AttentionParameter *param, const float *q, int q_stride, const float *k_cache,
+                      const float *v_cache, const float *mask, float *out, float *logits, int start, int end) {
+  int head_num = param->head_num_;
+  int head_size = param->head_size_;
+  int hidden = head_num * head_size;
+  int kv_seq = param->cache_len_ + param->q_seq_;
+  float scale = 1.0f / sqrtf((float)head_size);
+  for (int task = start; task < end; task++) {
+    int b = task / head_num;
+    int h = task % head_num;
+    const float *cur_k = k_cache + task * param->max_seq_ * head_size;
+    const float *cur_v = v_cache + task * param->max_seq_ * head_size;
+    for (int i = 0; i < param->q_seq_; i++) {
+      int row = b * param->q_seq_ + i;
+      const float *cur_q = q + row * q_stride + h * head_size;
+      int seen = param->is_causal_ ? param->cache_len_ + i + 1 : kv_seq;
+      for (int t = 0; t < seen; t++) {
+        const float *k = cur_k + t * head_size;
+        float dot = 0.0f;
+        for (int d = 0; d < head_size; d++) {
+          dot += cur_q[d] * k[d];
+        }
+        logits[t] = dot * scale;
+      }
+      if (mask != NULL) {
+        const float *cur_mask = mask + row * kv_seq;
+        for (int t = 0; t < seen; t++) {
+          logits[t] += (1.0f - cur_mask[t]) * -10000.0f;
+        }
+      }
+      (void)SoftmaxLastAxis(logits, logits, 1, seen);
+      float *cur_out = out + row * hidden + h * head_size;
+      memset(cur_out, 0, head_size * sizeof(float));
+      for (int t = 0; t < seen; t++) {
+        const float *v = cur_v + t * head_size;
+        float weight = logits[t];
+        for (int d = 0; d < head_size; d++) {
+          cur_out[d] += weight * v[d];
+        }
+      }
+    }
+  }
+}
@@ -66,6 +66,19 @@ void CalculateLogits(RelativePositionAttentionParameter *param, Matrix *q2wq_wit
 void RelPosAttention(RelativePositionAttentionParameter *param, Matrix *logits_mat, Matrix *softmax_mat,
                      Matrix *v2wv_trans_mat, Matrix *logits2v_mat, Matrix *logits2v_trans_mat, const Matrix *wo_mat,
                      Matrix *bo_mat, Matrix *output_mat);
+
+/* pack a row-major [row, deep] matrix as the left matrix of MatMulOpt, a single row is packed as a partial tile */
+void PackAttentionInput(const float *src, float *dst, int row, int deep, int row_tile);
+
+/* src is [batch, q_seq, head_num * head_size] with a row stride of src_stride, the cache is
+ * [batch, head_num, max_seq, head_size] and the tokens are written from position cache_len */
+void KVCacheAppend(const AttentionParameter *param, const float *src, int src_stride, float *cache);
+
+/* q is [batch, q_seq, head_num * head_size] with a row stride of q_stride, out is [batch, q_seq, head_num * head_size]
+ * and mask, if any, is [batch, q_seq, cache_len + q_seq]. logits holds cache_len + q_seq floats per task and the
+ * range [start, end) is on batch * head_num */
+void KVCacheAttention(const AttentionParameter *param, const float *q, int q_stride, const float *k_cache,
+                      const float *v_cache, const float *mask, float *out, float *logits, int start, int end);
 #ifdef __cplusplus
 }
 #endif
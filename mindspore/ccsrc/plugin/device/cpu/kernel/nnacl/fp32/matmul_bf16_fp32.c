@@ -0,0 +1,246 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#include <string.h>
+#include "nnacl/base/cast_base.h"
+#ifdef ENABLE_AVX
+#include <immintrin.h>
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+/* the kernel is compiled with target pragmas, gcc supports avx512-bf16 since 10 */
+#if defined(ENABLE_AVX) && defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 10)
+#define ENABLE_AVX512_BF16_KERNEL
+#endif
+
+#define BF16_COL_BLOCK 16
+#define BF16_PAIR 2
+#define BF16_BLOCK_SIZE (BF16_COL_BLOCK * BF16_PAIR)
+#define BF16_ROW_TILE 4
+#define BF16_MAX_COL_BLOCK 4
+#define BF16_DEEP_CHUNK 512
+#define BF16_RELU6_MAX 6.0f
+
+int MatMulBf16PackSize(int deep, int col) { return UP_ROUND(col, BF16_COL_BLOCK) * UP_ROUND(deep, BF16_PAIR); }
+
+static inline int PackedBf16Index(int k, int c, int deep2) {
+  return ((c / BF16_COL_BLOCK) * deep2 + k / BF16_PAIR) * BF16_BLOCK_SIZE + (c % BF16_COL_BLOCK) * BF16_PAIR +
+         k % BF16_PAIR;
+}
+
+void RowMajor2Row16x2MajorBf16Parallel(const float *src, uint16_t *dst, int deep, int col, int start_row,
+                                       int end_row) {
+  int deep2 = UP_DIV(deep, BF16_PAIR);
+  int col_align = UP_ROUND(col, BF16_COL_BLOCK);
+  for (int k = start_row; k < end_row; ++k) {
+    for (int c = 0; c < col_align; ++c) {
+      dst[PackedBf16Index(k, c, deep2)] = c < col ? Float32ToBFloat16Value(src[k * col + c]) : 0;
+    }
+  }
+  if (start_row < end_row && end_row == deep && deep % BF16_PAIR != 0) {
+    for (int c = 0; c < col_align; ++c) {
+      dst[PackedBf16Index(deep, c, deep2)] = 0;
+    }
+  }
+}
+
+void RowMajor2Col16x2MajorBf16Parallel(const float *src, uint16_t *dst, int col, int deep, int start_row,
+                                       int end_row) {
+  int deep2 = UP_DIV(deep, BF16_PAIR);
+  int deep_align = deep2 * BF16_PAIR;
+  for (int c = start_row; c < end_row; ++c) {
+    for (int k = 0; k < deep_align; ++k) {
+      dst[PackedBf16Index(k, c, deep2)] = k < deep ? Float32ToBFloat16Value(src[c * deep + k]) : 0;
+    }
+  }
+  if (start_row < end_row && end_row == col) {
+    for (int c = col; c < UP_ROUND(col, BF16_COL_BLOCK); ++c) {
+      for (int k = 0; k < deep_align; ++k) {
+        dst[PackedBf16Index(k, c, deep2)] = 0;
+      }
+    }
+  }
+}
+
+static void MatMulBf16Fp32C(const float *a, const uint16_t *b, float *c, const float *bias, ActType act_type,
+                            int deep, int row, int col, int col_stride) {
+  int deep2 = UP_DIV(deep, BF16_PAIR);
+  for (int r = 0; r < row; ++r) {
+    const float *src_a = a + r * deep;
+    for (int cb = 0; cb < col; cb += BF16_COL_BLOCK) {
+      const uint16_t *src_b = b + cb * deep2 * BF16_PAIR;
+      float acc[BF16_COL_BLOCK] = {0};
+      for (int k = 0; k < deep; ++k) {
+        const uint16_t *weight = src_b + (k / BF16_PAIR) * BF16_BLOCK_SIZE + k % BF16_PAIR;
+        for (int i = 0; i < BF16_COL_BLOCK; ++i) {
+          acc[i] += src_a[k] * BFloat16ToFloat32Value(weight[i * BF16_PAIR]);
+        }
+      }
+      int cur_col = MSMIN(BF16_COL_BLOCK, col - cb);
+      for (int i = 0; i < cur_col; ++i) {
+        float value = acc[i] + (bias != NULL ? bias[cb + i] : 0.0f);
+        if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+          value = MSMAX(value, 0.0f);
+        }
+        if (act_type == ActType_Relu6) {
+          value = MSMIN(value, BF16_RELU6_MAX);
+        }
+        c[r * col_stride + cb + i] = value;
+      }
+    }
+  }
+}
+
+#ifdef ENABLE_AVX512_BF16_KERNEL
+#pragma GCC push_options
+#pragma GCC target("avx512f", "avx512bw", "avx512bf16")
+static inline __mmask16 Bf16ColMask(int num) {
+  return num >= BF16_COL_BLOCK ? (__mmask16)0xffff : (num <= 0 ? (__mmask16)0 : (__mmask16)((1u << num) - 1));
+}
+
+/* rounds rows x [k_start, k_end) of the input to bfloat16 pairs, the odd tail is padded with zero */
+static void ConvertInputToBf16Avx512(const float *a, int deep, int rows, int k_start, int k_end, uint16_t *dst) {
+  int num = k_end - k_start;
+  for (int i = 0; i < rows; ++i) {
+    const float *src = a + i * deep + k_start;
+    uint16_t *out = dst + i * BF16_DEEP_CHUNK;
+    for (int k = 0; k < num; k += BF16_BLOCK_SIZE) {
+      __m512 low = _mm512_maskz_loadu_ps(Bf16ColMask(num - k), src + k);
+      __m512 high = _mm512_maskz_loadu_ps(Bf16ColMask(num - k - BF16_COL_BLOCK), src + k + BF16_COL_BLOCK);
+      _mm512_storeu_si512(out + k, (__m512i)_mm512_cvtne2ps_pbh(high, low));
+    }
+  }
+}
+
+static inline __attribute__((always_inline)) void MatMulBf16Avx512Tile(const uint16_t *a_bf16, const uint16_t *b,
+                                                                      float *c, const float *bias, ActType act_type,
+                                                                      int deep2, int k2_start, int k2_num, int rows,
+                                                                      int col, int col_stride, bool first, bool last,
+                                                                      const int col_block) {
+  __m512 acc[BF16_ROW_TILE][BF16_MAX_COL_BLOCK];
+#pragma GCC unroll 4
+  for (int i = 0; i < BF16_ROW_TILE; ++i) {
+#pragma GCC unroll 4
+    for (int j = 0; j < col_block; ++j) {
+      __mmask16 mask = Bf16ColMask(col - j * BF16_COL_BLOCK);
+      if (i >= rows) {
+        acc[i][j] = _mm512_setzero_ps();
+      } else if (!first) {
+        acc[i][j] = _mm512_maskz_loadu_ps(mask, c + i * col_stride + j * BF16_COL_BLOCK);
+      } else {
+        acc[i][j] = bias == NULL ? _mm512_setzero_ps() : _mm512_maskz_loadu_ps(mask, bias + j * BF16_COL_BLOCK);
+      }
+    }
+  }
+  for (int k2 = 0; k2 < k2_num; ++k2) {
+    __m512i weight[BF16_MAX_COL_BLOCK];
+#pragma GCC unroll 4
+    for (int j = 0; j < col_block; ++j) {
+      weight[j] = _mm512_loadu_si512(b + (j * deep2 + k2_start + k2) * BF16_BLOCK_SIZE);
+    }
+#pragma GCC unroll 4
+    for (int i = 0; i < BF16_ROW_TILE; ++i) {
+      int32_t pair;
+      memcpy(&pair, a_bf16 + i * BF16_DEEP_CHUNK + k2 * BF16_PAIR, sizeof(pair));
+      __m512i input = _mm512_set1_epi32(pair);
+#pragma GCC unroll 4
+      for (int j = 0; j < col_block; ++j) {
+        acc[i][j] = _mm512_dpbf16_ps(acc[i][j], (__m512bh)input, (__m512bh)weight[j]);
+      }
+    }
+  }
+#pragma GCC unroll 4
+  for (int i = 0; i < BF16_ROW_TILE; ++i) {
+    if (i >= rows) {
+      break;
+    }
+#pragma GCC unroll 4
+    for (int j = 0; j < col_block; ++j) {
+      __m512 value = acc[i][j];
+      if (last && (act_type == ActType_Relu || act_type == ActType_Relu6)) {
+        value = _mm512_max_ps(value, _mm512_setzero_ps());
+      }
+      if (last && act_type == ActType_Relu6) {
+        value = _mm512_min_ps(value, _mm512_set1_ps(BF16_RELU6_MAX));
+      }
+      _mm512_mask_storeu_ps(c + i * col_stride + j * BF16_COL_BLOCK, Bf16ColMask(col - j * BF16_COL_BLOCK), value);
+    }
+  }
+}
+
+static void MatMulBf16Avx512(const float *a, const uint16_t *b, float *c, const float *bias, ActType act_type,
+                             int deep, int row, int col, int col_stride) {
+  int deep2 = UP_DIV(deep, BF16_PAIR);
+  uint16_t a_bf16[BF16_ROW_TILE * BF16_DEEP_CHUNK] __attribute__((aligned(64)));
+  memset(a_bf16, 0, sizeof(a_bf16));
+  for (int r = 0; r < row; r += BF16_ROW_TILE) {
+    int rows = MSMIN(BF16_ROW_TILE, row - r);
+    for (int k = 0; k < deep; k += BF16_DEEP_CHUNK) {
+      int k_end = MSMIN(deep, k + BF16_DEEP_CHUNK);
+      ConvertInputToBf16Avx512(a + r * deep, deep, rows, k, k_end, a_bf16);
+      int k2_start = k / BF16_PAIR;
+      int k2_num = UP_DIV(k_end - k, BF16_PAIR);
+      bool first = k == 0;
+      bool last = k_end == deep;
+      for (int cb = 0; cb < col; cb += BF16_COL_BLOCK * BF16_MAX_COL_BLOCK) {
+        int cur_col = MSMIN(BF16_COL_BLOCK * BF16_MAX_COL_BLOCK, col - cb);
+        const uint16_t *cur_b = b + cb * deep2 * BF16_PAIR;
+        float *cur_c = c + r * col_stride + cb;
+        const float *cur_bias = bias == NULL ? NULL : bias + cb;
+        switch (UP_DIV(cur_col, BF16_COL_BLOCK)) {
+          case 4:
+            MatMulBf16Avx512Tile(a_bf16, cur_b, cur_c, cur_bias, act_type, deep2, k2_start, k2_num, rows, cur_col,
+                                 col_stride, first, last, 4);
+            break;
+          case 3:
+            MatMulBf16Avx512Tile(a_bf16, cur_b, cur_c, cur_bias, act_type, deep2, k2_start, k2_num, rows, cur_col,
+                                 col_stride, first, last, 3);
+            break;
+          case 2:
+            MatMulBf16Avx512Tile(a_bf16, cur_b, cur_c, cur_bias, act_type, deep2, k2_start, k2_num, rows, cur_col,
+                                 col_stride, first, last, 2);
+            break;
+          default:
+            MatMulBf16Avx512Tile(a_bf16, cur_b, cur_c, cur_bias, act_type, deep2, k2_start, k2_num, rows, cur_col,
+                                 col_stride, first, last, 1);
+            break;
+        }
+      }
+    }
+  }
+}
+#pragma GCC pop_options
+#endif
+
+bool IsSupportBf16Dot(void) {
+#ifdef ENABLE_AVX512_BF16_KERNEL
+  return X86_Avx512Bf16_Support();
+#else
+  return false;
+#endif
+}
+
+void MatMulBf16Fp32(const float *a, const uint16_t *b, float *c, const float *bias, ActType act_type, int deep,
+                    int row, int col, int col_stride) {
+#ifdef ENABLE_AVX512_BF16_KERNEL
+  if (X86_Avx512Bf16_Support() && deep > 0) {
+    MatMulBf16Avx512(a, b, c, bias, act_type, deep, row, col, col_stride);
+    return;
+  }
+#endif
+  MatMulBf16Fp32C(a, b, c, bias, act_type, deep, row, col, col_stride);
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
+
+#include <stdbool.h>
+#include "nnacl/op_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * fp32 matmul with bfloat16 weight and fp32 accumulation.
+ * The weight is packed as [UP_DIV(col, 16)][UP_DIV(deep, 2)][16][2] bfloat16, so that one 16-column block holds the
+ * pairs consumed by one vdpbf16ps. With avx512-bf16 the input is rounded to bfloat16 as well, otherwise the weight is
+ * widened to fp32 and the input keeps its full precision.
+ */
+bool IsSupportBf16Dot(void);
+
+/* number of bfloat16 elements of the packed weight */
+int MatMulBf16PackSize(int deep, int col);
+
+/* src is [deep][col], the range [start_row, end_row) is on deep */
+void RowMajor2Row16x2MajorBf16Parallel(const float *src, uint16_t *dst, int deep, int col, int start_row,
+                                       int end_row);
+
+/* src is [col][deep], the range [start_row, end_row) is on col */
+void RowMajor2Col16x2MajorBf16Parallel(const float *src, uint16_t *dst, int col, int deep, int start_row,
+                                       int end_row);
+
+/* a is [row][deep], b points to the first packed 16-column block of the columns to compute */
+void MatMulBf16Fp32(const float *a, const uint16_t *b, float *c, const float *bias, ActType act_type, int deep,
+                    int row, int col, int col_stride);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
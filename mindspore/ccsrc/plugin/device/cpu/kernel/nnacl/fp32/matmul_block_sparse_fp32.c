@@ -0,0 +1,202 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/fp32/matmul_block_sparse_fp32.h"
+#include "nnacl/intrinsics/ms_simd_instructions.h"
+
+#define SPARSE_ROW_TILE 4
+#define SPARSE_MAX_BLOCK 4
+#define SPARSE_RELU6_MAX 6.0f
+/* the densities under which the sparse kernels beat the packed dense gemm */
+#define SPARSE_BLOCK4_MAX_DENSITY 0.4f
+#define SPARSE_BLOCK1_MAX_DENSITY 0.25f
+
+static inline float SparseWeight(const float *b, int n, int k, int col, int deep, bool b_transpose) {
+  return b_transpose ? b[n * deep + k] : b[k * col + n];
+}
+
+static bool IsNonZeroBlock(const float *b, int block_index, int k, int col, int deep, int block, bool b_transpose) {
+  int end = MSMIN(col, (block_index + 1) * block);
+  for (int n = block_index * block; n < end; ++n) {
+    if (SparseWeight(b, n, k, col, deep, b_transpose) != 0.0f) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int BlockSparseNnz(const float *b, int col, int deep, int block, bool b_transpose) {
+  int nnz = 0;
+  int block_num = UP_DIV(col, block);
+  for (int i = 0; i < block_num; ++i) {
+    for (int k = 0; k < deep; ++k) {
+      nnz += IsNonZeroBlock(b, i, k, col, deep, block, b_transpose) ? 1 : 0;
+    }
+  }
+  return nnz;
+}
+
+int SelectBlockSparseBlock(const float *b, int col, int deep, bool b_transpose) {
+  if (b == NULL || col <= 1 || deep <= 0) {
+    return 0;
+  }
+  int nnz = BlockSparseNnz(b, col, deep, C4NUM, b_transpose);
+  if (nnz <= SPARSE_BLOCK4_MAX_DENSITY * UP_DIV(col, C4NUM) * deep) {
+    return C4NUM;
+  }
+  nnz = BlockSparseNnz(b, col, deep, 1, b_transpose);
+  if (nnz <= SPARSE_BLOCK1_MAX_DENSITY * col * deep) {
+    return 1;
+  }
+  return 0;
+}
+
+int BlockSparsePackSize(int col, int nnz, int block) { return UP_DIV(col, block) + 1 + nnz + nnz * block; }
+
+void PackBlockSparseWeight(const float *b, float *dst, int col, int deep, int block, bool b_transpose) {
+  int block_num = UP_DIV(col, block);
+  int32_t *offsets = (int32_t *)dst;
+  int32_t *indices = offsets + block_num + 1;
+  int nnz = 0;
+  offsets[0] = 0;
+  for (int i = 0; i < block_num; ++i) {
+    for (int k = 0; k < deep; ++k) {
+      if (IsNonZeroBlock(b, i, k, col, deep, block, b_transpose)) {
+        indices[nnz++] = k;
+      }
+    }
+    offsets[i + 1] = nnz;
+  }
+  float *values = (float *)(indices + nnz);
+  for (int i = 0; i < block_num; ++i) {
+    for (int j = offsets[i]; j < offsets[i + 1]; ++j) {
+      for (int bi = 0; bi < block; ++bi) {
+        int n = i * block + bi;
+        values[j * block + bi] = n < col ? SparseWeight(b, n, indices[j], col, deep, b_transpose) : 0.0f;
+      }
+    }
+  }
+}
+
+static inline float SparseAct(float value, ActType act_type) {
+  if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+    value = MSMAX(value, 0.0f);
+  }
+  if (act_type == ActType_Relu6) {
+    value = MSMIN(value, SPARSE_RELU6_MAX);
+  }
+  return value;
+}
+
+/* acc is [a_tile][block], the rows [row_begin, row_end) of the tile starting at tile_row are stored */
+static void StoreSparseTile(const float *acc, float *c, const float *bias, ActType act_type, int tile_row,
+                            int row_begin, int row_end, int col, int block, int block_index, int col_stride) {
+  int col_begin = block_index * block;
+  int cur_col = MSMIN(block, col - col_begin);
+  for (int r = row_begin; r < row_end; ++r) {
+    const float *src = acc + (r - tile_row) * block;
+    float *dst = c + r * col_stride + col_begin;
+    for (int bi = 0; bi < cur_col; ++bi) {
+      dst[bi] = SparseAct(src[bi] + (bias != NULL ? bias[col_begin + bi] : 0.0f), act_type);
+    }
+  }
+}
+
+static void SparseTileC(const float *a, const int32_t *offsets, const int32_t *indices, const float *values,
+                        float *acc, int a_tile, int block, int block_index) {
+  for (int i = 0; i < a_tile * block; ++i) {
+    acc[i] = 0.0f;
+  }
+  for (int j = offsets[block_index]; j < offsets[block_index + 1]; ++j) {
+    const float *src_a = a + indices[j] * a_tile;
+    const float *weight = values + j * block;
+    for (int r = 0; r < a_tile; ++r) {
+      for (int bi = 0; bi < block; ++bi) {
+        acc[r * block + bi] += src_a[r] * weight[bi];
+      }
+    }
+  }
+}
+
+#if defined(ENABLE_ARM) || defined(ENABLE_SSE)
+/* four rows by four columns, one weight vector is broadcast against four input values per block */
+static void SparseTile4x4(const float *a, const int32_t *offsets, const int32_t *indices, const float *values,
+                          float *acc, int block_index) {
+  MS_FLOAT32X4 acc0 = MS_MOVQ_F32(0.0f);
+  MS_FLOAT32X4 acc1 = MS_MOVQ_F32(0.0f);
+  MS_FLOAT32X4 acc2 = MS_MOVQ_F32(0.0f);
+  MS_FLOAT32X4 acc3 = MS_MOVQ_F32(0.0f);
+  for (int j = offsets[block_index]; j < offsets[block_index + 1]; ++j) {
+    const float *src_a = a + indices[j] * C4NUM;
+    MS_FLOAT32X4 weight = MS_LDQ_F32(values + j * C4NUM);
+    acc0 = MS_MLAQ_F32(acc0, weight, MS_MOVQ_F32(src_a[0]));
+    acc1 = MS_MLAQ_F32(acc1, weight, MS_MOVQ_F32(src_a[1]));
+    acc2 = MS_MLAQ_F32(acc2, weight, MS_MOVQ_F32(src_a[2]));
+    acc3 = MS_MLAQ_F32(acc3, weight, MS_MOVQ_F32(src_a[3]));
+  }
+  MS_STQ_F32(acc, acc0);
+  MS_STQ_F32(acc + C4NUM, acc1);
+  MS_STQ_F32(acc + C8NUM, acc2);
+  MS_STQ_F32(acc + C12NUM, acc3);
+}
+
+/* four rows by one column, the packed input of four rows is scaled by the weight */
+static void SparseTile4x1(const float *a, const int32_t *offsets, const int32_t *indices, const float *values,
+                          float *acc, int block_index) {
+  MS_FLOAT32X4 acc0 = MS_MOVQ_F32(0.0f);
+  MS_FLOAT32X4 acc1 = MS_MOVQ_F32(0.0f);
+  int j = offsets[block_index];
+  int end = offsets[block_index + 1];
+  for (; j < end - 1; j += C2NUM) {
+    acc0 = MS_MLAQ_F32(acc0, MS_LDQ_F32(a + indices[j] * C4NUM), MS_MOVQ_F32(values[j]));
+    acc1 = MS_MLAQ_F32(acc1, MS_LDQ_F32(a + indices[j + 1] * C4NUM), MS_MOVQ_F32(values[j + 1]));
+  }
+  if (j < end) {
+    acc0 = MS_MLAQ_F32(acc0, MS_LDQ_F32(a + indices[j] * C4NUM), MS_MOVQ_F32(values[j]));
+  }
+  MS_STQ_F32(acc, MS_ADDQ_F32(acc0, acc1));
+}
+#endif
+
+void MatMulBlockSparseFp32(const float *a, const float *b, float *c, const float *bias, ActType act_type, int deep,
+                           int a_tile, int start_row, int end_row, int col, int block, int start_block, int end_block,
+                           int col_stride) {
+  if (a_tile <= 0 || a_tile > SPARSE_ROW_TILE || block <= 0 || block > SPARSE_MAX_BLOCK) {
+    return;
+  }
+  const int32_t *offsets = (const int32_t *)b;
+  const int32_t *indices = offsets + UP_DIV(col, block) + 1;
+  const float *values = (const float *)(indices + offsets[UP_DIV(col, block)]);
+  float acc[SPARSE_ROW_TILE * SPARSE_MAX_BLOCK];
+  for (int tile_row = start_row / a_tile * a_tile; tile_row < end_row; tile_row += a_tile) {
+    const float *src_a = a + tile_row * deep;
+    int row_begin = MSMAX(start_row, tile_row);
+    int row_end = MSMIN(end_row, tile_row + a_tile);
+    for (int i = start_block; i < end_block; ++i) {
+#if defined(ENABLE_ARM) || defined(ENABLE_SSE)
+      if (a_tile == C4NUM && block == C4NUM) {
+        SparseTile4x4(src_a, offsets, indices, values, acc, i);
+      } else if (a_tile == C4NUM && block == 1) {
+        SparseTile4x1(src_a, offsets, indices, values, acc, i);
+      } else {
+        SparseTileC(src_a, offsets, indices, values, acc, a_tile, block, i);
+      }
+#else
+      SparseTileC(src_a, offsets, indices, values, acc, a_tile, block, i);
+#endif
+      StoreSparseTile(acc, c, bias, act_type, tile_row, row_begin, row_end, col, block, i, col_stride);
+    }
+  }
+}
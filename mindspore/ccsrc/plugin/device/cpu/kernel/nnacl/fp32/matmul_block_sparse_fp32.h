@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_BLOCK_SPARSE_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_BLOCK_SPARSE_FP32_H_
+
+#include <stdbool.h>
+#include "nnacl/op_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * fp32 matmul with a sparse constant weight.
+ * The weight is cut into blocks of `block` consecutive columns at one deep index, and only the blocks holding a
+ * non-zero value are packed, in the block compressed sparse row layout over the column blocks:
+ *   int32 offsets[UP_DIV(col, block) + 1], int32 deep_indices[nnz], float values[nnz][block].
+ * The input is packed as [UP_DIV(row, a_tile)][deep][a_tile], a_tile 1 is the plain row major input.
+ */
+
+/* the block is 4 for the weights pruned in column blocks and 1 for the unstructured or N:M pruned ones, 0 means the
+ * weight is too dense to gain from the sparse kernel. b is [col][deep] if b_transpose else [deep][col]. */
+int SelectBlockSparseBlock(const float *b, int col, int deep, bool b_transpose);
+
+/* number of the blocks holding a non-zero value */
+int BlockSparseNnz(const float *b, int col, int deep, int block, bool b_transpose);
+
+/* number of floats of the packed weight */
+int BlockSparsePackSize(int col, int nnz, int block);
+
+void PackBlockSparseWeight(const float *b, float *dst, int col, int deep, int block, bool b_transpose);
+
+/* computes the rows [start_row, end_row) and the column blocks [start_block, end_block), c and bias start at the first
+ * row and the first column, bias holds UP_ROUND(col, block) values or is NULL. */
+void MatMulBlockSparseFp32(const float *a, const float *b, float *c, const float *bias, ActType act_type, int deep,
+                           int a_tile, int start_row, int end_row, int col, int block, int start_block, int end_block,
+                           int col_stride);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_BLOCK_SPARSE_FP32_H_
@@ -902,11 +902,11 @@ void ConvInt8(int8_t *input_data, int8_t *packed_input, int8_t *matmul_input, in
                          conv_param->conv_quant_arg_.right_shift_, real_cal_num, out_channel, out_channel, per_channel);
       }
 #else
-      MatMulInt8_8x8_r(
-        gemm_input, packed_weight, gemm_output, real_cal_num, out_channel, unit_size, out_channel, tmp_input_sum,
-        bias_data, conv_param->conv_quant_arg_.left_shift_, conv_param->conv_quant_arg_.right_shift_,
-        conv_param->conv_quant_arg_.quant_multiplier_, conv_param->conv_quant_arg_.output_quant_args_[0].zp_,
-        conv_param->conv_quant_arg_.out_act_min_[0], conv_param->conv_quant_arg_.out_act_max_[0], per_channel);
+      MATMUL_OPT_R_FUNC matmul_r = matmul_func != NULL ? matmul_func : MatMulInt8_8x8_r;
+      matmul_r(gemm_input, packed_weight, gemm_output, real_cal_num, out_channel, unit_size, out_channel, tmp_input_sum,
+               bias_data, conv_param->conv_quant_arg_.left_shift_, conv_param->conv_quant_arg_.right_shift_,
+               conv_param->conv_quant_arg_.quant_multiplier_, conv_param->conv_quant_arg_.output_quant_args_[0].zp_,
+               conv_param->conv_quant_arg_.out_act_min_[0], conv_param->conv_quant_arg_.out_act_max_[0], per_channel);
 #endif
     }
   }
@@ -0,0 +1,426 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/int8/matmul_vnni_int8.h"
+#ifdef ENABLE_AVX
+#include <immintrin.h>
+#include <limits.h>
+#include <string.h>
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+
+/* the kernels are compiled with target pragmas, gcc supports avx512-vnni since 8 and avx-vnni since 11 */
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 8)
+#define ENABLE_AVX512_VNNI_KERNEL
+#endif
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#define ENABLE_AVX_VNNI_KERNEL
+#endif
+
+/* xor with 0x80 turns int8 x into uint8 x + 128 */
+#define VNNI_INPUT_OFFSET 128
+#define VNNI_INPUT_XOR_MASK 0x80808080
+#define VNNI_MAX_COL_BLOCK 4
+#define VNNI_HIGH_MUL_SHIFT 31
+
+void AdjustWeightBiasSumsForVnni(const int8_t *weight, int row, int stride, int cur_col, int32_t *dst,
+                                 DataOrder order) {
+  for (int c = 0; c < cur_col; ++c) {
+    int sum = 0;
+    for (int r = 0; r < row; ++r) {
+      if (order == RowMajor) {
+        sum += weight[r * stride + c];
+      } else {
+        sum += weight[c * row + r];
+      }
+    }
+    dst[c] -= VNNI_INPUT_OFFSET * sum;
+  }
+}
+
+static inline int32_t LoadVnniInput(const int8_t *src) {
+  int32_t value;
+  memcpy(&value, src, sizeof(int32_t));
+  return value ^ (int32_t)VNNI_INPUT_XOR_MASK;
+}
+
+#if defined(ENABLE_AVX512_VNNI_KERNEL) || defined(ENABLE_AVX_VNNI_KERNEL)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+static inline __m256i LoadPartInt32Avx2(const int32_t *src, size_t num, bool per_channel) {
+  if (!per_channel) {
+    return _mm256_set1_epi32(src[0]);
+  }
+  __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)num), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+  return _mm256_maskload_epi32(src, mask);
+}
+
+/* the same as MultiplyByQuantizedMultiplier with clamp, for 8 int32 values */
+static inline __m256i QuantizeInt32Avx2(__m256i value, __m256i left_shift, __m256i right_shift, __m256i multiplier,
+                                        __m256i output_zp, __m256i mini, __m256i maxi) {
+  value = _mm256_sllv_epi32(value, left_shift);
+
+  // SaturatingRoundingDoublingHighMul: (a * b + (1 << 30)) >> 31 is truncated towards zero for both signs
+  const __m256i rounding = _mm256_set1_epi64x(1ll << 30);
+  __m256i even = _mm256_add_epi64(_mm256_mul_epi32(value, multiplier), rounding);
+  __m256i odd = _mm256_add_epi64(
+    _mm256_mul_epi32(_mm256_srli_epi64(value, C32NUM), _mm256_srli_epi64(multiplier, C32NUM)), rounding);
+  even = _mm256_srli_epi64(even, VNNI_HIGH_MUL_SHIFT);
+  odd = _mm256_slli_epi64(_mm256_srli_epi64(odd, VNNI_HIGH_MUL_SHIFT), C32NUM);
+  __m256i high_mul = _mm256_blend_epi32(even, odd, 0xAA);
+  const __m256i int_min = _mm256_set1_epi32(INT_MIN);
+  __m256i overflow =
+    _mm256_and_si256(_mm256_cmpeq_epi32(value, int_min), _mm256_cmpeq_epi32(multiplier, int_min));
+  high_mul = _mm256_blendv_epi8(high_mul, _mm256_set1_epi32(INT_MAX), overflow);
+
+  // RoundingDivideByPOT
+  __m256i exponent = _mm256_sub_epi32(_mm256_setzero_si256(), right_shift);
+  exponent = _mm256_min_epi32(exponent, _mm256_set1_epi32(VNNI_HIGH_MUL_SHIFT));
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, exponent), one);
+  __m256i remainder = _mm256_and_si256(high_mul, mask);
+  __m256i sign = _mm256_srli_epi32(high_mul, VNNI_HIGH_MUL_SHIFT);
+  __m256i threshold = _mm256_add_epi32(_mm256_srli_epi32(mask, 1), sign);
+  __m256i result = _mm256_srav_epi32(high_mul, exponent);
+  result = _mm256_sub_epi32(result, _mm256_cmpgt_epi32(remainder, threshold));
+
+  result = _mm256_add_epi32(result, output_zp);
+  result = _mm256_min_epi32(result, maxi);
+  return _mm256_max_epi32(result, mini);
+}
+
+static inline void StoreInt8Avx2(int8_t *dst, __m256i value, size_t num) {
+  __m128i value16 = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+  __m128i value8 = _mm_packs_epi16(value16, value16);
+  if (num == C8NUM) {
+    _mm_storel_epi64((__m128i *)dst, value8);
+    return;
+  }
+  int8_t tmp[C16NUM];
+  _mm_storeu_si128((__m128i *)tmp, value8);
+  memcpy(dst, tmp, num);
+}
+#pragma GCC pop_options
+
+/*
+ * row8x4-major * row4x8-major with 256-bit vpdpbusd, one 8x8 tile at a time. The avx512-vnni and the avx-vnni
+ * versions only differ in the dot product instruction.
+ */
+#define DEFINE_MATMUL_R_INT8_VNNI_YMM(func_name, dpbusd)                                                             \
+  static void func_name(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,         \
+                        size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,      \
+                        const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,       \
+                        int32_t maxi, size_t per_channel) {                                                           \
+    size_t row_8 = UP_ROUND(row, C8NUM);                                                                              \
+    __m256i zp_vec = _mm256_set1_epi32(output_zp);                                                                    \
+    __m256i min_vec = _mm256_set1_epi32(mini);                                                                        \
+    __m256i max_vec = _mm256_set1_epi32(maxi);                                                                        \
+    for (size_t c = 0; c < col; c += C8NUM) {                                                                         \
+      size_t cur_col = MSMIN(C8NUM, col - c);                                                                         \
+      const int8_t *b_ptr = b + c * deep_4;                                                                           \
+      __m256i bias_vec = LoadPartInt32Avx2(bias + c, cur_col, true);                                                  \
+      __m256i left_vec = LoadPartInt32Avx2(per_channel ? left_shift + c : left_shift, cur_col, per_channel);          \
+      __m256i right_vec = LoadPartInt32Avx2(per_channel ? right_shift + c : right_shift, cur_col, per_channel);       \
+      __m256i mul_vec = LoadPartInt32Avx2(per_channel ? multiplier + c : multiplier, cur_col, per_channel);           \
+      for (size_t r = 0; r < row; r += C8NUM) {                                                                       \
+        const int8_t *a_ptr = a + r * deep_4;                                                                         \
+        __m256i acc[C8NUM];                                                                                           \
+        for (int i = 0; i < C8NUM; ++i) {                                                                             \
+          acc[i] = _mm256_setzero_si256();                                                                            \
+        }                                                                                                             \
+        for (size_t d = 0; d < deep_4; d += C4NUM) {                                                                  \
+          __m256i weight = _mm256_loadu_si256((const __m256i *)(b_ptr + d * C8NUM));                                  \
+          _Pragma("GCC unroll 8") for (int i = 0; i < C8NUM; ++i) {                                                   \
+            __m256i input = _mm256_set1_epi32(LoadVnniInput(a_ptr + d * C8NUM + i * C4NUM));                          \
+            acc[i] = dpbusd(acc[i], input, weight);                                                                   \
+          }                                                                                                           \
+        }                                                                                                             \
+        size_t cur_row = MSMIN(C8NUM, row - r);                                                                       \
+        for (size_t i = 0; i < cur_row; ++i) {                                                                        \
+          __m256i sum_vec = per_channel                                                                               \
+                              ? _mm256_loadu_si256((const __m256i *)(input_sum + c * row_8 + (r + i) * C8NUM))        \
+                              : _mm256_set1_epi32(input_sum[r + i]);                                                  \
+          __m256i value = _mm256_add_epi32(_mm256_sub_epi32(acc[i], sum_vec), bias_vec);                              \
+          value = QuantizeInt32Avx2(value, left_vec, right_vec, mul_vec, zp_vec, min_vec, max_vec);                   \
+          StoreInt8Avx2(dst + (r + i) * stride + c, value, cur_col);                                                  \
+        }                                                                                                             \
+      }                                                                                                               \
+    }                                                                                                                 \
+  }
+#endif
+
+#ifdef ENABLE_AVX512_VNNI_KERNEL
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512bw", "avx512vl", "avx512vnni")
+static inline __m512i LoadPartInt32Avx512(const int32_t *src, size_t num, bool per_channel) {
+  if (!per_channel) {
+    return _mm512_set1_epi32(src[0]);
+  }
+  return _mm512_maskz_loadu_epi32((__mmask16)((1u << num) - 1), src);
+}
+
+/* the same as QuantizeInt32Avx2, for 16 int32 values */
+static inline __m512i QuantizeInt32Avx512(__m512i value, __m512i left_shift, __m512i right_shift, __m512i multiplier,
+                                          __m512i output_zp, __m512i mini, __m512i maxi) {
+  value = _mm512_sllv_epi32(value, left_shift);
+
+  const __m512i rounding = _mm512_set1_epi64(1ll << 30);
+  __m512i even = _mm512_add_epi64(_mm512_mul_epi32(value, multiplier), rounding);
+  __m512i odd = _mm512_add_epi64(
+    _mm512_mul_epi32(_mm512_srli_epi64(value, C32NUM), _mm512_srli_epi64(multiplier, C32NUM)), rounding);
+  even = _mm512_srli_epi64(even, VNNI_HIGH_MUL_SHIFT);
+  odd = _mm512_slli_epi64(_mm512_srli_epi64(odd, VNNI_HIGH_MUL_SHIFT), C32NUM);
+  __m512i high_mul = _mm512_mask_blend_epi32(0xAAAA, even, odd);
+  const __m512i int_min = _mm512_set1_epi32(INT_MIN);
+  __mmask16 overflow = _mm512_cmpeq_epi32_mask(value, int_min) & _mm512_cmpeq_epi32_mask(multiplier, int_min);
+  high_mul = _mm512_mask_mov_epi32(high_mul, overflow, _mm512_set1_epi32(INT_MAX));
+
+  __m512i exponent = _mm512_sub_epi32(_mm512_setzero_si512(), right_shift);
+  exponent = _mm512_min_epi32(exponent, _mm512_set1_epi32(VNNI_HIGH_MUL_SHIFT));
+  const __m512i one = _mm512_set1_epi32(1);
+  __m512i mask = _mm512_sub_epi32(_mm512_sllv_epi32(one, exponent), one);
+  __m512i remainder = _mm512_and_si512(high_mul, mask);
+  __m512i sign = _mm512_srli_epi32(high_mul, VNNI_HIGH_MUL_SHIFT);
+  __m512i threshold = _mm512_add_epi32(_mm512_srli_epi32(mask, 1), sign);
+  __m512i result = _mm512_srav_epi32(high_mul, exponent);
+  result = _mm512_mask_add_epi32(result, _mm512_cmpgt_epi32_mask(remainder, threshold), result, one);
+
+  result = _mm512_add_epi32(result, output_zp);
+  result = _mm512_min_epi32(result, maxi);
+  return _mm512_max_epi32(result, mini);
+}
+
+static inline __attribute__((always_inline)) void MatMulDpInt8Avx512VnniTile(
+  const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t cur_col, size_t deep_4, size_t stride,
+  const int32_t *input_sum, const __m512i *bias_vec, const __m512i *left_vec, const __m512i *right_vec,
+  const __m512i *mul_vec, const __m512i *filter_zp_vec, __m512i zp_vec, __m512i min_vec, __m512i max_vec,
+  size_t per_channel, const int col_block) {
+  for (size_t r = 0; r < row; r += C4NUM) {
+    const int8_t *a_ptr = a + r * deep_4;
+    __m512i acc[C4NUM][VNNI_MAX_COL_BLOCK];
+#pragma GCC unroll 4
+    for (int i = 0; i < C4NUM; ++i) {
+#pragma GCC unroll 4
+      for (int j = 0; j < col_block; ++j) {
+        acc[i][j] = _mm512_setzero_si512();
+      }
+    }
+    for (size_t d = 0; d < deep_4; d += C4NUM) {
+      __m512i weight[VNNI_MAX_COL_BLOCK];
+#pragma GCC unroll 4
+      for (int j = 0; j < col_block; ++j) {
+        weight[j] = _mm512_loadu_si512(b + j * deep_4 * C16NUM + d * C16NUM);
+      }
+#pragma GCC unroll 4
+      for (int i = 0; i < C4NUM; ++i) {
+        __m512i input = _mm512_set1_epi32(LoadVnniInput(a_ptr + d * C4NUM + i * C4NUM));
+#pragma GCC unroll 4
+        for (int j = 0; j < col_block; ++j) {
+          acc[i][j] = _mm512_dpbusd_epi32(acc[i][j], input, weight[j]);
+        }
+      }
+    }
+    size_t cur_row = MSMIN(C4NUM, row - r);
+    for (size_t i = 0; i < cur_row; ++i) {
+      __m512i sum_vec = _mm512_set1_epi32(input_sum[r + i]);
+#pragma GCC unroll 4
+      for (int j = 0; j < col_block; ++j) {
+        __m512i cur_sum_vec = per_channel ? _mm512_mullo_epi32(sum_vec, filter_zp_vec[j]) : sum_vec;
+        __m512i value = _mm512_add_epi32(_mm512_sub_epi32(acc[i][j], cur_sum_vec), bias_vec[j]);
+        value = QuantizeInt32Avx512(value, left_vec[j], right_vec[j], mul_vec[j], zp_vec, min_vec, max_vec);
+        size_t num = MSMIN(C16NUM, cur_col - j * C16NUM);
+        _mm_mask_storeu_epi8(dst + (r + i) * stride + j * C16NUM, (__mmask16)((1u << num) - 1),
+                             _mm512_cvtsepi32_epi8(value));
+      }
+    }
+  }
+}
+
+static void MatMulDpInt8Avx512Vnni(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col,
+                                   size_t deep_4, size_t stride, const int32_t *input_sum, const int32_t *bias,
+                                   const int32_t *left_shift, const int32_t *right_shift, const int32_t *multiplier,
+                                   int32_t output_zp, int32_t mini, int32_t maxi, size_t per_channel,
+                                   const int32_t *filter_zp) {
+  __m512i zp_vec = _mm512_set1_epi32(output_zp);
+  __m512i min_vec = _mm512_set1_epi32(mini);
+  __m512i max_vec = _mm512_set1_epi32(maxi);
+  const size_t col_step = C16NUM * VNNI_MAX_COL_BLOCK;
+  for (size_t c = 0; c < col; c += col_step) {
+    size_t cur_col = MSMIN(col_step, col - c);
+    int col_block = UP_DIV(cur_col, C16NUM);
+    __m512i bias_vec[VNNI_MAX_COL_BLOCK];
+    __m512i left_vec[VNNI_MAX_COL_BLOCK];
+    __m512i right_vec[VNNI_MAX_COL_BLOCK];
+    __m512i mul_vec[VNNI_MAX_COL_BLOCK];
+    __m512i filter_zp_vec[VNNI_MAX_COL_BLOCK];
+    for (int j = 0; j < col_block; ++j) {
+      size_t cj = c + j * C16NUM;
+      size_t num = MSMIN(C16NUM, col - cj);
+      bias_vec[j] = LoadPartInt32Avx512(bias + cj, num, true);
+      left_vec[j] = LoadPartInt32Avx512(per_channel ? left_shift + cj : left_shift, num, per_channel);
+      right_vec[j] = LoadPartInt32Avx512(per_channel ? right_shift + cj : right_shift, num, per_channel);
+      mul_vec[j] = LoadPartInt32Avx512(per_channel ? multiplier + cj : multiplier, num, per_channel);
+      filter_zp_vec[j] = per_channel ? LoadPartInt32Avx512(filter_zp + cj, num, true) : _mm512_setzero_si512();
+    }
+    const int8_t *b_ptr = b + c * deep_4;
+    int8_t *dst_ptr = dst + c;
+    // expand the tile with a constant column block number, so that the accumulators stay in registers
+    switch (col_block) {
+      case C4NUM:
+        MatMulDpInt8Avx512VnniTile(a, b_ptr, dst_ptr, row, cur_col, deep_4, stride, input_sum, bias_vec, left_vec,
+                                   right_vec, mul_vec, filter_zp_vec, zp_vec, min_vec, max_vec, per_channel, C4NUM);
+        break;
+      case C3NUM:
+        MatMulDpInt8Avx512VnniTile(a, b_ptr, dst_ptr, row, cur_col, deep_4, stride, input_sum, bias_vec, left_vec,
+                                   right_vec, mul_vec, filter_zp_vec, zp_vec, min_vec, max_vec, per_channel, C3NUM);
+        break;
+      case C2NUM:
+        MatMulDpInt8Avx512VnniTile(a, b_ptr, dst_ptr, row, cur_col, deep_4, stride, input_sum, bias_vec, left_vec,
+                                   right_vec, mul_vec, filter_zp_vec, zp_vec, min_vec, max_vec, per_channel, C2NUM);
+        break;
+      default:
+        MatMulDpInt8Avx512VnniTile(a, b_ptr, dst_ptr, row, cur_col, deep_4, stride, input_sum, bias_vec, left_vec,
+                                   right_vec, mul_vec, filter_zp_vec, zp_vec, min_vec, max_vec, per_channel, C1NUM);
+        break;
+    }
+  }
+}
+
+DEFINE_MATMUL_R_INT8_VNNI_YMM(MatMulRInt8Avx512Vnni, _mm256_dpbusd_epi32)
+#pragma GCC pop_options
+#endif
+
+#ifdef ENABLE_AVX_VNNI_KERNEL
+#pragma GCC push_options
+#pragma GCC target("avx2", "avxvnni")
+static void MatMulDpInt8AvxVnni(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                                size_t stride, const int32_t *input_sum, const int32_t *bias,
+                                const int32_t *left_shift, const int32_t *right_shift, const int32_t *multiplier,
+                                int32_t output_zp, int32_t mini, int32_t maxi, size_t per_channel,
+                                const int32_t *filter_zp) {
+  __m256i zp_vec = _mm256_set1_epi32(output_zp);
+  __m256i min_vec = _mm256_set1_epi32(mini);
+  __m256i max_vec = _mm256_set1_epi32(maxi);
+  for (size_t c = 0; c < col; c += C16NUM) {
+    const int8_t *b_ptr = b + c * deep_4;
+    __m256i bias_vec[C2NUM];
+    __m256i left_vec[C2NUM];
+    __m256i right_vec[C2NUM];
+    __m256i mul_vec[C2NUM];
+    __m256i filter_zp_vec[C2NUM];
+    size_t num[C2NUM];
+    for (int j = 0; j < C2NUM; ++j) {
+      size_t cj = c + j * C8NUM;
+      num[j] = cj < col ? MSMIN(C8NUM, col - cj) : 0;
+      bias_vec[j] = LoadPartInt32Avx2(bias + cj, num[j], true);
+      left_vec[j] = LoadPartInt32Avx2(per_channel ? left_shift + cj : left_shift, num[j], per_channel);
+      right_vec[j] = LoadPartInt32Avx2(per_channel ? right_shift + cj : right_shift, num[j], per_channel);
+      mul_vec[j] = LoadPartInt32Avx2(per_channel ? multiplier + cj : multiplier, num[j], per_channel);
+      filter_zp_vec[j] = per_channel ? LoadPartInt32Avx2(filter_zp + cj, num[j], true) : _mm256_setzero_si256();
+    }
+    for (size_t r = 0; r < row; r += C4NUM) {
+      const int8_t *a_ptr = a + r * deep_4;
+      __m256i acc[C4NUM][C2NUM];
+      for (int i = 0; i < C4NUM; ++i) {
+        acc[i][0] = _mm256_setzero_si256();
+        acc[i][1] = _mm256_setzero_si256();
+      }
+      for (size_t d = 0; d < deep_4; d += C4NUM) {
+        // one row4x16 block holds 16 columns, columns 0~7 in the first 32 bytes and columns 8~15 in the next 32 bytes
+        __m256i weight0 = _mm256_loadu_si256((const __m256i *)(b_ptr + d * C16NUM));
+        __m256i weight1 = _mm256_loadu_si256((const __m256i *)(b_ptr + d * C16NUM + C32NUM));
+        for (int i = 0; i < C4NUM; ++i) {
+          __m256i input = _mm256_set1_epi32(LoadVnniInput(a_ptr + d * C4NUM + i * C4NUM));
+          acc[i][0] = _mm256_dpbusd_avx_epi32(acc[i][0], input, weight0);
+          acc[i][1] = _mm256_dpbusd_avx_epi32(acc[i][1], input, weight1);
+        }
+      }
+      size_t cur_row = MSMIN(C4NUM, row - r);
+      for (size_t i = 0; i < cur_row; ++i) {
+        __m256i sum_vec = _mm256_set1_epi32(input_sum[r + i]);
+        for (int j = 0; j < C2NUM && num[j] > 0; ++j) {
+          __m256i cur_sum_vec = per_channel ? _mm256_mullo_epi32(sum_vec, filter_zp_vec[j]) : sum_vec;
+          __m256i value = _mm256_add_epi32(_mm256_sub_epi32(acc[i][j], cur_sum_vec), bias_vec[j]);
+          value = QuantizeInt32Avx2(value, left_vec[j], right_vec[j], mul_vec[j], zp_vec, min_vec, max_vec);
+          StoreInt8Avx2(dst + (r + i) * stride + c + j * C8NUM, value, num[j]);
+        }
+      }
+    }
+  }
+}
+
+DEFINE_MATMUL_R_INT8_VNNI_YMM(MatMulRInt8AvxVnni, _mm256_dpbusd_avx_epi32)
+#pragma GCC pop_options
+#endif
+
+bool IsSupportInt8Vnni(void) {
+#ifdef ENABLE_AVX512_VNNI_KERNEL
+  if (X86_Avx512Vnni_Support()) {
+    return true;
+  }
+#endif
+#ifdef ENABLE_AVX_VNNI_KERNEL
+  if (X86_AvxVnni_Support()) {
+    return true;
+  }
+#endif
+  return false;
+}
+
+void MatMulDpInt8Vnni(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                      size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                      const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                      int32_t maxi, size_t per_channel, const int32_t *filter_zp) {
+#ifdef ENABLE_AVX512_VNNI_KERNEL
+  if (X86_Avx512Vnni_Support()) {
+    MatMulDpInt8Avx512Vnni(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                           output_zp, mini, maxi, per_channel, filter_zp);
+    return;
+  }
+#endif
+#ifdef ENABLE_AVX_VNNI_KERNEL
+  if (X86_AvxVnni_Support()) {
+    MatMulDpInt8AvxVnni(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                        output_zp, mini, maxi, per_channel, filter_zp);
+    return;
+  }
+#endif
+  MatMulInt8_4x16_r(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                    output_zp, mini, maxi, per_channel, filter_zp);
+}
+
+void MatMulRInt8Vnni(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                     size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                     const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                     int32_t maxi, size_t per_channel) {
+#ifdef ENABLE_AVX512_VNNI_KERNEL
+  if (X86_Avx512Vnni_Support()) {
+    MatMulRInt8Avx512Vnni(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                          output_zp, mini, maxi, per_channel);
+    return;
+  }
+#endif
+#ifdef ENABLE_AVX_VNNI_KERNEL
+  if (X86_AvxVnni_Support()) {
+    MatMulRInt8AvxVnni(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                       output_zp, mini, maxi, per_channel);
+    return;
+  }
+#endif
+  MatMulInt8_8x8_r(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                   output_zp, mini, maxi, per_channel);
+}
+#endif
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_INT8_MATMUL_VNNI_INT8_H_
+#define MINDSPORE_NNACL_INT8_MATMUL_VNNI_INT8_H_
+
+#include <stdbool.h>
+#include "nnacl/op_base.h"
+#include "nnacl/matmul_parameter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifdef ENABLE_AVX
+/*
+ * x86 int8 gemm based on vpdpbusd (avx512-vnni or avx-vnni), the kernel is selected by the cpu info at runtime.
+ * vpdpbusd multiplies unsigned bytes by signed bytes, so the kernels add 128 to the input and the weight bias sums
+ * must be compensated by AdjustWeightBiasSumsForVnni once the weight is packed.
+ */
+bool IsSupportInt8Vnni(void);
+
+/* row4x4-major * row4x16-major => (int8)row-major, the same layout as MatMulInt8_4x16_r */
+void MatMulDpInt8Vnni(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                      size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                      const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                      int32_t maxi, size_t per_channel, const int32_t *filter_zp);
+
+/* row8x4-major * row4x8-major => (int8)row-major, the same layout as MatMulInt8_8x8_r */
+void MatMulRInt8Vnni(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                     size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                     const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                     int32_t maxi, size_t per_channel);
+
+/* dst: dst - 128 * weight_col_sums, the weight is indexed in the same way as CalcPartWeightBiasSums */
+void AdjustWeightBiasSumsForVnni(const int8_t *weight, int row, int stride, int cur_col, int32_t *dst,
+                                 DataOrder order);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_INT8_MATMUL_VNNI_INT8_H_
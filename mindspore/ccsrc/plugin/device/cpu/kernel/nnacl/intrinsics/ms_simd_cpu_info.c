@@ -28,6 +28,9 @@ struct X86CpuInfoContext {
   bool sse4_1_flag_;
   bool avx2_flag_;
   bool avx512_flag_;
+  bool avx512_vnni_flag_;
+  bool avx_vnni_flag_;
+  bool avx512_bf16_flag_;
 };
 
 static struct X86CpuInfoContext g_x86_cpu_info_context_;
@@ -58,18 +61,44 @@ inline const bool X86_Avx512_Support(void) {
 #endif
 }
 
-void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
+// The vnni kernels are compiled with target pragmas, so they are available in both the avx and avx512 version.
+inline const bool X86_Avx512Vnni_Support(void) {
+#ifdef ENABLE_AVX
+  return g_x86_cpu_info_context_.avx512_vnni_flag_;
+#else
+  return false;
+#endif
+}
+
+inline const bool X86_AvxVnni_Support(void) {
+#ifdef ENABLE_AVX
+  return g_x86_cpu_info_context_.avx_vnni_flag_;
+#else
+  return false;
+#endif
+}
+
+inline const bool X86_Avx512Bf16_Support(void) {
+#ifdef ENABLE_AVX
+  return g_x86_cpu_info_context_.avx512_bf16_flag_;
+#else
+  return false;
+#endif
+}
+
+void ExecuteCpuIdSubCmd(DWORD cmd_code, DWORD sub_cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data,
+                        DWORD *edx_data) {
   DWORD deax, debx, decx, dedx;
   asm volatile(
     "movl %4, %%eax;\n"
-    "movl $0, %%ecx;\n"
+    "movl %5, %%ecx;\n"
     "cpuid;\n"
     "movl %%eax, %0;\n"
     "movl %%ebx, %1;\n"
     "movl %%ecx, %2;\n"
     "movl %%edx, %3;\n"
     : "=r"(deax), "=r"(debx), "=r"(decx), "=r"(dedx)
-    : "r"(cmd_code)
+    : "r"(cmd_code), "r"(sub_cmd_code)
     : "%eax", "%ebx", "%ecx", "%edx");
 
   *eax_data = deax;
@@ -78,6 +107,10 @@ void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ec
   *edx_data = dedx;
 }
 
+void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
+  ExecuteCpuIdSubCmd(cmd_code, 0, eax_data, ebx_data, ecx_data, edx_data);
+}
+
 bool IsIntelX86Platform(void) {
   DWORD eax_data, ebx_data, ecx_data, edx_data;
 
@@ -109,6 +142,19 @@ int IntelX86CpuInfoInit(void) {
   ExecuteCpuIdCmd(7, &eax_data, &ebx_data, &ecx_data, &edx_data);  // eax = 7, execute cpuid to get avx2/avx512 flag
   g_x86_cpu_info_context_.avx2_flag_ = (ebx_data & (1 << 5)) == 0 ? false : true;     // avx2 flag is ecx 5 bit
   g_x86_cpu_info_context_.avx512_flag_ = (ebx_data & (1 << 16)) == 0 ? false : true;  // avx512 flag is ecx 16 bit
+  // avx512-vnni kernels also use avx512bw(ebx 30 bit) and avx512vl(ebx 31 bit), vnni flag is ecx 11 bit
+  const DWORD avx512_vnni_mask = (1u << 16) | (1u << 30) | (1u << 31);
+  g_x86_cpu_info_context_.avx512_vnni_flag_ =
+    (ebx_data & avx512_vnni_mask) == avx512_vnni_mask && (ecx_data & (1 << 11)) != 0;
+  DWORD max_sub_cmd = eax_data;
+  g_x86_cpu_info_context_.avx_vnni_flag_ = false;
+  g_x86_cpu_info_context_.avx512_bf16_flag_ = false;
+  if (max_sub_cmd >= 1) {
+    ExecuteCpuIdSubCmd(7, 1, &eax_data, &ebx_data, &ecx_data, &edx_data);  // eax = 7, ecx = 1, get avx-vnni/bf16 flag
+    // avx-vnni is eax 4 bit, avx512-bf16 is eax 5 bit
+    g_x86_cpu_info_context_.avx_vnni_flag_ = g_x86_cpu_info_context_.avx2_flag_ && (eax_data & (1 << 4)) != 0;
+    g_x86_cpu_info_context_.avx512_bf16_flag_ = g_x86_cpu_info_context_.avx512_flag_ && (eax_data & (1 << 5)) != 0;
+  }
 
   return NNACL_OK;
 }
@@ -0,0 +1,262 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plugin/device/cpu/optimizer/multi_tensor_optimizer_fusion.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "ir/primitive.h"
+#include "include/common/utils/utils.h"
+#include "backend/common/optimizer/helper.h"
+#include "mindspore/core/ops/op_name.h"
+#include "utils/hash_set.h"
+#include "utils/ms_utils.h"
+#include "utils/flags.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+constexpr char kCpuOptimizerFusionEnv[] = "MS_DEV_CPU_OPTIMIZER_FUSION";
+// Clip the gradients by the global norm of all the gradients fused in one node when it is greater than 0.
+constexpr char kCpuClipGlobalNormEnv[] = "MS_DEV_CPU_CLIP_GLOBAL_NORM";
+// Accumulate the gradients of several steps before each update when it is greater than 1. It is not applied to Adam,
+// whose beta powers are advanced by the graph on every step. The learning rate is read at the step of the update.
+constexpr char kCpuGradAccumulationStepsEnv[] = "MS_DEV_CPU_GRAD_ACCUMULATION_STEPS";
+constexpr size_t kMinFusionNum = 2;
+
+// The supported optimizers and their input numbers.
+const std::map<std::string, size_t> &GetFusibleOptimizers() {
+  static const std::map<std::string, size_t> fusible_optimizers = {
+    {prim::kPrimAdam->name(), 10}, {prim::kPrimAdamWeightDecay->name(), 9}, {prim::kPrimApplyMomentum->name(), 5}};
+  return fusible_optimizers;
+}
+
+float GetClipGlobalNorm() {
+  const auto &clip_global_norm_env = common::GetEnv(kCpuClipGlobalNormEnv);
+  if (clip_global_norm_env.empty()) {
+    return 0.0f;
+  }
+  try {
+    return std::stof(clip_global_norm_env);
+  } catch (const std::exception &) {
+    MS_LOG(WARNING) << "Invalid env " << kCpuClipGlobalNormEnv << ": " << clip_global_norm_env
+                    << ", the gradients will not be clipped.";
+    return 0.0f;
+  }
+}
+
+int64_t GetGradAccumulationSteps() {
+  const auto &steps_env = common::GetEnv(kCpuGradAccumulationStepsEnv);
+  if (steps_env.empty()) {
+    return 1;
+  }
+  try {
+    return std::max<int64_t>(std::stoll(steps_env), 1);
+  } catch (const std::exception &) {
+    MS_LOG(WARNING) << "Invalid env " << kCpuGradAccumulationStepsEnv << ": " << steps_env
+                    << ", the gradients will not be accumulated.";
+    return 1;
+  }
+}
+
+bool IsFusibleOptimizer(const FuncGraphManagerPtr &manager, const CNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(manager);
+  MS_EXCEPTION_IF_NULL(node);
+  const auto &fusible_optimizers = GetFusibleOptimizers();
+  auto iter = fusible_optimizers.find(common::AnfAlgo::GetCNodeName(node));
+  if (iter == fusible_optimizers.end()) {
+    return false;
+  }
+  size_t input_num = common::AnfAlgo::GetInputTensorNum(node);
+  if (input_num != iter->second || common::AnfAlgo::IsDynamicShape(node) ||
+      common::AnfAlgo::HasNodeAttr(ops::kBatchRank, node)) {
+    return false;
+  }
+  for (size_t i = 0; i < input_num; ++i) {
+    if (common::AnfAlgo::GetPrevNodeOutputInferDataType(node, i) != kNumberTypeFloat32) {
+      return false;
+    }
+  }
+  // The fused node has no output of the updated parameters, so the outputs can only be used for the execution order.
+  auto users_iter = manager->node_users().find(node);
+  if (users_iter == manager->node_users().end()) {
+    return true;
+  }
+  for (const auto &user : users_iter->second) {
+    if (IsPrimitiveCNode(user.first, prim::kPrimUpdateState) ||
+        (IsPrimitiveCNode(user.first, prim::kPrimDepend) && user.second == kDependAttachNodeIndex)) {
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+// Strip the UpdateState nodes which only attach a node to be fused from the monad, e.g. the monad UpdateState(u, node_1)
+// of node_2 becomes u. The nodes run together after fused, so the fused node is ordered after the monad of the first
+// one, and keeping the stripped UpdateState would make the fused node depend on itself.
+AnfNodePtr StripFusedUpdateState(const AnfNodePtr &monad, const mindspore::HashSet<AnfNodePtr> &node_set) {
+  auto current = monad;
+  while (IsPrimitiveCNode(current, prim::kPrimUpdateState)) {
+    auto update_state = current->cast<CNodePtr>();
+    MS_EXCEPTION_IF_NULL(update_state);
+    if (update_state->size() != IntToSize(kUpdateStateRealInput) + 1 ||
+        node_set.count(update_state->input(kUpdateStateRealInput)) == 0) {
+      break;
+    }
+    current = update_state->input(kUpdateStateStateInput);
+  }
+  return current;
+}
+
+// The monad inputs of the fused node, so it is still ordered with the loads and the updates of the parameters it
+// writes.
+std::vector<AnfNodePtr> GetFusedMonadInputs(const std::vector<CNodePtr> &nodes) {
+  mindspore::HashSet<AnfNodePtr> node_set(nodes.begin(), nodes.end());
+  std::vector<AnfNodePtr> monad_inputs;
+  for (const auto &node : nodes) {
+    for (size_t i = common::AnfAlgo::GetInputTensorNum(node) + 1; i < node->inputs().size(); ++i) {
+      const auto &input = node->input(i);
+      if (!HasAbstractMonad(input)) {
+        continue;
+      }
+      auto monad = StripFusedUpdateState(input, node_set);
+      if (std::find(monad_inputs.begin(), monad_inputs.end(), monad) == monad_inputs.end()) {
+        (void)monad_inputs.emplace_back(monad);
+      }
+    }
+  }
+  return monad_inputs;
+}
+
+// Whether the inputs of the fused node, including the monads, depend on some node to be fused, then the fused node would
+// be in a cycle.
+bool DependOnEachOther(const std::vector<CNodePtr> &nodes, const std::vector<AnfNodePtr> &monad_inputs) {
+  mindspore::HashSet<AnfNodePtr> node_set(nodes.begin(), nodes.end());
+  mindspore::HashSet<AnfNodePtr> visited;
+  std::vector<AnfNodePtr> to_visit(monad_inputs.begin(), monad_inputs.end());
+  for (const auto &node : nodes) {
+    for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(node); ++i) {
+      (void)to_visit.emplace_back(common::AnfAlgo::GetInputNode(node, i));
+    }
+  }
+  while (!to_visit.empty()) {
+    auto current = to_visit.back();
+    to_visit.pop_back();
+    if (current == nullptr || !visited.insert(current).second) {
+      continue;
+    }
+    if (node_set.count(current) != 0) {
+      return true;
+    }
+    auto cnode = current->cast<CNodePtr>();
+    if (cnode != nullptr) {
+      (void)to_visit.insert(to_visit.end(), cnode->inputs().begin(), cnode->inputs().end());
+    }
+  }
+  return false;
+}
+
+CNodePtr CreateMultiTensorOptimizer(const FuncGraphPtr &graph, const std::vector<CNodePtr> &nodes,
+                                   const std::vector<AnfNodePtr> &monad_inputs) {
+  auto prim = std::make_shared<Primitive>(kMultiTensorOptimizerOpName);
+  std::vector<AnfNodePtr> inputs = {NewValueNode(prim)};
+  for (const auto &node : nodes) {
+    for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(node); ++i) {
+      (void)inputs.emplace_back(common::AnfAlgo::GetInputNode(node, i));
+    }
+  }
+  (void)inputs.insert(inputs.end(), monad_inputs.begin(), monad_inputs.end());
+  auto fused_node = NewCNode(inputs, graph);
+  MS_EXCEPTION_IF_NULL(fused_node);
+  // The output is the global norm of the gradients.
+  fused_node->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, ShapeVector{1}));
+  fused_node->set_scope(nodes[0]->scope());
+  const auto &first_node = nodes[0];
+  common::AnfAlgo::SetNodeAttr(kAttrN, MakeValue(SizeToLong(nodes.size())), fused_node);
+  common::AnfAlgo::SetNodeAttr(kAttrOptimizerType, MakeValue(common::AnfAlgo::GetCNodeName(first_node)), fused_node);
+  bool use_nesterov = common::AnfAlgo::HasNodeAttr(ops::kUseNesterov, first_node) &&
+                      common::AnfAlgo::GetNodeAttr<bool>(first_node, ops::kUseNesterov);
+  common::AnfAlgo::SetNodeAttr(ops::kUseNesterov, MakeValue(use_nesterov), fused_node);
+  common::AnfAlgo::SetNodeAttr(kAttrClipGlobalNorm, MakeValue(GetClipGlobalNorm()), fused_node);
+  auto grad_accumulation_steps = GetGradAccumulationSteps();
+  if (grad_accumulation_steps > 1 && common::AnfAlgo::GetCNodeName(first_node) == prim::kPrimAdam->name()) {
+    MS_LOG(WARNING) << "The gradient accumulation is not supported by Adam, the gradients of "
+                    << fused_node->fullname_with_scope() << " will not be accumulated.";
+    grad_accumulation_steps = 1;
+  }
+  common::AnfAlgo::SetNodeAttr(kAttrGradAccumulationSteps, MakeValue(grad_accumulation_steps), fused_node);
+  // The fused node updates the parameters and states of the original nodes in place.
+  if (common::AnfAlgo::HasNodeAttr(GRAPH_FLAG_SIDE_EFFECT_MEM, first_node)) {
+    common::AnfAlgo::SetNodeAttr(GRAPH_FLAG_SIDE_EFFECT_MEM,
+                                 MakeValue(common::AnfAlgo::GetNodeAttr<bool>(first_node, GRAPH_FLAG_SIDE_EFFECT_MEM)),
+                                 fused_node);
+  }
+  common::AnfAlgo::SetNodeAttr(kAttrIsRef, MakeValue(true), fused_node);
+  return fused_node;
+}
+}  // namespace
+
+bool MultiTensorOptimizerFusion::Run(const FuncGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  if (common::GetEnv(kCpuOptimizerFusionEnv) != "1") {
+    return false;
+  }
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+
+  // Group the optimizer nodes by the type and the attr use_nesterov.
+  std::map<std::pair<std::string, bool>, std::vector<CNodePtr>> optimizer_groups;
+  for (const auto &node : TopoSort(graph->get_return())) {
+    auto cnode = node->cast<CNodePtr>();
+    if (cnode == nullptr || !IsFusibleOptimizer(manager, cnode)) {
+      continue;
+    }
+    bool use_nesterov = common::AnfAlgo::HasNodeAttr(ops::kUseNesterov, cnode) &&
+                        common::AnfAlgo::GetNodeAttr<bool>(cnode, ops::kUseNesterov);
+    (void)optimizer_groups[{common::AnfAlgo::GetCNodeName(cnode), use_nesterov}].emplace_back(cnode);
+  }
+
+  bool changed = false;
+  for (const auto &group : optimizer_groups) {
+    const auto &nodes = group.second;
+    if (nodes.size() < kMinFusionNum) {
+      continue;
+    }
+    auto monad_inputs = GetFusedMonadInputs(nodes);
+    if (DependOnEachOther(nodes, monad_inputs)) {
+      MS_LOG(INFO) << "The " << group.first.first << " nodes depend on each other and can not be fused.";
+      continue;
+    }
+    auto fused_node = CreateMultiTensorOptimizer(graph, nodes, monad_inputs);
+    for (const auto &node : nodes) {
+      if (!manager->Replace(node, fused_node)) {
+        MS_LOG(EXCEPTION) << "Replace node " << node->fullname_with_scope() << " with "
+                          << fused_node->fullname_with_scope() << " failed.";
+      }
+    }
+    MS_LOG(INFO) << "Fuse " << nodes.size() << " " << group.first.first << " nodes to "
+                 << fused_node->fullname_with_scope();
+    changed = true;
+  }
+  return changed;
+}
+}  // namespace opt
+}  // namespace mindspore
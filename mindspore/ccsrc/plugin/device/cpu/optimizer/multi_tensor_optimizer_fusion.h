@@ -0,0 +1,35 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_OPTIMIZER_MULTI_TENSOR_OPTIMIZER_FUSION_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_OPTIMIZER_MULTI_TENSOR_OPTIMIZER_FUSION_H_
+
+#include <string>
+#include "backend/common/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// Replace the Adam, AdamWeightDecay or ApplyMomentum nodes of the same type with one MultiTensorOptimizer node, which
+// updates all the parameters in one launch. The pass is enabled by MS_DEV_CPU_OPTIMIZER_FUSION=1, and the fused node
+// can also clip the gradients by MS_DEV_CPU_CLIP_GLOBAL_NORM and accumulate them by MS_DEV_CPU_GRAD_ACCUMULATION_STEPS.
+class MultiTensorOptimizerFusion : public Pass {
+ public:
+  explicit MultiTensorOptimizerFusion(const std::string &name = "multi_tensor_optimizer_fusion") : Pass(name) {}
+  ~MultiTensorOptimizerFusion() override = default;
+  bool Run(const FuncGraphPtr &graph) override;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_OPTIMIZER_MULTI_TENSOR_OPTIMIZER_FUSION_H_
@@ -0,0 +1,229 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiler/device/perf_counter.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace profiler {
+namespace {
+constexpr size_t kCacheLineSize = 64;
+constexpr double kNanosecondToMillisecond = 1e6;
+
+uint64_t GetTimeNs() {
+  auto now = std::chrono::steady_clock::now();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+}
+
+#ifdef __linux__
+// In the order of PerfCounterValues.
+constexpr uint64_t kPerfEventConfigs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                          PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+constexpr size_t kPerfEventNum = sizeof(kPerfEventConfigs) / sizeof(kPerfEventConfigs[0]);
+
+// Layout of PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING.
+struct PerfGroupReadFormat {
+  uint64_t nr;
+  uint64_t time_enabled;
+  uint64_t time_running;
+  uint64_t values[kPerfEventNum];
+};
+
+int PerfEventOpen(uint64_t config, int group_fd) {
+  struct perf_event_attr attr;
+  (void)memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#endif
+}  // namespace
+
+PerfCounterValues &PerfCounterValues::operator+=(const PerfCounterValues &other) {
+  cycles += other.cycles;
+  instructions += other.instructions;
+  cache_misses += other.cache_misses;
+  branch_misses += other.branch_misses;
+  time_ns += other.time_ns;
+  return *this;
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+#ifdef __linux__
+  for (auto fd : fds_) {
+    (void)close(fd);
+  }
+#endif
+}
+
+bool PerfCounterGroup::Open() {
+#ifdef __linux__
+  for (auto config : kPerfEventConfigs) {
+    auto fd = PerfEventOpen(config, fds_.empty() ? -1 : fds_[0]);
+    if (fd == -1) {
+      MS_LOG(WARNING) << "Open perf event " << config << " failed: " << strerror(errno)
+                      << ". Hardware counters of this thread are not collected.";
+      for (auto opened_fd : fds_) {
+        (void)close(opened_fd);
+      }
+      fds_.clear();
+      return false;
+    }
+    fds_.push_back(fd);
+  }
+  return true;
+#else
+  MS_LOG(WARNING) << "Hardware counters are only supported on linux.";
+  return false;
+#endif
+}
+
+void PerfCounterGroup::Begin() {
+#ifdef __linux__
+  (void)ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  (void)ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  begin_time_ = GetTimeNs();
+}
+
+bool PerfCounterGroup::End(PerfCounterValues *values) {
+  MS_EXCEPTION_IF_NULL(values);
+  values->time_ns = GetTimeNs() - begin_time_;
+#ifdef __linux__
+  (void)ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  PerfGroupReadFormat result{};
+  if (read(fds_[0], &result, sizeof(result)) != static_cast<ssize_t>(sizeof(result)) || result.nr != kPerfEventNum) {
+    return false;
+  }
+  // scale up if the group was multiplexed with other events
+  double scale = 1.0;
+  if (result.time_running != 0 && result.time_running < result.time_enabled) {
+    scale = static_cast<double>(result.time_enabled) / result.time_running;
+  }
+  auto scaled = [scale](uint64_t value) { return static_cast<uint64_t>(value * scale); };
+  values->cycles = scaled(result.values[0]);
+  values->instructions = scaled(result.values[1]);
+  values->cache_misses = scaled(result.values[2]);
+  values->branch_misses = scaled(result.values[3]);
+  return true;
+#else
+  return false;
+#endif
+}
+
+KernelPerfCounter &KernelPerfCounter::GetInstance() {
+  static KernelPerfCounter instance;
+  return instance;
+}
+
+KernelPerfCounter::ThreadStat *KernelPerfCounter::GetThreadStat() {
+  thread_local std::shared_ptr<ThreadStat> thread_stat = nullptr;
+  if (thread_stat == nullptr) {
+    thread_stat = std::make_shared<ThreadStat>();
+    thread_stat->opened = thread_stat->group.Open();
+    std::lock_guard<std::mutex> lock(mutex_);
+    thread_stats_.push_back(thread_stat);
+  }
+  return thread_stat.get();
+}
+
+void KernelPerfCounter::Begin() {
+  auto thread_stat = GetThreadStat();
+  if (thread_stat->opened) {
+    thread_stat->group.Begin();
+  }
+}
+
+void KernelPerfCounter::End(const std::string &op_type) {
+  auto thread_stat = GetThreadStat();
+  PerfCounterValues values;
+  if (!thread_stat->opened || !thread_stat->group.End(&values)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(thread_stat->mutex);
+  auto &stat = thread_stat->stats[op_type];
+  ++stat.count;
+  stat.values += values;
+}
+
+bool KernelPerfCounter::Save(const std::string &file_path) {
+  std::map<std::string, OpTypeStat> stats;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &thread_stat : thread_stats_) {
+      std::lock_guard<std::mutex> stat_lock(thread_stat->mutex);
+      for (auto &[op_type, stat] : thread_stat->stats) {
+        auto &total = stats[op_type];
+        total.count += stat.count;
+        total.values += stat.values;
+      }
+    }
+  }
+  if (stats.empty()) {
+    return true;
+  }
+  std::ofstream ofs(file_path);
+  if (!ofs.is_open()) {
+    MS_LOG(WARNING) << "Open file '" << file_path << "' failed!";
+    return false;
+  }
+  // the counters follow the launching threads only and are not scaled, so the columns are named after them
+  ofs << "op_type,count,total_time(ms),launch_thread_cycles,launch_thread_instructions,IPC,"
+         "launch_thread_cache_misses,launch_thread_branch_misses,launch_thread_bandwidth(GB/s)\n";
+  for (auto &[op_type, stat] : stats) {
+    const auto &values = stat.values;
+    double ipc = values.cycles == 0 ? 0 : static_cast<double>(values.instructions) / values.cycles;
+    // bytes per nanosecond is GB/s
+    double bandwidth =
+      values.time_ns == 0 ? 0 : static_cast<double>(values.cache_misses) * kCacheLineSize / values.time_ns;
+    ofs << op_type << ',' << stat.count << ',' << std::fixed << std::setprecision(3)
+        << values.time_ns / kNanosecondToMillisecond << ',' << values.cycles << ',' << values.instructions << ','
+        << ipc << ',' << values.cache_misses << ',' << values.branch_misses << ',' << bandwidth << '\n';
+  }
+  ofs.close();
+#ifdef __linux__
+  (void)chmod(file_path.c_str(), S_IRUSR | S_IWUSR);
+#endif
+  MS_LOG(INFO) << "Write hardware counters of the launching threads of " << stats.size()
+               << " op types into file: " << file_path;
+  return true;
+}
+
+void KernelPerfCounter::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &thread_stat : thread_stats_) {
+    std::lock_guard<std::mutex> stat_lock(thread_stat->mutex);
+    thread_stat->stats.clear();
+  }
+}
+}  // namespace profiler
+}  // namespace mindspore
@@ -0,0 +1,99 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PROFILER_DEVICE_PERF_COUNTER_H
+#define MINDSPORE_CCSRC_PROFILER_DEVICE_PERF_COUNTER_H
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace profiler {
+struct PerfCounterValues {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t cache_misses = 0;
+  uint64_t branch_misses = 0;
+  uint64_t time_ns = 0;
+
+  PerfCounterValues &operator+=(const PerfCounterValues &other);
+};
+
+// Hardware counters of the calling thread, opened as one perf event group so that they are scheduled together.
+class PerfCounterGroup {
+ public:
+  PerfCounterGroup() = default;
+  ~PerfCounterGroup();
+  DISABLE_COPY_AND_ASSIGN(PerfCounterGroup)
+
+  // Returns false if perf events are not supported or not permitted, see /proc/sys/kernel/perf_event_paranoid.
+  bool Open();
+  void Begin();
+  bool End(PerfCounterValues *values);
+
+ private:
+  std::vector<int> fds_;
+  uint64_t begin_time_{0};
+};
+
+/*
+ * Counts cycles, instructions, cache misses and branch misses around each host kernel launch and accumulates them per
+ * op type. The counters only follow the launching thread, so parallel tasks run by other workers of the thread pool
+ * are not included. Cache misses are mostly last level cache misses, which gives an estimate of the memory bandwidth.
+ */
+class BACKEND_EXPORT KernelPerfCounter {
+ public:
+  static KernelPerfCounter &GetInstance();
+  ~KernelPerfCounter() = default;
+  DISABLE_COPY_AND_ASSIGN(KernelPerfCounter)
+
+  void Enable(bool enable) { enabled_ = enable; }
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void Begin();
+  void End(const std::string &op_type);
+  // Writes the counters, IPC and estimated bandwidth of each op type into a csv file.
+  bool Save(const std::string &file_path);
+  void Clear();
+
+ private:
+  KernelPerfCounter() = default;
+  struct OpTypeStat {
+    uint64_t count = 0;
+    PerfCounterValues values;
+  };
+  struct ThreadStat {
+    PerfCounterGroup group;
+    bool opened = false;
+    // only contended when the stats are saved
+    std::mutex mutex;
+    std::map<std::string, OpTypeStat> stats;
+  };
+  ThreadStat *GetThreadStat();
+
+  std::atomic<bool> enabled_{false};
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadStat>> thread_stats_;
+};
+}  // namespace profiler
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PROFILER_DEVICE_PERF_COUNTER_H
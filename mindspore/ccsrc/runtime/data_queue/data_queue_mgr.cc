@@ -58,6 +58,8 @@ void DataQueueMgr::Manage(const std::string &channel_name, const std::shared_ptr
 DataQueueStatus DataQueueMgr::Create(const std::string &channel_name, const std::vector<size_t> &shape,
                                      const size_t capacity) {
   MS_LOG(INFO) << "Data queue: " << channel_name << " created";
+  // The CPU runtime creates the queue while the dataset pipeline may be checking whether it exists.
+  std::lock_guard<std::mutex> lock(queue_map_mutex_);
   if (name_queue_map_.find(channel_name) != name_queue_map_.end()) {
     return DataQueueStatus::QUEUE_EXIST;
   }
@@ -188,6 +190,7 @@ bool DataQueueMgr::IsInit() const { return init_; }
 bool DataQueueMgr::IsClosed() const { return closed_; }
 
 bool DataQueueMgr::IsCreated(const std::string &channel_name) const {
+  std::lock_guard<std::mutex> lock(queue_map_mutex_);
   return name_queue_map_.find(channel_name) != name_queue_map_.end();
 }
 
@@ -15,14 +15,91 @@
  */
 
 #include "runtime/device/auto_mem_offload.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <cerrno>
 #include <memory>
 #include <vector>
 #include <queue>
 #include "runtime/hardware/device_context.h"
 #include "runtime/device/memory_offload_strategy.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace device {
+namespace {
+// The directory of the offload file tier, the file tier is disabled when it is not set.
+constexpr char kOffloadFilePathEnv[] = "MS_DEV_OFFLOAD_FILE_PATH";
+// The host memory size in MB before the blocks are offloaded to the file tier.
+constexpr char kOffloadHostMemLimitEnv[] = "MS_DEV_OFFLOAD_HOST_MEM_LIMIT";
+constexpr size_t kMBToByte = 1024 * 1024;
+}  // namespace
+
+OffloadedMemPool::OffloadedMemPool() {
+  const auto &file_path = common::GetEnv(kOffloadFilePathEnv);
+  if (file_path.empty()) {
+    return;
+  }
+  size_t host_mem_limit = 0;
+  const auto &host_mem_limit_env = common::GetEnv(kOffloadHostMemLimitEnv);
+  if (!host_mem_limit_env.empty()) {
+    try {
+      host_mem_limit = std::stoul(host_mem_limit_env) * kMBToByte;
+    } catch (const std::exception &) {
+      MS_LOG(WARNING) << "Invalid env " << kOffloadHostMemLimitEnv << ": " << host_mem_limit_env
+                      << ", all the offloaded memory will be in the file tier.";
+    }
+  }
+  SetFileTier(file_path, host_mem_limit);
+}
+
+OffloadedMemPool::~OffloadedMemPool() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  for (auto &block : file_mem_block_map_) {
+    (void)munmap(block.first, block.second);
+  }
+#endif
+}
+
+void OffloadedMemPool::SetFileTier(const std::string &file_path, size_t host_mem_limit) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  file_path_ = file_path;
+  host_mem_limit_ = host_mem_limit;
+  MS_LOG(INFO) << "Offload memory beyond " << host_mem_limit_ << " bytes of host memory to files in " << file_path_;
+#else
+  MS_LOG(WARNING) << "The offload file tier is not supported on windows, path: " << file_path;
+#endif
+}
+
+void *OffloadedMemPool::MallocFile(size_t mem_size) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  // The file is unlinked after mapped, so its space is released when the block is unmapped or the process exits.
+  auto file_name = file_path_ + "/offload_" + std::to_string(getpid()) + "_" + std::to_string(file_index_++);
+  auto fd = open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    MS_LOG(EXCEPTION) << "Open offload file failed: " << file_name << ", errno: " << errno;
+  }
+  (void)unlink(file_name.c_str());
+  if (ftruncate(fd, static_cast<off_t>(mem_size)) != 0) {
+    (void)close(fd);
+    MS_LOG(EXCEPTION) << "Resize offload file failed: " << file_name << ", size " << mem_size << ", errno: " << errno;
+  }
+  auto ptr = mmap(nullptr, mem_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  if (ptr == MAP_FAILED) {
+    MS_LOG(EXCEPTION) << "Map offload file failed: " << file_name << ", size " << mem_size << ", errno: " << errno;
+  }
+  file_mem_block_map_[ptr] = mem_size;
+  file_mem_size_ += mem_size;
+  return ptr;
+#else
+  MS_LOG(EXCEPTION) << "The offload file tier is not supported on windows.";
+#endif
+}
+
 void *OffloadedMemPool::MallocHost(size_t mem_size) {
   auto &mem_que = cached_host_mem_[mem_size];
   if (!mem_que.empty()) {
@@ -30,11 +107,15 @@ void *OffloadedMemPool::MallocHost(size_t mem_size) {
     mem_que.pop();
     return ret;
   }
+  if (!file_path_.empty() && host_mem_size_ + mem_size > host_mem_limit_) {
+    return MallocFile(mem_size);
+  }
   auto block = std::make_shared<std::vector<uint8_t>>();
   try {
     block->resize(mem_size, 0);
     auto ptr = block->data();
     host_mem_block_map_[ptr] = block;
+    host_mem_size_ += mem_size;
     return ptr;
   } catch (const std::exception &e) {
     MS_LOG(EXCEPTION) << "Malloc memory failed: size " << mem_size;
@@ -43,6 +124,11 @@ void *OffloadedMemPool::MallocHost(size_t mem_size) {
 
 void OffloadedMemPool::FreeHost(void *ptr) {
   MS_EXCEPTION_IF_NULL(ptr);
+  const auto &file_iter = file_mem_block_map_.find(ptr);
+  if (file_iter != file_mem_block_map_.end()) {
+    (void)cached_host_mem_[file_iter->second].emplace(ptr);
+    return;
+  }
   auto iter = host_mem_block_map_.find(ptr);
   if (iter == host_mem_block_map_.end()) {
     MS_LOG(DEBUG) << "Free ptr not be created from here, abort";
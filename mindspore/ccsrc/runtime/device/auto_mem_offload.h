@@ -16,11 +16,13 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_AUTO_MEM_OFFLOAD_H_
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_AUTO_MEM_OFFLOAD_H_
 
+#include <cstdint>
 #include <utility>
 #include <queue>
 #include <map>
 #include <vector>
 #include <memory>
+#include <string>
 #include <shared_mutex>
 
 #include "runtime/device/memory_manager.h"
@@ -30,16 +32,34 @@
 
 namespace mindspore {
 namespace device {
+// Host memory pool for the offloaded device memory. When the file tier is set, the blocks beyond the host memory limit
+// are mapped from the files in the file path, so the large and rarely used parameters and optimizer states can be
+// offloaded to NVMe.
 class OffloadedMemPool {
  public:
-  OffloadedMemPool() = default;
-  ~OffloadedMemPool() = default;
+  OffloadedMemPool();
+  ~OffloadedMemPool();
   void *MallocHost(size_t mem_size);
   void FreeHost(void *ptr);
 
+  // Set the directory of the file tier and the host memory size before the file tier is used.
+  void SetFileTier(const std::string &file_path, size_t host_mem_limit);
+  bool IsFileMem(void *ptr) const { return file_mem_block_map_.count(ptr) != 0; }
+  size_t host_mem_size() const { return host_mem_size_; }
+  size_t file_mem_size() const { return file_mem_size_; }
+
  private:
+  void *MallocFile(size_t mem_size);
+
   std::map<size_t, std::queue<void *>> cached_host_mem_;
   std::map<void *, std::shared_ptr<std::vector<uint8_t>>> host_mem_block_map_;
+  // The mapped file blocks and their sizes.
+  std::map<void *, size_t> file_mem_block_map_;
+  std::string file_path_;
+  size_t host_mem_limit_{SIZE_MAX};
+  size_t host_mem_size_{0};
+  size_t file_mem_size_{0};
+  size_t file_index_{0};
 };
 
 class MemHandler {
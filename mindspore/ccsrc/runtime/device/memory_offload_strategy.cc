@@ -87,6 +87,7 @@ void MemOffloadStrategy<Key>::Execute() {
     GenContinuousMemAllocInfo();
   }
   GenComputeMemEvents();
+  EstimateStepTime();
 }
 
 template <typename Key>
@@ -204,6 +205,7 @@ void MemOffloadStrategy<Key>::GenSwapEventSet() {
         (void)swap_events_.emplace(event);
       }
     }
+    mem_used_with_swap_.assign(min_mem_used_.begin(), min_mem_used_.end());
     return;
   }
   // greedy span filter
@@ -230,6 +232,7 @@ void MemOffloadStrategy<Key>::GenSwapEventSet() {
     auto span = iter.second.second;
     AddToSwapEventSetIfOutOfMem(event, span, &cur_mem_used);
   }
+  mem_used_with_swap_ = std::move(cur_mem_used);
 }
 
 template <typename Key>
@@ -408,6 +411,8 @@ void MemOffloadStrategy<Key>::GenComputeMemEvents() {
   post_compute_events_.clear();
   pre_compute_events_.resize(total_compute_index_);
   post_compute_events_.resize(total_compute_index_);
+  swap_in_infos_.clear();
+  prefetch_count_ = 0;
   for (auto &item : mem_events_) {
     auto &mem_events = item.second;
     // No need to generate events for memory that has only one event, which means it is never used by any kernel.
@@ -442,10 +447,12 @@ void MemOffloadStrategy<Key>::GenComputeMemEvents() {
         (void)post_compute_events_[pre_index].emplace_back(swap_out_event);
         // avoid swap-in-event follow init-event
         if (i != kFirstGetMemEventIndex || first_event->type != kInit) {
-          auto swap_in_event = std::make_shared<MemEvent<Key>>(kSwapIn, event->index);
+          const auto swap_in_index = GetSwapInIndex(event->index, pre_index, first_event->mem_size);
+          auto swap_in_event = std::make_shared<MemEvent<Key>>(kSwapIn, swap_in_index);
           swap_in_event->key = item.first;
           swap_in_event->mem_size = first_event->mem_size;
-          (void)pre_compute_events_[event->index].emplace_back(swap_in_event);
+          (void)pre_compute_events_[swap_in_index].emplace_back(swap_in_event);
+          (void)swap_in_infos_.emplace_back(swap_in_index, event->index, first_event->mem_size);
         }
       }
       if (event->index < pre_compute_events_.size()) {
@@ -459,6 +466,93 @@ void MemOffloadStrategy<Key>::GenComputeMemEvents() {
   }
 }
 
+template <typename Key>
+bool MemOffloadStrategy<Key>::NeedPrefetch() const {
+  return need_swap_ && transfer_bandwidth_ > 0 && compute_time_.size() >= total_compute_index_ &&
+         mem_used_with_swap_.size() >= total_compute_index_;
+}
+
+template <typename Key>
+size_t MemOffloadStrategy<Key>::GetSwapInIndex(size_t used_index, size_t pre_index, size_t mem_size) {
+  // The memory is swapped out after the computing of pre_index, and can not be swapped in before that.
+  if (!NeedPrefetch() || pre_index >= used_index) {
+    return used_index;
+  }
+  // Move the swap in forward until the computing in between could cover the transfer on a copy stream, while the
+  // memory is enough.
+  const double transfer_time = static_cast<double>(mem_size) / transfer_bandwidth_;
+  double hidden_time = 0;
+  size_t swap_in_index = used_index;
+  while (swap_in_index > pre_index + 1 && hidden_time < transfer_time) {
+    const size_t pre_compute_index = swap_in_index - 1;
+    if (mem_used_with_swap_[pre_compute_index] + mem_size > mem_size_) {
+      break;
+    }
+    hidden_time += compute_time_[pre_compute_index];
+    swap_in_index = pre_compute_index;
+  }
+  if (swap_in_index != used_index) {
+    for (size_t index = swap_in_index; index < used_index; ++index) {
+      mem_used_with_swap_[index] += mem_size;
+    }
+    ++prefetch_count_;
+  }
+  return swap_in_index;
+}
+
+template <typename Key>
+void MemOffloadStrategy<Key>::EstimateStepTime() {
+  if (!need_swap_ || mem_used_with_swap_.empty()) {
+    peak_mem_used_ = mem_used_without_swap_;
+  } else {
+    peak_mem_used_ = *(std::max_element(mem_used_with_swap_.begin(), mem_used_with_swap_.end()));
+  }
+  estimated_step_time_ = 0;
+  estimated_overlapped_step_time_ = 0;
+  if (transfer_bandwidth_ <= 0 || compute_time_.size() < total_compute_index_) {
+    MS_LOG(INFO) << "Offload plan peak mem: " << peak_mem_used_ << ", mem without swap: " << mem_used_without_swap_
+                 << ", swap in count: " << swap_in_infos_.size();
+    return;
+  }
+  // The swaps are issued on the compute stream, so every transfer adds to the step. The step with a separate copy
+  // stream is simulated as well, where the computing only waits for the swap in of the memory it uses.
+  std::vector<std::vector<size_t>> swap_in_at_index(total_compute_index_);
+  for (size_t i = 0; i < swap_in_infos_.size(); ++i) {
+    (void)swap_in_at_index[std::get<0>(swap_in_infos_[i])].emplace_back(i);
+  }
+  std::vector<double> ready_time(total_compute_index_, 0);
+  double compute_end_time = 0;
+  double copy_end_time = 0;
+  double total_compute_time = 0;
+  double total_transfer_time = 0;
+  for (size_t index = 0; index < total_compute_index_; ++index) {
+    for (auto info_index : swap_in_at_index[index]) {
+      const auto &info = swap_in_infos_[info_index];
+      const double transfer_time = static_cast<double>(std::get<2>(info)) / transfer_bandwidth_;
+      total_transfer_time += transfer_time;
+      copy_end_time = std::max(copy_end_time, compute_end_time) + transfer_time;
+      auto &used_ready_time = ready_time[std::get<1>(info)];
+      used_ready_time = std::max(used_ready_time, copy_end_time);
+    }
+    compute_end_time = std::max(compute_end_time, ready_time[index]) + compute_time_[index];
+    total_compute_time += compute_time_[index];
+    for (const auto &event : post_compute_events_[index]) {
+      if (event->type == kSwapOut) {
+        const double transfer_time = static_cast<double>(event->mem_size) / transfer_bandwidth_;
+        total_transfer_time += transfer_time;
+        copy_end_time = std::max(copy_end_time, compute_end_time) + transfer_time;
+      }
+    }
+  }
+  estimated_step_time_ = total_compute_time + total_transfer_time;
+  estimated_overlapped_step_time_ = compute_end_time;
+  MS_LOG(INFO) << "Offload plan peak mem: " << peak_mem_used_ << ", mem without swap: " << mem_used_without_swap_
+               << ", swap in count: " << swap_in_infos_.size() << ", prefetch count: " << prefetch_count_
+               << ", compute time: " << total_compute_time << ", estimated step time with the swaps on the compute "
+               << "stream: " << estimated_step_time_ << ", estimated step time if the swaps were on a copy stream: "
+               << estimated_overlapped_step_time_;
+}
+
 template <typename Key>
 void MemOffloadStrategy<Key>::GenFreeEvent(const MemEventPtr<Key> &last_event) {
   MS_EXCEPTION_IF_NULL(last_event);
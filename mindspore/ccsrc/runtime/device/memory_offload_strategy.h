@@ -21,6 +21,7 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <tuple>
 #include <algorithm>
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
@@ -167,6 +168,12 @@ class MemOffloadStrategy {
 
   void SetComputeTime(const std::vector<double> &compute_time) { compute_time_ = compute_time; }
 
+  // Set the bandwidth between device and host in bytes per unit of compute time, 0 disables the prefetch and the step
+  // time estimates. With the compute time, the swap in events are planned as early as a separate copy stream would need
+  // to cover the transfer by the computing. The swaps are still issued on the compute stream, so the transfers are not
+  // hidden yet, the plan and the estimates are for evaluating the offload.
+  void set_transfer_bandwidth(double transfer_bandwidth) { transfer_bandwidth_ = transfer_bandwidth; }
+
   MemEventPtrList<Key> &GetPreComputeEvents(size_t index);
 
   MemEventPtrList<Key> &GetPostComputeEvents(size_t index);
@@ -175,6 +182,21 @@ class MemOffloadStrategy {
 
   bool need_swap() const { return need_swap_; }
 
+  // The planned peak device memory, it is the memory without swap when no swap is needed.
+  size_t peak_mem_used() const { return peak_mem_used_; }
+
+  size_t mem_used_without_swap() const { return mem_used_without_swap_; }
+
+  // The step time estimated by the compute time and the transfer bandwidth with the swaps issued on the compute
+  // stream as they are, 0 if unknown.
+  double estimated_step_time() const { return estimated_step_time_; }
+
+  // The step time estimated as if the swaps were issued on a separate copy stream waited by events, which is not
+  // done yet, 0 if unknown.
+  double estimated_overlapped_step_time() const { return estimated_overlapped_step_time_; }
+
+  size_t prefetch_count() const { return prefetch_count_; }
+
   std::vector<ContinuousMemInfoPtr<Key>> GetContinuousMemAllocInfo(size_t index) {
     return continuous_mem_info_helper_->GetContinuousMemAllocInfo(index);
   }
@@ -196,6 +218,12 @@ class MemOffloadStrategy {
 
   void GenFreeEvent(const MemEventPtr<Key> &last_event);
 
+  bool NeedPrefetch() const;
+
+  size_t GetSwapInIndex(size_t used_index, size_t pre_index, size_t mem_size);
+
+  void EstimateStepTime();
+
   void AddToSwapEventSetIfOutOfMem(const MemEventPtr<Key> &mem_event, size_t span, std::vector<size_t> *mem_used);
 
   void GenContinuousMemSwapEvent(const ContinuousMemInfoPtr<Key> &continuous_mem_info, std::vector<size_t> *mem_used,
@@ -229,12 +257,21 @@ class MemOffloadStrategy {
 
   size_t mem_size_{0};
   std::vector<double> compute_time_;
+  double transfer_bandwidth_{0};
   bool need_swap_{false};
   std::multimap<size_t, std::pair<MemEventPtr<Key>, size_t>> event_span_;
   std::set<MemEventPtr<Key>> swap_events_;
   std::vector<size_t> min_mem_used_;
   size_t mem_used_without_swap_{0};
   size_t min_mem_needed_{0};
+  // The memory used of each compute index after the swap events are generated.
+  std::vector<size_t> mem_used_with_swap_;
+  // The compute index where the swap in is issued, the compute index where the memory is used and the memory size.
+  std::vector<std::tuple<size_t, size_t, size_t>> swap_in_infos_;
+  size_t prefetch_count_{0};
+  size_t peak_mem_used_{0};
+  double estimated_step_time_{0};
+  double estimated_overlapped_step_time_{0};
   std::shared_ptr<ContinuousMemInfoHelper<Key>> continuous_mem_info_helper_{nullptr};
 };
 }  // namespace device
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <queue>
 #include <set>
+#include <string>
 #ifdef _MSC_VER
 #include <time.h>
 #else
@@ -25,6 +26,7 @@
 #endif
 #include "utils/log_adapter.h"
 #include "utils/convert_utils_base.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace device {
@@ -33,6 +35,26 @@ constexpr float kMaxMemReuseFactor = 1.0;
 constexpr float kMinMemReuseFactor = 0.5;
 constexpr float kRetryFactor = 0.1;
 constexpr size_t kMockTimes = 5;
+// The bandwidth between device and host in GB/s used to plan the swap in prefetch and estimate the step time. The swaps
+// are issued on the compute stream, where the prefetch hides nothing, so it is only planned when the env is set.
+constexpr char kOffloadBandwidthEnv[] = "MS_DEV_OFFLOAD_BANDWIDTH";
+constexpr double kDefaultOffloadBandwidth = 0;
+// The compute time is recorded in microseconds.
+constexpr double kGBPerSecondToBytePerUs = 1.0e3;
+
+double GetTransferBandwidth() {
+  const auto &bandwidth_env = common::GetEnv(kOffloadBandwidthEnv);
+  if (bandwidth_env.empty()) {
+    return kDefaultOffloadBandwidth * kGBPerSecondToBytePerUs;
+  }
+  try {
+    return std::stod(bandwidth_env) * kGBPerSecondToBytePerUs;
+  } catch (const std::exception &) {
+    MS_LOG(WARNING) << "Invalid env " << kOffloadBandwidthEnv << ": " << bandwidth_env << ", use the default value "
+                    << kDefaultOffloadBandwidth;
+  }
+  return kDefaultOffloadBandwidth * kGBPerSecondToBytePerUs;
+}
 
 double GetCurrentTime() {
 #ifdef _MSC_VER
@@ -234,6 +256,7 @@ void MemScheduler::OptMemUsage(float mem_used_factor) {
   if (strategy_ == nullptr) {
     strategy_ = std::make_shared<MemOffloadStrategy<const void *>>(mem_priority_, mem_events_, manual_offload_keys_,
                                                                    total_step_, continuous_mem_info_helper_);
+    strategy_->set_transfer_bandwidth(GetTransferBandwidth());
     if (manual_offload_keys_.empty()) {
       compute_time_.resize(total_step_);
     } else {
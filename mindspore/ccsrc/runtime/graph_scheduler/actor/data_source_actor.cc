@@ -23,9 +23,16 @@
 #include "mindrt/include/async/async.h"
 #include "utils/log_adapter.h"
 #include "kernel/common_utils.h"
+#include "include/backend/data_queue/data_queue_mgr.h"
+#include "plugin/device/cpu/hal/device/cpu_data_queue.h"
 
 namespace mindspore {
 namespace runtime {
+namespace {
+// Each front of the data queue waits 30 seconds at most.
+constexpr size_t kCpuQueueFrontRetryTimes = 10;
+}  // namespace
+
 void DataSourceActor::Init() {
   // Check device contexts number.
   if (device_contexts_.size() < device::kDeviceContextsNumOne) {
@@ -87,6 +94,16 @@ void DeviceQueueDataSourceActor::Init() {
   for (size_t i = 0; i < kernel_info_->output_address_list().size(); ++i) {
     (void)launch_info_.outputs_.emplace_back(std::make_shared<Address>());
   }
+
+  // The host buffers of the dataset pipeline are addressable by the CPU kernels, so create the data queue of the
+  // channel here and pop the data from it directly.
+  MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+  if (device_contexts_[0]->GetDeviceType() == device::DeviceType::kCPU) {
+    MS_EXCEPTION_IF_NULL(data_kernel_);
+    channel_name_ = common::AnfAlgo::GetNodeAttr<std::string>(data_kernel_, "shared_name");
+    device::InitCpuDataQueue(channel_name_);
+    is_zero_copy_ = true;
+  }
 }
 
 void DeviceQueueDataSourceActor::FillDataBuffer() {
@@ -102,6 +119,11 @@ void DeviceQueueDataSourceActor::FillDataBuffer() {
 }
 
 void DeviceQueueDataSourceActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
+  // The memory of zero copy data is allocated by the dataset pipeline.
+  if (is_zero_copy_) {
+    OnMemoryAllocFinish(context);
+    return;
+  }
   auto &device_tensors = buffers_.back();
   if (ActorDispatcher::is_memory_allocation_sync()) {
     ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::AllocateMemory, &device_tensors,
@@ -138,6 +160,18 @@ void DeviceQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *co
     SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), "The data queue is empty.");
   }
 
+  if (is_zero_copy_) {
+    FetchCpuQueueData(context);
+    if (IsRunningFailed(context)) {
+      return;
+    }
+    if (common::AnfAlgo::IsDynamicShape(data_kernel_)) {
+      AnfAlgo::UpdateInternalParameterShape(internal_parameters_, data_kernel_);
+    }
+    PostRun(context);
+    return;
+  }
+
   // Construct outputs of data kernel launching.
   auto &device_tensors = buffers_.back();
   if (launch_info_.outputs_.size() != device_tensors.size()) {
@@ -177,6 +211,53 @@ void DeviceQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *co
   PostRun(context);
 }
 
+void DeviceQueueDataSourceActor::FetchCpuQueueData(OpContext<DeviceTensor> *const context) {
+  auto &data_queue_mgr = device::DataQueueMgr::GetInstance();
+  // The steps run one after another, so the data of last step is not used any more and can be given back to the
+  // dataset pipeline.
+  if (has_fronted_data_) {
+    (void)data_queue_mgr.Pop(channel_name_);
+    has_fronted_data_ = false;
+  }
+
+  std::vector<device::DataQueueItem> data;
+  auto ret = data_queue_mgr.Front(channel_name_, &data);
+  for (size_t retry = 1; (ret == device::DataQueueStatus::TIMEOUT) && (retry < kCpuQueueFrontRetryTimes); ++retry) {
+    MS_LOG(INFO) << "Waiting for data of channel " << channel_name_ << "...(" << retry << " / "
+                 << kCpuQueueFrontRetryTimes << ")";
+    ret = data_queue_mgr.Front(channel_name_, &data);
+  }
+  if (ret != device::DataQueueStatus::SUCCESS) {
+    std::string error_info = "Get data from the data queue of channel " + channel_name_ +
+                             " failed, error code: " + std::to_string(static_cast<int>(ret));
+    SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+  }
+  has_fronted_data_ = true;
+
+  auto &device_tensors = buffers_.back();
+  if (data.size() != device_tensors.size()) {
+    std::string error_info = "The data number " + std::to_string(data.size()) + " of channel " + channel_name_ +
+                             " is not equal to the outputs number " + std::to_string(device_tensors.size());
+    SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+  }
+  bool is_dynamic_shape = common::AnfAlgo::IsDynamicShape(data_kernel_);
+  if (is_dynamic_shape) {
+    device::UpdateGetNextWithDataQueueItems(data_kernel_, data);
+  }
+  for (size_t i = 0; i < device_tensors.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(device_tensors[i]);
+    if (!is_dynamic_shape && data[i].data_len != device_tensors[i]->GetSize()) {
+      std::string error_info = "The data size " + std::to_string(data[i].data_len) + " of output " +
+                               std::to_string(i) + " is not equal to the device tensor size " +
+                               std::to_string(device_tensors[i]->GetSize());
+      SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+    }
+    // The buffer is owned by the dataset pipeline until it is popped, so it must not be freed by the memory pool.
+    device_tensors[i]->set_ptr(data[i].device_addr);
+    device_tensors[i]->set_from_mem_pool(false);
+  }
+}
+
 void DeviceQueueDataSourceActor::SendDebugReq(OpContext<DeviceTensor> *const context) {
   ActorDispatcher::SendSync(*debug_aid_, &DebugActor::Debug, data_kernel_, &launch_info_, device_contexts_[0], context,
                             &GetAID());
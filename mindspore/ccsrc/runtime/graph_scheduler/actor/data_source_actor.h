@@ -101,12 +101,22 @@ class DeviceQueueDataSourceActor : public DataSourceActor {
   friend class GraphScheduler;
   friend class ControlNodeScheduler;
 
+  // On CPU the output device tensors point to the buffers popped from the data queue instead of the copies made by
+  // the data kernel.
+  void FetchCpuQueueData(OpContext<DeviceTensor> *const context);
+
   // Input data kernel(for example GetNext) fetches data from device queue.
   CNodePtr data_kernel_{nullptr};
   KernelInfo *kernel_info_{nullptr};
 
   // The kernel launch info is fetched by the device tensors.
   KernelLaunchInfo launch_info_;
+
+  // Whether the data is handed over from the CPU data queue without copying.
+  bool is_zero_copy_{false};
+  std::string channel_name_;
+  // The front data of the queue is in use by the current step, it is popped when the next step fetches data.
+  bool has_fronted_data_{false};
 };
 
 // The class represents that the data source is host queue.
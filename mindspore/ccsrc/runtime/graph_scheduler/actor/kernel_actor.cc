@@ -24,6 +24,9 @@
 #include "distributed/recovery/recovery_context.h"
 #include "distributed/collective/collective_manager.h"
 #include "kernel/common_utils.h"
+#ifndef ENABLE_SECURITY
+#include "profiler/device/perf_counter.h"
+#endif
 
 namespace mindspore {
 namespace runtime {
@@ -663,6 +666,17 @@ bool KernelActor::LaunchKernel(OpContext<DeviceTensor> *const) {
   }
 
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+#ifndef ENABLE_SECURITY
+  // Hardware counters only make sense for kernels that run on the host thread.
+  auto &perf_counter = profiler::KernelPerfCounter::GetInstance();
+  if (perf_counter.enabled() && device_contexts_[0]->GetDeviceType() == device::DeviceType::kCPU) {
+    perf_counter.Begin();
+    auto ret = device_contexts_[0]->kernel_executor_->LaunchKernel(
+      kernel_, launch_info_.inputs_, launch_info_.workspaces_, launch_info_.outputs_, kernel_info_->stream_id());
+    perf_counter.End(common::AnfAlgo::GetCNodeName(kernel_));
+    return ret;
+  }
+#endif
   MS_LOG(DEBUG) << "Begin launch kernel of actor: " << GetAID().Name();
   auto ret = device_contexts_[0]->kernel_executor_->LaunchKernel(
     kernel_, launch_info_.inputs_, launch_info_.workspaces_, launch_info_.outputs_, kernel_info_->stream_id());
@@ -40,7 +40,8 @@ MessageBase *MuxRecvActor::HandleMessage(MessageBase *const msg) {
   if (common::GetEnv("use_void").empty()) {
     // The mux recv actor receives requests for the service process. Currently, the requests are processed serially.
     std::unique_lock<std::mutex> is_ready_lock(is_ready_mtx_);
-    is_ready_cv_.wait(is_ready_lock, [this] { return is_ready_.load(); });
+    // Several message handlers may wait here at the same time, all of them must be woken up when finalizing.
+    is_ready_cv_.wait(is_ready_lock, [this] { return is_ready_.load() || finalized_.load(); });
     is_ready_ = false;
   }
 
@@ -109,7 +110,8 @@ void *MuxRecvActor::AllocateMessage(size_t size) {
   // The mux recv actor receives requests for the service process. Currently, the requests are processed serially.
   if (!common::GetEnv("use_void").empty()) {
     std::unique_lock<std::mutex> is_ready_lock(is_ready_mtx_);
-    is_ready_cv_.wait(is_ready_lock, [this] { return is_ready_.load(); });
+    // Several message handlers may wait here at the same time, all of them must be woken up when finalizing.
+    is_ready_cv_.wait(is_ready_lock, [this] { return is_ready_.load() || finalized_.load(); });
     is_ready_ = false;
   }
 
@@ -124,6 +126,8 @@ void MuxRecvActor::UpdateStatus() {
 
 void MuxRecvActor::Finalize() {
   std::unique_lock<std::mutex> lock(context_mtx_);
+  // The waiting message handlers check the flags under the ready lock, so the flags are set under it as well.
+  std::unique_lock<std::mutex> is_ready_lock(is_ready_mtx_);
   finalized_ = true;
   is_ready_ = true;
   is_context_valid_ = true;
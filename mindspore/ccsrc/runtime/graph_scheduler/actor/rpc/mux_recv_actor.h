@@ -35,7 +35,10 @@ class MuxRecvActor : public RecvActor {
                         GraphExecutionStrategy strategy, const std::set<size_t> &modifiable_ref_input_indexes,
                         const std::set<size_t> &modifiable_ref_output_indexes)
       : RecvActor(name, kernel, device_context, memory_manager_aid, debug_aid, recorder_aid, strategy,
-                  modifiable_ref_input_indexes, modifiable_ref_output_indexes) {}
+                  modifiable_ref_input_indexes, modifiable_ref_output_indexes) {
+    // The requests from different clients are read by several event loops, and are still processed serially.
+    recv_event_loop_num_ = distributed::kMuxRecvEventLoopNum;
+  }
   ~MuxRecvActor() override = default;
 
   // Get the from actor aid of received message.
@@ -58,7 +58,7 @@ void RecvActor::SetRouteInfo(uint32_t, const std::string &, const std::string &r
 
 bool RecvActor::StartServer() {
   // Step 1: Create a tcp server and start listening.
-  server_ = std::make_unique<TCPServer>();
+  server_ = std::make_unique<TCPServer>(false, recv_event_loop_num_);
   MS_EXCEPTION_IF_NULL(server_);
 
   // Only set the memory allocating callback when using void* message.
@@ -39,6 +39,7 @@ class RecvActor : public RpcActor {
       : RpcActor(name, kernel, device_context, memory_manager_aid, debug_aid, recorder_aid, strategy,
                  modifiable_ref_input_indexes, modifiable_ref_output_indexes, KernelTransformType::kRecvActor),
         server_(nullptr),
+        recv_event_loop_num_(1),
         is_context_valid_(false),
         recv_data_(nullptr),
         ip_(""),
@@ -97,6 +98,9 @@ class RecvActor : public RpcActor {
   void *AllocateMemByDeviceRes(size_t size);
 
   std::unique_ptr<TCPServer> server_;
+  // The number of event loops of the server receiving messages, the message handler must be thread safe if it is more
+  // than one.
+  size_t recv_event_loop_num_;
 
   // The variables used to ensure thread-safe of op context visited by recv actor.
   bool is_context_valid_;
@@ -25,6 +25,7 @@
 #include "runtime/graph_scheduler/optimizer/invalid_data_arrow_elimination.h"
 #include "runtime/graph_scheduler/optimizer/batch_data_arrow_fusion.h"
 #include "runtime/graph_scheduler/optimizer/multi_actor_fusion.h"
+#include "runtime/graph_scheduler/optimizer/cost_based_actor_fusion.h"
 #include "runtime/hardware/device_context_manager.h"
 #include "mindrt/src/actor/actormgr.h"
 #include "mindrt/include/async/async.h"
@@ -80,6 +81,9 @@ using distributed::recovery::RecoveryContext;
 namespace {
 constexpr char kNumaEnableEnv[] = "MS_ENABLE_NUMA";
 constexpr char kNumaEnableEnv2[] = "DATASET_ENABLE_NUMA";
+// Set "cost" to fuse the actors by the estimated cost instead of the structure of actors.
+constexpr char kActorFusionModeEnv[] = "MS_DEV_ACTOR_FUSION_MODE";
+constexpr char kActorFusionModeCost[] = "cost";
 
 // For the transform state synchronization.
 constexpr char kTransformFinishPrefix[] = "TRANSFORM_FINISH_";
@@ -952,7 +956,11 @@ void GraphScheduler::Optimize(const ActorSetPtr &actor_set) const {
   }
   optimizer->AddPass(std::make_shared<InvalidDataArrowElimination>());
   if (!ms_context->get_param<bool>(MS_CTX_ENABLE_MEM_OFFLOAD)) {
-    optimizer->AddPass(std::make_shared<MultiActorFusion>());
+    if (common::GetEnv(kActorFusionModeEnv) == kActorFusionModeCost) {
+      optimizer->AddPass(std::make_shared<CostBasedActorFusion>());
+    } else {
+      optimizer->AddPass(std::make_shared<MultiActorFusion>());
+    }
   }
   optimizer->AddPass(std::make_shared<BatchDataArrowFusion>());
   optimizer->Optimize(actor_set);
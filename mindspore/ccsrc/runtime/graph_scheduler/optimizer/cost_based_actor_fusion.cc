@@ -0,0 +1,222 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/optimizer/cost_based_actor_fusion.h"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <queue>
+#include <set>
+#include <string>
+#include "runtime/graph_scheduler/scheduler_helper.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "mindrt/src/actor/actormgr.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+// The estimated cost of sending and handling one actor message, in nanoseconds.
+constexpr double kActorMessageCost = 2000.0;
+// The estimated fixed cost of launching one kernel, in nanoseconds.
+constexpr double kKernelLaunchCost = 200.0;
+// The estimated memory bandwidth of one thread, in bytes per nanosecond.
+constexpr double kMemoryBytesPerNs = 8.0;
+// A segment can always grow until the message cost is amortized.
+constexpr double kMinSegmentCost = kActorMessageCost * 20;
+// Keep at least this number of segments of the total cost for each actor thread.
+constexpr size_t kSegmentNumPerThread = 2;
+// The actors in one segment run in the nested synchronous sending, so limit the number to bound the stack depth.
+constexpr size_t kSegmentMaxActorNum = 1000;
+
+bool SupportFusion(const AbstractActorPtr &actor) {
+  MS_EXCEPTION_IF_NULL(actor);
+  // The super kernel actor runs the whole graph and is expensive enough to be a segment alone.
+  return (actor->type() == KernelTransformType::kDeviceDataSourceActor) ||
+         (actor->type() == KernelTransformType::kHostDataSourceActor) ||
+         (actor->type() == KernelTransformType::kKernelActor) || (actor->type() == KernelTransformType::kCopyActor);
+}
+
+// Estimate the execution time of the actor by the memory size accessed by the kernel.
+double EstimateActorCost(const AbstractActorPtr &actor) {
+  MS_EXCEPTION_IF_NULL(actor);
+  if (actor->type() != KernelTransformType::kKernelActor) {
+    return kKernelLaunchCost;
+  }
+  auto kernel_actor = dynamic_cast<KernelActor *>(actor.get());
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  auto kernel_mod = AnfAlgo::GetKernelMod(kernel_actor->kernel());
+  if (kernel_mod == nullptr) {
+    return kKernelLaunchCost;
+  }
+  size_t access_size = 0;
+  for (auto size : kernel_mod->GetInputSizeList()) {
+    access_size += size;
+  }
+  for (auto size : kernel_mod->GetOutputSizeList()) {
+    access_size += size;
+  }
+  return kKernelLaunchCost + static_cast<double>(access_size) / kMemoryBytesPerNs;
+}
+
+size_t GetActorThreadNum() {
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+  if (actor_manager == nullptr || actor_manager->GetActorThreadPool() == nullptr) {
+    return 1;
+  }
+  return std::max(actor_manager->GetActorThreadPool()->GetActorThreadNum(), static_cast<size_t>(1));
+}
+}  // namespace
+
+std::vector<std::vector<size_t>> CostBasedActorFusion::Partition(const std::vector<double> &costs,
+                                                                 const std::vector<std::vector<size_t>> &outputs,
+                                                                 size_t thread_num) {
+  if (costs.size() != outputs.size()) {
+    MS_LOG(EXCEPTION) << "The costs size " << costs.size() << " is not equal to the outputs size " << outputs.size();
+  }
+  // Sort the actors in topological order, the actors in the cycle are skipped.
+  std::vector<std::vector<size_t>> inputs(costs.size());
+  std::vector<size_t> input_nums(costs.size(), 0);
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    for (auto output : outputs[i]) {
+      (void)inputs.at(output).emplace_back(i);
+      ++input_nums[output];
+    }
+  }
+  std::vector<size_t> order;
+  std::queue<size_t> ready_actors;
+  for (size_t i = 0; i < input_nums.size(); ++i) {
+    if (input_nums[i] == 0) {
+      ready_actors.push(i);
+    }
+  }
+  while (!ready_actors.empty()) {
+    auto current = ready_actors.front();
+    ready_actors.pop();
+    (void)order.emplace_back(current);
+    for (auto output : outputs[current]) {
+      if (--input_nums[output] == 0) {
+        ready_actors.push(output);
+      }
+    }
+  }
+
+  double total_cost = 0;
+  for (auto cost : costs) {
+    total_cost += cost;
+  }
+  auto cost_limit =
+    std::max(total_cost / static_cast<double>(std::max(thread_num, static_cast<size_t>(1)) * kSegmentNumPerThread),
+             kMinSegmentCost);
+
+  // Append the actor to the segment of the input actor which finishes last when the input actor is the tail of the
+  // segment, so the message on the critical path is saved. Otherwise the actor starts a new segment.
+  constexpr size_t kInvalidSegment = SIZE_MAX;
+  std::vector<std::vector<size_t>> segments;
+  std::vector<double> segment_costs;
+  std::vector<size_t> actor_segments(costs.size(), kInvalidSegment);
+  std::vector<double> finish_times(costs.size(), 0);
+  for (auto current : order) {
+    size_t best_segment = kInvalidSegment;
+    double best_finish_time = -1;
+    double start_time = 0;
+    for (auto input : inputs[current]) {
+      start_time = std::max(start_time, finish_times[input]);
+      auto segment = actor_segments[input];
+      if (segments[segment].back() != input || segments[segment].size() >= kSegmentMaxActorNum ||
+          segment_costs[segment] + costs[current] > cost_limit) {
+        continue;
+      }
+      if (finish_times[input] > best_finish_time) {
+        best_finish_time = finish_times[input];
+        best_segment = segment;
+      }
+    }
+    finish_times[current] = start_time + costs[current];
+
+    if (best_segment == kInvalidSegment) {
+      best_segment = segments.size();
+      (void)segments.emplace_back();
+      (void)segment_costs.emplace_back(0);
+    }
+    (void)segments[best_segment].emplace_back(current);
+    segment_costs[best_segment] += costs[current];
+    actor_segments[current] = best_segment;
+  }
+
+  std::vector<std::vector<size_t>> fused_segments;
+  for (auto &segment : segments) {
+    if (segment.size() > 1) {
+      (void)fused_segments.emplace_back(std::move(segment));
+    }
+  }
+  MS_LOG(INFO) << "Partition actors num: " << costs.size() << ", total cost: " << total_cost
+               << " ns, segment cost limit: " << cost_limit << " ns, segments num: " << segments.size()
+               << ", fused segments num: " << fused_segments.size();
+  return fused_segments;
+}
+
+void CostBasedActorFusion::Process(ActorSet *const actor_set, AbstractActor *const) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  if (!actor_set->custom_actors_.empty()) {
+    return;
+  }
+
+  // Collect the actors which support fusion and the dependencies between them.
+  std::vector<AbstractActorPtr> actors;
+  mindspore::HashMap<std::string, size_t> actor_indexes;
+  for (auto &actor : SchedulerHelper::CollectActors(actor_set)) {
+    if (SupportFusion(actor)) {
+      actor_indexes[actor->GetAID().Name()] = actors.size();
+      (void)actors.emplace_back(actor);
+    }
+  }
+  std::vector<double> costs;
+  std::vector<std::vector<size_t>> outputs(actors.size());
+  for (size_t i = 0; i < actors.size(); ++i) {
+    (void)costs.emplace_back(EstimateActorCost(actors[i]));
+    std::set<size_t> output_indexes;
+    for (auto &output_data_arrow : actors[i]->output_data_arrows()) {
+      MS_EXCEPTION_IF_NULL(output_data_arrow);
+      auto iter = actor_indexes.find(output_data_arrow->to_op_id_.Name());
+      if (iter != actor_indexes.end()) {
+        (void)output_indexes.insert(iter->second);
+      }
+    }
+    for (auto &output_control_arrow : actors[i]->output_control_arrows()) {
+      MS_EXCEPTION_IF_NULL(output_control_arrow);
+      auto iter = actor_indexes.find(output_control_arrow->to_op_id_.Name());
+      if (iter != actor_indexes.end()) {
+        (void)output_indexes.insert(iter->second);
+      }
+    }
+    outputs[i].assign(output_indexes.begin(), output_indexes.end());
+  }
+
+  // Build all the fusion actors.
+  for (auto &segment : Partition(costs, outputs, GetActorThreadNum())) {
+    std::vector<AbstractActorPtr> sub_actors;
+    (void)std::transform(segment.begin(), segment.end(), std::back_inserter(sub_actors),
+                         [&actors](size_t index) { return actors[index]; });
+    (void)actor_set->fusion_actors_.emplace_back(SchedulerHelper::BuildFusionActor(sub_actors));
+  }
+
+  // Link fusion actor.
+  for (auto &fusion_actor : actor_set->fusion_actors_) {
+    SchedulerHelper::AddArrowForFusionActor(fusion_actor.get());
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,47 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_OPTIMIZER_COST_BASED_ACTOR_FUSION_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_OPTIMIZER_COST_BASED_ACTOR_FUSION_H_
+
+#include <vector>
+#include "runtime/graph_scheduler/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace runtime {
+// Partition the actors into sequential segments by the estimated cost and fuse each segment to a fusion actor, so the
+// cheap actors pay one message per segment instead of one message per actor. A segment only grows along the
+// dependency chain and stops at the cost limit, which keeps the parallel branches in different segments to fill the
+// actor thread pool.
+class CostBasedActorFusion : public ActorPass {
+ public:
+  CostBasedActorFusion() : ActorPass("cost_based_actor_fusion", false) {}
+  ~CostBasedActorFusion() override = default;
+
+  // Partition the DAG of actors in topological order. The costs are the estimated execution time of the actors in
+  // nanoseconds, the outputs are the indexes of the dependent actors. Return the segments whose size is greater than 1,
+  // and the actors in each segment are in the execution order.
+  static std::vector<std::vector<size_t>> Partition(const std::vector<double> &costs,
+                                                    const std::vector<std::vector<size_t>> &outputs,
+                                                    size_t thread_num);
+
+ protected:
+  void Process(ActorSet *const actor_set, AbstractActor *const actor) override;
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_OPTIMIZER_COST_BASED_ACTOR_FUSION_H_
@@ -28,6 +28,9 @@ namespace mindspore {
 using runtime::DeviceAddressUtils;
 namespace pynative {
 namespace {
+// The default max number of cached single op graphs, can be changed by env MS_DEV_PYNATIVE_OP_CACHE_SIZE.
+constexpr size_t kDefaultOpCacheCapacity = 10000;
+
 static const mindspore::HashSet<std::string> kDynamicProcessOp = {
   kExpandDimsOpName,
   kConv2DOpName,
@@ -100,7 +103,23 @@ void CreateDeviceAddressWithoutWorkspace(const KernelGraphPtr &graph, const Devi
 }
 }  // namespace
 
-OpCompiler::OpCompiler() { session_ = session::SessionFactory::Get().Create(kSessionBasic); }
+OpCompiler::OpCompiler() : cache_capacity_(GetCacheCapacity()) {
+  session_ = session::SessionFactory::Get().Create(kSessionBasic);
+}
+
+size_t OpCompiler::GetCacheCapacity() {
+  const auto &capacity_env = common::GetEnv("MS_DEV_PYNATIVE_OP_CACHE_SIZE");
+  if (capacity_env.empty()) {
+    return kDefaultOpCacheCapacity;
+  }
+  try {
+    return std::stoul(capacity_env);
+  } catch (const std::exception &) {
+    MS_LOG(WARNING) << "Invalid env MS_DEV_PYNATIVE_OP_CACHE_SIZE: " << capacity_env << ", use the default value "
+                    << kDefaultOpCacheCapacity;
+  }
+  return kDefaultOpCacheCapacity;
+}
 
 OpCompiler &OpCompiler::GetInstance() {
   static OpCompiler instance;
@@ -113,14 +132,17 @@ OpCompilerInfoPtr OpCompiler::Compile(const session::BackendOpRunInfoPtr &op_run
   MS_EXCEPTION_IF_NULL(device_context);
   py::gil_scoped_acquire acquire_gil;
   auto graph_info = op_run_info->base_op_run_info.graph_info;
-  auto iter = op_compiler_infos_.find(graph_info);
   // Check if the graph cache exists.
   auto &op_executor = runtime::OpExecutor::GetInstance();
-  if (iter != op_compiler_infos_.end() && op_executor.BuildQueueEmpty()) {
-    const auto &op_compiler_info = iter->second;
-    MS_EXCEPTION_IF_NULL(op_compiler_info);
-    *single_op_cache_hit = true;
-    return iter->second;
+  if (op_executor.BuildQueueEmpty()) {
+    auto cached_op_compiler_info = FindOpCompilerInfo(graph_info);
+    if (cached_op_compiler_info != nullptr) {
+      *single_op_cache_hit = true;
+      return cached_op_compiler_info;
+    }
+  } else {
+    // The cache is not looked up while the build queue is not empty, count it as a miss.
+    ++cache_miss_count_;
   }
   *single_op_cache_hit = false;
   // Generate kernel graph.
@@ -162,10 +184,52 @@ OpCompilerInfoPtr OpCompiler::Compile(const session::BackendOpRunInfoPtr &op_run
   auto op_compiler_info =
     std::make_shared<OpCompilerInfo>(graph_info, graph->graph_id(), graph, outputs_with_index, device_context, false);
 
-  op_compiler_infos_[graph_info] = op_compiler_info;
+  CacheOpCompilerInfo(op_compiler_info);
+  return op_compiler_info;
+}
+
+OpCompilerInfoPtr OpCompiler::FindOpCompilerInfo(const GraphInfo &graph_info) {
+  auto iter = op_compiler_infos_.find(OpCacheKey{graph_info, std::hash<GraphInfo>{}(graph_info)});
+  if (iter == op_compiler_infos_.end()) {
+    ++cache_miss_count_;
+    return nullptr;
+  }
+  ++cache_hit_count_;
+  // Move the hit one to the front of the list.
+  op_compiler_info_list_.splice(op_compiler_info_list_.begin(), op_compiler_info_list_, iter->second);
+  const auto &op_compiler_info = *iter->second;
+  MS_EXCEPTION_IF_NULL(op_compiler_info);
   return op_compiler_info;
 }
 
+void OpCompiler::CacheOpCompilerInfo(const OpCompilerInfoPtr &op_compiler_info) {
+  MS_EXCEPTION_IF_NULL(op_compiler_info);
+  OpCacheKey key{op_compiler_info->graph_info_, op_compiler_info->graph_info_hash_};
+  auto iter = op_compiler_infos_.find(key);
+  if (iter != op_compiler_infos_.end()) {
+    // Recompiled while the build queue is not empty, replace the old one. The old key views the graph info of the old
+    // one, so it is replaced as well.
+    auto list_iter = iter->second;
+    (void)op_compiler_infos_.erase(iter);
+    op_compiler_info_list_.splice(op_compiler_info_list_.begin(), op_compiler_info_list_, list_iter);
+    *list_iter = op_compiler_info;
+    op_compiler_infos_[key] = list_iter;
+    return;
+  }
+  op_compiler_info_list_.push_front(op_compiler_info);
+  op_compiler_infos_[key] = op_compiler_info_list_.begin();
+  if (cache_capacity_ == 0) {
+    return;
+  }
+  while (op_compiler_infos_.size() > cache_capacity_) {
+    const auto &evicted = op_compiler_info_list_.back();
+    MS_LOG(DEBUG) << "Evict op cache " << evicted->graph_info_;
+    (void)op_compiler_infos_.erase(OpCacheKey{evicted->graph_info_, evicted->graph_info_hash_});
+    op_compiler_info_list_.pop_back();
+    ++cache_evict_count_;
+  }
+}
+
 void OpCompiler::BatchBuild(const std::vector<KernelGraphPtr> &graphs, const DeviceContext *device_context) {
   MS_EXCEPTION_IF_NULL(device_context);
   std::vector<CNodePtr> node_to_build;
@@ -184,9 +248,22 @@ void OpCompiler::BatchBuild(const std::vector<KernelGraphPtr> &graphs, const Dev
   }
 }
 
-void OpCompiler::ClearOpCache(const GraphInfo &graph_info) { (void)op_compiler_infos_.erase(graph_info); }
+void OpCompiler::ClearOpCache(const GraphInfo &graph_info) {
+  auto iter = op_compiler_infos_.find(OpCacheKey{graph_info, std::hash<GraphInfo>{}(graph_info)});
+  if (iter == op_compiler_infos_.end()) {
+    return;
+  }
+  (void)op_compiler_info_list_.erase(iter->second);
+  (void)op_compiler_infos_.erase(iter);
+}
 
-void OpCompiler::ClearAllCache() { op_compiler_infos_.clear(); }
+void OpCompiler::ClearAllCache() {
+  MS_LOG(INFO) << "Op cache size: " << op_compiler_infos_.size() << ", capacity: " << cache_capacity_
+               << ", hit: " << cache_hit_count_ << ", miss: " << cache_miss_count_
+               << ", evict: " << cache_evict_count_;
+  op_compiler_infos_.clear();
+  op_compiler_info_list_.clear();
+}
 
 bool OpCompiler::NeedEnableDynamicProcess(const std::string &op_name) {
   auto context = MsContext::GetInstance();
@@ -16,10 +16,12 @@
 #ifndef MINDSPORE_MINDSPORE_CCSRC_RUNTIME_PYNATIVE_OP_COMPILER_H_
 #define MINDSPORE_MINDSPORE_CCSRC_RUNTIME_PYNATIVE_OP_COMPILER_H_
 
+#include <list>
 #include <utility>
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
 #include "utils/ms_utils.h"
 #include "backend/common/session/kernel_graph.h"
 #include "backend/common/session/session_basic.h"
@@ -37,7 +39,8 @@ struct OpCompilerInfo {
         graph_(std::move(graph)),
         graph_output_nodes_(std::move(graph_output_nodes)),
         device_context_(device_context),
-        need_erase_(need_erase) {}
+        need_erase_(need_erase),
+        graph_info_hash_(std::hash<GraphInfo>{}(graph_info_)) {}
   ~OpCompilerInfo() = default;
   GraphInfo graph_info_;
   GraphId graph_id_;
@@ -45,9 +48,22 @@ struct OpCompilerInfo {
   std::vector<KernelWithIndex> graph_output_nodes_;
   DeviceContext *device_context_;
   bool need_erase_;
+  // Computed once, so the op cache never hashes the long graph info of a cached op again.
+  size_t graph_info_hash_;
 };
 using OpCompilerInfoPtr = std::shared_ptr<OpCompilerInfo>;
 
+// The key of the op cache, which views the graph info and carries its hash.
+struct OpCacheKey {
+  std::string_view graph_info;
+  size_t hash;
+  bool operator==(const OpCacheKey &other) const { return hash == other.hash && graph_info == other.graph_info; }
+};
+
+struct OpCacheKeyHash {
+  size_t operator()(const OpCacheKey &key) const { return key.hash; }
+};
+
 // FuncGraph, Backend and GraphCompiler correspond one-to-one,
 // and GraphCompiler stores the compilation cache of operators.
 // When the graph structure changes, the front-end will send multiple graphs,
@@ -74,14 +90,36 @@ class BACKEND_EXPORT OpCompiler {
 
   bool NeedEnableDynamicProcess(const std::string &op_name);
 
+  size_t cache_size() const { return op_compiler_infos_.size(); }
+  size_t cache_hit_count() const { return cache_hit_count_; }
+  size_t cache_miss_count() const { return cache_miss_count_; }
+  size_t cache_evict_count() const { return cache_evict_count_; }
+
  private:
   OpCompiler();
   ~OpCompiler() = default;
   DISABLE_COPY_AND_ASSIGN(OpCompiler);
 
+  // The max number of cached op compiler infos set by env MS_DEV_PYNATIVE_OP_CACHE_SIZE, 0 means unlimited.
+  static size_t GetCacheCapacity();
+  // Find the cached op compiler info and mark it as the most recently used one, return nullptr if it is not cached.
+  // Counted as a hit or a miss.
+  OpCompilerInfoPtr FindOpCompilerInfo(const GraphInfo &graph_info);
+  // Insert the op compiler info as the most recently used one, and evict the least recently used ones beyond the
+  // capacity. An evicted info is released after the tasks still holding it are finished.
+  void CacheOpCompilerInfo(const OpCompilerInfoPtr &op_compiler_info);
+
   // All operators shared the same session.
   session::SessionPtr session_;
-  mindspore::HashMap<GraphInfo, OpCompilerInfoPtr> op_compiler_infos_;
+  // Op compiler infos ordered from the most recently used to the least recently used.
+  std::list<OpCompilerInfoPtr> op_compiler_info_list_;
+  // The keys view the graph infos of the op compiler infos in the list.
+  mindspore::HashMap<OpCacheKey, std::list<OpCompilerInfoPtr>::iterator, OpCacheKeyHash> op_compiler_infos_;
+  // The max number of cached op compiler infos, 0 means unlimited.
+  size_t cache_capacity_;
+  size_t cache_hit_count_{0};
+  size_t cache_miss_count_{0};
+  size_t cache_evict_count_{0};
 };
 }  // namespace pynative
 using OpCompilerInfoPtr = pynative::OpCompilerInfoPtr;
@@ -61,6 +61,7 @@ void ParallelContext::Reset() {
   enable_reduce_scatter_fusion_ = true;
   strategy_ckpt_load_file_ = "";
   strategy_ckpt_save_file_ = "";
+  rec_strategy_cache_dir_ = "";
   enable_parallel_optimizer_ = false;
   all_reduce_fusion_split_indices_.clear();
   all_reduce_fusion_split_sizes_.clear();
@@ -178,6 +179,10 @@ void ParallelContext::set_group_ckpt_save_file(const std::string &group_ckpt_sav
   group_ckpt_save_file_ = group_ckpt_save_file;
 }
 
+void ParallelContext::set_rec_strategy_cache_dir(const std::string &rec_strategy_cache_dir) {
+  rec_strategy_cache_dir_ = rec_strategy_cache_dir;
+}
+
 void ParallelContext::set_optimizer_weight_shard_size(int64_t optimizer_weight_shard_size) {
   optimizer_weight_shard_size_ = optimizer_weight_shard_size;
 }
@@ -57,7 +57,10 @@ enum TensorCompressionType {
   kFSE = 3,
   kBitPacking = 4,
   kFSEInt = 5,
-  kFSEInfer = 6
+  kFSEInfer = 6,
+  kBF16 = 7,
+  kNMSparse = 8,
+  kBlockSparse = 9
 };
 
 // A sub namespace in ME to support tensor related definition.
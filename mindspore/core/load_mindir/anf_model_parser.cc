@@ -19,23 +19,35 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <stack>
 #include <string>
 #include <vector>
 #include <utility>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "ir/tensor.h"
 #include "ir/param_info.h"
 #include "ir/map_tensor.h"
 #include "ops/primitive_c.h"
 #include "abstract/abstract_value.h"
+#include "abstract/utils.h"
 #include "abstract/ops/primitive_infer_map.h"
 #include "utils/hash_map.h"
 #include "utils/log_adapter.h"
 #include "utils/shape_utils.h"
 #include "utils/check_convert_utils.h"
 #include "utils/ms_utils_secure.h"
+#include "utils/ms_utils.h"
+#include "utils/profile.h"
 #include "abstract/abstract_function.h"
 #include "load_mindir/infer_mindir.h"
 
@@ -266,39 +278,149 @@ AnfNodePtr NewValueNodeWithAbstract(const T &value) {
   node->set_abstract(value->ToAbstract());
   return node;
 }
+
+// Parameters are built on several threads once their data exceeds this size.
+constexpr size_t kParallelLoadThreshold = 64 << 20;
+constexpr size_t kMaxParallelLoadThreadNum = 8;
+// Set to 0 to read external data files into memory instead of mapping them.
+constexpr char kMindIRMmapEnv[] = "MS_MINDIR_MMAP";
+
+TypeId GetTensorProtoTypeId(const mind_ir::TensorProto &tensor_proto) {
+  // find instead of operator[], parameters are built concurrently
+  auto iter = kDefaultValueSwitchMap.find(tensor_proto.data_type());
+  return iter == kDefaultValueSwitchMap.end() ? kTypeUnknown : iter->second;
+}
+
+size_t GetTensorProtoDataSize(const mind_ir::TensorProto &tensor_proto) {
+  return tensor_proto.has_external_data() ? LongToSize(tensor_proto.external_data().length())
+                                          : tensor_proto.raw_data().size();
+}
+
+// Tensor data pointing into a copy-on-write file mapping, pages are loaded on first access and only copied when the
+// tensor is written.
+class MappedTensorData : public tensor::TensorData {
+ public:
+  MappedTensorData(const MappedFilePtr &file, unsigned char *data, size_t size, size_t item_size, size_t ndim)
+      : file_(file), data_(data), size_(size), item_size_(item_size), ndim_(ndim) {}
+  ~MappedTensorData() override = default;
+
+  ssize_t size() const override { return static_cast<ssize_t>(size_); }
+  ssize_t itemsize() const override { return static_cast<ssize_t>(item_size_); }
+  ssize_t nbytes() const override { return size() * itemsize(); }
+  ssize_t ndim() const override { return static_cast<ssize_t>(ndim_); }
+  void *data() override { return data_; }
+  const void *const_data() const override { return data_; }
+  bool is_sub_data() const override { return false; }
+  bool has_sub_data() const override { return false; }
+
+  std::string ToString(TypeId type, const ShapeVector &shape, bool use_comma) const override {
+    // Only used for printing, format a copy like any other tensor.
+    tensor::Tensor copy(type, shape, data_, type);
+    return copy.data().ToString(type, shape, use_comma);
+  }
+
+ private:
+  MappedFilePtr file_;
+  unsigned char *data_;
+  size_t size_;
+  size_t item_size_;
+  size_t ndim_;
+};
 }  // namespace
 
+class MappedFile {
+ public:
+  static MappedFilePtr Open(const std::string &file) {
+#ifndef _WIN32
+    int fd = open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return nullptr;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+      (void)close(fd);
+      return nullptr;
+    }
+    auto size = static_cast<size_t>(file_stat.st_size);
+    // Private mapping, so that parameters can be updated in place without touching the file.
+    auto addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED) {
+      return nullptr;
+    }
+    return std::shared_ptr<MappedFile>(new MappedFile(static_cast<unsigned char *>(addr), size));
+#else
+    return nullptr;
+#endif
+  }
+
+  ~MappedFile() {
+#ifndef _WIN32
+    (void)munmap(data_, size_);
+#endif
+  }
+
+  unsigned char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MappedFile(unsigned char *data, size_t size) : data_(data), size_(size) {}
+
+  unsigned char *data_;
+  size_t size_;
+};
+
 tensor::TensorPtr MSANFModelParser::GenerateTensorPtrFromTensorProto(const mind_ir::TensorProto &attr_tensor) {
+  tensor::TensorPtr tensor = nullptr;
+  auto iter = prepared_tensors_.find(&attr_tensor);
+  if (iter != prepared_tensors_.end()) {
+    tensor = iter->second;
+    (void)prepared_tensors_.erase(iter);
+  } else {
+    tensor = BuildTensorFromTensorProto(attr_tensor);
+  }
+  if (tensor == nullptr) {
+    return nullptr;
+  }
+  if (!IsIncLoad() || load_tensor_map_.find(attr_tensor.name()) == load_tensor_map_.end()) {
+    load_tensor_map_[attr_tensor.name()] = tensor;
+  }
+  return tensor;
+}
+
+// Builds the tensor and its data, may run concurrently for different tensor protos.
+tensor::TensorPtr MSANFModelParser::BuildTensorFromTensorProto(const mind_ir::TensorProto &attr_tensor) {
   ShapeVector shape;
-  const int attr_tensor_type = attr_tensor.data_type();
   for (int i = 0; i < attr_tensor.dims_size(); ++i) {
     shape.push_back(attr_tensor.dims(i));
   }
+  auto data_type = GetTensorProtoTypeId(attr_tensor);
   tensor::TensorPtr tensor = nullptr;
-  if (!attr_tensor.has_compression_type() ||
-      attr_tensor.compression_type() == mind_ir::TensorProto_CompressionType_NO_COMPRESSION) {
-    tensor = std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape);
+  bool mapped = false;
+  bool compressed = attr_tensor.has_compression_type() &&
+                    attr_tensor.compression_type() != mind_ir::TensorProto_CompressionType_NO_COMPRESSION;
+  if (!compressed) {
+    if (!attr_tensor.has_raw_data() && attr_tensor.has_external_data()) {
+      tensor = BuildMappedTensor(attr_tensor, data_type, shape);
+      mapped = tensor != nullptr;
+    }
+    if (tensor == nullptr) {
+      tensor = std::make_shared<tensor::Tensor>(data_type, shape);
+    }
   } else {
     auto compression_type = static_cast<TensorCompressionType>(static_cast<int>(attr_tensor.compression_type()));
-    size_t data_size = 0;
-    if (!attr_tensor.has_external_data()) {
-      data_size = attr_tensor.raw_data().size();
-    } else {
-      data_size = attr_tensor.external_data().length();
-    }
-    tensor =
-      std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape, data_size, compression_type);
+    tensor = std::make_shared<tensor::Tensor>(data_type, shape, GetTensorProtoDataSize(attr_tensor), compression_type);
   }
 
   auto quantization_param_vector = GenerateQuantizationParam(attr_tensor);
   if (!quantization_param_vector.empty()) {
     tensor->set_quant_param(quantization_param_vector);
   }
-  if (!IsIncLoad() || load_tensor_map_.find(attr_tensor.name()) == load_tensor_map_.end()) {
-    load_tensor_map_[attr_tensor.name()] = tensor;
-  }
 
   MS_EXCEPTION_IF_NULL(tensor);
+  if (mapped) {
+    return tensor;
+  }
   const std::string &tensor_buf = attr_tensor.raw_data();
   if (attr_tensor.has_raw_data() && tensor->data().nbytes() != 0) {
     auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor->data_c());
@@ -681,45 +803,16 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
   if (!tensor_proto.has_external_data()) {
     return false;
   }
-  const unsigned char *data = nullptr;
-  auto it = tenor_data_.find(tensor_proto.external_data().location());
-  if (it != tenor_data_.end()) {
-    data = it->second.get();
-  } else {
-    std::string file = mindir_path_ + "/" + tensor_proto.external_data().location();
-    if (mindir_dec_key_ != nullptr) {
-      size_t plain_len;
-      auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
-      if (plain_data == nullptr) {
-        MS_LOG(ERROR) << "Decrypt MindIR file failed, please check the correctness of the dec_key or dec_mode.";
-        return false;
-      }
-      data = plain_data.get();
-      (void)tenor_data_.emplace(tensor_proto.external_data().location(), std::move(plain_data));
-    } else {
-      // Read file
-      std::basic_ifstream<char> fid(file, std::ios::in | std::ios::binary);
-      if (!fid) {
-        MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
-      }
-      (void)fid.seekg(0, std::ios_base::end);
-      size_t file_size = static_cast<size_t>(fid.tellg());
-      fid.clear();
-      (void)fid.seekg(0);
-      auto plain_data = std::make_unique<char[]>(file_size);
-      constexpr Byte is_little_endian = 1;
-      constexpr int byte_order_index = 0;
-      (void)fid.read(plain_data.get(), SizeToLong(file_size));
-      fid.close();
-      // if byte order is not same return false
-      if ((plain_data[byte_order_index] == is_little_endian) ^ little_endian()) {
-        MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
-        return false;
-      }
-      data = reinterpret_cast<const unsigned char *>(plain_data.get());
-      (void)tenor_data_.emplace(tensor_proto.external_data().location(),
-                                std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())));
-    }
+  MappedFilePtr mapped_file = nullptr;
+  const unsigned char *data = GetExternalData(tensor_proto.external_data().location(), &mapped_file);
+  if (data == nullptr) {
+    return false;
+  }
+  auto data_end = LongToSize(tensor_proto.external_data().offset()) + LongToSize(tensor_proto.external_data().length());
+  if (mapped_file != nullptr && data_end > mapped_file->size()) {
+    MS_LOG(ERROR) << "The external data of " << tensor_proto.name() << " is out of the range of file "
+                  << tensor_proto.external_data().location();
+    return false;
   }
   auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor_info->data_c());
   MS_EXCEPTION_IF_NULL(tensor_data_buf);
@@ -740,6 +833,156 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
   return true;
 }
 
+// Opens an external data file at the first use. Files are mapped unless they are encrypted or mapping is disabled,
+// mapped_file is set in that case.
+const unsigned char *MSANFModelParser::GetExternalData(const std::string &location, MappedFilePtr *mapped_file) {
+  MS_EXCEPTION_IF_NULL(mapped_file);
+  std::lock_guard<std::mutex> lock(external_data_mutex_);
+  auto mapped_iter = mapped_files_.find(location);
+  if (mapped_iter != mapped_files_.end()) {
+    *mapped_file = mapped_iter->second;
+    return mapped_iter->second->data();
+  }
+  auto it = tenor_data_.find(location);
+  if (it != tenor_data_.end()) {
+    return it->second.get();
+  }
+  constexpr Byte is_little_endian = 1;
+  constexpr int byte_order_index = 0;
+  std::string file = mindir_path_ + "/" + location;
+  if (mindir_dec_key_ != nullptr) {
+    size_t plain_len;
+    auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
+    if (plain_data == nullptr) {
+      MS_LOG(ERROR) << "Decrypt MindIR file failed, please check the correctness of the dec_key or dec_mode.";
+      return nullptr;
+    }
+    auto data = plain_data.get();
+    (void)tenor_data_.emplace(location, std::move(plain_data));
+    return data;
+  }
+  if (common::GetEnv(kMindIRMmapEnv) != "0") {
+    auto mapped = MappedFile::Open(file);
+    if (mapped != nullptr) {
+      // if byte order is not same return false
+      if ((mapped->data()[byte_order_index] == is_little_endian) ^ little_endian()) {
+        MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
+        return nullptr;
+      }
+      (void)mapped_files_.emplace(location, mapped);
+      *mapped_file = mapped;
+      return mapped->data();
+    }
+    MS_LOG(INFO) << "Map file '" << file << "' failed, read it into memory instead.";
+  }
+  // Read file
+  std::basic_ifstream<char> fid(file, std::ios::in | std::ios::binary);
+  if (!fid) {
+    MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
+  }
+  (void)fid.seekg(0, std::ios_base::end);
+  size_t file_size = static_cast<size_t>(fid.tellg());
+  fid.clear();
+  (void)fid.seekg(0);
+  auto plain_data = std::make_unique<char[]>(file_size);
+  (void)fid.read(plain_data.get(), SizeToLong(file_size));
+  fid.close();
+  // if byte order is not same return false
+  if ((plain_data[byte_order_index] == is_little_endian) ^ little_endian()) {
+    MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
+    return nullptr;
+  }
+  auto data = reinterpret_cast<const unsigned char *>(plain_data.get());
+  (void)tenor_data_.emplace(location, std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())));
+  return data;
+}
+
+// Creates a parameter whose data stays in the mapped external data file. Returns nullptr if the data has to be
+// copied, for encrypted files or data that is not aligned to its element size.
+tensor::TensorPtr MSANFModelParser::BuildMappedTensor(const mind_ir::TensorProto &tensor_proto, TypeId data_type,
+                                                      const ShapeVector &shape) {
+  if (mindir_dec_key_ != nullptr || data_type == kTypeUnknown || data_type == kObjectTypeString) {
+    return nullptr;
+  }
+  MappedFilePtr mapped_file = nullptr;
+  auto data = GetExternalData(tensor_proto.external_data().location(), &mapped_file);
+  if (data == nullptr || mapped_file == nullptr) {
+    return nullptr;
+  }
+  auto item_size = abstract::TypeIdSize(data_type);
+  auto offset = LongToSize(tensor_proto.external_data().offset());
+  auto length = LongToSize(tensor_proto.external_data().length());
+  size_t size = SizeOf(shape);
+  if (item_size == 0 || offset % item_size != 0 || length != size * item_size || offset + length > mapped_file->size()) {
+    return nullptr;
+  }
+  auto tensor_data =
+    std::make_shared<MappedTensorData>(mapped_file, mapped_file->data() + offset, size, item_size, shape.size());
+  return std::make_shared<tensor::Tensor>(data_type, shape, tensor_data);
+}
+
+// Builds the parameter tensors of all graphs on several threads, they are the bulk of the load time of a large model.
+// Graph nodes are still built in order, as they refer to each other.
+void MSANFModelParser::PrepareParameterTensors(const mind_ir::ModelProto &model_proto) {
+  std::vector<const mind_ir::TensorProto *> parameters;
+  std::set<std::string> names;
+  size_t total_size = 0;
+  auto collect = [this, &parameters, &names, &total_size](const mind_ir::GraphProto &graph_proto) {
+    for (int i = 0; i < graph_proto.parameter_size(); ++i) {
+      const auto &parameter_proto = graph_proto.parameter(i);
+      if (IsIncLoad() &&
+          (load_tensor_map_.count(parameter_proto.name()) > 0 || !names.insert(parameter_proto.name()).second)) {
+        continue;
+      }
+      parameters.push_back(&parameter_proto);
+      total_size += GetTensorProtoDataSize(parameter_proto);
+    }
+  };
+  collect(model_proto.graph());
+  for (int i = 0; i < model_proto.functions_size(); ++i) {
+    collect(model_proto.functions(i));
+  }
+  if (parameters.size() < 2 || total_size < kParallelLoadThreshold) {
+    return;
+  }
+
+  std::vector<tensor::TensorPtr> tensors(parameters.size());
+  std::atomic<size_t> next_index{0};
+  std::atomic<bool> failed{false};
+  auto worker = [this, &parameters, &tensors, &next_index, &failed]() {
+    try {
+      for (auto i = next_index++; i < parameters.size() && !failed; i = next_index++) {
+        tensors[i] = BuildTensorFromTensorProto(*parameters[i]);
+        if (tensors[i] == nullptr) {
+          failed = true;
+        }
+      }
+    } catch (const std::exception &e) {
+      MS_LOG(INFO) << "Build parameter tensor failed: " << e.what();
+      failed = true;
+    }
+  };
+  size_t core_num = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1));
+  size_t thread_num = std::min({core_num, kMaxParallelLoadThreadNum, parameters.size()});
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; ++i) {
+    (void)threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (failed) {
+    // the parameters are built again in order to report the error where it occurs
+    return;
+  }
+  for (size_t i = 0; i < parameters.size(); ++i) {
+    prepared_tensors_[parameters[i]] = tensors[i];
+  }
+  MS_LOG(INFO) << "Built " << parameters.size() << " parameters of " << total_size << " bytes with " << thread_num
+               << " threads.";
+}
+
 bool MSANFModelParser::BuildInputForFuncGraph(const ParameterPtr &node, const mind_ir::ValueInfoProto &value_proto) {
   MS_EXCEPTION_IF_NULL(node);
 
@@ -1901,6 +2144,10 @@ FuncGraphPtr MSANFModelParser::Parse(const mind_ir::ModelProto &model_proto,
   }
   const mind_ir::GraphProto &graphBuild = model_proto.graph();
 
+  auto start_time = GetTime();
+  PrepareParameterTensors(model_proto);
+  auto prepare_time = GetTime();
+
   // Forward declare FuncGraph name
   // Compatible with the previous proto.
   if (graphBuild.has_name()) {
@@ -1949,11 +2196,17 @@ FuncGraphPtr MSANFModelParser::Parse(const mind_ir::ModelProto &model_proto,
 
   // Release resource
   anfnode_build_map_.clear();
+  prepared_tensors_.clear();
+  auto build_time = GetTime();
 
   // Correct the null abstract for compatibility with previous versions.
   if (!abstract_valid_ && weights.empty()) {
     CorrectFuncGraph(dstGraph);
   }
+  constexpr double kSecondToMillisecond = 1000.0;
+  MS_LOG(INFO) << "Parse MindIR cost: prepare parameters " << (prepare_time - start_time) * kSecondToMillisecond
+               << " ms, build graphs " << (build_time - prepare_time) * kSecondToMillisecond
+               << " ms, correct abstracts " << (GetTime() - build_time) * kSecondToMillisecond << " ms.";
   return dstGraph;
 }
 
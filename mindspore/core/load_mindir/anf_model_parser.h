@@ -20,6 +20,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "utils/hash_map.h"
 #include "google/protobuf/io/zero_copy_stream_impl.h"
@@ -62,6 +63,10 @@ class Layout {
 using LayoutPtr = std::shared_ptr<Layout>;
 using LayoutMap = std::map<string, LayoutPtr>;
 
+// Copy-on-write memory mapping of an external data file, shared by the parameters created from it.
+class MappedFile;
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
 class MSANFModelParser {
  public:
   MSANFModelParser() = default;
@@ -101,6 +106,10 @@ class MSANFModelParser {
   abstract::AbstractCSRTensorPtr BuildAbstractCSRTensorFromAttrProto(const mind_ir::AttributeProto &attr_proto);
   bool SetValueForTopGraphParameter(const FuncGraphPtr &topGraph, const std::map<std::string, ValuePtr> &weights);
   bool GetTensorDataFromExternal(const mind_ir::TensorProto &tensor_proto, const tensor::TensorPtr &tensor_info);
+  const unsigned char *GetExternalData(const std::string &location, MappedFilePtr *mapped_file);
+  tensor::TensorPtr BuildMappedTensor(const mind_ir::TensorProto &tensor_proto, TypeId data_type,
+                                      const ShapeVector &shape);
+  void PrepareParameterTensors(const mind_ir::ModelProto &model_proto);
   bool BuildInputForFuncGraph(const ParameterPtr &node, const mind_ir::ValueInfoProto &value_proto);
   abstract::AbstractTensorPtr GetAbsTensorFromTensorProto(const mind_ir::TensorProto &tensor_proto);
   CNodePtr BuildCNodeForFuncGraph(const FuncGraphPtr &outputFuncGraph, const mind_ir::NodeProto &node_proto);
@@ -138,6 +147,7 @@ class MSANFModelParser {
     const mind_ir::AttributeProto &attr_proto);
   AnfNodePtr GetAnfNode(const std::string &node_name);
   tensor::TensorPtr GenerateTensorPtrFromTensorProto(const mind_ir::TensorProto &attr_tensor);
+  tensor::TensorPtr BuildTensorFromTensorProto(const mind_ir::TensorProto &attr_tensor);
 
   FuncGraphPtr top_graph_ = nullptr;
   std::string producer_name_;
@@ -153,6 +163,10 @@ class MSANFModelParser {
   std::string mindir_dec_mode_;
   bool little_endian_ = common::IsLittleByteOrder();
   std::map<std::string, std::unique_ptr<Byte[]>> tenor_data_;
+  std::map<std::string, MappedFilePtr> mapped_files_;
+  std::mutex external_data_mutex_;
+  // Parameter tensors built ahead by PrepareParameterTensors.
+  mindspore::HashMap<const mind_ir::TensorProto *, tensor::TensorPtr> prepared_tensors_;
   static std::map<std::string, tensor::TensorPtr> load_tensor_map_;
 };
 }  // namespace mindspore
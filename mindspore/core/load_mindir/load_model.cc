@@ -20,18 +20,27 @@
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <nlohmann/json.hpp>
 
 #include "load_mindir/load_model.h"
 #include "utils/crypto.h"
 #include "utils/os.h"
+#include "utils/profile.h"
 
 using std::string;
 using std::vector;
 
 namespace mindspore {
+namespace {
+constexpr size_t kMaxParseThreadNum = 8;
+}  // namespace
+
 bool get_all_files(const std::string &dir_in, std::vector<std::string> *files) {
   if (dir_in.empty()) {
     return false;
@@ -238,6 +247,7 @@ FuncGraphPtr MindIRLoader::LoadMindIR(const std::string &file_name) {
   }
 #endif
   // Read graph
+  auto start_time = GetTime();
   mind_ir::ModelProto origin_model;
   if (!ParseModelProto(&origin_model, std::string(abs_path_buff))) {
     return nullptr;
@@ -260,26 +270,63 @@ FuncGraphPtr MindIRLoader::LoadMindIR(const std::string &file_name) {
       return nullptr;
     }
 
+    // The variable files are independent, parse them on several threads.
     size_t file_size = files.size();
-    mind_ir::GraphProto *mod_graph = origin_model.mutable_graph();
-    for (size_t file_index = 0; file_index < file_size; file_index++) {
-      mind_ir::GraphProto param_graph;
-      if (!ParseGraphProto(&param_graph, files[file_index])) {
-        return nullptr;
+    std::vector<mind_ir::GraphProto> param_graphs(file_size);
+    std::vector<std::thread> threads;
+    std::atomic<size_t> next_file{0};
+    std::atomic<bool> parse_failed{false};
+    // An exception must not escape a thread, the first one is rethrown after all the threads are joined.
+    std::exception_ptr parse_exception = nullptr;
+    std::mutex exception_mutex;
+    auto parse_files = [this, &files, &param_graphs, &next_file, &parse_failed, &parse_exception, &exception_mutex]() {
+      try {
+        for (auto i = next_file++; i < files.size() && !parse_failed; i = next_file++) {
+          if (!ParseGraphProto(&param_graphs[i], files[i])) {
+            parse_failed = true;
+          }
+        }
+      } catch (...) {
+        parse_failed = true;
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (parse_exception == nullptr) {
+          parse_exception = std::current_exception();
+        }
       }
+    };
+    size_t core_num = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1));
+    size_t thread_num = std::min({core_num, kMaxParseThreadNum, file_size});
+    for (size_t i = 1; i < thread_num; ++i) {
+      (void)threads.emplace_back(parse_files);
+    }
+    parse_files();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    if (parse_exception != nullptr) {
+      std::rethrow_exception(parse_exception);
+    }
+    if (parse_failed) {
+      return nullptr;
+    }
 
+    mind_ir::GraphProto *mod_graph = origin_model.mutable_graph();
+    for (auto &param_graph : param_graphs) {
       for (int param_index = 0; param_index < param_graph.parameter_size(); param_index++) {
+        auto param = param_graph.mutable_parameter(param_index);
         mind_ir::TensorProto *param_proto = mod_graph->add_parameter();
-        param_proto->set_name(param_graph.parameter(param_index).name());
-        param_proto->set_data_type(param_graph.parameter(param_index).data_type());
-        param_proto->set_raw_data(param_graph.parameter(param_index).raw_data());
-        param_proto->set_compression_type(param_graph.parameter(param_index).compression_type());
-        for (const auto &dim : param_graph.parameter(param_index).dims()) {
+        param_proto->set_name(param->name());
+        param_proto->set_data_type(param->data_type());
+        // move the data instead of copying it, it is the bulk of the file
+        param_proto->mutable_raw_data()->swap(*param->mutable_raw_data());
+        param_proto->set_compression_type(param->compression_type());
+        for (const auto &dim : param->dims()) {
           param_proto->add_dims(dim);
         }
       }
     }
   }
+  auto read_time = GetTime();
 
   MSANFModelParser model_parser;
 
@@ -290,6 +337,9 @@ FuncGraphPtr MindIRLoader::LoadMindIR(const std::string &file_name) {
   if (has_parallel_info_) {
     layout_map_ = model_parser.ParseLayout(origin_model);
   }
+  constexpr double kSecondToMillisecond = 1000.0;
+  MS_LOG(INFO) << "Load MindIR " << file_name << " cost: read proto " << (read_time - start_time) * kSecondToMillisecond
+               << " ms, parse graph " << (GetTime() - read_time) * kSecondToMillisecond << " ms.";
   return dstgraph_ptr;
 }
 
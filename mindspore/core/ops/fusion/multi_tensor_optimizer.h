@@ -0,0 +1,35 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_OPS_MULTI_TENSOR_OPTIMIZER_H_
+#define MINDSPORE_CORE_OPS_MULTI_TENSOR_OPTIMIZER_H_
+#include "ops/base_operator.h"
+#include "mindapi/base/types.h"
+
+namespace mindspore {
+namespace ops {
+constexpr auto kNameMultiTensorOptimizer = "MultiTensorOptimizer";
+/// \brief MultiTensorOptimizer updates the parameters of several optimizer nodes of the same type in one kernel.
+class MIND_API MultiTensorOptimizer : public BaseOperator {
+ public:
+  MIND_API_BASE_MEMBER(MultiTensorOptimizer);
+  /// \brief Constructor.
+  MultiTensorOptimizer() : BaseOperator(kNameMultiTensorOptimizer) {}
+};
+}  // namespace ops
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_OPS_MULTI_TENSOR_OPTIMIZER_H_
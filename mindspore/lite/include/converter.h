@@ -42,6 +42,12 @@ class MS_API Converter {
   void SetWeightFp16(bool weight_fp16);
   bool GetWeightFp16() const;
 
+  void SetWeightBf16(bool weight_bf16);
+  bool GetWeightBf16() const;
+
+  inline void SetWeightSparsity(const std::string &sparsity);
+  inline std::string GetWeightSparsity() const;
+
   inline void SetInputShape(const std::map<std::string, std::vector<int64_t>> &input_shape);
   inline std::map<std::string, std::vector<int64_t>> GetInputShape() const;
 
@@ -101,6 +107,8 @@ class MS_API Converter {
   std::vector<char> GetEncryptKeyChar() const;
   void SetDevice(const std::vector<char> &device);
   std::vector<char> GetDeviceChar();
+  void SetWeightSparsity(const std::vector<char> &sparsity);
+  std::vector<char> GetWeightSparsityChar() const;
   std::shared_ptr<ConverterPara> data_;
 };
 
@@ -143,5 +151,9 @@ std::string Converter::GetEncryptKey() const { return CharToString(GetEncryptKey
 void Converter::SetDevice(const std::string &device) { SetDevice(StringToChar(device)); }
 
 std::string Converter::GetDevice() { return CharToString(GetDeviceChar()); }
+
+void Converter::SetWeightSparsity(const std::string &sparsity) { SetWeightSparsity(StringToChar(sparsity)); }
+
+std::string Converter::GetWeightSparsity() const { return CharToString(GetWeightSparsityChar()); }
 }  // namespace mindspore
 #endif  // MINDSPORE_LITE_INCLUDE_CONVERTER_H_
@@ -39,6 +39,10 @@ void ConverterPyBind(const py::module &m) {
     .def("get_config_info", &Converter::GetConfigInfo)
     .def("set_weight_fp16", &Converter::SetWeightFp16)
     .def("get_weight_fp16", &Converter::GetWeightFp16)
+    .def("set_weight_bf16", &Converter::SetWeightBf16)
+    .def("get_weight_bf16", &Converter::GetWeightBf16)
+    .def("set_weight_sparsity", py::overload_cast<const std::string &>(&Converter::SetWeightSparsity))
+    .def("get_weight_sparsity", &Converter::GetWeightSparsity)
     .def("set_input_shape",
          py::overload_cast<const std::map<std::string, std::vector<int64_t>> &>(&Converter::SetInputShape))
     .def("get_input_shape", &Converter::GetInputShape)
@@ -58,6 +58,9 @@ static const char *const kMSCacheModelPath = "cache_model_path";
 static const char *const kMSCacheVocabSize = "vocab_size";
 static const char *const kMSCacheDeviceSize = "device_cache_size";
 static const char *const kMSCacheSerializePath = "serialize_path";
+// kv cache
+static const char *const kKVCache = "kv_cache";
+static const char *const kKVCacheMaxSeqLen = "max_seq_len";
 // weight path
 static const char *const kWeight = "weight";
 static const char *const kWeightPath = "weight_path";
@@ -343,6 +343,14 @@ Status Model::UpdateWeights(const std::vector<MSTensor> &new_weights) {
   return impl_->UpdateWeights(new_weights);
 }
 
+Status Model::ResetState() {
+  if (impl_ == nullptr) {
+    MS_LOG(ERROR) << "Model implement is null.";
+    return kLiteNullptr;
+  }
+  return impl_->ResetState();
+}
+
 Status Model::RunStep(const MSKernelCallBack &before, const MSKernelCallBack &after) {
   if (impl_ == nullptr) {
     MS_LOG(ERROR) << "Model implement is null.";
@@ -843,6 +843,15 @@ Status ModelImpl::UpdateWeights(const std::vector<MSTensor> &new_weights) {
   return static_cast<StatusCode>(ret);
 }
 
+Status ModelImpl::ResetState() {
+  if (session_ == nullptr) {
+    MS_LOG(ERROR) << "Session is null.";
+    return kLiteNullptr;
+  }
+  auto ret = session_->ResetState();
+  return static_cast<StatusCode>(ret);
+}
+
 Status ModelImpl::SetupVirtualBatch(int virtual_batch_multiplier, float lr, float momentum) {
   if (session_ == nullptr) {
     MS_LOG(ERROR) << "Session is null.";
@@ -0,0 +1,365 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel/cpu/fp32/attention_fp32.h"
+#include "schema/model_generated.h"
+#include "src/litert/kernel_registry.h"
+#include "src/common/common.h"
+#include "src/common/utils.h"
+#include "include/errorcode.h"
+#include "nnacl/fp32/matmul_fp32.h"
+
+using mindspore::kernel::KERNEL_ARCH;
+using mindspore::lite::KernelRegistrar;
+using mindspore::lite::RET_ERROR;
+using mindspore::lite::RET_MEMORY_FAILED;
+using mindspore::lite::RET_NOT_SUPPORT;
+using mindspore::lite::RET_OK;
+using mindspore::schema::PrimitiveType_Attention;
+
+namespace mindspore::kernel {
+namespace {
+constexpr int kAttentionInputSize = 7;
+constexpr int kWeightQKVIndex = 3;
+constexpr int kWeightOIndex = 4;
+constexpr int kBiasQKVIndex = 5;
+constexpr int kBiasOIndex = 6;
+constexpr int kMaskIndex = 7;
+constexpr int kOutputKIndex = 1;
+constexpr int kOutputVIndex = 2;
+constexpr int kQKVNum = 3;
+
+int PackWeightTensor(const lite::Tensor *tensor, Matrix *matrix, int col_tile) {
+  matrix->data_ = reinterpret_cast<float *>(tensor->data());
+  matrix->batch_ = 1;
+  matrix->is_transpose_ = false;
+  matrix->row_ = tensor->shape().at(0);
+  matrix->col_ = tensor->shape().at(1);
+  return PackRightMatrix(matrix, col_tile);
+}
+
+int PackBiasTensor(const lite::Tensor *tensor, Matrix *matrix, int bias_tile) {
+  matrix->data_ = reinterpret_cast<float *>(tensor->data());
+  matrix->batch_ = 1;
+  matrix->is_transpose_ = false;
+  matrix->row_ = 1;
+  matrix->col_ = tensor->shape().at(0);
+  return PackAttentionBias(matrix, bias_tile);
+}
+
+void FreePackedData(Matrix *matrix) {
+  if (matrix->packed_data_ != nullptr) {
+    free(matrix->packed_data_);
+    matrix->packed_data_ = nullptr;
+  }
+}
+}  // namespace
+
+AttentionCPUKernel::~AttentionCPUKernel() {
+  FreeRunBuffers();
+  FreePackedWeights();
+  FreeCache();
+}
+
+int AttentionCPUKernel::CheckWeights() {
+  auto weight_qkv = in_tensors_.at(kWeightQKVIndex);
+  auto weight_o = in_tensors_.at(kWeightOIndex);
+  auto bias_qkv = in_tensors_.at(kBiasQKVIndex);
+  auto bias_o = in_tensors_.at(kBiasOIndex);
+  for (auto tensor : {weight_qkv, weight_o, bias_qkv, bias_o}) {
+    if (!tensor->IsConst() || tensor->data_type() != kNumberTypeFloat32 || tensor->data() == nullptr) {
+      MS_LOG(ERROR) << "Attention only supports const fp32 weights and biases, tensor: " << tensor->tensor_name();
+      return RET_ERROR;
+    }
+  }
+  hidden_ = param_->head_num_ * param_->head_size_;
+  if (hidden_ <= 0 || weight_qkv->shape() != std::vector<int>{hidden_, kQKVNum * hidden_} ||
+      weight_o->shape() != std::vector<int>{hidden_, hidden_} || bias_qkv->ElementsNum() != kQKVNum * hidden_ ||
+      bias_o->ElementsNum() != hidden_) {
+    MS_LOG(ERROR) << "Attention weights do not match head_num " << param_->head_num_ << " and head_size "
+                  << param_->head_size_;
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+int AttentionCPUKernel::PrepareWeights() {
+#ifdef ENABLE_AVX
+  row_tile_ = C6NUM;
+  col_tile_ = C16NUM;
+#elif defined(ENABLE_ARM32)
+  row_tile_ = C12NUM;
+  col_tile_ = C4NUM;
+#elif defined(ENABLE_SSE)
+  row_tile_ = C4NUM;
+  col_tile_ = C8NUM;
+#else
+  row_tile_ = C12NUM;
+  col_tile_ = C8NUM;
+#endif
+  FreePackedWeights();
+  if (PackWeightTensor(in_tensors_.at(kWeightQKVIndex), &weight_qkv_mat_, col_tile_) != NNACL_OK ||
+      PackWeightTensor(in_tensors_.at(kWeightOIndex), &weight_o_mat_, col_tile_) != NNACL_OK ||
+      PackBiasTensor(in_tensors_.at(kBiasQKVIndex), &bias_qkv_mat_, col_tile_) != NNACL_OK ||
+      PackBiasTensor(in_tensors_.at(kBiasOIndex), &bias_o_mat_, col_tile_) != NNACL_OK) {
+    MS_LOG(ERROR) << "Pack attention weights failed.";
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+void AttentionCPUKernel::FreePackedWeights() {
+  FreePackedData(&weight_qkv_mat_);
+  FreePackedData(&weight_o_mat_);
+  FreePackedData(&bias_qkv_mat_);
+  FreePackedData(&bias_o_mat_);
+}
+
+int AttentionCPUKernel::Prepare() {
+  CHECK_LESS_RETURN(in_tensors_.size(), kAttentionInputSize);
+  CHECK_LESS_RETURN(out_tensors_.size(), 1);
+  if (param_->cross_) {
+    MS_LOG(ERROR) << "Attention cpu kernel does not support cross attention.";
+    return RET_NOT_SUPPORT;
+  }
+  auto ret = CheckWeights();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "CheckWeights failed.";
+    return ret;
+  }
+  ret = PrepareWeights();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "PrepareWeights failed.";
+    return ret;
+  }
+  auto config = GetConfig(lite::kKVCache);
+  auto iter = config.find(lite::kKVCacheMaxSeqLen);
+  if (iter != config.end()) {
+    if (!lite::ConvertStrToInt(iter->second, &max_seq_len_) || max_seq_len_ <= 0) {
+      MS_LOG(ERROR) << "Invalid " << lite::kKVCacheMaxSeqLen << ": " << iter->second;
+      return RET_ERROR;
+    }
+  }
+  if (!InferShapeDone()) {
+    return RET_OK;
+  }
+  return ReSize();
+}
+
+int AttentionCPUKernel::ReSize() {
+  auto input = in_tensors_.front();
+  auto &shape = input->shape();
+  if (input->data_type() != kNumberTypeFloat32 || (shape.size() != C2NUM && shape.size() != C3NUM) ||
+      shape.back() != hidden_) {
+    MS_LOG(ERROR) << "Attention input should be fp32 [batch, seq, " << hidden_ << "].";
+    return RET_ERROR;
+  }
+  param_->batch_ = shape.size() == C2NUM ? 1 : shape.front();
+  param_->q_seq_ = shape.at(shape.size() - C2NUM);
+  task_num_ = MSMAX(MSMIN(param_->batch_ * param_->head_num_, thread_num_), 1);
+  return RET_OK;
+}
+
+int AttentionCPUKernel::InitCache() {
+  int max_seq = max_seq_len_ > 0 ? max_seq_len_ : param_->q_seq_;
+  if (max_seq_len_ > 0 && k_cache_ != nullptr) {
+    if (param_->batch_ != cache_batch_) {
+      MS_LOG(ERROR) << "Batch changes from " << cache_batch_ << " to " << param_->batch_
+                    << " while the kv cache is in use, call ResetState first.";
+      return RET_ERROR;
+    }
+    return RET_OK;
+  }
+  FreeCache();
+  size_t cache_size = static_cast<size_t>(param_->batch_) * hidden_ * max_seq * sizeof(float);
+  if (max_seq_len_ > 0) {
+    // the cache outlives a run, so it does not come from the runtime allocator
+    k_cache_ = reinterpret_cast<float *>(malloc(cache_size));
+    v_cache_ = reinterpret_cast<float *>(malloc(cache_size));
+  } else {
+    k_cache_ = reinterpret_cast<float *>(ms_context_->allocator->Malloc(cache_size));
+    v_cache_ = reinterpret_cast<float *>(ms_context_->allocator->Malloc(cache_size));
+  }
+  if (k_cache_ == nullptr || v_cache_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc kv cache failed.";
+    return RET_MEMORY_FAILED;
+  }
+  cache_batch_ = param_->batch_;
+  cache_len_ = 0;
+  return RET_OK;
+}
+
+void AttentionCPUKernel::FreeCache() {
+  if (max_seq_len_ > 0) {
+    free(k_cache_);
+    free(v_cache_);
+  } else if (ms_context_ != nullptr && ms_context_->allocator != nullptr) {
+    ms_context_->allocator->Free(k_cache_);
+    ms_context_->allocator->Free(v_cache_);
+  }
+  k_cache_ = nullptr;
+  v_cache_ = nullptr;
+  cache_len_ = 0;
+}
+
+int AttentionCPUKernel::ResetState() {
+  if (max_seq_len_ > 0) {
+    FreeCache();
+  }
+  return RET_OK;
+}
+
+int AttentionCPUKernel::MallocRunBuffers() {
+  int row = param_->batch_ * param_->q_seq_;
+  int kv_seq = param_->cache_len_ + param_->q_seq_;
+  auto allocator = ms_context_->allocator;
+  packed_input_ = reinterpret_cast<float *>(allocator->Malloc(UP_ROUND(row, row_tile_) * hidden_ * sizeof(float)));
+  qkv_ = reinterpret_cast<float *>(allocator->Malloc(row * kQKVNum * hidden_ * sizeof(float)));
+  attention_ = reinterpret_cast<float *>(allocator->Malloc(row * hidden_ * sizeof(float)));
+  logits_ = reinterpret_cast<float *>(allocator->Malloc(task_num_ * kv_seq * sizeof(float)));
+  if (packed_input_ == nullptr || qkv_ == nullptr || attention_ == nullptr || logits_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc attention run buffers failed.";
+    return RET_MEMORY_FAILED;
+  }
+  return RET_OK;
+}
+
+void AttentionCPUKernel::FreeRunBuffers() {
+  if (ms_context_ == nullptr || ms_context_->allocator == nullptr) {
+    return;
+  }
+  for (auto buffer : {&packed_input_, &qkv_, &attention_, &logits_}) {
+    ms_context_->allocator->Free(*buffer);
+    *buffer = nullptr;
+  }
+  if (max_seq_len_ <= 0) {
+    FreeCache();
+  }
+}
+
+void AttentionCPUKernel::Projection(const float *src, const Matrix *weight, const Matrix *bias, float *dst, int row) {
+  int deep = weight->row_;
+  int col = weight->col_;
+  PackAttentionInput(src, packed_input_, row, deep, row_tile_);
+  MatMulOpt(packed_input_, weight->packed_data_, dst, bias->packed_data_, ActType_No, deep, row, col, col,
+            OutType_Nhwc);
+}
+
+int AttentionCPUKernel::DoAttention(int task_id) {
+  int total = param_->batch_ * param_->head_num_;
+  int stride = UP_DIV(total, task_num_);
+  int start = task_id * stride;
+  int end = MSMIN(start + stride, total);
+  if (start >= end) {
+    return RET_OK;
+  }
+  int kv_seq = param_->cache_len_ + param_->q_seq_;
+  KVCacheAttention(param_, qkv_, kQKVNum * hidden_, k_cache_, v_cache_, mask_, attention_, logits_ + task_id * kv_seq,
+                   start, end);
+  return RET_OK;
+}
+
+int AttentionRun(void *cdata, int task_id, float, float) {
+  CHECK_NULL_RETURN(cdata);
+  auto kernel = reinterpret_cast<AttentionCPUKernel *>(cdata);
+  auto ret = kernel->DoAttention(task_id);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "DoAttention error task_id: " << task_id << ", ret: " << ret;
+  }
+  return ret;
+}
+
+void AttentionCPUKernel::CopyKVOutputs() {
+  if (out_tensors_.size() <= static_cast<size_t>(kOutputVIndex)) {
+    return;
+  }
+  auto k_out = reinterpret_cast<float *>(out_tensors_.at(kOutputKIndex)->data());
+  auto v_out = reinterpret_cast<float *>(out_tensors_.at(kOutputVIndex)->data());
+  if (k_out == nullptr || v_out == nullptr) {
+    return;
+  }
+  int head_size = param_->head_size_;
+  int q_seq = param_->q_seq_;
+  for (int task = 0; task < param_->batch_ * param_->head_num_; task++) {
+    const float *k = k_cache_ + (task * param_->max_seq_ + param_->cache_len_) * head_size;
+    const float *v = v_cache_ + (task * param_->max_seq_ + param_->cache_len_) * head_size;
+    float *cur_k_out = k_out + task * head_size * q_seq;
+    memcpy(v_out + task * q_seq * head_size, v, q_seq * head_size * sizeof(float));
+    for (int i = 0; i < q_seq; i++) {
+      for (int d = 0; d < head_size; d++) {
+        cur_k_out[d * q_seq + i] = k[i * head_size + d];
+      }
+    }
+  }
+}
+
+int AttentionCPUKernel::Run() {
+  auto ret = InitCache();
+  if (ret != RET_OK) {
+    return ret;
+  }
+  param_->max_seq_ = max_seq_len_ > 0 ? max_seq_len_ : param_->q_seq_;
+  param_->cache_len_ = max_seq_len_ > 0 ? cache_len_ : 0;
+  if (param_->cache_len_ + param_->q_seq_ > param_->max_seq_) {
+    MS_LOG(ERROR) << "KV cache overflows: " << param_->cache_len_ << " cached and " << param_->q_seq_
+                  << " new tokens exceed max_seq_len " << param_->max_seq_ << ", call ResetState first.";
+    return RET_ERROR;
+  }
+  int kv_seq = param_->cache_len_ + param_->q_seq_;
+  mask_ = nullptr;
+  if (in_tensors_.size() > static_cast<size_t>(kMaskIndex) && in_tensors_.at(kMaskIndex)->data() != nullptr) {
+    auto mask = in_tensors_.at(kMaskIndex);
+    if (mask->data_type() != kNumberTypeFloat32 || mask->ElementsNum() != param_->batch_ * param_->q_seq_ * kv_seq) {
+      MS_LOG(ERROR) << "Attention mask should be fp32 [batch, q_seq, kv_seq] = [" << param_->batch_ << ", "
+                    << param_->q_seq_ << ", " << kv_seq << "], but got data type " << mask->data_type()
+                    << " and elements num " << mask->ElementsNum();
+      return RET_ERROR;
+    }
+    mask_ = reinterpret_cast<float *>(mask->data());
+  }
+  // the cache is attended in causal order only when no mask is given
+  param_->is_causal_ = max_seq_len_ > 0 && mask_ == nullptr;
+  auto input = reinterpret_cast<float *>(in_tensors_.front()->data());
+  auto output = reinterpret_cast<float *>(out_tensors_.front()->data());
+  CHECK_NULL_RETURN(input);
+  CHECK_NULL_RETURN(output);
+
+  ret = MallocRunBuffers();
+  if (ret != RET_OK) {
+    FreeRunBuffers();
+    return ret;
+  }
+  int row = param_->batch_ * param_->q_seq_;
+  Projection(input, &weight_qkv_mat_, &bias_qkv_mat_, qkv_, row);
+  KVCacheAppend(param_, qkv_ + hidden_, kQKVNum * hidden_, k_cache_);
+  KVCacheAppend(param_, qkv_ + C2NUM * hidden_, kQKVNum * hidden_, v_cache_);
+  ret = ParallelLaunch(this->ms_context_, AttentionRun, this, task_num_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Attention ParallelLaunch failed, ret: " << ret;
+    FreeRunBuffers();
+    return ret;
+  }
+  Projection(attention_, &weight_o_mat_, &bias_o_mat_, output, row);
+  CopyKVOutputs();
+  if (max_seq_len_ > 0) {
+    cache_len_ += param_->q_seq_;
+  }
+  FreeRunBuffers();
+  return RET_OK;
+}
+
+REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_Attention, LiteKernelCreator<AttentionCPUKernel>)
+}  // namespace mindspore::kernel
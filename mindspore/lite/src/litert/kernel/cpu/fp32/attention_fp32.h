@@ -0,0 +1,84 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_ATTENTION_FP32_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_ATTENTION_FP32_H_
+
+#include <vector>
+#include "src/litert/lite_kernel.h"
+#include "nnacl/fp32/attention_fp32.h"
+
+namespace mindspore::kernel {
+// inputs: 0:Q 1:K 2:V 3:WQKV 4:WO 5:BQKV 6:BO 7:MASK(optional), outputs: 0:out 1:K^T(optional) 2:V(optional)
+// only self attention is supported, the projections of Q, K and V are all computed from input Q.
+// When the session config has section "kv_cache" with "max_seq_len", K and V of every run are appended to a cache kept
+// by the kernel and the tokens of a run attend to the whole cache, so that a decoding step only feeds the new token.
+// Without a mask the attention is causal in that mode, a given mask must cover the whole cache as [batch, q_seq,
+// cache_len + q_seq]. The cache is dropped by ResetState.
+class AttentionCPUKernel : public LiteKernel {
+ public:
+  AttentionCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                     const std::vector<lite::Tensor *> &outputs, const lite::InnerContext *ctx)
+      : LiteKernel(parameter, inputs, outputs, ctx) {
+    param_ = reinterpret_cast<AttentionParameter *>(op_parameter_);
+  }
+  ~AttentionCPUKernel() override;
+
+  int Prepare() override;
+  int ReSize() override;
+  int Run() override;
+  int ResetState() override;
+  int DoAttention(int task_id);
+
+ private:
+  int CheckWeights();
+  int PrepareWeights();
+  int InitCache();
+  int MallocRunBuffers();
+  void FreeRunBuffers();
+  void FreePackedWeights();
+  void FreeCache();
+  void Projection(const float *src, const Matrix *weight, const Matrix *bias, float *dst, int row);
+  void CopyKVOutputs();
+
+  AttentionParameter *param_ = nullptr;
+  int row_tile_ = C12NUM;
+  int col_tile_ = C8NUM;
+  int hidden_ = 0;
+  int task_num_ = 1;
+  const float *mask_ = nullptr;
+
+  Matrix weight_qkv_mat_{};  // [hidden, 3 * hidden]
+  Matrix weight_o_mat_{};    // [hidden, hidden]
+  Matrix bias_qkv_mat_{};    // [3 * hidden]
+  Matrix bias_o_mat_{};      // [hidden]
+
+  // run buffers
+  float *packed_input_ = nullptr;  // packed [batch * q_seq, hidden]
+  float *qkv_ = nullptr;           // [batch * q_seq, 3 * hidden]
+  float *attention_ = nullptr;     // [batch * q_seq, hidden]
+  float *logits_ = nullptr;        // [task_num, kv_seq]
+
+  // [batch, head_num, max_seq, head_size], kept across runs when max_seq_len_ is set
+  float *k_cache_ = nullptr;
+  float *v_cache_ = nullptr;
+  int cache_batch_ = 0;
+  int cache_len_ = 0;
+  int max_seq_len_ = 0;
+};
+}  // namespace mindspore::kernel
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_ATTENTION_FP32_H_
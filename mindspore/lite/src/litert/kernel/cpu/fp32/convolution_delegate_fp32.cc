@@ -212,6 +212,15 @@ bool ConvolutionDelegateCPUKernel::CheckAvxUseSW1x1Conv(const ConvParameter *con
   return false;
 }
 
+// the 1x1 weight pruned by the converter is computed by the matmul kernels, which pick the sparse one by its density.
+bool ConvolutionDelegateCPUKernel::CheckSparseUseSW1x1Conv(const ConvParameter *conv_param) {
+  auto compress_type = in_tensors_.at(kWeightIndex)->get_compress_type();
+  if (compress_type != lite::kNMSparse && compress_type != lite::kBlockSparse) {
+    return false;
+  }
+  return conv_param->group_ == 1 && CheckAvxUseSW1x1Conv(conv_param);
+}
+
 bool ConvolutionDelegateCPUKernel::CheckAvxUseSWConv(const ConvParameter *conv_param) {
   if (conv_param->kernel_h_ == 1 && conv_param->kernel_w_ == 1) {
     MS_CHECK_INT_MUL_NOT_OVERFLOW(conv_param->input_w_, conv_param->input_h_, false);
@@ -270,6 +279,10 @@ kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32NHWCKernelSelect()
                                                 origin_weight_, origin_bias_);
   }
 
+  if (kernel == nullptr && CheckSparseUseSW1x1Conv(conv_param)) {
+    kernel = CreateConv1x1MatmulKernel();
+  }
+
 #ifdef ENABLE_AVX
   if (kernel == nullptr && CheckAvxUseSW1x1Conv(conv_param)) {
     kernel = CreateConv1x1MatmulKernel();
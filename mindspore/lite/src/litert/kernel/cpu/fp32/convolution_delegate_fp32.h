@@ -93,6 +93,7 @@ class ConvolutionDelegateCPUKernel : public LiteKernel {
   kernel::LiteKernel *CpuConvFp32NHWCKernelSelect();
   kernel::LiteKernel *CreateConv1x1MatmulKernel();
   bool CheckAvxUseSW1x1Conv(const ConvParameter *conv_param);
+  bool CheckSparseUseSW1x1Conv(const ConvParameter *conv_param);
   bool CheckAvxUseSWConv(const ConvParameter *conv_param);
   // If inferShape process can't complete in Init part, initialization of weight and bis will be implemented in runtime
   // via Resize() API. However,data of const tensor(weight and bias) doesn't exist anymore in runtime stage.Thus,
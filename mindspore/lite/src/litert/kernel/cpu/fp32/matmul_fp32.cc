@@ -20,8 +20,12 @@
 #include "nnacl/fp32/matmul_fp32.h"
 #include "src/litert/kernel_registry.h"
 #include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_sparse.h"
+#include "nnacl/fp32/matmul_block_sparse_fp32.h"
 #if defined(ENABLE_AVX512)
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_avx512.h"
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_bf16.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
 #endif
 
 #if defined(ENABLE_AVX)
@@ -68,12 +72,60 @@ int MatmulCPUKernel::Run() {
   return matmul_base_->Run();
 }
 
+namespace {
+// the block of the sparse kernel measured from a constant weight, 0 means the weight is too dense for it. The weight is
+// a 2D matrix, or the [oc, 1, 1, ic] weight of the 1x1 convolution.
+int GetSparseWeightBlock(const OpParameter *parameter, const std::vector<lite::Tensor *> &inputs) {
+  if (parameter->is_train_session_ || inputs.size() <= 1 || inputs[1] == nullptr || !inputs[1]->IsConst() ||
+      inputs[1]->data_type() != kNumberTypeFloat32 || inputs[1]->data() == nullptr) {
+    return 0;
+  }
+  auto b_transpose = reinterpret_cast<const MatMulParameter *>(parameter)->b_transpose_;
+  auto shape = inputs[1]->shape();
+  int col = 0;
+  int deep = 0;
+  if (shape.size() == C2NUM) {
+    col = b_transpose ? shape[0] : shape[1];
+    deep = b_transpose ? shape[1] : shape[0];
+  } else if (shape.size() == C4NUM && shape[1] == 1 && shape[C2NUM] == 1 && b_transpose) {
+    col = shape[0];
+    deep = shape[C3NUM];
+  } else {
+    return 0;
+  }
+  return SelectBlockSparseBlock(reinterpret_cast<const float *>(inputs[1]->data()), col, deep, b_transpose);
+}
+}  // namespace
+
+#if defined(ENABLE_AVX512)
+namespace {
+// the weight serialized in bfloat16 keeps the Float32 data type, so it is picked here instead of by the registry.
+bool IsBf16ConstWeight(const OpParameter *parameter, const std::vector<lite::Tensor *> &inputs) {
+  return !parameter->is_train_session_ && inputs.size() > 1 && inputs[1] != nullptr && inputs[1]->IsConst() &&
+         inputs[1]->get_compress_type() == lite::kBF16 && IsSupportBf16Dot();
+}
+}  // namespace
+#endif
+
 MatmulFp32BaseCPUKernel *CreateMatmulFp32CPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
                                                    const std::vector<lite::Tensor *> &outputs,
                                                    const lite::InnerContext *ctx) {
   MatmulFp32BaseCPUKernel *kernel = nullptr;
+  auto sparse_block = GetSparseWeightBlock(parameter, inputs);
+  if (sparse_block > 0) {
+    kernel = new (std::nothrow) MatmulFp32SparseCPUKernel(parameter, inputs, outputs, ctx, sparse_block);
+    if (kernel != nullptr) {
+      return kernel;
+    }
+  }
 #if defined(ENABLE_AVX512)
   AVX512_HARDWARE_SELF_AWARENESS_BEGIN
+  if (IsBf16ConstWeight(parameter, inputs)) {
+    kernel = new (std::nothrow) MatmulFp32Bf16CPUKernel(parameter, inputs, outputs, ctx);
+    if (kernel != nullptr) {
+      return kernel;
+    }
+  }
   kernel = new (std::nothrow) MatmulFp32AVX512CPUKernel(parameter, inputs, outputs, ctx);
   if (kernel != nullptr) {
     return kernel;
@@ -683,7 +683,7 @@ int MatmulFp32BaseCPUKernel::InitParameter() {
   MS_CHECK_INT_MUL_NOT_OVERFLOW(a_batch_, params_->col_align_, RET_ERROR);
   MS_CHECK_INT_MUL_NOT_OVERFLOW(a_batch_ * params_->col_align_, params_->deep_, RET_ERROR);
   auto a_pack_size = a_batch_ * params_->row_align_ * params_->deep_;
-  auto b_pack_size = b_batch_ * params_->col_align_ * params_->deep_;
+  auto b_pack_size = GetMatrixBPackSize();
   if ((matrix_a_.has_packed && matrix_a_.pack_size != a_pack_size) ||
       (matrix_b_.has_packed && matrix_b_.pack_size != b_pack_size)) {
     MS_LOG(ERROR) << "matmul don't support dynamic packing if matrix is a constant.";
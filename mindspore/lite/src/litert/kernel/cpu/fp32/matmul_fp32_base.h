@@ -69,16 +69,11 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
     float *pack_ptr{nullptr};
   };
 
-  virtual int ParallelRunByRow(int task_id) const;
-  virtual int ParallelRunByOC(int task_id) const;
-  virtual int ParallelRunByBatch(int task_id) const;
   int ParallelRunIsNotPackByBatch(int task_id) const;
   int BackupConstMatrix(MatrixInfo *matrix_info, int index);
-  virtual void InitGlobalVariable();
   int PackMatrixA();
   int PackMatrixB();
   int PackMatrixAImpl();
-  int PackMatrixBImpl();
   virtual int PackMatrixAImplOpt();
   bool CheckRow1OptimalConditions();
   virtual bool SupportMulBatchCuttingByRow() { return false; }
@@ -88,13 +83,21 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   int InitParameter();
   int InitTmpOutBuffer();
   int GetThreadCuttingPolicy();
-  virtual bool CheckThreadCuttingByRow();
   void GetThreadCuttingInfoByRow();
   void InitShapeA();
   void InitShapeB();
   int InitBroadcastParams();
 
  protected:
+  virtual int ParallelRunByRow(int task_id) const;
+  virtual int ParallelRunByOC(int task_id) const;
+  virtual int ParallelRunByBatch(int task_id) const;
+  virtual void InitGlobalVariable();
+  virtual int PackMatrixBImpl();
+  virtual bool CheckThreadCuttingByRow();
+  // size of the packed matrix-b in float, the kernels packing the weight in a narrower type override it.
+  virtual int GetMatrixBPackSize() { return b_batch_ * params_->col_align_ * params_->deep_; }
+
   MatMulParameter *params_ = nullptr;
   GemmIsNotPackFun gemmIsNotPackFun = nullptr;
   int a_batch_ = 1;
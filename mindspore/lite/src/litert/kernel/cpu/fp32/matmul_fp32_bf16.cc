@@ -0,0 +1,136 @@
+#ifdef ENABLE_AVX512
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_bf16.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#include "nnacl/fp32/pack_fp32.h"
+
+namespace mindspore::kernel {
+namespace {
+void RowMajor2Row16x2MajorBf16(const float *src_ptr, float *dst_ptr, int row, int col, int start_row, int end_row) {
+  RowMajor2Row16x2MajorBf16Parallel(src_ptr, reinterpret_cast<uint16_t *>(dst_ptr), row, col, start_row, end_row);
+}
+
+void RowMajor2Col16x2MajorBf16(const float *src_ptr, float *dst_ptr, int row, int col, int start_row, int end_row) {
+  RowMajor2Col16x2MajorBf16Parallel(src_ptr, reinterpret_cast<uint16_t *>(dst_ptr), row, col, start_row, end_row);
+}
+}  // namespace
+
+void MatmulFp32Bf16CPUKernel::InitGlobalVariable() {
+  // the row-1 and col-1 shortcuts of the base kernel pack matrix-b in fp32.
+  use_bf16_ = params_->b_const_ && b_batch_ == C1NUM && params_->col_ != 1 && IsSupportBf16Dot();
+  if (!use_bf16_) {
+    MatmulFp32AVX512CPUKernel::InitGlobalVariable();
+    return;
+  }
+  matrix_a_.need_pack = params_->a_transpose_;
+  matrix_b_.need_pack = true;
+  matrix_a_pack_fun_ = params_->a_transpose_ ? RowMajor2ColMajorParallel : RowMajor2RowMajorParallel;
+  matrix_b_pack_fun_ = params_->b_transpose_ ? RowMajor2Col16x2MajorBf16 : RowMajor2Row16x2MajorBf16;
+  row_tile_ = C1NUM;
+  col_tile_ = C16NUM;
+  col_min_unit_ = C16NUM;
+  out_need_aligned_ = false;
+}
+
+int MatmulFp32Bf16CPUKernel::GetMatrixBPackSize() {
+  if (!use_bf16_) {
+    return MatmulFp32AVX512CPUKernel::GetMatrixBPackSize();
+  }
+  return UP_DIV(MatMulBf16PackSize(params_->deep_, params_->col_), C2NUM);
+}
+
+int MatmulFp32Bf16CPUKernel::ParallelRunByBatch(int task_id) const {
+  if (!use_bf16_) {
+    return MatmulFp32AVX512CPUKernel::ParallelRunByBatch(task_id);
+  }
+  int start_batch = task_id * batch_stride_;
+  int end_batch = MSMIN(params_->batch, start_batch + batch_stride_);
+  auto b = reinterpret_cast<const uint16_t *>(matrix_b_.pack_ptr);
+  for (int index = start_batch; index < end_batch; ++index) {
+    const float *a = matrix_a_.pack_ptr + a_offset_[index] * params_->row_align_ * params_->deep_;
+    float *c = output_data_ + index * params_->row_ * col_step_;
+    MatMulBf16Fp32(a, b, c, matrix_c_.pack_ptr, params_->act_type_, params_->deep_, params_->row_, params_->col_,
+                   col_step_);
+  }
+  return RET_OK;
+}
+
+int MatmulFp32Bf16CPUKernel::ParallelRunByRow(int task_id) const {
+  if (!use_bf16_) {
+    return MatmulFp32AVX512CPUKernel::ParallelRunByRow(task_id);
+  }
+  if (task_id < 0 || task_id >= thread_count_) {
+    MS_LOG(ERROR) << "task_id " << task_id << " is out of range, node is " << name_;
+    return RET_ERROR;
+  }
+  int start_row = split_points_[task_id];
+  int end_row = row_num_;
+  if (task_id < (thread_count_ - 1)) {
+    end_row = split_points_[task_id + 1];
+  }
+  int row_num = end_row - start_row;
+  if (row_num <= 0) {
+    return RET_OK;
+  }
+  const float *input = matrix_a_.pack_ptr + start_row * params_->deep_;
+  float *output = output_data_ + start_row * col_step_;
+  MatMulBf16Fp32(input, reinterpret_cast<const uint16_t *>(matrix_b_.pack_ptr), output, matrix_c_.pack_ptr,
+                 params_->act_type_, params_->deep_, row_num, params_->col_, col_step_);
+  return RET_OK;
+}
+
+int MatmulFp32Bf16CPUKernel::ParallelRunByOC(int task_id) const {
+  if (!use_bf16_) {
+    return MatmulFp32AVX512CPUKernel::ParallelRunByOC(task_id);
+  }
+  if (task_id < 0 || task_id >= thread_count_) {
+    MS_LOG(ERROR) << "task_id " << task_id << " is out of range, node is " << name_;
+    return RET_ERROR;
+  }
+  int start_oc = split_points_[task_id];
+  int end_oc = col_step_;
+  if (task_id < (thread_count_ - 1)) {
+    end_oc = split_points_[task_id + 1];
+  }
+  int compute_oc = end_oc - start_oc;
+  if (compute_oc <= 0) {
+    return RET_OK;
+  }
+  auto b = reinterpret_cast<const uint16_t *>(matrix_b_.pack_ptr) + start_oc * UP_ROUND(params_->deep_, C2NUM);
+  auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr + start_oc;
+  for (int i = 0; i < params_->batch; ++i) {
+    auto a = matrix_a_.pack_ptr + a_offset_[i] * params_->row_align_ * params_->deep_;
+    auto c = output_data_ + i * params_->row_ * col_step_ + start_oc;
+    MatMulBf16Fp32(a, b, c, bias, params_->act_type_, params_->deep_, params_->row_, compute_oc, col_step_);
+  }
+  return RET_OK;
+}
+
+bool MatmulFp32Bf16CPUKernel::CheckThreadCuttingByRow() {
+  if (!use_bf16_) {
+    return MatmulFp32AVX512CPUKernel::CheckThreadCuttingByRow();
+  }
+  if (b_batch_ != C1NUM || row_num_ < op_parameter_->thread_num_) {
+    return false;
+  }
+  row_min_unit_ = C4NUM;
+  return MSMIN(row_num_ / row_min_unit_, op_parameter_->thread_num_) >
+         MSMIN(col_step_ / col_min_unit_, op_parameter_->thread_num_);
+}
+}  // namespace mindspore::kernel
+#endif
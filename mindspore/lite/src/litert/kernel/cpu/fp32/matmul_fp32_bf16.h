@@ -0,0 +1,46 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BF16_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BF16_H_
+
+#ifdef ENABLE_AVX512
+#include <vector>
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_avx512.h"
+namespace mindspore::kernel {
+// Matmul whose constant weight was serialized in bfloat16, the weight is packed in bfloat16 and computed by vdpbf16ps.
+// It works as the avx512 kernel when the weight is not a single 2D constant or the cpu lacks avx512-bf16.
+class MatmulFp32Bf16CPUKernel : public MatmulFp32AVX512CPUKernel {
+ public:
+  MatmulFp32Bf16CPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                          const std::vector<lite::Tensor *> &outputs, const mindspore::lite::InnerContext *ctx)
+      : MatmulFp32AVX512CPUKernel(parameter, inputs, outputs, ctx) {}
+  ~MatmulFp32Bf16CPUKernel() = default;
+
+  void InitGlobalVariable() override;
+  int ParallelRunByBatch(int task_id) const override;
+  int ParallelRunByRow(int task_id) const override;
+  int ParallelRunByOC(int task_id) const override;
+  bool CheckThreadCuttingByRow() override;
+  int GetMatrixBPackSize() override;
+
+ private:
+  bool use_bf16_ = false;
+};
+}  // namespace mindspore::kernel
+#endif
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BF16_H_
@@ -0,0 +1,154 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_sparse.h"
+#include "nnacl/fp32/matmul_block_sparse_fp32.h"
+#include "nnacl/fp32/pack_fp32.h"
+
+namespace mindspore::kernel {
+const float *MatmulFp32SparseCPUKernel::GetMatrixBSource() const {
+  if (matrix_b_.has_origin) {
+    return matrix_b_.origin_ptr;
+  }
+  if (conv1x1_origin_weight_ != nullptr) {
+    return conv1x1_origin_weight_;
+  }
+  return reinterpret_cast<const float *>(in_tensors_[SECOND_INPUT]->data());
+}
+
+void MatmulFp32SparseCPUKernel::InitGlobalVariable() {
+  use_sparse_ = block_ > 0 && params_->b_const_ && b_batch_ == C1NUM && params_->col_ != 1;
+  if (use_sparse_ && nnz_ < 0) {
+    // the weight may be released after packing, so the size of the packed weight is counted only once.
+    auto src_ptr = GetMatrixBSource();
+    if (src_ptr == nullptr) {
+      use_sparse_ = false;
+    } else {
+      nnz_ = BlockSparseNnz(src_ptr, params_->col_, params_->deep_, block_, params_->b_transpose_);
+    }
+  }
+  if (!use_sparse_) {
+    MatmulFp32BaseCPUKernel::InitGlobalVariable();
+    return;
+  }
+  matrix_a_.need_pack = true;
+  matrix_b_.need_pack = true;
+  matrix_a_pack_fun_ = params_->a_transpose_ ? RowMajor2Row4MajorParallel : RowMajor2Col4MajorParallel;
+  row_tile_ = C4NUM;
+  col_tile_ = block_;
+  col_min_unit_ = C4NUM;
+  out_need_aligned_ = false;
+}
+
+int MatmulFp32SparseCPUKernel::GetMatrixBPackSize() {
+  if (!use_sparse_) {
+    return MatmulFp32BaseCPUKernel::GetMatrixBPackSize();
+  }
+  return BlockSparsePackSize(params_->col_, nnz_, block_);
+}
+
+int MatmulFp32SparseCPUKernel::PackMatrixBImpl() {
+  if (!use_sparse_) {
+    return MatmulFp32BaseCPUKernel::PackMatrixBImpl();
+  }
+  auto src_ptr = GetMatrixBSource();
+  MS_CHECK_TRUE_MSG(src_ptr != nullptr, RET_ERROR, "matrix-b source ptr is a nullptr.");
+  MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr, RET_ERROR, "matrix-b pack ptr is a nullptr.");
+  MS_CHECK_TRUE_MSG(BlockSparseNnz(src_ptr, params_->col_, params_->deep_, block_, params_->b_transpose_) == nnz_,
+                    RET_ERROR, "matrix-b is changed after its size is counted.");
+  PackBlockSparseWeight(src_ptr, matrix_b_.pack_ptr, params_->col_, params_->deep_, block_, params_->b_transpose_);
+  return RET_OK;
+}
+
+int MatmulFp32SparseCPUKernel::ParallelRunByBatch(int task_id) const {
+  if (!use_sparse_) {
+    return MatmulFp32BaseCPUKernel::ParallelRunByBatch(task_id);
+  }
+  int start_batch = task_id * batch_stride_;
+  int end_batch = MSMIN(params_->batch, start_batch + batch_stride_);
+  for (int index = start_batch; index < end_batch; ++index) {
+    const float *a = matrix_a_.pack_ptr + a_offset_[index] * params_->row_align_ * params_->deep_;
+    float *c = output_data_ + index * params_->row_ * col_step_;
+    MatMulBlockSparseFp32(a, matrix_b_.pack_ptr, c, matrix_c_.pack_ptr, params_->act_type_, params_->deep_, row_tile_,
+                          0, params_->row_, params_->col_, block_, 0, UP_DIV(params_->col_, block_), col_step_);
+  }
+  return RET_OK;
+}
+
+int MatmulFp32SparseCPUKernel::ParallelRunByRow(int task_id) const {
+  if (!use_sparse_) {
+    return MatmulFp32BaseCPUKernel::ParallelRunByRow(task_id);
+  }
+  if (task_id < 0 || task_id >= thread_count_) {
+    MS_LOG(ERROR) << "task_id " << task_id << " is out of range, node is " << name_;
+    return RET_ERROR;
+  }
+  int start_row = split_points_[task_id];
+  int end_row = row_num_;
+  if (task_id < (thread_count_ - 1)) {
+    end_row = split_points_[task_id + 1];
+  }
+  if (end_row <= start_row) {
+    return RET_OK;
+  }
+  // the split points are not aligned to the row tile, the tile shared by two tasks is computed by both of them.
+  MatMulBlockSparseFp32(matrix_a_.pack_ptr, matrix_b_.pack_ptr, output_data_, matrix_c_.pack_ptr, params_->act_type_,
+                        params_->deep_, row_tile_, start_row, end_row, params_->col_, block_, 0,
+                        UP_DIV(params_->col_, block_), col_step_);
+  return RET_OK;
+}
+
+int MatmulFp32SparseCPUKernel::ParallelRunByOC(int task_id) const {
+  if (!use_sparse_) {
+    return MatmulFp32BaseCPUKernel::ParallelRunByOC(task_id);
+  }
+  if (task_id < 0 || task_id >= thread_count_) {
+    MS_LOG(ERROR) << "task_id " << task_id << " is out of range, node is " << name_;
+    return RET_ERROR;
+  }
+  int start_oc = split_points_[task_id];
+  int end_oc = col_step_;
+  if (task_id < (thread_count_ - 1)) {
+    end_oc = split_points_[task_id + 1];
+  }
+  // the split points are multiples of col_min_unit_, which is a multiple of the block.
+  int start_block = start_oc / block_;
+  int end_block = UP_DIV(MSMIN(end_oc, params_->col_), block_);
+  if (end_block <= start_block) {
+    return RET_OK;
+  }
+  for (int i = 0; i < params_->batch; ++i) {
+    const float *a = matrix_a_.pack_ptr + a_offset_[i] * params_->row_align_ * params_->deep_;
+    float *c = output_data_ + i * params_->row_ * col_step_;
+    MatMulBlockSparseFp32(a, matrix_b_.pack_ptr, c, matrix_c_.pack_ptr, params_->act_type_, params_->deep_, row_tile_,
+                          0, params_->row_, params_->col_, block_, start_block, end_block, col_step_);
+  }
+  return RET_OK;
+}
+
+bool MatmulFp32SparseCPUKernel::CheckThreadCuttingByRow() {
+  if (!use_sparse_) {
+    return MatmulFp32BaseCPUKernel::CheckThreadCuttingByRow();
+  }
+  // the rows of different batches are not contiguous in the packed input.
+  if (a_batch_ != C1NUM || row_num_ < op_parameter_->thread_num_) {
+    return false;
+  }
+  row_min_unit_ = C4NUM;
+  return MSMIN(row_num_ / row_min_unit_, op_parameter_->thread_num_) >
+         MSMIN(col_step_ / col_min_unit_, op_parameter_->thread_num_);
+}
+}  // namespace mindspore::kernel
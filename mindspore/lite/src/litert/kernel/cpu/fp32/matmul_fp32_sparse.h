@@ -0,0 +1,51 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_SPARSE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_SPARSE_H_
+
+#include <vector>
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
+namespace mindspore::kernel {
+// Matmul whose constant weight is mostly zero, only the non-zero blocks of the weight are packed and computed. The
+// block is chosen from the measured density when the kernel is created, and the kernel works as the base kernel when
+// the weight is not a single 2D constant.
+class MatmulFp32SparseCPUKernel : public MatmulFp32BaseCPUKernel {
+ public:
+  MatmulFp32SparseCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                            const std::vector<lite::Tensor *> &outputs, const mindspore::lite::InnerContext *ctx,
+                            int block)
+      : MatmulFp32BaseCPUKernel(parameter, inputs, outputs, ctx), block_(block) {}
+  ~MatmulFp32SparseCPUKernel() = default;
+
+  void InitGlobalVariable() override;
+  int ParallelRunByBatch(int task_id) const override;
+  int ParallelRunByRow(int task_id) const override;
+  int ParallelRunByOC(int task_id) const override;
+  bool CheckThreadCuttingByRow() override;
+  int GetMatrixBPackSize() override;
+  int PackMatrixBImpl() override;
+
+ private:
+  const float *GetMatrixBSource() const;
+
+  int block_ = 0;
+  int nnz_ = -1;
+  bool use_sparse_ = false;
+};
+}  // namespace mindspore::kernel
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_SPARSE_H_
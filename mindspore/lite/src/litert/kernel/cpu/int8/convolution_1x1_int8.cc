@@ -17,6 +17,7 @@
 #include "src/litert/kernel/cpu/int8/convolution_1x1_int8.h"
 #include "src/common/file_utils.h"
 #include "src/litert/kernel/cpu/int8/opt_op_handler.h"
+#include "nnacl/int8/matmul_vnni_int8.h"
 
 using mindspore::lite::RET_ERROR;
 using mindspore::lite::RET_MEMORY_FAILED;
@@ -151,6 +152,11 @@ void Convolution1x1Int8CPUKernel::CheckSupportOptimize() {
 #if !defined(SUPPORT_NNIE) && !defined(SUPPORT_34XX) && !defined(MACHINE_LINUX_ARM64)
   }
 #endif
+#elif defined(ENABLE_AVX)
+  if (IsSupportInt8Vnni()) {
+    support_optimize_ = true;
+    matmul_func_ = MatMulDpInt8Vnni;
+  }
 #endif
   return;
 }
@@ -172,6 +178,11 @@ int Convolution1x1Int8CPUKernel::InitBiasByzp(const void *src_weight, int input_
     }
     bias_data[oc] += filter_zp * input_zp * input_channel - weight_sum_value * input_zp;
   }
+#ifdef ENABLE_AVX
+  if (support_optimize_) {
+    AdjustWeightBiasSumsForVnni(weight, input_channel, output_channel, output_channel, bias_data, ColMajor);
+  }
+#endif
 
   if (filter_peroc_) {
     /* filter zp */
@@ -22,6 +22,9 @@
 #ifdef ENABLE_ARM64
 #include "src/litert/kernel/cpu/int8/opt_op_handler.h"
 #endif
+#ifdef ENABLE_AVX
+#include "nnacl/int8/matmul_vnni_int8.h"
+#endif
 
 using mindspore::lite::RET_ERROR;
 using mindspore::lite::RET_OK;
@@ -46,6 +49,10 @@ void ConvolutionInt8CPUKernel::CheckSupportOptimize() {
 #if !defined(SUPPORT_NNIE) && !defined(SUPPORT_34XX) && !defined(MACHINE_LINUX_ARM64)
   }
 #endif
+#elif defined(ENABLE_AVX)
+  if (IsSupportInt8Vnni()) {
+    matmul_func_ = MatMulRInt8Vnni;
+  }
 #endif
   conv_param_->tile_num_ = tile_num_;
 }
@@ -140,6 +147,12 @@ int ConvolutionInt8CPUKernel::InitWeightBias() {
     }
     bias_data[oc] += filter_zp * input_zp * up_round_deep - weight_sum_value * input_zp;
   }
+#ifdef ENABLE_AVX
+  if (matmul_func_ != nullptr) {
+    AdjustWeightBiasSumsForVnni(origin_weight, kernel_plane * input_channel, output_channel, output_channel, bias_data,
+                                ColMajor);
+  }
+#endif
 
   size_t input_sum_size;
   if (conv_quant_arg_->per_channel_ & FILTER_PER_CHANNEL) {
@@ -26,6 +26,12 @@
 #include "nnacl/int8/common_func_int8.h"
 #include "nnacl/int8/matmul_int8.h"
 
+#if (defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && !defined(SUPPORT_34XX) && (!defined(MACHINE_LINUX_ARM64))) || \
+  defined(ENABLE_AVX)
+/* sdot on arm64 and vpdpbusd on x86 share the row4x4 * row4x16 packing */
+#define MATMUL_INT8_DOT_PRODUCT
+#endif
+
 namespace mindspore::kernel {
 class MatmulBaseInt8CPUKernel : public LiteKernel {
   typedef void (*PackFunc)(const int8_t *src, int8_t *dst, int row, int col);
@@ -44,10 +50,10 @@ class MatmulBaseInt8CPUKernel : public LiteKernel {
 
  public:
   int RunImpl(int task_id);
-#if defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && (!defined(MACHINE_LINUX_ARM64))
-  int RunArm64Sdot();
-  int Arm64SdotImpl(int task_id);
-  int Arm64SdotPre(int task_id);
+#ifdef MATMUL_INT8_DOT_PRODUCT
+  int RunDotProduct();
+  int DotProductImpl(int task_id);
+  int DotProductPre(int task_id);
 #endif
 
  protected:
@@ -87,7 +93,7 @@ class MatmulBaseInt8CPUKernel : public LiteKernel {
   int col_tile_ = C4NUM;
   int deep_tile_ = C16NUM;
   int channel_num_ = 0;
-  bool support_sdot_ = false;
+  bool support_dot_product_ = false;
   PackFunc a_pack_func_{nullptr};
   PackFunc b_pack_func_{nullptr};
   std::vector<int> a_offset_;
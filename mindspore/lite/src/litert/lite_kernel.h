@@ -50,6 +50,10 @@ class LiteKernel : public Abstractkernel {
     if (ctx != nullptr) {
       thread_num_ = ctx->thread_num_;
     }
+    // inter-op parallel mode gives each branch a share of the threads through the parameter
+    if (parameter != nullptr && parameter->thread_num_ > 0 && parameter->thread_num_ < thread_num_) {
+      thread_num_ = parameter->thread_num_;
+    }
   }
 
   virtual ~LiteKernel() {
@@ -166,6 +170,9 @@ class LiteKernel : public Abstractkernel {
 
   virtual int SetupVirtualBatch(int, int) { return mindspore::lite::RET_OK; }
 
+  // drop the state kept between runs, e.g. the key/value cache of incremental decoding
+  virtual int ResetState() { return mindspore::lite::RET_OK; }
+
   bool IsEval() const override { return !this->train_mode_; }
 
   void SetTrainable(bool trainable) override { this->trainable_ = trainable; }
@@ -232,6 +232,9 @@ lite::Tensor *LiteSession::ConvertTensor(const schema::Tensor &src_tensor) {
     dst_tensor->set_compress_type(static_cast<CompressType>(compress_type));
     dst_tensor->set_compressed_size(src_tensor.data()->size());
   }
+  if (compress_type == kBF16 || compress_type == kNMSparse || compress_type == kBlockSparse) {
+    dst_tensor->set_compress_type(compress_type);
+  }
   return dst_tensor;
 }
 
@@ -1090,6 +1093,19 @@ int LiteSession::ResizeInputs(const std::vector<mindspore::lite::Tensor *> &inpu
   return RET_OK;
 }
 
+bool LiteSession::IsSameInputShapes(const std::vector<mindspore::lite::Tensor *> &inputs,
+                                    const std::vector<std::vector<int>> &dims) const {
+  if (inputs != inputs_ || dims.size() != inputs_.size() || is_infershape_ != RET_OK) {
+    return false;
+  }
+  for (size_t i = 0; i < inputs_.size(); ++i) {
+    if (inputs_[i]->shape() != dims[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void LiteSession::ResetInputsShape(const std::vector<std::vector<int>> &dims) {
   for (size_t i = 0; i < inputs_.size(); ++i) {
     inputs_[i]->FreeData();
@@ -1210,6 +1226,10 @@ int LiteSession::BindGLTexture2DMemory(const std::map<std::string, unsigned int>
 
 int LiteSession::Resize(const std::vector<mindspore::lite::Tensor *> &inputs,
                         const std::vector<std::vector<int>> &dims) {
+  if (IsSameInputShapes(inputs, dims)) {
+    MS_LOG(DEBUG) << "Input shapes are not changed, skip resize.";
+    return RET_OK;
+  }
   bool expected = false;
   if (!is_running_.compare_exchange_strong(expected, true)) {
     MS_LOG(ERROR) << "Not support multi-threading";
@@ -1258,6 +1278,36 @@ int LiteSession::Resize(const std::vector<mindspore::lite::Tensor *> &inputs,
   return RET_OK;
 }
 
+int LiteSession::ResetState() {
+  bool expected = false;
+  if (!is_running_.compare_exchange_strong(expected, true)) {
+    MS_LOG(ERROR) << "Not support multi-threading";
+    return RET_ERROR;
+  }
+  for (auto kernel : this->kernels_) {
+    if (kernel->desc().arch == kernel::kDelegate) {
+      continue;
+    }
+    std::vector<kernel::KernelExec *> nodes = {kernel};
+    if (kernel->subgraph_type() != kernel::kNotSubGraph) {
+      nodes = reinterpret_cast<kernel::SubGraphKernel *>(kernel)->nodes();
+    }
+    for (auto node : nodes) {
+      if (!node->IsBuiltin()) {
+        continue;
+      }
+      auto ret = static_cast<kernel::LiteKernel *>(node->kernel())->ResetState();
+      if (ret != RET_OK) {
+        MS_LOG(ERROR) << "node: " << node->name() << " reset state failed.";
+        is_running_.store(false);
+        return ret;
+      }
+    }
+  }
+  is_running_.store(false);
+  return RET_OK;
+}
+
 int LiteSession::PreCheck(Model *model) {
   bool expected = false;
   if (!is_running_.compare_exchange_strong(expected, true)) {
@@ -1478,9 +1528,21 @@ int LiteSession::RuntimeAllocatorInit() {
     return RET_ERROR;
   }
 
-  RuntimeAllocatorInitSubgraph();
+  std::vector<std::vector<int>> input_shapes;
+  for (auto input : inputs_) {
+    input_shapes.push_back(input->shape());
+  }
+  if (runtime_allocator_->LoadPlan(input_shapes)) {
+    for (auto &iter : runtime_allocator_->GetOffsetMap()) {
+      iter.first->set_allocator(runtime_allocator_);
+    }
+  } else {
+    RuntimeAllocatorInitSubgraph();
 
-  RuntimeAllocatorInitGraphOutput();
+    RuntimeAllocatorInitGraphOutput();
+
+    runtime_allocator_->SavePlan(input_shapes);
+  }
 
   auto ret = RuntimeAllocatorSetData();
   if (ret != RET_OK) {
@@ -73,6 +73,7 @@ class LiteSession {
   virtual int BindGLTexture2DMemory(const std::map<std::string, unsigned int> &inputGLTexture,
                                     std::map<std::string, unsigned int> *outputGLTexture);
   virtual int Resize(const std::vector<mindspore::lite::Tensor *> &inputs, const std::vector<std::vector<int>> &dims);
+  int ResetState();
   void InitExecutionConfig(std::map<std::string, TypeId> *config) { execution_plan_ = config; }
   void set_model(Model *model) { this->model_ = model; }
   const std::vector<kernel::KernelExec *> &get_kernels() const { return this->kernels_; }
@@ -153,6 +154,8 @@ class LiteSession {
   int PreCheck(Model *model);
   int InitExecutor();
   void ResetInputsShape(const std::vector<std::vector<int>> &dims);
+  bool IsSameInputShapes(const std::vector<mindspore::lite::Tensor *> &inputs,
+                         const std::vector<std::vector<int>> &dims) const;
   int ContextInit(const std::shared_ptr<InnerContext> &context);
   int CreateTensorRTDelegate();
   int CreateNPUDelegate();
@@ -30,8 +30,14 @@ RuntimeAllocator::~RuntimeAllocator() {
 }
 
 void *RuntimeAllocator::MallocOptData() {
+  // the buffer is kept across Clear, so switching between planned shapes does not reallocate it
+  if (data_ != nullptr && data_size_ < total_size_) {
+    free(data_);
+    data_ = nullptr;
+  }
   if (data_ == nullptr) {
     data_ = malloc(total_size_);
+    data_size_ = (data_ == nullptr) ? 0 : total_size_;
   }
   return data_;
 }
@@ -85,15 +91,38 @@ void RuntimeAllocator::Clear(AllocatorPtr default_allocator) {
     iter.first->set_allocator(default_allocator);
     iter.first->set_data(nullptr);
   }
-  if (data_ != nullptr) {
-    free(data_);
-    data_ = nullptr;
-  }
   offset_map_.clear();
   free_list_.clear();
   used_list_.clear();
 }
 
+bool RuntimeAllocator::LoadPlan(const std::vector<std::vector<int>> &input_shapes) {
+  auto iter = plans_.find(input_shapes);
+  if (iter == plans_.end()) {
+    return false;
+  }
+  plan_order_.remove(input_shapes);
+  plan_order_.push_back(input_shapes);
+  offset_map_ = iter->second.offset_map_;
+  total_size_ = iter->second.total_size_;
+  free_list_.clear();
+  used_list_.clear();
+  return true;
+}
+
+void RuntimeAllocator::SavePlan(const std::vector<std::vector<int>> &input_shapes) {
+  if (plans_.find(input_shapes) == plans_.end()) {
+    if (plans_.size() >= kMaxPlanNum) {
+      plans_.erase(plan_order_.front());
+      plan_order_.pop_front();
+    }
+    plan_order_.push_back(input_shapes);
+  }
+  auto &plan = plans_[input_shapes];
+  plan.offset_map_ = offset_map_;
+  plan.total_size_ = total_size_;
+}
+
 void RuntimeAllocator::MallocTensorData(lite::Tensor *tensor) {
   size_t size = tensor->Size();
   size_t offset = FindMinFree(size);
@@ -19,6 +19,8 @@
 
 #include <memory>
 #include <map>
+#include <list>
+#include <vector>
 #include <unordered_map>
 #include "include/api/allocator.h"
 #include "include/errorcode.h"
@@ -46,12 +48,26 @@ class RuntimeAllocator : public Allocator {
   const std::unordered_map<lite::Tensor *, size_t> &GetOffsetMap() const { return offset_map_; }
   void Clear(AllocatorPtr default_allocator);
 
+  /* The plan only depends on the input shapes of the graph, so the plans of the shapes seen before are kept and a
+   * Resize back to one of them rebinds the tensors instead of planning again. */
+  bool LoadPlan(const std::vector<std::vector<int>> &input_shapes);
+  void SavePlan(const std::vector<std::vector<int>> &input_shapes);
+
  private:
   size_t FindMinFree(size_t size);
 
  private:
+  struct MemoryPlan {
+    std::unordered_map<lite::Tensor *, size_t> offset_map_;
+    size_t total_size_ = 0;
+  };
+  static constexpr size_t kMaxPlanNum = 16;
+
   void *data_ = nullptr;
+  size_t data_size_ = 0;
   size_t total_size_ = 0;
+  std::map<std::vector<std::vector<int>>, MemoryPlan> plans_;
+  std::list<std::vector<std::vector<int>>> plan_order_; /* least recently used first */
   std::unordered_map<lite::Tensor *, size_t> offset_map_;
   std::map<size_t, size_t> free_list_; /* offset, size */
   std::map<size_t, size_t> used_list_; /* offset, size */
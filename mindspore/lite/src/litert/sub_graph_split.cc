@@ -27,6 +27,7 @@
 #include "src/common/ops/populate/populate_register.h"
 #include "src/litert/scheduler.h"
 #include "src/litert/tensor_category.h"
+#include "src/litert/thread_cost_model.h"
 #include "nnacl/pooling_parameter.h"
 #include "nnacl/split_parameter.h"
 #include "nnacl/reduce_parameter.h"
@@ -1162,9 +1163,85 @@ void SearchSubGraph::SubGraphSplitByOperator() {
       sub_graphs_.push_back(std::move(subgraph));
     }
   }
+  AssignOperatorSubGraphThreads(&sub_graphs_);
   ConvertSubGraphToModel(&sub_graphs_);
 }
 
+float SearchSubGraph::CalculateOperatorCost(const LiteGraph::Node *node) {
+  auto type = GetPrimitiveType(node->primitive_, SCHEMA_VERSION::SCHEMA_CUR);
+  if (type == schema::PrimitiveType_Conv2DFusion && node->input_indices_.size() > 1 &&
+      src_tensors_->at(node->input_indices_[1])->shape().size() == DIMENSION_4D &&
+      src_tensors_->at(node->output_indices_[0])->shape().size() == DIMENSION_4D) {
+    return static_cast<float>(CalculateConv2DFusion(node).cost());
+  }
+  ThreadCostContext cost_context;
+  cost_context.total_unit_num_ = 0;
+  for (auto output : node->output_indices_) {
+    cost_context.total_unit_num_ += MSMAX(src_tensors_->at(output)->ElementsNum(), 1);
+  }
+  cost_context.per_unit_load_num_ = 0;
+  for (auto input : node->input_indices_) {
+    if (tensors_[input].type_ != CONST) {
+      cost_context.per_unit_load_num_++;
+    }
+  }
+  cost_context.per_unit_store_num_ = 1;
+  cost_context.per_unit_compute_cost_ = GetKernelComputeCost(TC_TYPE(type, 0));
+  return ThreadCostModel::TotalCost(&cost_context);
+}
+
+/* Subgraphs at the same depth of the subgraph dag can not depend on each other, so they may run at the same time and
+ * share the threads in proportion to their cost instead of each taking all of them. */
+void SearchSubGraph::AssignOperatorSubGraphThreads(std::vector<Subgraph> *sub_graphs) {
+  int thread_num = MSMIN(context_->thread_num_, kOperatorMaxThreadNum);
+  std::unordered_map<uint32_t, size_t> node_sub;
+  std::vector<float> costs(sub_graphs->size(), 0.0f);
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    for (auto node_index : sub_graphs->at(i).nodes_) {
+      node_sub[node_index] = i;
+      costs[i] += CalculateOperatorCost(model_->graph_.all_nodes_[node_index]);
+    }
+  }
+  std::vector<std::set<size_t>> producers(sub_graphs->size());
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    for (auto node_index : sub_graphs->at(i).nodes_) {
+      for (auto input : model_->graph_.all_nodes_[node_index]->input_indices_) {
+        for (auto producer : tensors_[input].out_nodes_) {
+          auto iter = node_sub.find(producer);
+          if (iter != node_sub.end() && iter->second != i) {
+            producers[i].insert(iter->second);
+          }
+        }
+      }
+    }
+  }
+  /* depth is the longest producer chain, the subgraph dag has at most size() levels */
+  std::vector<int> depth(sub_graphs->size(), 0);
+  for (size_t round = 0; round < sub_graphs->size(); round++) {
+    bool changed = false;
+    for (size_t i = 0; i < sub_graphs->size(); i++) {
+      for (auto producer : producers[i]) {
+        if (depth[producer] + 1 > depth[i]) {
+          depth[i] = depth[producer] + 1;
+          changed = true;
+        }
+      }
+    }
+    if (!changed) {
+      break;
+    }
+  }
+  std::map<int, float> depth_cost;
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    depth_cost[depth[i]] += costs[i];
+  }
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    float total = depth_cost[depth[i]];
+    int thread = total > 0 ? static_cast<int>(thread_num * costs[i] / total + 0.5f) : thread_num;
+    sub_graphs->at(i).thread_ = static_cast<size_t>(MSVALID(1, thread, thread_num));
+  }
+}
+
 void SearchSubGraph::DoOnlineFusion() {
   DoSplitReduceConcatFusionPass();  // split + reduce + concat op fusion
 }
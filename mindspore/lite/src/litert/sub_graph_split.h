@@ -141,6 +141,8 @@ class SearchSubGraph {
 
  private: /* public cost-model func  */
   CostModel CalculateConv2DFusion(const LiteGraph::Node *node);
+  float CalculateOperatorCost(const LiteGraph::Node *node);
+  void AssignOperatorSubGraphThreads(std::vector<Subgraph> *sub_graphs);
   void dfs(int i, int n, int current_sum, int except_value, int *min_value, std::vector<bool> *tmp_group,
            std::vector<bool> *cor_group, std::vector<Subgraph> *sub_graphs);
 
@@ -21,6 +21,8 @@
 #include "thread/threadpool.h"
 
 namespace mindspore::lite {
+constexpr float kDefaultKernelComputeCost = 1.806f;  // cost of a plain element-wise op
+
 const std::map<int32_t, float> kernel_compute_cost_map_ = {
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU), 1.806f},        // dataNum about 100k
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU6), 1.806f},       // dataNum about 100k
@@ -65,6 +67,11 @@ const std::map<int32_t, float> kernel_compute_cost_map_ = {
   {TC_TYPE(schema::PrimitiveType_OneHot, 0), 136.562f},           // dataNum about 1.5k
 };
 
+float GetKernelComputeCost(int32_t kernel_type) {
+  auto iter = kernel_compute_cost_map_.find(kernel_type);
+  return iter == kernel_compute_cost_map_.end() ? kDefaultKernelComputeCost : iter->second;
+}
+
 float ThreadCostModel::per_unit_load_cost_ = 1.0 / 64 * 11;   // 64: L2 cache size, 11 : L2 cache latency on Haswell
 float ThreadCostModel::per_unit_store_cost_ = 1.0 / 64 * 11;  // 64: L2 cache size, 11 : L2 cache latency on Haswell
 int64_t ThreadCostModel::per_unit_compute_num_ = 1;           // 1 : per unit compute num
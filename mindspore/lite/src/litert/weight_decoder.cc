@@ -19,6 +19,7 @@
 #include "src/litert/huffman_decode.h"
 #include "tools/converter/quantizer/fse_decoder.h"
 #include "nnacl/conv_parameter.h"
+#include "nnacl/base/cast_base.h"
 
 namespace mindspore::lite {
 #ifndef WEIGHT_DECODE_CLIP
@@ -513,9 +514,158 @@ int WeightDecoder::DequantNode(const OpParameter *op_parameter, const std::vecto
 #endif
 }
 
+int WeightDecoder::Bf16Decompress(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor) {
+  MS_ASSERT(src_tensor.handler() != nullptr);
+  MS_ASSERT(src_tensor.data() != nullptr);
+  MS_LOG(DEBUG) << "expand bfloat16 weight";
+  MS_CHECK_TRUE_MSG(dst_tensor->data_type() == kNumberTypeFloat32, RET_ERROR, "bfloat16 weight is not float32");
+  auto elem_num = dst_tensor->ElementsNum();
+  MS_CHECK_TRUE_MSG(elem_num > 0 && src_tensor.length() == static_cast<size_t>(elem_num) * sizeof(uint16_t), RET_ERROR,
+                    "bfloat16 weight size invalid");
+  MS_CHECK_FALSE_MSG(dst_tensor->data() != nullptr, RET_ERROR, "data_c not null");
+  if (dst_tensor->MallocData() != RET_OK) {
+    MS_LOG(ERROR) << "Malloc tensor data failed";
+    return RET_NULL_PTR;
+  }
+  BFloat16ToFloat32(static_cast<const uint16_t *>(src_tensor.data()), static_cast<float *>(dst_tensor->data()),
+                    elem_num);
+  return RET_OK;
+}
+
+namespace {
+// the pruned weight is viewed as [shape[0]][elem_num / shape[0]], see WeightSparsityPass for the layouts.
+int MallocSparseWeight(lite::Tensor *dst_tensor, int *outer, int *inner) {
+  MS_CHECK_TRUE_MSG(dst_tensor->data_type() == kNumberTypeFloat32, RET_ERROR, "sparse weight is not float32");
+  MS_CHECK_TRUE_MSG(!dst_tensor->shape().empty() && dst_tensor->shape()[0] > 0 && dst_tensor->ElementsNum() > 0,
+                    RET_ERROR, "sparse weight shape invalid");
+  MS_CHECK_FALSE_MSG(dst_tensor->data() != nullptr, RET_ERROR, "data_c not null");
+  *outer = dst_tensor->shape()[0];
+  *inner = static_cast<int>(dst_tensor->ElementsNum()) / *outer;
+  if (dst_tensor->MallocData() != RET_OK) {
+    MS_LOG(ERROR) << "Malloc tensor data failed";
+    return RET_NULL_PTR;
+  }
+  (void)memset(dst_tensor->data(), 0, dst_tensor->Size());
+  return RET_OK;
+}
+}  // namespace
+
+int WeightDecoder::NMSparseDecompress(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor) {
+  MS_ASSERT(src_tensor.handler() != nullptr);
+  MS_ASSERT(src_tensor.data() != nullptr);
+  MS_LOG(DEBUG) << "expand N:M sparse weight";
+  auto src = static_cast<const uint8_t *>(src_tensor.data());
+  int32_t header[C2NUM];
+  MS_CHECK_TRUE_MSG(src_tensor.length() >= sizeof(header), RET_ERROR, "N:M sparse weight size invalid");
+  (void)memcpy(header, src, sizeof(header));
+  int n = header[0];
+  int m = header[1];
+  MS_CHECK_TRUE_MSG(n > 0 && n < m && m <= UINT8_MAX + 1, RET_ERROR, "N:M sparse weight pattern invalid");
+  int outer = 0;
+  int inner = 0;
+  auto ret = MallocSparseWeight(dst_tensor, &outer, &inner);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  size_t kept_num = 0;
+  for (int start = 0; start < inner; start += m) {
+    kept_num += static_cast<size_t>(MSMIN(n, inner - start));
+  }
+  kept_num *= static_cast<size_t>(outer);
+  if (src_tensor.length() != sizeof(header) + kept_num * (sizeof(float) + sizeof(uint8_t))) {
+    MS_LOG(ERROR) << "N:M sparse weight size invalid";
+    dst_tensor->FreeData();
+    return RET_ERROR;
+  }
+  auto values = src + sizeof(header);
+  auto indices = values + kept_num * sizeof(float);
+  auto dst = static_cast<float *>(dst_tensor->data());
+  size_t index = 0;
+  for (int i = 0; i < outer; ++i) {
+    for (int start = 0; start < inner; start += m) {
+      int group = MSMIN(m, inner - start);
+      for (int j = 0; j < MSMIN(n, group); ++j, ++index) {
+        if (indices[index] >= group) {
+          MS_LOG(ERROR) << "N:M sparse weight index invalid";
+          dst_tensor->FreeData();
+          return RET_ERROR;
+        }
+        (void)memcpy(dst + i * inner + start + indices[index], values + index * sizeof(float), sizeof(float));
+      }
+    }
+  }
+  return RET_OK;
+}
+
+int WeightDecoder::BlockSparseDecompress(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor) {
+  MS_ASSERT(src_tensor.handler() != nullptr);
+  MS_ASSERT(src_tensor.data() != nullptr);
+  MS_LOG(DEBUG) << "expand block sparse weight";
+  auto src = static_cast<const uint8_t *>(src_tensor.data());
+  int32_t header[C2NUM];
+  MS_CHECK_TRUE_MSG(src_tensor.length() >= sizeof(header), RET_ERROR, "block sparse weight size invalid");
+  (void)memcpy(header, src, sizeof(header));
+  int block = header[0];
+  int nnz = header[1];
+  MS_CHECK_TRUE_MSG(block > 0 && nnz >= 0, RET_ERROR, "block sparse weight pattern invalid");
+  int outer = 0;
+  int inner = 0;
+  auto ret = MallocSparseWeight(dst_tensor, &outer, &inner);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  auto block_num = static_cast<size_t>(UP_DIV(outer, block));
+  if (src_tensor.length() != sizeof(header) + (block_num + 1 + nnz) * sizeof(int32_t) +
+                               static_cast<size_t>(nnz) * block * sizeof(float)) {
+    MS_LOG(ERROR) << "block sparse weight size invalid";
+    dst_tensor->FreeData();
+    return RET_ERROR;
+  }
+  std::vector<int32_t> offsets(block_num + 1);
+  std::vector<int32_t> indices(nnz);
+  (void)memcpy(offsets.data(), src + sizeof(header), offsets.size() * sizeof(int32_t));
+  (void)memcpy(indices.data(), src + sizeof(header) + offsets.size() * sizeof(int32_t),
+               indices.size() * sizeof(int32_t));
+  // the offsets must be checked as a whole before any of them is used to index the blocks.
+  bool offsets_valid = offsets[0] == 0 && offsets[block_num] == nnz;
+  for (size_t i = 0; offsets_valid && i < block_num; ++i) {
+    offsets_valid = offsets[i + 1] >= offsets[i] && offsets[i + 1] <= nnz;
+  }
+  if (!offsets_valid) {
+    MS_LOG(ERROR) << "block sparse weight offset invalid";
+    dst_tensor->FreeData();
+    return RET_ERROR;
+  }
+  auto values = src + sizeof(header) + (offsets.size() + indices.size()) * sizeof(int32_t);
+  auto dst = static_cast<float *>(dst_tensor->data());
+  for (size_t i = 0; i < block_num; ++i) {
+    for (int j = offsets[i]; j < offsets[i + 1]; ++j) {
+      if (indices[j] < 0 || indices[j] >= inner) {
+        MS_LOG(ERROR) << "block sparse weight index invalid";
+        dst_tensor->FreeData();
+        return RET_ERROR;
+      }
+      for (int b = 0; b < block && static_cast<int>(i) * block + b < outer; ++b) {
+        (void)memcpy(dst + (i * block + b) * inner + indices[j], values + (j * block + b) * sizeof(float),
+                     sizeof(float));
+      }
+    }
+  }
+  return RET_OK;
+}
+
 int WeightDecoder::DecompressTensor(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor) {
   MS_ASSERT(src_tensor.handler() != nullptr);
   MS_ASSERT(dst_tensor != nullptr);
+  if (src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_BF16) {
+    return Bf16Decompress(src_tensor, dst_tensor);
+  }
+  if (src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_NM_SPARSE) {
+    return NMSparseDecompress(src_tensor, dst_tensor);
+  }
+  if (src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_BLOCK_SPARSE) {
+    return BlockSparseDecompress(src_tensor, dst_tensor);
+  }
 #ifndef WEIGHT_DECODE_CLIP
   if (src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_FSE ||
       src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_FSE_INT) {
@@ -409,6 +409,11 @@ class WeightDecoder {
     return RET_OK;
   }
 #endif
+
+ private:
+  static int Bf16Decompress(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor);
+  static int NMSparseDecompress(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor);
+  static int BlockSparseDecompress(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor);
 };
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_WEIGHT_DECODER_H_
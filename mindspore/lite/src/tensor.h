@@ -60,7 +60,10 @@ enum CompressType {
   kFSE = 3,
   kBitPacking = 4,
   kFSEInt = 5,
-  kFSEInfer = 6
+  kFSEInfer = 6,
+  kBF16 = 7,
+  kNMSparse = 8,
+  kBlockSparse = 9
 };
 
 class Tensor {
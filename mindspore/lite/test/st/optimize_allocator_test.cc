@@ -168,4 +168,48 @@ TEST_F(OptimizeAllocator, RuntimeAllocator1) {
 
   delete lite_session;
 }
+
+TEST_F(OptimizeAllocator, RuntimeAllocatorResizeBack) {
+  auto meta_graph = std::make_shared<mindspore::schema::MetaGraphT>();
+  CreateModel1(meta_graph.get());
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  auto offset = mindspore::schema::MetaGraph::Pack(builder, meta_graph.get());
+  builder.Finish(offset);
+  mindspore::schema::FinishMetaGraphBuffer(builder, offset);
+  size_t size = builder.GetSize();
+  const char *content = reinterpret_cast<char *>(builder.GetBufferPointer());
+  mindspore::lite::Model *model = mindspore::lite::Model::Import(content, size);
+
+  auto context = std::make_shared<lite::InnerContext>();
+  auto lite_session = new lite::SessionMock();
+  ASSERT_NE(lite_session, nullptr);
+  ON_CALL(*lite_session, RuntimeAllocatorValid).WillByDefault(testing::Return(0));
+  ASSERT_EQ(mindspore::lite::RET_OK, lite_session->Init(context));
+  ASSERT_EQ(mindspore::lite::RET_OK, lite_session->CompileGraph(model));
+
+  auto input = lite_session->GetInputs().front();
+  auto output = lite_session->GetOutputs().begin()->second;
+  void *planned_data = output->data();
+  /* resize to a new shape, then back to the compiled one whose plan is reused */
+  for (auto shape : {std::vector<int>{2}, std::vector<int>{4}, std::vector<int>{2}, std::vector<int>{4}}) {
+    auto ret = lite_session->Resize({input}, {shape});
+    ASSERT_EQ(mindspore::lite::RET_OK, ret);
+    ASSERT_NE(output->allocator(), context->allocator);
+    std::vector<float> in_data = {1.0, 2.0, 3.0, 4.0};
+    memcpy(input->MutableData(), in_data.data(), input->Size());
+    ret = lite_session->RunGraph();
+    ASSERT_EQ(mindspore::lite::RET_OK, ret);
+    auto fp32_data = reinterpret_cast<float *>(output->MutableData());
+    for (int i = 0; i < shape.front(); i++) {
+      float cos_value = cosf(in_data[i]);
+      ASSERT_LE(fabs(fp32_data[i] - (cos_value + sinf(cos_value))), 0.01);
+    }
+    if (shape.front() == 4) {
+      ASSERT_EQ(output->data(), planned_data);
+    }
+  }
+
+  delete lite_session;
+}
 }  // namespace mindspore
@@ -0,0 +1,84 @@
+#!/bin/bash
+# Compare the per-request latency of models run serially and with inter-op parallel branches on x86 CPU.
+
+function Run_Latency() {
+    # $1:modelFile; $2:interOpParallelNum;
+    ${benchmark} --modelFile=$1 --device=CPU --numThreads=${thread_num} --interOpParallelNum=$2 \
+        --loopCount=${loop_count} --warmUpLoopCount=${warm_up_loop_count} >> "${run_log_file}" 2>&1 || return 1
+    grep "AvgRunTime" "${run_log_file}" | tail -n 1 | awk -F '=' '{print $2}' | awk '{print $1}'
+}
+
+function Run_Inter_Op_Parallel() {
+    printf "%-40s %16s %16s %10s\n" "model" "serial(ms)" "parallel(ms)" "speedup" | tee -a "${run_result_file}"
+    while read line; do
+        model_name=${line%%;*}
+        if [[ $model_name == \#* || $model_name == "" ]]; then
+          continue
+        fi
+        model_file=${ms_models_path}/${model_name}.ms
+        echo "${model_name}" >> "${run_log_file}"
+        serial_time=$(Run_Latency "${model_file}" 1)
+        if [ $? != 0 ]; then
+            echo "${model_name} serial run failed" | tee -a "${run_result_file}"; return 1
+        fi
+        parallel_time=$(Run_Latency "${model_file}" ${inter_op_parallel_num})
+        if [ $? != 0 ]; then
+            echo "${model_name} inter-op parallel run failed" | tee -a "${run_result_file}"; return 1
+        fi
+        speedup=$(awk -v s="${serial_time}" -v p="${parallel_time}" 'BEGIN {if (p > 0) printf "%.2f", s / p; else print "-"}')
+        printf "%-40s %16s %16s %10s\n" "${model_name}" "${serial_time}" "${parallel_time}" "${speedup}" | tee -a "${run_result_file}"
+    done < ${models_config}
+}
+
+basepath=$(pwd)
+thread_num=4
+inter_op_parallel_num=2
+loop_count=100
+warm_up_loop_count=10
+
+# Example:sh run_benchmark_inter_op_parallel.sh -b ./benchmark -m /home/temp_test/ms_models -c models_inter_op.cfg -t 4 -n 2
+while getopts "b:m:c:t:n:l:" opt; do
+    case ${opt} in
+        b)
+            benchmark=${OPTARG}
+            echo "benchmark is ${benchmark}"
+            ;;
+        m)
+            ms_models_path=${OPTARG}
+            echo "ms_models_path is ${ms_models_path}"
+            ;;
+        c)
+            models_config=${OPTARG}
+            echo "models_config is ${models_config}"
+            ;;
+        t)
+            thread_num=${OPTARG}
+            echo "thread_num is ${thread_num}"
+            ;;
+        n)
+            inter_op_parallel_num=${OPTARG}
+            echo "inter_op_parallel_num is ${inter_op_parallel_num}"
+            ;;
+        l)
+            loop_count=${OPTARG}
+            echo "loop_count is ${loop_count}"
+            ;;
+        ?)
+        echo "unknown para"
+        exit 1;;
+    esac
+done
+
+if [[ ! -x ${benchmark} || ! -f ${models_config} ]]; then
+    echo "benchmark or models config is not found"
+    exit 1
+fi
+
+run_log_file=${basepath}/run_inter_op_parallel_log.txt
+run_result_file=${basepath}/run_inter_op_parallel_result.txt
+echo ' ' > ${run_log_file}
+echo ' ' > ${run_result_file}
+
+Run_Inter_Op_Parallel
+Run_status=$?
+exit ${Run_status}
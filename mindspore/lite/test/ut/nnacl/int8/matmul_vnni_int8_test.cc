@@ -0,0 +1,158 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/quantize.h"
+#ifdef ENABLE_AVX
+#include "nnacl/int8/matmul_vnni_int8.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+namespace mindspore {
+class MatMulVnniInt8Test : public mindspore::CommonTest {
+ public:
+  MatMulVnniInt8Test() {}
+};
+
+#ifdef ENABLE_AVX
+namespace {
+struct QuantArgs {
+  std::vector<int32_t> multiplier;
+  std::vector<int32_t> left_shift;
+  std::vector<int32_t> right_shift;
+  std::vector<int32_t> filter_zp;
+};
+
+void RandomInt8(std::mt19937 *gen, std::vector<int8_t> *data) {
+  std::uniform_int_distribution<int> dist(INT8_MIN, INT8_MAX);
+  for (auto &v : *data) {
+    v = static_cast<int8_t>(dist(*gen));
+  }
+}
+
+QuantArgs RandomQuantArgs(std::mt19937 *gen, int num) {
+  std::uniform_real_distribution<double> scale_dist(0.0005, 0.01);
+  std::uniform_int_distribution<int> zp_dist(-10, 10);
+  QuantArgs args;
+  args.multiplier.resize(num);
+  args.left_shift.resize(num);
+  args.right_shift.resize(num);
+  args.filter_zp.resize(num);
+  for (int i = 0; i < num; i++) {
+    QuantizeRoundParameterWithDoublePrecision(scale_dist(*gen), &args.multiplier[i], &args.left_shift[i],
+                                              &args.right_shift[i]);
+    args.filter_zp[i] = zp_dist(*gen);
+  }
+  return args;
+}
+
+int CompareDp(int row, int col, int deep, bool per_channel) {
+  std::mt19937 gen(row * col + deep);
+  int deep4 = UP_ROUND(deep, C4NUM);
+  int col16 = UP_ROUND(col, C16NUM);
+  std::vector<int8_t> a(row * deep);
+  std::vector<int8_t> b(deep * col);
+  RandomInt8(&gen, &a);
+  RandomInt8(&gen, &b);
+  auto args = RandomQuantArgs(&gen, per_channel ? col : 1);
+  std::vector<int32_t> raw_bias(col, 1000);
+
+  std::vector<int8_t> pack_a(UP_ROUND(row, C4NUM) * deep4, 0);
+  std::vector<int8_t> pack_b(col16 * deep4, 0);
+  std::vector<int32_t> input_sum(UP_ROUND(row, C4NUM), 0);
+  std::vector<int32_t> bias(col16, 0);
+  PackInput4x4AndInputSumPert(a.data(), pack_a.data(), input_sum.data(), deep, row,
+                              per_channel ? 1 : args.filter_zp[0]);
+  RowMajor2Col4x16MajorInt8(b.data(), pack_b.data(), deep, col);
+  CalcWeightBiasSums(b.data(), deep, col, -3, args.filter_zp.data(), raw_bias.data(), bias.data(), RowMajor,
+                     per_channel);
+  std::vector<int32_t> vnni_bias = bias;
+  AdjustWeightBiasSumsForVnni(b.data(), deep, col, col, vnni_bias.data(), RowMajor);
+
+  std::vector<int8_t> expect(row * col);
+  std::vector<int8_t> output(row * col);
+  MatMulInt8_4x16_r(pack_a.data(), pack_b.data(), expect.data(), row, col, deep4, col, input_sum.data(), bias.data(),
+                    args.left_shift.data(), args.right_shift.data(), args.multiplier.data(), 3, -100, 120,
+                    per_channel, args.filter_zp.data());
+  MatMulDpInt8Vnni(pack_a.data(), pack_b.data(), output.data(), row, col, deep4, col, input_sum.data(),
+                   vnni_bias.data(), args.left_shift.data(), args.right_shift.data(), args.multiplier.data(), 3, -100,
+                   120, per_channel, args.filter_zp.data());
+  return CommonTest::CompareOutputData(output.data(), expect.data(), row * col, 0);
+}
+
+int CompareR(int row, int col, int deep, bool per_channel) {
+  std::mt19937 gen(row * col + deep);
+  int deep4 = UP_ROUND(deep, C4NUM);
+  int row8 = UP_ROUND(row, C8NUM);
+  int col8 = UP_ROUND(col, C8NUM);
+  std::vector<int8_t> a(row * deep);
+  std::vector<int8_t> b(col * deep);
+  RandomInt8(&gen, &a);
+  RandomInt8(&gen, &b);
+  auto args = RandomQuantArgs(&gen, per_channel ? col : 1);
+
+  std::vector<int8_t> pack_a(row8 * deep4, 0);
+  std::vector<int8_t> pack_b(col8 * deep4, 0);
+  RowMajor2Row8x4MajorInt8(a.data(), pack_a.data(), row, deep);
+  RowMajor2Row8x4MajorInt8(b.data(), pack_b.data(), col, deep);
+  std::uniform_int_distribution<int> sum_dist(-50000, 50000);
+  std::vector<int32_t> input_sum(row8 * col8);
+  for (auto &v : input_sum) {
+    v = sum_dist(gen);
+  }
+  std::vector<int32_t> bias(col8, -2000);
+  std::vector<int32_t> vnni_bias = bias;
+  AdjustWeightBiasSumsForVnni(b.data(), deep, col, col, vnni_bias.data(), ColMajor);
+
+  std::vector<int8_t> expect(row * col);
+  std::vector<int8_t> output(row * col);
+  MatMulInt8_8x8_r(pack_a.data(), pack_b.data(), expect.data(), row, col, deep4, col, input_sum.data(), bias.data(),
+                   args.left_shift.data(), args.right_shift.data(), args.multiplier.data(), -5, INT8_MIN, INT8_MAX,
+                   per_channel);
+  MatMulRInt8Vnni(pack_a.data(), pack_b.data(), output.data(), row, col, deep4, col, input_sum.data(),
+                  vnni_bias.data(), args.left_shift.data(), args.right_shift.data(), args.multiplier.data(), -5,
+                  INT8_MIN, INT8_MAX, per_channel);
+  return CommonTest::CompareOutputData(output.data(), expect.data(), row * col, 0);
+}
+
+const int kShapes[][3] = {{1, 1, 1}, {1, 17, 5}, {3, 16, 16}, {5, 65, 33}, {13, 100, 77}, {33, 200, 300}, {64, 48, 3}};
+}  // namespace
+
+TEST_F(MatMulVnniInt8Test, DotProductMatchesReference) {
+  IntelX86CpuInfoInit();
+  if (!IsSupportInt8Vnni()) {
+    return;
+  }
+  for (auto &shape : kShapes) {
+    ASSERT_EQ(0, CompareDp(shape[0], shape[1], shape[2], false));
+    ASSERT_EQ(0, CompareDp(shape[0], shape[1], shape[2], true));
+  }
+}
+
+TEST_F(MatMulVnniInt8Test, Row8x8MatchesReference) {
+  IntelX86CpuInfoInit();
+  if (!IsSupportInt8Vnni()) {
+    return;
+  }
+  for (auto &shape : kShapes) {
+    ASSERT_EQ(0, CompareR(shape[0], shape[1], shape[2], false));
+    ASSERT_EQ(0, CompareR(shape[0], shape[1], shape[2], true));
+  }
+}
+#endif
+}  // namespace mindspore
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/fp32/attention_fp32.h"
+
+namespace mindspore {
+class TestKVCacheAttentionFp32 : public mindspore::CommonTest {
+ public:
+  TestKVCacheAttentionFp32() {}
+};
+
+namespace {
+constexpr int kBatch = 2;
+constexpr int kHeadNum = 3;
+constexpr int kHeadSize = 5;
+constexpr int kHidden = kHeadNum * kHeadSize;
+constexpr int kSeq = 9;
+constexpr int kQKVNum = 3;
+
+// qkv is [batch, seq, 3 * hidden], token i attends to tokens [0, i] when causal, otherwise to those kept by mask
+std::vector<float> NaiveAttention(const std::vector<float> &qkv, const float *mask, bool causal) {
+  std::vector<float> out(kBatch * kSeq * kHidden, 0.0f);
+  float scale = 1.0f / std::sqrt(static_cast<float>(kHeadSize));
+  for (int b = 0; b < kBatch; b++) {
+    for (int h = 0; h < kHeadNum; h++) {
+      for (int i = 0; i < kSeq; i++) {
+        const float *q = qkv.data() + (b * kSeq + i) * kQKVNum * kHidden + h * kHeadSize;
+        int seen = causal ? i + 1 : kSeq;
+        std::vector<float> logits(seen);
+        float max = -INFINITY;
+        for (int t = 0; t < seen; t++) {
+          const float *k = qkv.data() + (b * kSeq + t) * kQKVNum * kHidden + kHidden + h * kHeadSize;
+          float dot = 0.0f;
+          for (int d = 0; d < kHeadSize; d++) {
+            dot += q[d] * k[d];
+          }
+          logits[t] = dot * scale;
+          if (mask != nullptr) {
+            logits[t] += (1.0f - mask[(b * kSeq + i) * kSeq + t]) * -10000.0f;
+          }
+          max = std::max(max, logits[t]);
+        }
+        float sum = 0.0f;
+        for (auto &l : logits) {
+          l = std::exp(l - max);
+          sum += l;
+        }
+        float *o = out.data() + (b * kSeq + i) * kHidden + h * kHeadSize;
+        for (int t = 0; t < seen; t++) {
+          const float *v = qkv.data() + (b * kSeq + t) * kQKVNum * kHidden + C2NUM * kHidden + h * kHeadSize;
+          for (int d = 0; d < kHeadSize; d++) {
+            o[d] += logits[t] / sum * v[d];
+          }
+        }
+      }
+    }
+  }
+  return out;
+}
+
+// rows [start, start + len) of every batch of qkv
+std::vector<float> SliceSeq(const std::vector<float> &qkv, int start, int len) {
+  std::vector<float> slice;
+  for (int b = 0; b < kBatch; b++) {
+    auto begin = qkv.begin() + (b * kSeq + start) * kQKVNum * kHidden;
+    slice.insert(slice.end(), begin, begin + len * kQKVNum * kHidden);
+  }
+  return slice;
+}
+
+std::vector<float> RandomQKV() {
+  std::mt19937 gen(kSeq);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> qkv(kBatch * kSeq * kQKVNum * kHidden);
+  for (auto &v : qkv) {
+    v = dist(gen);
+  }
+  return qkv;
+}
+
+// feed the sequence in steps of the given lengths, every step attends to the cache of the former steps
+std::vector<float> IncrementalAttention(const std::vector<float> &qkv, const std::vector<int> &steps) {
+  AttentionParameter param{};
+  param.head_num_ = kHeadNum;
+  param.head_size_ = kHeadSize;
+  param.batch_ = kBatch;
+  param.max_seq_ = kSeq;
+  param.is_causal_ = true;
+  std::vector<float> k_cache(kBatch * kHeadNum * kSeq * kHeadSize);
+  std::vector<float> v_cache(k_cache.size());
+  std::vector<float> logits(kSeq);
+  std::vector<float> out(kBatch * kSeq * kHidden);
+  int cache_len = 0;
+  for (auto len : steps) {
+    auto cur_qkv = SliceSeq(qkv, cache_len, len);
+    std::vector<float> cur_out(kBatch * len * kHidden);
+    param.q_seq_ = len;
+    param.cache_len_ = cache_len;
+    KVCacheAppend(&param, cur_qkv.data() + kHidden, kQKVNum * kHidden, k_cache.data());
+    KVCacheAppend(&param, cur_qkv.data() + C2NUM * kHidden, kQKVNum * kHidden, v_cache.data());
+    KVCacheAttention(&param, cur_qkv.data(), kQKVNum * kHidden, k_cache.data(), v_cache.data(), nullptr,
+                     cur_out.data(), logits.data(), 0, kBatch * kHeadNum);
+    for (int b = 0; b < kBatch; b++) {
+      std::copy(cur_out.begin() + b * len * kHidden, cur_out.begin() + (b + 1) * len * kHidden,
+                out.begin() + (b * kSeq + cache_len) * kHidden);
+    }
+    cache_len += len;
+  }
+  return out;
+}
+}  // namespace
+
+TEST_F(TestKVCacheAttentionFp32, IncrementalMatchesFullCausal) {
+  auto qkv = RandomQKV();
+  auto expect = NaiveAttention(qkv, nullptr, true);
+  // prefill a prompt of 4 tokens, then decode one token per step
+  auto out = IncrementalAttention(qkv, {4, 1, 1, 1, 1, 1});
+  ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), out.size(), 1e-5));
+  // the whole sequence in one step is the plain causal attention
+  out = IncrementalAttention(qkv, {kSeq});
+  ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), out.size(), 1e-5));
+}
+
+TEST_F(TestKVCacheAttentionFp32, FullWithMask) {
+  auto qkv = RandomQKV();
+  std::vector<float> mask(kBatch * kSeq * kSeq);
+  for (size_t i = 0; i < mask.size(); i++) {
+    mask[i] = (i % C3NUM == 0) ? 0.0f : 1.0f;
+  }
+  auto expect = NaiveAttention(qkv, mask.data(), false);
+
+  AttentionParameter param{};
+  param.head_num_ = kHeadNum;
+  param.head_size_ = kHeadSize;
+  param.batch_ = kBatch;
+  param.q_seq_ = kSeq;
+  param.max_seq_ = kSeq;
+  param.cache_len_ = 0;
+  param.is_causal_ = false;
+  std::vector<float> k_cache(kBatch * kHeadNum * kSeq * kHeadSize);
+  std::vector<float> v_cache(k_cache.size());
+  std::vector<float> logits(C2NUM * kSeq);
+  std::vector<float> out(kBatch * kSeq * kHidden);
+  KVCacheAppend(&param, qkv.data() + kHidden, kQKVNum * kHidden, k_cache.data());
+  KVCacheAppend(&param, qkv.data() + C2NUM * kHidden, kQKVNum * kHidden, v_cache.data());
+  // two tasks split on batch * head_num
+  int half = kBatch * kHeadNum / C2NUM;
+  KVCacheAttention(&param, qkv.data(), kQKVNum * kHidden, k_cache.data(), v_cache.data(), mask.data(), out.data(),
+                   logits.data(), 0, half);
+  KVCacheAttention(&param, qkv.data(), kQKVNum * kHidden, k_cache.data(), v_cache.data(), mask.data(), out.data(),
+                   logits.data() + kSeq, half, kBatch * kHeadNum);
+  ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), out.size(), 1e-5));
+}
+}  // namespace mindspore
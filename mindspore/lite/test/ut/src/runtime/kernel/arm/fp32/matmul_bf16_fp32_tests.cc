@@ -0,0 +1,125 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/base/cast_base.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+
+namespace mindspore {
+class TestMatMulBf16Fp32 : public mindspore::CommonTest {
+ public:
+  TestMatMulBf16Fp32() {}
+};
+
+namespace {
+void RandomFloat(std::mt19937 *gen, std::vector<float> *data) {
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  for (auto &v : *data) {
+    v = dist(*gen);
+  }
+}
+
+// the reference uses the rounded weight, so only the rounding of the input is left in the error.
+int CompareBf16MatMul(int row, int col, int deep, ActType act_type) {
+  std::mt19937 gen(row * col + deep);
+  std::vector<float> a(row * deep);
+  std::vector<float> b(deep * col);
+  std::vector<float> bias(col);
+  RandomFloat(&gen, &a);
+  RandomFloat(&gen, &b);
+  RandomFloat(&gen, &bias);
+  std::vector<float> b_trans(col * deep);
+  for (int k = 0; k < deep; ++k) {
+    for (int j = 0; j < col; ++j) {
+      b_trans[j * deep + k] = b[k * col + j];
+    }
+  }
+
+  std::vector<uint16_t> pack_row(MatMulBf16PackSize(deep, col), 1);
+  std::vector<uint16_t> pack_col(MatMulBf16PackSize(deep, col), 2);
+  RowMajor2Row16x2MajorBf16Parallel(b.data(), pack_row.data(), deep, col, 0, deep / 2);
+  RowMajor2Row16x2MajorBf16Parallel(b.data(), pack_row.data(), deep, col, deep / 2, deep);
+  RowMajor2Col16x2MajorBf16Parallel(b_trans.data(), pack_col.data(), col, deep, 0, col / 3);
+  RowMajor2Col16x2MajorBf16Parallel(b_trans.data(), pack_col.data(), col, deep, col / 3, col);
+  if (pack_row != pack_col) {
+    return 1;
+  }
+
+  std::vector<float> expect(row * col);
+  for (int i = 0; i < row; ++i) {
+    for (int j = 0; j < col; ++j) {
+      double sum = bias[j];
+      for (int k = 0; k < deep; ++k) {
+        sum += a[i * deep + k] * BFloat16ToFloat32Value(Float32ToBFloat16Value(b[k * col + j]));
+      }
+      if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+        sum = std::max(sum, 0.0);
+      }
+      if (act_type == ActType_Relu6) {
+        sum = std::min(sum, 6.0);
+      }
+      expect[i * col + j] = static_cast<float>(sum);
+    }
+  }
+  // one extra column checks the output stride.
+  int stride = col + 1;
+  std::vector<float> output(row * stride, -100.0f);
+  MatMulBf16Fp32(a.data(), pack_row.data(), output.data(), bias.data(), act_type, deep, row, col, stride);
+  float tolerance = 0.01f * std::sqrt(static_cast<float>(deep));
+  for (int i = 0; i < row; ++i) {
+    for (int j = 0; j < col; ++j) {
+      if (std::fabs(output[i * stride + j] - expect[i * col + j]) > tolerance) {
+        return 1;
+      }
+    }
+    if (output[i * stride + col] != -100.0f) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+const int kShapes[][3] = {{1, 1, 1}, {1, 17, 5}, {3, 16, 16}, {5, 65, 33}, {13, 100, 77}, {7, 130, 1025}};
+}  // namespace
+
+TEST_F(TestMatMulBf16Fp32, Bf16RoundTrip) {
+  float in[] = {0.0f, 1.0f, -2.5f, 1.00390625f, 1.01171875f, 3.4e38f};
+  uint16_t expect[] = {0x0000, 0x3f80, 0xc020, 0x3f80, 0x3f82, 0x7f80};
+  uint16_t out[6];
+  Float32ToBFloat16(in, out, 6);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(expect[i], out[i]);
+  }
+  float back[6];
+  BFloat16ToFloat32(out, back, 6);
+  ASSERT_EQ(-2.5f, back[2]);
+  ASSERT_EQ(1.0f, back[3]);
+}
+
+TEST_F(TestMatMulBf16Fp32, MatMulMatchesReference) {
+#ifdef ENABLE_AVX
+  IntelX86CpuInfoInit();
+#endif
+  for (auto &shape : kShapes) {
+    ASSERT_EQ(0, CompareBf16MatMul(shape[0], shape[1], shape[2], ActType_No));
+    ASSERT_EQ(0, CompareBf16MatMul(shape[0], shape[1], shape[2], ActType_Relu6));
+  }
+}
+}  // namespace mindspore
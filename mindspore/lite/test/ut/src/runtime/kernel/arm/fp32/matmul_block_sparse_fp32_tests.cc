@@ -0,0 +1,146 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/fp32/matmul_block_sparse_fp32.h"
+#include "nnacl/fp32/pack_fp32.h"
+
+namespace mindspore {
+class TestMatMulBlockSparseFp32 : public mindspore::CommonTest {
+ public:
+  TestMatMulBlockSparseFp32() {}
+};
+
+namespace {
+// b is [deep][col], about `density` of the blocks of `block` columns at one depth are kept.
+std::vector<float> RandomSparseWeight(std::mt19937 *gen, int deep, int col, int block, float density) {
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> keep(0.0f, 1.0f);
+  std::vector<float> b(deep * col, 0.0f);
+  for (int k = 0; k < deep; ++k) {
+    for (int j = 0; j < col; j += block) {
+      if (keep(*gen) >= density) {
+        continue;
+      }
+      for (int n = j; n < std::min(col, j + block); ++n) {
+        b[k * col + n] = dist(*gen);
+      }
+    }
+  }
+  return b;
+}
+
+int CompareSparseMatMul(int row, int col, int deep, int block, int a_tile, ActType act_type) {
+  std::mt19937 gen(row * col + deep + block);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> a(row * deep);
+  std::vector<float> bias(col);
+  for (auto &v : a) {
+    v = dist(gen);
+  }
+  for (auto &v : bias) {
+    v = dist(gen);
+  }
+  auto b = RandomSparseWeight(&gen, deep, col, block, 0.3f);
+  std::vector<float> b_trans(col * deep);
+  for (int k = 0; k < deep; ++k) {
+    for (int j = 0; j < col; ++j) {
+      b_trans[j * deep + k] = b[k * col + j];
+    }
+  }
+
+  int nnz = BlockSparseNnz(b.data(), col, deep, block, false);
+  if (nnz != BlockSparseNnz(b_trans.data(), col, deep, block, true)) {
+    return 1;
+  }
+  std::vector<float> pack(BlockSparsePackSize(col, nnz, block), 1.0f);
+  std::vector<float> pack_trans(pack.size(), 2.0f);
+  PackBlockSparseWeight(b.data(), pack.data(), col, deep, block, false);
+  PackBlockSparseWeight(b_trans.data(), pack_trans.data(), col, deep, block, true);
+  if (pack != pack_trans) {
+    return 1;
+  }
+
+  std::vector<float> a_pack(a);
+  if (a_tile == C4NUM) {
+    a_pack.resize(UP_ROUND(row, C4NUM) * deep);
+    RowMajor2Col4Major(a.data(), a_pack.data(), row, deep);
+  }
+  std::vector<float> expect(row * col);
+  for (int i = 0; i < row; ++i) {
+    for (int j = 0; j < col; ++j) {
+      double sum = bias[j];
+      for (int k = 0; k < deep; ++k) {
+        sum += a[i * deep + k] * b[k * col + j];
+      }
+      if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+        sum = std::max(sum, 0.0);
+      }
+      if (act_type == ActType_Relu6) {
+        sum = std::min(sum, 6.0);
+      }
+      expect[i * col + j] = static_cast<float>(sum);
+    }
+  }
+  // one extra column checks the output stride, the rows and blocks are cut at unaligned points like the threads do.
+  int stride = col + 1;
+  int block_num = UP_DIV(col, block);
+  std::vector<float> output(row * stride, -100.0f);
+  MatMulBlockSparseFp32(a_pack.data(), pack.data(), output.data(), bias.data(), act_type, deep, a_tile, 0, row / 3,
+                        col, block, 0, block_num / 2, stride);
+  MatMulBlockSparseFp32(a_pack.data(), pack.data(), output.data(), bias.data(), act_type, deep, a_tile, row / 3, row,
+                        col, block, 0, block_num / 2, stride);
+  MatMulBlockSparseFp32(a_pack.data(), pack.data(), output.data(), bias.data(), act_type, deep, a_tile, 0, row, col,
+                        block, block_num / 2, block_num, stride);
+  for (int i = 0; i < row; ++i) {
+    for (int j = 0; j < col; ++j) {
+      if (std::fabs(output[i * stride + j] - expect[i * col + j]) > 1e-4f * deep) {
+        return 1;
+      }
+    }
+    if (output[i * stride + col] != -100.0f) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+const int kShapes[][3] = {{1, 2, 1}, {1, 17, 5}, {4, 16, 16}, {5, 65, 33}, {13, 100, 77}, {7, 130, 259}};
+}  // namespace
+
+TEST_F(TestMatMulBlockSparseFp32, SelectBlock) {
+  std::mt19937 gen(1);
+  auto block4 = RandomSparseWeight(&gen, 64, 64, C4NUM, 0.2f);
+  ASSERT_EQ(C4NUM, SelectBlockSparseBlock(block4.data(), 64, 64, false));
+  auto block1 = RandomSparseWeight(&gen, 64, 64, 1, 0.2f);
+  ASSERT_EQ(1, SelectBlockSparseBlock(block1.data(), 64, 64, false));
+  auto dense = RandomSparseWeight(&gen, 64, 64, 1, 1.0f);
+  ASSERT_EQ(0, SelectBlockSparseBlock(dense.data(), 64, 64, false));
+  ASSERT_EQ(0, SelectBlockSparseBlock(block4.data(), 1, 64, false));
+}
+
+TEST_F(TestMatMulBlockSparseFp32, MatMulMatchesReference) {
+  for (auto &shape : kShapes) {
+    for (int block : {1, C2NUM, C4NUM}) {
+      ASSERT_EQ(0, CompareSparseMatMul(shape[0], shape[1], shape[2], block, C4NUM, ActType_No));
+      ASSERT_EQ(0, CompareSparseMatMul(shape[0], shape[1], shape[2], block, 1, ActType_Relu6));
+    }
+  }
+}
+}  // namespace mindspore
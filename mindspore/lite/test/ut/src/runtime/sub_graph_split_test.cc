@@ -0,0 +1,151 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <map>
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "schema/inner/model_generated.h"
+#include "src/tensor.h"
+#define private public
+#include "src/litert/sub_graph_split.h"
+#undef private
+
+namespace mindspore {
+namespace {
+// builds a graph of Abs nodes, the input tensors of the nodes which no node outputs are the graph inputs.
+class AbsGraphBuilder {
+ public:
+  AbsGraphBuilder() : meta_graph_(std::make_unique<schema::MetaGraphT>()) {
+    meta_graph_->name = "graph";
+    meta_graph_->version = Version();
+  }
+
+  ~AbsGraphBuilder() {
+    for (auto tensor : src_tensors_) {
+      delete tensor;
+    }
+    delete model_;
+  }
+
+  uint32_t AddTensor(const std::vector<int> &dims) {
+    auto tensor = std::make_unique<schema::TensorT>();
+    tensor->nodeType = lite::NodeType_Parameter;
+    tensor->format = schema::Format_NHWC;
+    tensor->dataType = kNumberTypeFloat32;
+    tensor->dims = dims;
+    tensor->offset = -1;
+    meta_graph_->allTensors.emplace_back(std::move(tensor));
+    src_tensors_.push_back(new lite::Tensor(kNumberTypeFloat32, dims));
+    return static_cast<uint32_t>(meta_graph_->allTensors.size() - 1);
+  }
+
+  uint32_t AddAbs(uint32_t input, uint32_t output) {
+    auto node = std::make_unique<schema::CNodeT>();
+    node->inputIndex = {input};
+    node->outputIndex = {output};
+    node->primitive = std::make_unique<schema::PrimitiveT>();
+    node->primitive->value.type = schema::PrimitiveType_Abs;
+    node->primitive->value.value = new schema::AbsT;
+    node->name = "abs" + std::to_string(meta_graph_->nodes.size());
+    meta_graph_->nodes.emplace_back(std::move(node));
+    return static_cast<uint32_t>(meta_graph_->nodes.size() - 1);
+  }
+
+  lite::Model *Build(const std::vector<uint32_t> &inputs, const std::vector<uint32_t> &outputs) {
+    meta_graph_->inputIndex = inputs;
+    meta_graph_->outputIndex = outputs;
+    flatbuffers::FlatBufferBuilder builder(1024);
+    auto offset = schema::MetaGraph::Pack(builder, meta_graph_.get());
+    builder.Finish(offset);
+    schema::FinishMetaGraphBuffer(builder, offset);
+    model_ = lite::Model::Import(reinterpret_cast<char *>(builder.GetBufferPointer()), builder.GetSize());
+    return model_;
+  }
+
+  std::vector<lite::Tensor *> *src_tensors() { return &src_tensors_; }
+
+ private:
+  std::unique_ptr<schema::MetaGraphT> meta_graph_;
+  std::vector<lite::Tensor *> src_tensors_;
+  lite::Model *model_ = nullptr;
+};
+
+// assigns the threads of subgraphs which each hold one node.
+std::vector<size_t> AssignThreads(AbsGraphBuilder *builder, lite::Model *model, int thread_num,
+                                  const std::vector<uint32_t> &sub_graph_nodes) {
+  lite::InnerContext context;
+  context.thread_num_ = thread_num;
+  if (context.Init() != lite::RET_OK) {
+    return {};
+  }
+  std::map<int, OpParameter *> op_parameters;
+  std::vector<size_t> output_nodes;
+  lite::SearchSubGraph search(&context, model, builder->src_tensors(), &op_parameters, &output_nodes);
+  std::vector<lite::SearchSubGraph::Subgraph> sub_graphs(sub_graph_nodes.size());
+  for (size_t i = 0; i < sub_graph_nodes.size(); i++) {
+    sub_graphs[i].nodes_ = {sub_graph_nodes[i]};
+  }
+  search.AssignOperatorSubGraphThreads(&sub_graphs);
+  std::vector<size_t> threads;
+  for (const auto &sub_graph : sub_graphs) {
+    threads.push_back(sub_graph.thread_);
+  }
+  return threads;
+}
+}  // namespace
+
+class SubGraphSplitTest : public mindspore::CommonTest {
+ public:
+  SubGraphSplitTest() = default;
+};
+
+TEST_F(SubGraphSplitTest, AssignThreadsByCost) {
+  // a and b are independent, c consumes the output of b, so it runs after both of them.
+  AbsGraphBuilder builder;
+  auto a_in = builder.AddTensor({1, 1024});
+  auto b_in = builder.AddTensor({1, 3072});
+  auto a_out = builder.AddTensor({1, 1024});
+  auto b_out = builder.AddTensor({1, 3072});
+  auto c_out = builder.AddTensor({1, 3072});
+  auto a = builder.AddAbs(a_in, a_out);
+  auto b = builder.AddAbs(b_in, b_out);
+  auto c = builder.AddAbs(b_out, c_out);
+  auto model = builder.Build({a_in, b_in}, {a_out, c_out});
+  ASSERT_NE(model, nullptr);
+  // a and b share the 4 threads as 1:3 by their cost, c runs alone and takes all of them.
+  ASSERT_EQ(AssignThreads(&builder, model, 4, {a, b, c}), std::vector<size_t>({1, 3, 4}));
+}
+
+TEST_F(SubGraphSplitTest, AssignThreadsFewerThanSubGraphs) {
+  AbsGraphBuilder builder;
+  std::vector<uint32_t> inputs;
+  std::vector<uint32_t> outputs;
+  std::vector<uint32_t> nodes;
+  for (int size : {1, 1024, 4096}) {
+    auto in = builder.AddTensor({1, size});
+    auto out = builder.AddTensor({1, size});
+    inputs.push_back(in);
+    outputs.push_back(out);
+    nodes.push_back(builder.AddAbs(in, out));
+  }
+  auto model = builder.Build(inputs, outputs);
+  ASSERT_NE(model, nullptr);
+  // 3 independent subgraphs share 2 threads, every subgraph keeps at least one thread and none exceeds the total.
+  auto threads = AssignThreads(&builder, model, 2, nodes);
+  ASSERT_EQ(threads, std::vector<size_t>({1, 1, 2}));
+  ASSERT_EQ(AssignThreads(&builder, model, 1, nodes), std::vector<size_t>({1, 1, 1}));
+}
+}  // namespace mindspore
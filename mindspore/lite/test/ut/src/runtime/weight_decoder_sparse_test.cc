@@ -0,0 +1,168 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <vector>
+#include "common/common_test.h"
+#include "schema/inner/model_generated.h"
+#include "src/litert/weight_decoder.h"
+#include "src/litert/schema_tensor_wrapper.h"
+#include "src/tensor.h"
+#include "src/common/utils.h"
+
+namespace mindspore {
+namespace {
+template <typename T>
+void AppendData(std::vector<uint8_t> *dst, const std::vector<T> &src) {
+  auto bytes = reinterpret_cast<const uint8_t *>(src.data());
+  dst->insert(dst->end(), bytes, bytes + src.size() * sizeof(T));
+}
+
+// packs the encoded weight into a schema tensor and expands it into dst.
+int Decode(schema::WeightQuantCompressType type, const std::vector<int> &shape, const std::vector<uint8_t> &encoded,
+           lite::Tensor *dst) {
+  schema::TensorT tensor_t;
+  tensor_t.nodeType = lite::NodeType_ValueNode;
+  tensor_t.dataType = kNumberTypeFloat32;
+  tensor_t.dims = shape;
+  tensor_t.weightQuantCompressType = type;
+  tensor_t.data = encoded;
+  flatbuffers::FlatBufferBuilder builder(1024);
+  builder.Finish(schema::Tensor::Pack(builder, &tensor_t));
+  auto tensor = flatbuffers::GetRoot<schema::Tensor>(builder.GetBufferPointer());
+  lite::SchemaTensorWrapper wrapper;
+  if (!wrapper.Init(*tensor, lite::SCHEMA_CUR, "")) {
+    return lite::RET_ERROR;
+  }
+  return lite::WeightDecoder::DecompressTensor(wrapper, dst);
+}
+
+// the 3x4 weight {{0, 1, 0, 2}, {3, 0, 0, 4}, {0, 5, 6, 0}} pruned 2:4.
+std::vector<uint8_t> NMEncoded(uint8_t first_index) {
+  std::vector<uint8_t> encoded;
+  AppendData(&encoded, std::vector<int32_t>{2, 4});
+  AppendData(&encoded, std::vector<float>{1, 2, 3, 4, 5, 6});
+  AppendData(&encoded, std::vector<uint8_t>{first_index, 3, 0, 3, 1, 2});
+  return encoded;
+}
+
+// the 3x4 weight {{0, 1, 0, 2}, {0, 3, 0, 4}, {5, 0, 0, 0}} in blocks of 2 rows, the padded row is zero.
+std::vector<uint8_t> BlockEncoded(const std::vector<int32_t> &offsets, int32_t nnz = 3) {
+  std::vector<uint8_t> encoded;
+  AppendData(&encoded, std::vector<int32_t>{2, nnz});
+  AppendData(&encoded, offsets);
+  AppendData(&encoded, std::vector<int32_t>{1, 3, 0});
+  AppendData(&encoded, std::vector<float>{1, 3, 2, 4, 5, 0});
+  return encoded;
+}
+}  // namespace
+
+class WeightDecoderSparseTest : public mindspore::CommonTest {
+ public:
+  WeightDecoderSparseTest() = default;
+};
+
+TEST_F(WeightDecoderSparseTest, NMSparse) {
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_NM_SPARSE, {3, 4}, NMEncoded(1), &dst), lite::RET_OK);
+  std::vector<float> expect = {0, 1, 0, 2, 3, 0, 0, 4, 0, 5, 6, 0};
+  ASSERT_EQ(memcmp(dst.data(), expect.data(), expect.size() * sizeof(float)), 0);
+}
+
+TEST_F(WeightDecoderSparseTest, NMSparseTailGroup) {
+  // a row of 6 in groups of 4 keeps 2 of the first group and both values of the tail group.
+  std::vector<uint8_t> encoded;
+  AppendData(&encoded, std::vector<int32_t>{2, 4});
+  AppendData(&encoded, std::vector<float>{1, 2, 3, 4});
+  AppendData(&encoded, std::vector<uint8_t>{0, 2, 0, 1});
+  lite::Tensor dst(kNumberTypeFloat32, {1, 6});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_NM_SPARSE, {1, 6}, encoded, &dst), lite::RET_OK);
+  std::vector<float> expect = {1, 0, 2, 0, 3, 4};
+  ASSERT_EQ(memcmp(dst.data(), expect.data(), expect.size() * sizeof(float)), 0);
+}
+
+TEST_F(WeightDecoderSparseTest, NMSparseIndexOutOfGroup) {
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_NM_SPARSE, {3, 4}, NMEncoded(4), &dst), lite::RET_ERROR);
+  ASSERT_EQ(dst.data(), nullptr);
+}
+
+TEST_F(WeightDecoderSparseTest, NMSparseInvalidPattern) {
+  auto encoded = NMEncoded(1);
+  int32_t pattern[] = {4, 4};
+  (void)memcpy(encoded.data(), pattern, sizeof(pattern));
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_NM_SPARSE, {3, 4}, encoded, &dst), lite::RET_ERROR);
+}
+
+TEST_F(WeightDecoderSparseTest, NMSparseInvalidSize) {
+  auto encoded = NMEncoded(1);
+  encoded.pop_back();
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_NM_SPARSE, {3, 4}, encoded, &dst), lite::RET_ERROR);
+  ASSERT_EQ(dst.data(), nullptr);
+}
+
+TEST_F(WeightDecoderSparseTest, BlockSparse) {
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_BLOCK_SPARSE, {3, 4}, BlockEncoded({0, 2, 3}), &dst),
+            lite::RET_OK);
+  std::vector<float> expect = {0, 1, 0, 2, 0, 3, 0, 4, 5, 0, 0, 0};
+  ASSERT_EQ(memcmp(dst.data(), expect.data(), expect.size() * sizeof(float)), 0);
+}
+
+TEST_F(WeightDecoderSparseTest, BlockSparseEmpty) {
+  std::vector<uint8_t> encoded;
+  AppendData(&encoded, std::vector<int32_t>{2, 0, 0, 0, 0});
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_BLOCK_SPARSE, {3, 4}, encoded, &dst), lite::RET_OK);
+  std::vector<float> expect(12, 0);
+  ASSERT_EQ(memcmp(dst.data(), expect.data(), expect.size() * sizeof(float)), 0);
+}
+
+TEST_F(WeightDecoderSparseTest, BlockSparseInvalidOffsets) {
+  std::vector<std::vector<int32_t>> invalid_offsets = {
+    {1, 2, 3},   // not starting at 0
+    {0, 3, 2},   // decreasing and not ending at nnz
+    {0, 4, 3},   // decreasing with an entry beyond nnz
+    {0, 2, 2},   // not ending at nnz
+    {0, -1, 3},  // negative
+  };
+  for (const auto &offsets : invalid_offsets) {
+    lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+    ASSERT_EQ(Decode(schema::WeightQuantCompressType_BLOCK_SPARSE, {3, 4}, BlockEncoded(offsets), &dst),
+              lite::RET_ERROR);
+    ASSERT_EQ(dst.data(), nullptr);
+  }
+}
+
+TEST_F(WeightDecoderSparseTest, BlockSparseIndexOutOfRange) {
+  auto encoded = BlockEncoded({0, 2, 3});
+  int32_t index = 4;
+  // the second index follows the header and the 3 offsets.
+  (void)memcpy(encoded.data() + (2 + 3 + 1) * sizeof(int32_t), &index, sizeof(index));
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_BLOCK_SPARSE, {3, 4}, encoded, &dst), lite::RET_ERROR);
+  ASSERT_EQ(dst.data(), nullptr);
+}
+
+TEST_F(WeightDecoderSparseTest, BlockSparseInvalidSize) {
+  lite::Tensor dst(kNumberTypeFloat32, {3, 4});
+  // the nnz in the header disagrees with the encoded indices and values.
+  ASSERT_EQ(Decode(schema::WeightQuantCompressType_BLOCK_SPARSE, {3, 4}, BlockEncoded({0, 2, 3}, 4), &dst),
+            lite::RET_ERROR);
+  ASSERT_EQ(dst.data(), nullptr);
+}
+}  // namespace mindspore
@@ -25,7 +25,7 @@
 #include "schema/model_generated.h"
 #include "src/common/common.h"
 #include "src/tensor.h"
-#ifdef ENABLE_ARM64
+#ifdef BENCHMARK_PERF_EVENT
 #include <linux/perf_event.h>
 #include <sys/ioctl.h>
 #include <asm/unistd.h>
@@ -45,6 +45,7 @@ constexpr int kParallelThreadNumMin = 1;
 constexpr int kColumnLen = 4;
 constexpr int kPrintColNum = 5;
 constexpr int kPrintRowLenMax = 100;
+constexpr float kCacheLineSize = 64;
 
 constexpr float kInputDataFloatMin = 0.1f;
 constexpr float kInputDataFloatMax = 1.0f;
@@ -593,7 +594,7 @@ int BenchmarkBase::PrintResult(const std::vector<std::string> &title,
   return RET_OK;
 }
 
-#ifdef ENABLE_ARM64
+#ifdef BENCHMARK_PERF_EVENT
 int BenchmarkBase::PrintPerfResult(const std::vector<std::string> &title,
                                    const std::map<std::string, std::pair<int, struct PerfCount>> &result) {
   std::vector<size_t> columnLenMax(kPrintColNum);
@@ -661,6 +662,59 @@ int BenchmarkBase::PrintPerfResult(const std::vector<std::string> &title,
   }
   return RET_OK;
 }
+
+int BenchmarkBase::PrintPerfBoundResult(const std::map<std::string, std::pair<int, struct PerfCount>> &result) {
+  const std::vector<std::string> title = {"opType", "calledTimes",  "avg(ms)",       "cycles(k)",      "ins(k)",
+                                          "IPC",    "cacheMiss(k)", "branchMiss(k)", "bandwidth(GB/s)"};
+  std::vector<size_t> columnLenMax(title.size());
+  std::vector<std::vector<std::string>> rows;
+  auto loop_count = float_t(flags_->loop_count_);
+  for (auto &iter : result) {
+    const auto &count = iter.second.second;
+    // the counters follow the calling thread only and are reported as they are, the work of the other threads is not
+    // known, so it is not extrapolated from them
+    auto time_ms = count.time_us / loop_count / kFloatMSEC;
+    auto cycles = count.value[0] / loop_count / kFloatMSEC;
+    auto instructions = count.value[1] / loop_count / kFloatMSEC;
+    auto cache_misses = count.value[2] / loop_count / kFloatMSEC;
+    auto branch_misses = count.value[3] / loop_count / kFloatMSEC;
+    float_t ipc = count.value[0] == 0 ? 0 : float_t(count.value[1]) / count.value[0];
+    // a cache miss loads one cache line from memory, bytes per microsecond divided by 1000 is GB/s
+    float_t bandwidth = count.time_us == 0 ? 0 : count.value[2] * kCacheLineSize / count.time_us / kFloatMSEC;
+    std::vector<float_t> values = {time_ms, cycles, instructions, ipc, cache_misses, branch_misses, bandwidth};
+
+    std::vector<std::string> columns = {iter.first, std::to_string(iter.second.first)};
+    for (auto value : values) {
+      char buf[kPrintRowLenMax] = {};
+      (void)snprintf(buf, sizeof(buf), "%.3f", value);
+      columns.emplace_back(buf);
+    }
+    for (size_t i = 0; i < columns.size(); i++) {
+      columnLenMax.at(i) = std::max(columnLenMax.at(i), columns[i].size() + kColumnLen);
+    }
+    rows.push_back(columns);
+  }
+
+  printf("-------------------------------------------------------------------------\n");
+  printf("Hardware counters of the thread launching the ops only, not counting the other %d threads.\n",
+         flags_->num_threads_ - 1);
+  for (size_t i = 0; i < title.size(); i++) {
+    auto printBuf = title[i];
+    columnLenMax.at(i) = std::max(columnLenMax.at(i), printBuf.size());
+    printBuf.resize(columnLenMax.at(i), ' ');
+    printf("%s\t", printBuf.c_str());
+  }
+  printf("\n");
+  for (auto &row : rows) {
+    for (size_t j = 0; j < row.size(); j++) {
+      auto printBuf = row[j];
+      printBuf.resize(columnLenMax.at(j), ' ');
+      printf("%s\t", printBuf.c_str());
+    }
+    printf("\n");
+  }
+  return RET_OK;
+}
 #endif
 
 #ifdef SUPPORT_NNIE
@@ -88,16 +88,23 @@ constexpr auto kInputOutput = "input_output";
 constexpr auto kKernels = "kernels";
 }  // namespace dump
 
-#ifdef ENABLE_ARM64
+#if defined(ENABLE_ARM64) || (defined(__linux__) && defined(__x86_64__))
+#define BENCHMARK_PERF_EVENT
+#endif
+
+#ifdef BENCHMARK_PERF_EVENT
+// BOUND reads cycles, instructions, cache misses and branch misses together, the other events read two counters.
+constexpr int kPerfEventMaxNum = 4;
 struct PerfResult {
   int64_t nr;
   struct {
     int64_t value;
     int64_t id;
-  } values[2];
+  } values[kPerfEventMaxNum];
 };
 struct PerfCount {
-  int64_t value[2];
+  int64_t value[kPerfEventMaxNum];
+  uint64_t time_us;
 };
 #endif
 
@@ -133,7 +140,8 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
     AddFlag(&BenchmarkFlags::time_profiling_, "timeProfiling", "Run time profiling", false);
     AddFlag(&BenchmarkFlags::perf_profiling_, "perfProfiling",
             "Perf event profiling(only instructions statics enabled currently)", false);
-    AddFlag(&BenchmarkFlags::perf_event_, "perfEvent", "CYCLE|CACHE|STALL", "CYCLE");
+    AddFlag(&BenchmarkFlags::perf_event_, "perfEvent",
+            "CYCLE|CACHE|STALL|BOUND, BOUND reports IPC and memory bandwidth per op type", "CYCLE");
     // MarkAccuracy
     AddFlag(&BenchmarkFlags::benchmark_data_file_, "benchmarkDataFile", "Benchmark data file path", "");
     AddFlag(&BenchmarkFlags::benchmark_data_type_, "benchmarkDataType",
@@ -255,9 +263,11 @@ class MS_API BenchmarkBase {
 
   int PrintResult(const std::vector<std::string> &title, const std::map<std::string, std::pair<int, float>> &result);
 
-#ifdef ENABLE_ARM64
+#ifdef BENCHMARK_PERF_EVENT
   int PrintPerfResult(const std::vector<std::string> &title,
                       const std::map<std::string, std::pair<int, struct PerfCount>> &result);
+
+  int PrintPerfBoundResult(const std::map<std::string, std::pair<int, struct PerfCount>> &result);
 #endif
 
   // tensorData need to be converter first
@@ -508,9 +518,11 @@ class MS_API BenchmarkBase {
   nlohmann::json dump_cfg_json_;
 #endif
   std::string dump_file_output_dir_;
-#ifdef ENABLE_ARM64
+#ifdef BENCHMARK_PERF_EVENT
   int perf_fd = 0;
-  int perf_fd2 = 0;
+  // all the events of the group led by perf_fd, they are closed with the benchmark
+  std::vector<int> perf_fds_;
+  int perf_event_num_ = 0;
   float op_cost2_total_ = 0.0f;
   std::map<std::string, std::pair<int, struct PerfCount>> op_perf_by_type_;
   std::map<std::string, std::pair<int, struct PerfCount>> op_perf_by_name_;
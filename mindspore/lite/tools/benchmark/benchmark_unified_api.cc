@@ -26,7 +26,7 @@
 #include "src/common/common.h"
 #include "src/tensor.h"
 #include "tools/common/string_util.h"
-#ifdef ENABLE_ARM64
+#ifdef BENCHMARK_PERF_EVENT
 #include <linux/perf_event.h>
 #include <sys/ioctl.h>
 #include <asm/unistd.h>
@@ -864,9 +864,11 @@ int BenchmarkUnifiedApi::MarkPerformance() {
     const std::vector<std::string> per_op_type = {"opType", "avg(ms)", "percent", "calledTimes", "opTotalTime"};
     (void)PrintResult(per_op_name, op_times_by_name_);
     (void)PrintResult(per_op_type, op_times_by_type_);
-#ifdef ENABLE_ARM64
+#ifdef BENCHMARK_PERF_EVENT
   } else if (flags_->perf_profiling_) {
-    if (flags_->perf_event_ == "CACHE") {
+    if (flags_->perf_event_ == "BOUND") {
+      (void)PrintPerfBoundResult(op_perf_by_type_);
+    } else if (flags_->perf_event_ == "CACHE") {
       const std::vector<std::string> per_op_name = {"opName", "cache ref(k)", "cache ref(%)", "miss(k)", "miss(%)"};
       const std::vector<std::string> per_op_type = {"opType", "cache ref(k)", "cache ref(%)", "miss(k)", "miss(%)"};
       (void)PrintPerfResult(per_op_name, op_perf_by_name_);
@@ -1393,52 +1395,52 @@ int BenchmarkUnifiedApi::InitTimeProfilingCallbackParameter() {
 }
 
 int BenchmarkUnifiedApi::InitPerfProfilingCallbackParameter() {
-#ifndef ENABLE_ARM64
-  MS_LOG(ERROR) << "Only support perf_profiling on arm64.";
+#ifndef BENCHMARK_PERF_EVENT
+  MS_LOG(ERROR) << "Only support perf_profiling on arm64 and x86_64 linux.";
   return RET_ERROR;
 #else
-  struct perf_event_attr pe, pe2;
-  memset(&pe, 0, sizeof(struct perf_event_attr));
-  memset(&pe2, 0, sizeof(struct perf_event_attr));
-  pe.type = PERF_TYPE_HARDWARE;
-  pe2.type = PERF_TYPE_HARDWARE;
-  pe.size = sizeof(struct perf_event_attr);
-  pe2.size = sizeof(struct perf_event_attr);
-  pe.disabled = 1;
-  pe2.disabled = 1;
-  pe.exclude_kernel = 1;   // don't count kernel
-  pe2.exclude_kernel = 1;  // don't count kernel
-  pe.exclude_hv = 1;       // don't count hypervisor
-  pe2.exclude_hv = 1;      // don't count hypervisor
-  pe.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
-  pe2.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
-  if (flags_->perf_event_ == "CACHE") {
-    pe.config = PERF_COUNT_HW_CACHE_REFERENCES;
-    pe2.config = PERF_COUNT_HW_CACHE_MISSES;
+  std::vector<uint64_t> configs;
+  if (flags_->perf_event_ == "BOUND") {
+    configs = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+               PERF_COUNT_HW_BRANCH_MISSES};
+  } else if (flags_->perf_event_ == "CACHE") {
+    configs = {PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES};
   } else if (flags_->perf_event_ == "STALL") {
-    pe.config = PERF_COUNT_HW_STALLED_CYCLES_FRONTEND;
-    pe2.config = PERF_COUNT_HW_STALLED_CYCLES_BACKEND;
+    configs = {PERF_COUNT_HW_STALLED_CYCLES_FRONTEND, PERF_COUNT_HW_STALLED_CYCLES_BACKEND};
   } else {
-    pe.config = PERF_COUNT_HW_CPU_CYCLES;
-    pe2.config = PERF_COUNT_HW_INSTRUCTIONS;
-  }
-  perf_fd = syscall(__NR_perf_event_open, pe, 0, -1, -1, 0);
-  if (perf_fd == -1) {
-    MS_LOG(ERROR) << "Failed to open perf event " << pe.config;
-    return RET_ERROR;
-  }
-  perf_fd2 = syscall(__NR_perf_event_open, pe2, 0, -1, perf_fd, 0);
-  if (perf_fd2 == -1) {
-    MS_LOG(ERROR) << "Failed to open perf event " << pe2.config;
-    return RET_ERROR;
+    configs = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS};
+  }
+  // the first event leads the group, so that all counters are enabled, disabled and read together
+  for (size_t i = 0; i < configs.size(); i++) {
+    struct perf_event_attr pe;
+    memset(&pe, 0, sizeof(struct perf_event_attr));
+    pe.type = PERF_TYPE_HARDWARE;
+    pe.size = sizeof(struct perf_event_attr);
+    pe.disabled = 1;
+    pe.exclude_kernel = 1;  // don't count kernel
+    pe.exclude_hv = 1;      // don't count hypervisor
+    pe.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+    pe.config = configs[i];
+    auto fd = static_cast<int>(syscall(__NR_perf_event_open, &pe, 0, -1, i == 0 ? -1 : perf_fd, 0));
+    if (fd == -1) {
+      MS_LOG(ERROR) << "Failed to open perf event " << pe.config;
+      for (auto opened_fd : perf_fds_) {
+        (void)close(opened_fd);
+      }
+      perf_fds_.clear();
+      return RET_ERROR;
+    }
+    if (i == 0) {
+      perf_fd = fd;
+    }
+    perf_fds_.push_back(fd);
   }
-  struct PerfCount zero;
-  zero.value[0] = 0;
-  zero.value[1] = 0;
+  perf_event_num_ = static_cast<int>(configs.size());
+  struct PerfCount zero = {};
   // before callback
-  ms_before_call_back_ = [&](const std::vector<mindspore::MSTensor> &before_inputs,
-                             const std::vector<mindspore::MSTensor> &before_outputs,
-                             const MSCallBackParam &call_param) {
+  ms_before_call_back_ = [&, zero](const std::vector<mindspore::MSTensor> &before_inputs,
+                                   const std::vector<mindspore::MSTensor> &before_outputs,
+                                   const MSCallBackParam &call_param) {
     if (before_inputs.empty()) {
       MS_LOG(INFO) << "The num of beforeInputs is empty";
     }
@@ -1453,6 +1455,7 @@ int BenchmarkUnifiedApi::InitPerfProfilingCallbackParameter() {
     }
 
     op_call_times_total_++;
+    op_begin_ = GetTimeUs();
     ioctl(perf_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
     ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
     return true;
@@ -1463,6 +1466,7 @@ int BenchmarkUnifiedApi::InitPerfProfilingCallbackParameter() {
                             const std::vector<mindspore::MSTensor> &after_outputs, const MSCallBackParam &call_param) {
     struct PerfResult res;
     ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    auto op_time = GetTimeUs() - op_begin_;
     if (read(perf_fd, &res, sizeof(struct PerfResult)) == -1) {
       MS_LOG(ERROR) << "Failed to read perf_fd";
       return false;
@@ -1474,16 +1478,18 @@ int BenchmarkUnifiedApi::InitPerfProfilingCallbackParameter() {
     if (after_outputs.empty()) {
       MS_LOG(INFO) << "The num of after outputs is empty";
     }
-    float cost1 = static_cast<float>(res.values[0].value);
-    float cost2 = static_cast<float>(res.values[1].value);
-    op_cost_total_ += cost1;
-    op_cost2_total_ += cost2;
-    op_perf_by_type_[call_param.node_type].first++;
-    op_perf_by_type_[call_param.node_type].second.value[0] += cost1;
-    op_perf_by_type_[call_param.node_type].second.value[1] += cost2;
-    op_perf_by_name_[call_param.node_name].first++;
-    op_perf_by_name_[call_param.node_name].second.value[0] += cost1;
-    op_perf_by_name_[call_param.node_name].second.value[1] += cost2;
+    op_cost_total_ += static_cast<float>(res.values[0].value);
+    op_cost2_total_ += static_cast<float>(res.values[1].value);
+    auto &perf_by_type = op_perf_by_type_[call_param.node_type];
+    auto &perf_by_name = op_perf_by_name_[call_param.node_name];
+    perf_by_type.first++;
+    perf_by_name.first++;
+    for (int i = 0; i < perf_event_num_; i++) {
+      perf_by_type.second.value[i] += res.values[i].value;
+      perf_by_name.second.value[i] += res.values[i].value;
+    }
+    perf_by_type.second.time_us += op_time;
+    perf_by_name.second.time_us += op_time;
     return true;
   };
 #endif
@@ -1640,6 +1646,12 @@ int BenchmarkUnifiedApi::InitDumpTensorDataCallbackParameter() {
 }
 
 BenchmarkUnifiedApi::~BenchmarkUnifiedApi() {
+#ifdef BENCHMARK_PERF_EVENT
+  for (auto fd : perf_fds_) {
+    (void)close(fd);
+  }
+  perf_fds_.clear();
+#endif
 #ifdef PARALLEL_INFERENCE
   for (auto tensor : ms_inputs_for_api_) {
     auto data = tensor.MutableData();
@@ -72,6 +72,8 @@ constexpr auto kModelFile = "modelFile";
 constexpr auto kOutputFile = "outputFile";
 constexpr auto kWeightFile = "weightFile";
 constexpr auto kFp16 = "fp16";
+constexpr auto kWeightBf16 = "weightBf16";
+constexpr auto kWeightSparsity = "weightSparsity";
 constexpr auto kInputshape = "inputShape";
 constexpr auto kInputDataFormat = "inputDataFormat";
 constexpr auto kEncryptKey = "encryptKey";
@@ -108,6 +110,10 @@ STATUS StoreConverterParameters(const std::shared_ptr<ConverterPara> &param) {
   std::stringstream weight_fp16_ss;
   weight_fp16_ss << std::boolalpha << param->weight_fp16;
   conver_param_maps[mindspore::converter::KConverterParam][kFp16] = weight_fp16_ss.str();
+  std::stringstream weight_bf16_ss;
+  weight_bf16_ss << std::boolalpha << param->weight_bf16;
+  conver_param_maps[mindspore::converter::KConverterParam][kWeightBf16] = weight_bf16_ss.str();
+  conver_param_maps[mindspore::converter::KConverterParam][kWeightSparsity] = param->weight_sparsity;
   conver_param_maps[mindspore::converter::KConverterParam][kInputshape] = param_input_shape;
   conver_param_maps[mindspore::converter::KConverterParam][kInputDataFormat] = std::to_string(param->input_format);
   conver_param_maps[mindspore::converter::KConverterParam][kEncryptKey] = param->encrypt_key;
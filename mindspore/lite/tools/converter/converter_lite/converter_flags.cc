@@ -49,6 +49,15 @@ Flags::Flags() {
   AddFlag(&Flags::saveFP16Str, "fp16",
           "Serialize const tensor in Float16 data type, only effective for const tensor in Float32 data type. on | off",
           "off");
+  AddFlag(&Flags::saveBF16Str, "weightBf16",
+          "Serialize const weight tensor in BFloat16, it is expanded to Float32 at load time and fed to bfloat16 "
+          "matmul kernels on cpus with avx512-bf16. Exclusive with fp16. on | off",
+          "off");
+  AddFlag(&Flags::weightSparsity, "weightSparsity",
+          "Prune the const weight of FullConnection, MatMul with transposed weight and 1x1 Conv2D, and serialize it "
+          "in a sparse layout. nm:N:M keeps the N largest of every M input channels, block:B:R drops the ratio R of "
+          "the blocks of B output channels. Exclusive with fp16 and weightBf16. nm:N:M | block:B:R | off",
+          "off");
   AddFlag(&Flags::trainModelIn, "trainModel",
           "whether the model is going to be trained on device. "
           "true | false",
@@ -217,6 +226,40 @@ int Flags::InitSaveFP16() {
   return RET_OK;
 }
 
+int Flags::InitSaveBF16() {
+  if (saveBF16Str == "on") {
+    saveBF16 = true;
+  } else if (saveBF16Str == "off") {
+    saveBF16 = false;
+  } else {
+    std::cerr << "Init weight_bf16 failed." << std::endl;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (saveBF16 && saveFP16) {
+    std::cerr << "fp16 and weightBf16 can not be both on." << std::endl;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  return RET_OK;
+}
+
+int Flags::InitWeightSparsity() {
+  if (weightSparsity == "off") {
+    return RET_OK;
+  }
+  // the values are checked by the sparsity pass of the converter.
+  constexpr size_t kSparsityPartNum = 3;
+  auto parts = lite::SplitStringToVector(weightSparsity, ':');
+  if (parts.size() != kSparsityPartNum || (parts[0] != "nm" && parts[0] != "block")) {
+    std::cerr << "Init weight_sparsity failed." << std::endl;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (saveFP16 || saveBF16) {
+    std::cerr << "weightSparsity can not be used with fp16 or weightBf16." << std::endl;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  return RET_OK;
+}
+
 int Flags::InitPreInference() {
   if (this->inferStr == "true") {
     this->infer = true;
@@ -306,6 +349,18 @@ int Flags::Init(int argc, const char **argv) {
     return RET_INPUT_PARAM_INVALID;
   }
 
+  ret = InitSaveBF16();
+  if (ret != RET_OK) {
+    std::cerr << "Init save bf16 failed." << std::endl;
+    return RET_INPUT_PARAM_INVALID;
+  }
+
+  ret = InitWeightSparsity();
+  if (ret != RET_OK) {
+    std::cerr << "Init weight sparsity failed." << std::endl;
+    return RET_INPUT_PARAM_INVALID;
+  }
+
   ret = InitInputOutputDataType();
   if (ret != RET_OK) {
     std::cerr << "Init input output datatype failed." << std::endl;
@@ -95,6 +95,34 @@ bool Converter::GetWeightFp16() const {
   }
 }
 
+void Converter::SetWeightBf16(bool weight_bf16) {
+  if (data_ != nullptr) {
+    data_->weight_bf16 = weight_bf16;
+  }
+}
+
+bool Converter::GetWeightBf16() const {
+  if (data_ != nullptr) {
+    return data_->weight_bf16;
+  } else {
+    return false;
+  }
+}
+
+void Converter::SetWeightSparsity(const std::vector<char> &sparsity) {
+  if (data_ != nullptr) {
+    data_->weight_sparsity = CharToString(sparsity);
+  }
+}
+
+std::vector<char> Converter::GetWeightSparsityChar() const {
+  std::string sparsity = "off";
+  if (data_ != nullptr) {
+    sparsity = data_->weight_sparsity;
+  }
+  return StringToChar(sparsity);
+}
+
 void Converter::SetInputShape(const std::map<std::vector<char>, std::vector<int64_t>> &input_shape) {
   auto input_shape_str = MapCharToString(input_shape);
   if (data_ != nullptr) {
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tools/converter/legacy_optimizer/graph/convert_fp32_to_bf16_pass.h"
+#include <vector>
+#include "tools/converter/converter_context.h"
+#include "src/common/log_adapter.h"
+#include "tools/common/tensor_util.h"
+#include "include/errorcode.h"
+#include "schema/inner/model_generated.h"
+#include "nnacl/base/cast_base.h"
+#include "src/common/log_util.h"
+
+namespace mindspore {
+namespace lite {
+namespace {
+constexpr size_t kMinWeightDims = 2;
+}  // namespace
+
+// The bfloat16 data keeps the Float32 data type and is marked by the compress type, so that every kernel reads the
+// expanded weight and only the bfloat16 matmul kernels take the packed weight from it. Bias and scalar tensors stay in
+// Float32 since they are small and sensitive to the precision.
+STATUS ConvertFP32ToBF16Pass::Run(schema::MetaGraphT *graph) {
+  if (!need_convert_) {
+    return RET_NO_CHANGE;
+  }
+  CHECK_NULL_RETURN(graph);
+  bool if_changed = false;
+  for (auto &tensor : graph->allTensors) {
+    CHECK_NULL_RETURN(tensor);
+    if (tensor->dataType != kNumberTypeFloat32 || tensor->data.empty() || tensor->dims.size() < kMinWeightDims ||
+        tensor->weightQuantCompressType != schema::WeightQuantCompressType_NONE) {
+      continue;
+    }
+    auto ele_num = lite::GetShapeSize(tensor->dims);
+    if (tensor->data.size() != ele_num * sizeof(float)) {
+      MS_LOG(ERROR) << "Tensor data length error.";
+      ReturnCode::GetSingleReturnCode()->UpdateReturnCode(RET_ERROR);
+      return RET_ERROR;
+    }
+    std::vector<uint8_t> new_data(ele_num * sizeof(uint16_t));
+    auto fp32_data = reinterpret_cast<float *>(tensor->data.data());
+    auto bf16_data = reinterpret_cast<uint16_t *>(new_data.data());
+    for (size_t i = 0; i < ele_num; i++) {
+      bf16_data[i] = Float32ToBFloat16Value(fp32_data[i]);
+    }
+    tensor->data.swap(new_data);
+    tensor->weightQuantCompressType = schema::WeightQuantCompressType_BF16;
+    if_changed = true;
+  }
+  return if_changed ? RET_OK : RET_NO_CHANGE;
+}
+}  // namespace lite
+}  // namespace mindspore
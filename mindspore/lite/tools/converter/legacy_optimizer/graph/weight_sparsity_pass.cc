@@ -0,0 +1,251 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tools/converter/legacy_optimizer/graph/weight_sparsity_pass.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include "tools/converter/converter_context.h"
+#include "src/common/log_adapter.h"
+#include "tools/common/tensor_util.h"
+#include "tools/common/string_util.h"
+#include "include/errorcode.h"
+#include "schema/inner/model_generated.h"
+#include "src/common/log_util.h"
+#include "nnacl/op_base.h"
+
+namespace mindspore {
+namespace lite {
+namespace {
+constexpr auto kOffSparsity = "off";
+constexpr auto kNMSparsity = "nm";
+constexpr auto kBlockSparsity = "block";
+constexpr size_t kSparsityPartNum = 3;
+constexpr size_t kWeightIndex = 1;
+constexpr size_t kMatrixDims = 2;
+constexpr size_t kConvWeightDims = 4;
+constexpr int kMaxNMGroup = 256;  // the index in a group is serialized in uint8.
+constexpr int kMaxSparseBlock = 64;
+
+template <typename T>
+void AppendData(std::vector<uint8_t> *dst, const T *src, size_t num) {
+  auto bytes = reinterpret_cast<const uint8_t *>(src);
+  dst->insert(dst->end(), bytes, bytes + num * sizeof(T));
+}
+
+// Keeps the n largest of every m values of a row. NM_SPARSE is int32 n, int32 m, float values[kept] and
+// uint8 indices[kept], a tail group shorter than m keeps min(n, its length) values.
+std::vector<uint8_t> PruneNM(float *data, int outer, int inner, int n, int m) {
+  std::vector<float> values;
+  std::vector<uint8_t> indices;
+  std::vector<int> order;
+  for (int i = 0; i < outer; ++i) {
+    float *row = data + static_cast<size_t>(i) * inner;
+    for (int start = 0; start < inner; start += m) {
+      int group = std::min(m, inner - start);
+      int kept = std::min(n, group);
+      order.resize(group);
+      std::iota(order.begin(), order.end(), 0);
+      std::partial_sort(order.begin(), order.begin() + kept, order.end(),
+                        [row, start](int l, int r) { return std::fabs(row[start + l]) > std::fabs(row[start + r]); });
+      std::sort(order.begin(), order.begin() + kept);
+      std::vector<float> kept_values(kept);
+      for (int j = 0; j < kept; ++j) {
+        kept_values[j] = row[start + order[j]];
+      }
+      std::fill(row + start, row + start + group, 0.0f);
+      for (int j = 0; j < kept; ++j) {
+        row[start + order[j]] = kept_values[j];
+        values.push_back(kept_values[j]);
+        indices.push_back(static_cast<uint8_t>(order[j]));
+      }
+    }
+  }
+  std::vector<uint8_t> encoded;
+  int32_t header[] = {n, m};
+  AppendData(&encoded, header, C2NUM);
+  AppendData(&encoded, values.data(), values.size());
+  AppendData(&encoded, indices.data(), indices.size());
+  return encoded;
+}
+
+// Drops the ratio of the blocks of `block` rows at one column with the smallest L2 norms. BLOCK_SPARSE is int32 block,
+// int32 nnz, int32 offsets[UP_DIV(outer, block) + 1], int32 indices[nnz] and float values[nnz][block], the rows
+// beyond outer in the last block are zero.
+std::vector<uint8_t> PruneBlock(float *data, int outer, int inner, int block, double ratio) {
+  int block_num = UP_DIV(outer, block);
+  auto value = [data, inner](int r, int k) -> float & { return data[static_cast<size_t>(r) * inner + k]; };
+  std::vector<float> norms(static_cast<size_t>(block_num) * inner, 0.0f);
+  for (int r = 0; r < outer; ++r) {
+    for (int k = 0; k < inner; ++k) {
+      norms[static_cast<size_t>(r / block) * inner + k] += value(r, k) * value(r, k);
+    }
+  }
+  auto drop_num = static_cast<size_t>(ratio * norms.size());
+  std::vector<size_t> order(norms.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::nth_element(order.begin(), order.begin() + drop_num, order.end(),
+                   [&norms](size_t l, size_t r) { return norms[l] < norms[r]; });
+  for (size_t i = 0; i < drop_num; ++i) {
+    int b = static_cast<int>(order[i] / inner);
+    int k = static_cast<int>(order[i] % inner);
+    for (int r = b * block; r < std::min(outer, (b + 1) * block); ++r) {
+      value(r, k) = 0.0f;
+    }
+  }
+
+  std::vector<int32_t> offsets = {0};
+  std::vector<int32_t> indices;
+  std::vector<float> values;
+  for (int b = 0; b < block_num; ++b) {
+    for (int k = 0; k < inner; ++k) {
+      bool non_zero = false;
+      for (int r = b * block; r < std::min(outer, (b + 1) * block); ++r) {
+        non_zero = non_zero || value(r, k) != 0.0f;
+      }
+      if (!non_zero) {
+        continue;
+      }
+      indices.push_back(k);
+      for (int r = b * block; r < (b + 1) * block; ++r) {
+        values.push_back(r < outer ? value(r, k) : 0.0f);
+      }
+    }
+    offsets.push_back(static_cast<int32_t>(indices.size()));
+  }
+  std::vector<uint8_t> encoded;
+  int32_t header[] = {block, static_cast<int32_t>(indices.size())};
+  AppendData(&encoded, header, C2NUM);
+  AppendData(&encoded, offsets.data(), offsets.size());
+  AppendData(&encoded, indices.data(), indices.size());
+  AppendData(&encoded, values.data(), values.size());
+  return encoded;
+}
+
+bool IsOneByOneConv(const schema::Conv2DFusionT &conv) {
+  return conv.group == 1 && conv.kernel_size.size() == kMatrixDims && conv.kernel_size[0] == 1 &&
+         conv.kernel_size[1] == 1;
+}
+}  // namespace
+
+int WeightSparsityPass::ParseSparsity(const std::string &sparsity_str, WeightSparsity *sparsity) {
+  CHECK_NULL_RETURN(sparsity);
+  auto parts = SplitStringToVector(sparsity_str, ':');
+  if (parts.size() != kSparsityPartNum) {
+    MS_LOG(ERROR) << "weight sparsity should be nm:N:M or block:B:R, but got " << sparsity_str;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (parts[0] == kNMSparsity) {
+    sparsity->nm = true;
+    if (!ConvertIntNum(parts[1], &sparsity->n) || !ConvertIntNum(parts[C2NUM], &sparsity->m) || sparsity->n <= 0 ||
+        sparsity->n >= sparsity->m || sparsity->m > kMaxNMGroup) {
+      MS_LOG(ERROR) << "N:M sparsity should satisfy 0 < N < M <= " << kMaxNMGroup << ", but got " << sparsity_str;
+      return RET_INPUT_PARAM_INVALID;
+    }
+    return RET_OK;
+  }
+  if (parts[0] == kBlockSparsity) {
+    sparsity->nm = false;
+    if (!ConvertIntNum(parts[1], &sparsity->block) || !ConvertDoubleNum(parts[C2NUM], &sparsity->ratio) ||
+        sparsity->block <= 0 || sparsity->block > kMaxSparseBlock || sparsity->ratio <= 0 || sparsity->ratio >= 1) {
+      MS_LOG(ERROR) << "block sparsity should satisfy 0 < B <= " << kMaxSparseBlock << " and 0 < R < 1, but got "
+                    << sparsity_str;
+      return RET_INPUT_PARAM_INVALID;
+    }
+    return RET_OK;
+  }
+  MS_LOG(ERROR) << "weight sparsity should be nm:N:M or block:B:R, but got " << sparsity_str;
+  return RET_INPUT_PARAM_INVALID;
+}
+
+std::vector<uint32_t> WeightSparsityPass::GetPrunableWeights(const schema::MetaGraphT &graph) const {
+  std::set<uint32_t> weights;
+  for (auto &node : graph.nodes) {
+    if (node == nullptr || node->primitive == nullptr || node->inputIndex.size() <= kWeightIndex) {
+      continue;
+    }
+    auto weight_index = node->inputIndex[kWeightIndex];
+    if (weight_index >= graph.allTensors.size() || graph.allTensors[weight_index] == nullptr) {
+      continue;
+    }
+    auto &value = node->primitive->value;
+    auto dims_size = graph.allTensors[weight_index]->dims.size();
+    bool prunable = false;
+    if (value.type == schema::PrimitiveType_FullConnection) {
+      prunable = dims_size == kMatrixDims;
+    } else if (value.type == schema::PrimitiveType_MatMulFusion) {
+      prunable = dims_size == kMatrixDims && value.AsMatMulFusion() != nullptr && value.AsMatMulFusion()->transpose_b;
+    } else if (value.type == schema::PrimitiveType_Conv2DFusion) {
+      // the 1x1 weight is [oc][ic] in memory whatever the position of the kernel dims is.
+      auto format = graph.allTensors[weight_index]->format;
+      prunable = dims_size == kConvWeightDims && value.AsConv2DFusion() != nullptr &&
+                 IsOneByOneConv(*value.AsConv2DFusion()) &&
+                 (format == schema::Format_KHWC || format == schema::Format_KCHW || format == schema::Format_NHWC ||
+                  format == schema::Format_NCHW);
+    }
+    if (prunable) {
+      (void)weights.insert(weight_index);
+    }
+  }
+  return std::vector<uint32_t>(weights.begin(), weights.end());
+}
+
+// The pruned weight is expanded to Float32 at load time, and the matmul kernels pick the sparse kernel by the measured
+// density, so the sparsity only changes the size of the model and the kernel selection.
+STATUS WeightSparsityPass::Run(schema::MetaGraphT *graph) {
+  if (sparsity_str_.empty() || sparsity_str_ == kOffSparsity) {
+    return RET_NO_CHANGE;
+  }
+  CHECK_NULL_RETURN(graph);
+  WeightSparsity sparsity;
+  auto ret = ParseSparsity(sparsity_str_, &sparsity);
+  if (ret != RET_OK) {
+    ReturnCode::GetSingleReturnCode()->UpdateReturnCode(ret);
+    return ret;
+  }
+  bool if_changed = false;
+  for (auto index : GetPrunableWeights(*graph)) {
+    auto &tensor = graph->allTensors[index];
+    if (tensor->dataType != kNumberTypeFloat32 || tensor->data.empty() || tensor->dims.empty() ||
+        tensor->weightQuantCompressType != schema::WeightQuantCompressType_NONE) {
+      continue;
+    }
+    auto ele_num = lite::GetShapeSize(tensor->dims);
+    if (tensor->data.size() != ele_num * sizeof(float)) {
+      MS_LOG(ERROR) << "Tensor data length error.";
+      ReturnCode::GetSingleReturnCode()->UpdateReturnCode(RET_ERROR);
+      return RET_ERROR;
+    }
+    int outer = tensor->dims[0];
+    int inner = static_cast<int>(ele_num) / outer;
+    auto data = reinterpret_cast<float *>(tensor->data.data());
+    auto encoded = sparsity.nm ? PruneNM(data, outer, inner, sparsity.n, sparsity.m)
+                               : PruneBlock(data, outer, inner, sparsity.block, sparsity.ratio);
+    if_changed = true;
+    // the pruned weight stays dense when the sparse layout is not smaller.
+    if (encoded.size() >= tensor->data.size()) {
+      MS_LOG(INFO) << "Keep the pruned weight " << tensor->name << " dense.";
+      continue;
+    }
+    tensor->data.swap(encoded);
+    tensor->weightQuantCompressType =
+      sparsity.nm ? schema::WeightQuantCompressType_NM_SPARSE : schema::WeightQuantCompressType_BLOCK_SPARSE;
+  }
+  return if_changed ? RET_OK : RET_NO_CHANGE;
+}
+}  // namespace lite
+}  // namespace mindspore
@@ -0,0 +1,56 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_TOOLS_CONVERTER_LEGACY_OPTIMIZER_GRAPH_WEIGHT_SPARSITY_PASS_H_
+#define MINDSPORE_LITE_TOOLS_CONVERTER_LEGACY_OPTIMIZER_GRAPH_WEIGHT_SPARSITY_PASS_H_
+
+#include <string>
+#include <vector>
+#include "tools/converter/optimizer.h"
+
+namespace mindspore {
+namespace lite {
+struct WeightSparsity {
+  bool nm = true;
+  int n = 0;
+  int m = 0;
+  int block = 0;
+  double ratio = 0;
+};
+
+// Prunes the constant weights of FullConnection, MatMulFusion with the transposed weight and 1x1 Conv2DFusion, which
+// are [oc][ic] matrices in memory, and serializes them in a sparse layout. The sparsity is "nm:N:M" to keep the N
+// largest of every M input channels, or "block:B:R" to drop the ratio R of the blocks of B output channels by the L2
+// norm of the block.
+class WeightSparsityPass : public GraphPass {
+ public:
+  explicit WeightSparsityPass(const std::string &sparsity) : sparsity_str_(sparsity) {}
+
+  ~WeightSparsityPass() override = default;
+
+  STATUS Run(schema::MetaGraphT *graph) override;
+
+  static int ParseSparsity(const std::string &sparsity_str, WeightSparsity *sparsity);
+
+ private:
+  std::vector<uint32_t> GetPrunableWeights(const schema::MetaGraphT &graph) const;
+
+  std::string sparsity_str_;
+};
+}  // namespace lite
+}  // namespace mindspore
+
+#endif  // MINDSPORE_LITE_TOOLS_CONVERTER_LEGACY_OPTIMIZER_GRAPH_WEIGHT_SPARSITY_PASS_H_
@@ -477,13 +477,15 @@ def set_enable_autotune(enable, filepath_prefix=None):
     Note:
         - When `enable` is False, `json_filepath` will be ignored.
         - The JSON file can be loaded by API `mindspore.dataset.deserialize` to build a tuned pipeline.
+        - If the JSON file already exists and is saved by the same pipeline, which is checked by the "fingerprint"
+          field, AutoTune starts from the configuration in it instead of the one of the pipeline.
         - In distributed training scenario, set_enable_autotune() must be called after cluster communication has been
           initialized (mindspore.communication.management.init()), otherwise the AutoTune file will always suffix with
           rank id 0.
 
     An example of the generated JSON file is as follows. "remark" file will conclude that if the dataset has been
     tuned or not. "summary" filed will show the tuned configuration of dataset pipeline. Users can modify scripts
-    based on the tuned result.
+    based on the tuned result. "fingerprint" field identifies the pipeline regardless of its tuned configuration.
 
     .. code-block::
 
@@ -495,6 +497,7 @@ def set_enable_autotune(enable, filepath_prefix=None):
                 "MapOp(ID:3)         (num_parallel_workers: 2, prefetch_size:64)",
                 "BatchOp(ID:2)       (num_parallel_workers: 8, prefetch_size:64)"
             ],
+            "fingerprint": "5c2a1e3b9d7f4a60",
             "tree": {
                 ...
             }
@@ -807,6 +810,14 @@ def set_fast_recovery(fast_recovery):
     Set whether dataset pipeline should recover in fast mode during failover
     (yet with slightly different random augmentations).
 
+    Note:
+        - When the pipeline is reset, a non-mappable source (TFRecord, TextFile, CSV, CLUE and so on) skips the
+          consumed rows by its file offsets without reading them, only if the source is directly followed by the skip.
+        - A shuffle buffer can not be rebuilt without reading the rows in it, so the skip stays above a shuffle or
+          cache operation. As `shuffle` of these sources, such as TFRecordDataset, is Shuffle.GLOBAL by default, which
+          adds a shuffle operation after the source, such a pipeline still reads the consumed rows again on reset. Set
+          `shuffle` to Shuffle.FILES or False to resume without reading them.
+
     Args:
         fast_recovery (bool): Whether the dataset pipeline recovers in fast mode.
 
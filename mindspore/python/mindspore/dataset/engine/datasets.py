@@ -118,6 +118,9 @@ def _reset_training_dataset(step, epoch):
     """
     Reset the training dataset to the given step and epoch number.
 
+    A non-mappable source skips the consumed rows by its file offsets only if no shuffle or cache operation sits
+    between it and the skip, see `mindspore.dataset.config.set_fast_recovery`.
+
     Args:
         step (int): Global step number.
         epoch (int): Global epoch number
@@ -37,8 +37,11 @@ class FileWriter:
     Class to write user defined raw data into MindRecord files.
 
     Note:
-        After the MindRecord file is generated, if the file name is changed,
-        the file may fail to be read.
+        - After the MindRecord file is generated, if the file name is changed,
+          the file may fail to be read.
+        - The MindRecord files are generated in version 3.0 by default. They are generated
+          in version 3.1, which the earlier versions of MindSpore can not read, only after
+          the typed layout is enabled by `set_typed_raw_data` .
 
     Args:
         file_name (str): File name of MindRecord file.
@@ -326,6 +329,34 @@ class FileWriter:
         """
         return self._writer.set_page_size(page_size)
 
+    def set_typed_raw_data(self, enable):
+        """
+        Set whether the raw fields are stored in the typed layout, in which the fields of a sample
+        are packed by their schema types instead of msgpack, so that they are smaller and faster to
+        decode. The values of float32 fields are then stored in float32 precision.
+
+        Note:
+            The MindRecord files written in the typed layout are in version 3.1, which the earlier
+            versions of MindSpore can not read.
+
+        Args:
+           enable (bool): Whether to store the raw fields in the typed layout.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            ParamTypeError: If `enable` is not bool.
+
+        Examples:
+            >>> from mindspore.mindrecord import FileWriter
+            >>> writer = FileWriter(file_name="test.mindrecord", shard_num=1)
+            >>> status = writer.set_typed_raw_data(True)
+        """
+        if not isinstance(enable, bool):
+            raise ParamTypeError('enable', 'bool')
+        return self._writer.set_typed_raw_data(enable)
+
     def commit(self):
         """
         Flush data in memory to disk and generate the corresponding database files.
@@ -365,10 +396,10 @@ class FileWriter:
             if os.path.exists(item):
                 os.chmod(item, stat.S_IRUSR | stat.S_IWUSR)
                 mindrecord_files.append(item)
-            index_file = item + ".db"
-            if os.path.exists(index_file):
-                os.chmod(index_file, stat.S_IRUSR | stat.S_IWUSR)
-                index_files.append(index_file)
+            for index_file in (item + ".db", item + ".idx"):
+                if os.path.exists(index_file):
+                    os.chmod(index_file, stat.S_IRUSR | stat.S_IWUSR)
+                    index_files.append(index_file)
 
         logger.info("The list of mindrecord files created are: {}, and the list of index files are: {}".format(
             mindrecord_files, index_files))
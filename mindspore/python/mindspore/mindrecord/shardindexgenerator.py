@@ -72,3 +72,20 @@ class ShardIndexGenerator:
             logger.critical("Failed to write to database.")
             raise MRMGenerateIndexError
         return ret
+
+    def convert_to_sorted_index(self):
+        """
+        Convert the existing db files to sorted index files, which are loaded instead of the db files
+        when opening the MindRecord files.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            MRMGenerateIndexError: If failed to convert the db files.
+        """
+        ret = self._generator.convert_to_sorted_index()
+        if ret != ms.MSRStatus.SUCCESS:
+            logger.critical("Failed to convert to sorted index.")
+            raise MRMGenerateIndexError
+        return ret
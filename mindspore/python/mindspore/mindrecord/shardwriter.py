@@ -126,6 +126,18 @@ class ShardWriter:
             raise MRMInvalidPageSizeError
         return ret
 
+    def set_typed_raw_data(self, typed_raw_data):
+        """
+        Set whether the raw fields are stored in the typed layout.
+
+        Args:
+           typed_raw_data (bool): Store the raw fields in the typed layout if True.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+        """
+        return self._writer.set_typed_raw_data(typed_raw_data)
+
     def set_shard_header(self, shard_header):
         """
         Set header which contains schema and index before write raw data.
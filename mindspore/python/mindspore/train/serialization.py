@@ -60,6 +60,8 @@ from mindspore.parallel._parallel_serialization import _convert_to_list, _conver
     _restore_group_info_list
 from mindspore.train._utils import read_proto
 from mindspore._c_expression import load_mindir, _encrypt, _decrypt, _is_cipher_file, dynamic_obfuscate_mindir
+from mindspore._c_expression import _save_sharded_checkpoint, _wait_sharded_checkpoint, _load_sharded_checkpoint, \
+    _is_sharded_checkpoint
 from ..ops.operations._opaque_predicate_registry import add_opaque_predicate, clean_funcs
 
 tensor_to_ms_type = {"Int8": mstype.int8, "UInt8": mstype.uint8, "Int16": mstype.int16, "UInt16": mstype.uint16,
@@ -253,7 +255,7 @@ def _exec_save(ckpt_file_name, data_list, enc_key=None, enc_mode="AES-GCM"):
         raise e
 
 
-def _check_save_obj_and_ckpt_file_name(save_obj, ckpt_file_name):
+def _check_save_obj_and_ckpt_file_name(save_obj, ckpt_file_name, sharded=False):
     """Check save_obj and ckpt_file_name for save_checkpoint."""
     if not isinstance(save_obj, nn.Cell) and not isinstance(save_obj, list):
         raise TypeError("For 'save_checkpoint', the parameter 'save_obj' must be nn.Cell or list, "
@@ -263,7 +265,7 @@ def _check_save_obj_and_ckpt_file_name(save_obj, ckpt_file_name):
                         "'ckpt_file_name' must be "
                         "string, but got {}.".format(ckpt_file_name, type(ckpt_file_name)))
     ckpt_file_name = os.path.realpath(ckpt_file_name)
-    if os.path.isdir(ckpt_file_name):
+    if os.path.isdir(ckpt_file_name) and not sharded:
         raise IsADirectoryError("For 'save_checkpoint', the parameter `ckpt_file_name`: {} is a directory, "
                                 "it must be a file name.".format(ckpt_file_name))
     if not ckpt_file_name.endswith('.ckpt'):
@@ -272,7 +274,7 @@ def _check_save_obj_and_ckpt_file_name(save_obj, ckpt_file_name):
 
 
 def save_checkpoint(save_obj, ckpt_file_name, integrated_save=True,
-                    async_save=False, append_dict=None, enc_key=None, enc_mode="AES-GCM"):
+                    async_save=False, append_dict=None, enc_key=None, enc_mode="AES-GCM", shard_size=0):
     """
     Save checkpoint to a specified file.
 
@@ -290,6 +292,11 @@ def save_checkpoint(save_obj, ckpt_file_name, integrated_save=True,
                                       is not required. Default: None.
         enc_mode (str): This parameter is valid only when enc_key is not set to None. Specifies the encryption
                         mode, currently supports 'AES-GCM' and 'AES-CBC' and 'SM4-CBC'. Default: 'AES-GCM'.
+        shard_size (int): If it is greater than 0, the checkpoint is saved as a folder named `ckpt_file_name`, in
+                          which the parameters are packed into shard files of about `shard_size` MB and written
+                          in parallel. With `async_save`, the parameters are copied into staging buffers and the
+                          shard files are written in background. Encryption and string values are not supported
+                          in this format. Default: 0.
 
     Raises:
         TypeError: If the parameter save_obj is not `nn.Cell` or list type. And if the parameter `integrated_save`
@@ -301,7 +308,8 @@ def save_checkpoint(save_obj, ckpt_file_name, integrated_save=True,
         >>> net = Net()
         >>> ms.save_checkpoint(net, "lenet.ckpt")
     """
-    ckpt_file_name = _check_save_obj_and_ckpt_file_name(save_obj, ckpt_file_name)
+    shard_size = Validator.check_non_negative_int(shard_size, "shard_size", "save_checkpoint")
+    ckpt_file_name = _check_save_obj_and_ckpt_file_name(save_obj, ckpt_file_name, shard_size > 0)
     integrated_save = Validator.check_bool(integrated_save)
     async_save = Validator.check_bool(async_save)
     append_dict = _check_append_dict(append_dict)
@@ -321,7 +329,8 @@ def save_checkpoint(save_obj, ckpt_file_name, integrated_save=True,
         param_list = []
         for (key, value) in param_dict.items():
             each_param = {"name": key}
-            param_data = Tensor(value.data.asnumpy())
+            # the sharded save copies the parameters into its own buffers, so they are passed as they are
+            param_data = value.data if shard_size > 0 else Tensor(value.data.asnumpy())
 
             # in automatic model parallel scenario, some parameters were split to all the devices,
             # which should be combined before saving
@@ -340,6 +349,11 @@ def save_checkpoint(save_obj, ckpt_file_name, integrated_save=True,
             append_info_list.append({"name": k_name, "data": value})
             save_obj.extend(append_info_list)
 
+    if shard_size > 0:
+        _exec_save_sharded(ckpt_file_name, save_obj, shard_size, async_save, enc_key)
+        logger.info("Saving checkpoint process is finished.")
+        return
+
     data_list = OrderedDict()
     with _ckpt_mutex:
         for param in save_obj:
@@ -375,6 +389,27 @@ def save_checkpoint(save_obj, ckpt_file_name, integrated_save=True,
     logger.info("Saving checkpoint process is finished.")
 
 
+def _exec_save_sharded(ckpt_dir, save_obj, shard_size, async_save, enc_key):
+    """Save the checkpoint into shard files, which are written by the writer threads of the backend."""
+    if enc_key is not None:
+        raise ValueError("For 'save_checkpoint', encryption is not supported when 'shard_size' is set.")
+    names = []
+    tensors = []
+    for param in save_obj:
+        if isinstance(param["data"], str):
+            raise TypeError(f"For 'save_checkpoint', string value '{param['name']}' is not supported when "
+                            f"'shard_size' is set.")
+        if isinstance(param["data"], Parameter):
+            param["data"].init_data()
+        names.append(param["name"])
+        tensors.append(param["data"])
+    with _ckpt_mutex:
+        if not _save_sharded_checkpoint(ckpt_dir, names, tensors, shard_size * 1024 * 1024, async_save):
+            logger.critical("Failed to save the checkpoint folder %s. Maybe don't have the permission to write "
+                            "files, or the disk space is insufficient and so on.", ckpt_dir)
+            raise RuntimeError(f"For 'save_checkpoint', failed to save the checkpoint folder {ckpt_dir}.")
+
+
 def _check_append_dict(append_dict):
     """Check the argument append_dict for save_checkpoint."""
     if append_dict is None:
@@ -702,6 +737,14 @@ def load_checkpoint(ckpt_file_name, net=None, strict_load=False, filter_prefix=N
     dec_key = Validator.check_isinstance('dec_key', dec_key, (type(None), bytes))
     dec_mode = Validator.check_isinstance('dec_mode', dec_mode, str)
     logger.info("Execute the process of loading checkpoint files.")
+    if os.path.isdir(ckpt_file_name):
+        if dec_key is not None:
+            raise ValueError("For 'load_checkpoint', decryption is not supported for the checkpoint folder "
+                             f"{ckpt_file_name}, because it is saved without encryption.")
+        parameter_dict = _load_sharded_ckpt(ckpt_file_name, specify_prefix, filter_prefix)
+        if net is not None:
+            load_param_into_net(net, parameter_dict, strict_load)
+        return parameter_dict
     checkpoint_list = _parse_ckpt_proto(ckpt_file_name, dec_key, dec_mode)
 
     parameter_dict = {}
@@ -752,6 +795,25 @@ def load_checkpoint(ckpt_file_name, net=None, strict_load=False, filter_prefix=N
     return parameter_dict
 
 
+def _load_sharded_ckpt(ckpt_dir, specify_prefix, filter_prefix):
+    """Load the checkpoint saved into shard files, the shard files are read in parallel by the backend."""
+    # the checkpoint may be being saved asynchronously by this process
+    if not _wait_sharded_checkpoint():
+        logger.warning("The former asynchronous checkpoint save failed.")
+    if not _is_sharded_checkpoint(ckpt_dir):
+        raise ValueError(f"For 'load_checkpoint', the checkpoint folder {ckpt_dir} is incomplete, maybe it is still "
+                         f"being written.")
+    parameter_dict = {}
+    for name, tensor in _load_sharded_checkpoint(ckpt_dir).items():
+        if _whether_load_param(specify_prefix, filter_prefix, name):
+            parameter_dict[name] = Parameter(tensor, name=name)
+    if not parameter_dict:
+        raise ValueError(f"The loaded parameter dict is empty after filter or specify, please check whether "
+                         f"'filter_prefix' or 'specify_prefix' are set correctly.")
+    logger.info("Loading checkpoint files process is finished.")
+    return parameter_dict
+
+
 def _check_ckpt_file_name(ckpt_file_name):
     """Check function load_checkpoint's cket_file_name."""
     if not isinstance(ckpt_file_name, str):
@@ -0,0 +1,77 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""
+Pre-populate the CPU kernel tuning database of a MindIR model.
+
+The Conv2D, Conv3D, MatMul and BatchMatMul CPU kernels are tuned at the first launch and the results are saved in
+the database set by MS_DEV_CPU_KERNEL_TUNE_DB. This tool runs the model once with zero inputs, so the later
+processes using the same database skip the tuning.
+
+Usage:
+    python scripts/tune_cpu_kernel.py --mindir_path net.mindir --db_path tune_db.json \
+        --input_shapes "1,3,224,224" [--input_dtypes float32]
+"""
+import argparse
+import json
+import os
+
+import numpy as np
+
+
+def parse_shapes(shapes_str):
+    """Parse the shapes like '1,3,224,224;1,10' to a list of tuples."""
+    shapes = []
+    for shape_str in shapes_str.split(";"):
+        shape_str = shape_str.strip()
+        shapes.append(tuple(int(dim) for dim in shape_str.split(",")) if shape_str else ())
+    return shapes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pre-populate the CPU kernel tuning database of a MindIR model.")
+    parser.add_argument("--mindir_path", type=str, required=True, help="The MindIR file of the model.")
+    parser.add_argument("--db_path", type=str, required=True, help="The kernel tuning database file.")
+    parser.add_argument("--input_shapes", type=str, required=True,
+                        help="The shapes of the inputs, the dims are separated by ',' and the inputs by ';'.")
+    parser.add_argument("--input_dtypes", type=str, default="",
+                        help="The numpy data types of the inputs separated by ';', float32 by default.")
+    args = parser.parse_args()
+
+    shapes = parse_shapes(args.input_shapes)
+    dtypes = args.input_dtypes.split(";") if args.input_dtypes else ["float32"] * len(shapes)
+    if len(dtypes) != len(shapes):
+        raise ValueError(f"The number of input dtypes {len(dtypes)} is not equal to the number of input shapes "
+                         f"{len(shapes)}.")
+
+    # The database is opened at the first kernel tuning, so set it before importing mindspore.
+    db_path = os.path.realpath(args.db_path)
+    os.environ["MS_DEV_CPU_KERNEL_TUNE_DB"] = db_path
+    import mindspore as ms
+    from mindspore import nn
+
+    ms.set_context(mode=ms.GRAPH_MODE, device_target="CPU")
+    net = nn.GraphCell(ms.load(args.mindir_path))
+    inputs = [ms.Tensor(np.zeros(shape, dtype)) for shape, dtype in zip(shapes, dtypes)]
+    net(*inputs)
+
+    record_num = 0
+    if os.path.exists(db_path):
+        with open(db_path, "r") as f:
+            record_num = len(json.load(f).get("records", {}))
+    print(f"The kernel tuning database {db_path} has {record_num} records.")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,85 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""
+test reading performance of mindrecord files with many small rows of scalar fields, which are dominated by decoding
+the raw fields. Run it with the builds before and after a change of the raw field layout to compare them.
+"""
+import os
+import sys
+import time
+
+import mindspore.dataset as ds
+from mindspore.mindrecord import FileReader, FileWriter
+
+MINDRECORD_FILE = "./scalar.mindrecord"
+ROW_NUM = 1000000
+BATCH_ROW_NUM = 10000
+COLUMNS = ["file_name", "label", "id", "score", "ratio"]
+
+
+def write_mindrecord(row_num):
+    for suffix in ["", ".db"]:
+        if os.path.exists(MINDRECORD_FILE + suffix):
+            os.remove(MINDRECORD_FILE + suffix)
+    schema_json = {"file_name": {"type": "string"},
+                   "label": {"type": "int32"},
+                   "id": {"type": "int64"},
+                   "score": {"type": "float32"},
+                   "ratio": {"type": "float64"}}
+    writer = FileWriter(file_name=MINDRECORD_FILE, shard_num=1, overwrite=True)
+    writer.add_schema(schema_json, "scalar_schema")
+    writer.add_index(["label"])
+    start = time.time()
+    for begin in range(0, row_num, BATCH_ROW_NUM):
+        rows = [{"file_name": "{:08d}.jpg".format(i),
+                 "label": i % 1000,
+                 "id": i,
+                 "score": (i % 100) / 4.0,
+                 "ratio": i / row_num} for i in range(begin, min(begin + BATCH_ROW_NUM, row_num))]
+        writer.write_raw_data(rows)
+    writer.commit()
+    end = time.time()
+    print("Write - total rows: {}, cost time: {:.3f}s, file size: {} bytes".format(
+        row_num, end - start, os.path.getsize(MINDRECORD_FILE)))
+
+
+def use_filereader():
+    start = time.time()
+    reader = FileReader(file_name=MINDRECORD_FILE, num_consumer=4, columns=COLUMNS)
+    num_iter = 0
+    for _ in reader.get_next():
+        num_iter += 1
+    reader.close()
+    end = time.time()
+    print("Read by FileReader - total rows: {}, cost time: {:.3f}s, rows per second: {:.0f}".format(
+        num_iter, end - start, num_iter / (end - start)))
+
+
+def use_minddataset():
+    start = time.time()
+    data_set = ds.MindDataset(dataset_files=MINDRECORD_FILE, columns_list=COLUMNS,
+                              num_parallel_workers=4, shuffle=False)
+    num_iter = 0
+    for _ in data_set.create_tuple_iterator(num_epochs=1, output_numpy=True):
+        num_iter += 1
+    end = time.time()
+    print("Read by MindDataset - total rows: {}, cost time: {:.3f}s, rows per second: {:.0f}".format(
+        num_iter, end - start, num_iter / (end - start)))
+
+
+if __name__ == '__main__':
+    write_mindrecord(int(sys.argv[1]) if len(sys.argv) > 1 else ROW_NUM)
+    use_filereader()
+    use_minddataset()
@@ -0,0 +1,105 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""
+test the open time of mindrecord files with many shards, which is dominated by reading the meta files of the shards.
+Each dataset is opened with the sorted index files (.idx) and with the sqlite meta files (.db) only.
+"""
+import glob
+import os
+import sys
+import time
+
+import mindspore.dataset as ds
+from mindspore.mindrecord import FileReader, FileWriter
+from mindspore.mindrecord.shardindexgenerator import ShardIndexGenerator
+
+MINDRECORD_DIR = "./shards"
+MINDRECORD_FILE = os.path.join(MINDRECORD_DIR, "shards.mindrecord")
+SHARD_NUM = 1000
+ROW_NUM_PER_SHARD = 100
+REPEAT = 5
+
+
+def write_mindrecord(shard_num):
+    os.makedirs(MINDRECORD_DIR, exist_ok=True)
+    for item in glob.glob(MINDRECORD_FILE + "*"):
+        os.remove(item)
+    schema_json = {"file_name": {"type": "string"},
+                   "label": {"type": "int32"},
+                   "data": {"type": "bytes"}}
+    writer = FileWriter(file_name=MINDRECORD_FILE, shard_num=shard_num, overwrite=True)
+    writer.add_schema(schema_json, "shards_schema")
+    writer.add_index(["file_name", "label"])
+    rows = [{"file_name": "{:08d}.jpg".format(i),
+             "label": i % 10,
+             "data": bytes(64)} for i in range(shard_num * ROW_NUM_PER_SHARD)]
+    start = time.time()
+    writer.write_raw_data(rows)
+    writer.commit()
+    end = time.time()
+    print("Write - shards: {}, total rows: {}, cost time: {:.3f}s".format(shard_num, len(rows), end - start))
+
+
+def first_file(shard_num):
+    return MINDRECORD_FILE + ("0" if shard_num > 1 else "")
+
+
+def open_by_filereader(shard_num):
+    start = time.time()
+    for _ in range(REPEAT):
+        reader = FileReader(file_name=first_file(shard_num), num_consumer=4)
+        reader.close()
+    return (time.time() - start) / REPEAT
+
+
+def open_by_minddataset(shard_num):
+    start = time.time()
+    for _ in range(REPEAT):
+        data_set = ds.MindDataset(dataset_files=first_file(shard_num), num_parallel_workers=4, shuffle=False)
+        num_rows = data_set.get_dataset_size()
+    if num_rows != shard_num * ROW_NUM_PER_SHARD:
+        raise RuntimeError("Unexpected number of rows: {}".format(num_rows))
+    return (time.time() - start) / REPEAT
+
+
+def open_by_class(shard_num):
+    sampler = ds.PKSampler(2, class_column="label")
+    start = time.time()
+    for _ in range(REPEAT):
+        data_set = ds.MindDataset(dataset_files=first_file(shard_num), num_parallel_workers=4, sampler=sampler)
+        data_set.get_dataset_size()
+    return (time.time() - start) / REPEAT
+
+
+def benchmark(shard_num):
+    idx_files = glob.glob(MINDRECORD_FILE + "*.idx")
+    mode = "sorted index" if len(idx_files) == shard_num else "meta files"
+    print("Open with {} - FileReader: {:.3f}s, MindDataset: {:.3f}s, MindDataset with PKSampler: {:.3f}s".format(
+        mode, open_by_filereader(shard_num), open_by_minddataset(shard_num), open_by_class(shard_num)))
+
+
+if __name__ == '__main__':
+    num_shards = int(sys.argv[1]) if len(sys.argv) > 1 else SHARD_NUM
+    write_mindrecord(num_shards)
+    benchmark(num_shards)
+
+    for index_file in glob.glob(MINDRECORD_FILE + "*.idx"):
+        os.remove(index_file)
+    benchmark(num_shards)
+
+    convert_start = time.time()
+    ShardIndexGenerator(os.path.realpath(first_file(num_shards))).convert_to_sorted_index()
+    print("Convert - shards: {}, cost time: {:.3f}s".format(num_shards, time.time() - convert_start))
+    benchmark(num_shards)
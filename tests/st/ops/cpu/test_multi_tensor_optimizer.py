@@ -0,0 +1,77 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+import os
+import numpy as np
+import pytest
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.nn import TrainOneStepCell, WithLossCell
+
+context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+
+
+class Net(nn.Cell):
+    def __init__(self):
+        super(Net, self).__init__()
+        self.fc1 = nn.Dense(16, 32, weight_init="ones")
+        self.relu = nn.ReLU()
+        self.fc2 = nn.Dense(32, 10, weight_init="ones")
+
+    def construct(self, x):
+        return self.fc2(self.relu(self.fc1(x)))
+
+
+def train(optimizer_type, fusion):
+    if fusion:
+        os.environ['MS_DEV_CPU_OPTIMIZER_FUSION'] = '1'
+    net = Net()
+    if optimizer_type == "momentum":
+        optimizer = nn.Momentum(net.trainable_params(), learning_rate=0.01, momentum=0.9)
+    elif optimizer_type == "adam":
+        optimizer = nn.Adam(net.trainable_params(), learning_rate=0.01)
+    else:
+        optimizer = nn.AdamWeightDecay(net.trainable_params(), learning_rate=0.01, weight_decay=0.1)
+    criterion = nn.SoftmaxCrossEntropyWithLogits(sparse=True, reduction='mean')
+    train_network = TrainOneStepCell(WithLossCell(net, criterion), optimizer)
+    train_network.set_train()
+    data = Tensor(np.arange(0, 64).reshape(4, 16).astype(np.float32) * 0.01)
+    label = Tensor(np.array([0, 1, 2, 3]).astype(np.int32))
+    losses = []
+    try:
+        for _ in range(5):
+            losses.append(train_network(data, label).asnumpy())
+    finally:
+        os.environ.pop('MS_DEV_CPU_OPTIMIZER_FUSION', None)
+    return losses, [param.asnumpy() for param in net.trainable_params()]
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize("optimizer_type", ["momentum", "adam", "adam_weight_decay"])
+def test_multi_tensor_optimizer(optimizer_type):
+    """
+    Feature: Fuse the optimizer nodes of all the parameters to one MultiTensorOptimizer node on CPU.
+    Description: Train the net with and without the fusion.
+    Expectation: The losses and the parameters are the same.
+    """
+    expect_losses, expect_params = train(optimizer_type, False)
+    losses, params = train(optimizer_type, True)
+    assert np.allclose(losses, expect_losses, 1e-5, 1e-5)
+    for param, expect_param in zip(params, expect_params):
+        assert np.allclose(param, expect_param, 1e-5, 1e-5)
@@ -12,6 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import os
 import time
 import numpy as np
 import pytest
@@ -190,3 +191,38 @@ def test_concurrent_with_while():
     net = NetConcurrentWithWhile()
     expect = np.array([202, 202])
     run_multi_actor_fusion("concurrent_with_while", net, input1, input_loop1, input2, input_loop2, expect)
+
+
+class NetSmallOps(nn.Cell):
+    def __init__(self):
+        super().__init__()
+        self.relu = ops.ReLU()
+        self.add = ops.Add()
+        self.mul = ops.Mul()
+
+    def construct(self, input_x1, input_x2, input_x3, input_x4):
+        outputs = [self.relu(input_x1), self.relu(input_x2), self.relu(input_x3), self.relu(input_x4)]
+        for _ in range(20):
+            for i in range(4):
+                outputs[i] = self.mul(self.add(outputs[i], 1), 1)
+            shared = outputs[0] + outputs[3]
+            outputs[1] = outputs[1] + shared - shared
+        return outputs[0] + outputs[1] + outputs[2] + outputs[3]
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_cost_based_actor_fusion():
+    """
+    Feature: Cost based actor fusion.
+    Description: Run the net with many small ops with the structure and the cost based actor fusion.
+    Expectation: The outputs are the same, and the average time of both modes are printed.
+    """
+    input_x = Tensor(np.ones(2), mindspore.float32)
+    expect = np.array([84, 84])
+    os.environ['MS_DEV_ACTOR_FUSION_MODE'] = ''
+    run_multi_actor_fusion("small_ops_structure_fusion", NetSmallOps(), input_x, input_x, input_x, input_x, expect)
+    os.environ['MS_DEV_ACTOR_FUSION_MODE'] = 'cost'
+    run_multi_actor_fusion("small_ops_cost_fusion", NetSmallOps(), input_x, input_x, input_x, input_x, expect)
+    del os.environ['MS_DEV_ACTOR_FUSION_MODE']
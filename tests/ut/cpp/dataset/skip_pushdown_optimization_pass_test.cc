@@ -666,3 +666,36 @@ TEST_F(MindDataSkipPushdownTestOptimizationPass, SkipPushdownCombineOperations4)
                   ->Rename({"col1"}, {"fake_label"});
   EXPECT_OK(prepare_trees(root, root_target, 0));
 }
+
+/// Feature: MindData Skip Pushdown Optimization Pass Test
+/// Description: Test MindData Skip Pushdown Optimization Pass with TextFile and TFRecord reading multiple files by
+/// multiple workers, where the skip of the reset is done by the offsets of the files
+/// Expectation: The rows after the reset are the same as the rows after Skip
+TEST_F(MindDataSkipPushdownTestOptimizationPass, SkipPushdownNonMappableSourceNodeMultiWorkers) {
+  MS_LOG(INFO) << "Doing MindDataSkipPushdownTestOptimizationPass-SkipPushdownNonMappableSourceNodeMultiWorkers.";
+  std::vector<std::string> text_files = {datasets_root_path_ + "/testTextFileDataset/1.txt",
+                                         datasets_root_path_ + "/testTextFileDataset/2.txt"};
+  std::vector<std::string> tf_files = {datasets_root_path_ + "/tf_file_dataset/test1.data",
+                                       datasets_root_path_ + "/tf_file_dataset/test2.data",
+                                       datasets_root_path_ + "/tf_file_dataset/test3.data"};
+
+  std::shared_ptr<Dataset> root;
+  std::shared_ptr<Dataset> root_target;
+
+  for (int64_t step : {1, 3, 5}) {
+    root = TextFile(text_files, 0, ShuffleMode::kFalse)->SetNumWorkers(3);
+    root_target = TextFile(text_files, 0, ShuffleMode::kFalse)->SetNumWorkers(3)->Skip(step);
+    EXPECT_OK(prepare_trees(root, root_target, step));
+  }
+
+  for (int64_t step : {1, 7, 25}) {
+    // equal rows per shard gives the offsets of the files, otherwise the skipped rows are read and dropped
+    for (bool shard_equal_rows : {true, false}) {
+      root = TFRecord(tf_files, "", {"scalars"}, 0, ShuffleMode::kFalse, 1, 0, shard_equal_rows)->SetNumWorkers(2);
+      root_target = TFRecord(tf_files, "", {"scalars"}, 0, ShuffleMode::kFalse, 1, 0, shard_equal_rows)
+                      ->SetNumWorkers(2)
+                      ->Skip(step);
+      EXPECT_OK(prepare_trees(root, root_target, step));
+    }
+  }
+}
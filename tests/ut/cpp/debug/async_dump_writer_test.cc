@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <vector>
+#include "common/common_test.h"
+#include "debug/data_dump/async_dump_writer.h"
+
+namespace mindspore {
+class TestAsyncDumpWriter : public UT::Common {
+ public:
+  TestAsyncDumpWriter() {}
+  void TearDown() override { AsyncDumpWriter::GetInstance().Finalize(); }
+};
+
+/// Feature: Async dump writer.
+/// Description: submit tensors to several writer threads.
+/// Expectation: every task sees a snapshot of the data as it was at submit time.
+TEST_F(TestAsyncDumpWriter, test_snapshot) {
+  auto &writer = AsyncDumpWriter::GetInstance();
+  writer.Init(2, 1024, false);
+  ASSERT_TRUE(writer.enabled());
+  const int task_num = 16;
+  std::vector<int> data(32);
+  std::atomic<int> sum{0};
+  for (int i = 0; i < task_num; i++) {
+    std::fill(data.begin(), data.end(), i);
+    ASSERT_TRUE(writer.Submit(data.data(), data.size() * sizeof(int), [&sum](const AsyncDumpWriter::Buffer &buffer) {
+      auto values = reinterpret_cast<const int *>(buffer.data());
+      sum += std::accumulate(values, values + buffer.size() / sizeof(int), 0);
+    }));
+  }
+  writer.Sync();
+  ASSERT_EQ(sum, static_cast<int>(data.size()) * task_num * (task_num - 1) / 2);
+}
+
+/// Feature: Async dump writer.
+/// Description: fill the staging pool while the writer is blocked, with drop_when_full set.
+/// Expectation: tasks beyond the pool size are dropped and counted, the queued ones are still written.
+TEST_F(TestAsyncDumpWriter, test_drop_when_full) {
+  auto &writer = AsyncDumpWriter::GetInstance();
+  writer.Init(1, 64, true);
+  std::promise<void> release;
+  auto blocked = release.get_future().share();
+  std::atomic<int> written{0};
+  std::vector<uint8_t> data(32);
+  auto task = [blocked, &written](const AsyncDumpWriter::Buffer &) {
+    blocked.wait();
+    ++written;
+  };
+  ASSERT_TRUE(writer.Submit(data.data(), data.size(), task));
+  ASSERT_TRUE(writer.Submit(data.data(), data.size(), task));
+  ASSERT_FALSE(writer.Submit(data.data(), data.size(), task));
+  ASSERT_EQ(writer.dropped_num(), 1);
+  release.set_value();
+  writer.Sync();
+  ASSERT_EQ(written, 2);
+}
+
+/// Feature: Async dump writer.
+/// Description: fill the staging pool while the writer is blocked, without drop_when_full.
+/// Expectation: the producer waits for space instead of dropping.
+TEST_F(TestAsyncDumpWriter, test_backpressure) {
+  auto &writer = AsyncDumpWriter::GetInstance();
+  writer.Init(1, 64, false);
+  std::promise<void> release;
+  auto blocked = release.get_future().share();
+  std::atomic<int> written{0};
+  auto task = [blocked, &written]() {
+    blocked.wait();
+    ++written;
+  };
+  ASSERT_TRUE(writer.Submit(64, task));
+  auto producer = std::async(std::launch::async, [&writer, &task]() { return writer.Submit(64, task); });
+  ASSERT_EQ(producer.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+  release.set_value();
+  ASSERT_TRUE(producer.get());
+  writer.Sync();
+  ASSERT_EQ(written, 2);
+  ASSERT_EQ(writer.dropped_num(), 0);
+}
+}  // namespace mindspore
@@ -18,6 +18,8 @@
 #include <map>
 #include "common/common_test.h"
 #include "runtime/device/memory_scheduler.h"
+#include "runtime/device/memory_offload_strategy.h"
+#include "runtime/device/auto_mem_offload.h"
 namespace mindspore::device {
 constexpr size_t kDeviceMemSize = 5;
 constexpr size_t kMaxVirtualCount = 1024;
@@ -283,4 +285,93 @@ scheduler->Optimize();
 // run
 Run(scheduler);
 }
+/// Feature: MemOffloadStrategy
+/// Description: Plan the offload with the compute time and the simulated transfer bandwidth
+/// Expectation: The swap in is planned before the use, the swaps on the compute stream add to the estimated step time,
+/// and the step time estimated with a copy stream only grows when the bandwidth is too low to be covered
+TEST_F(TestMemScheduler, test_offload_strategy_prefetch) {
+  // Tensor 0 of size 3 is used in step 0 and 7, tensor 1~3 of size 2 are used in step 1~3.
+  constexpr size_t kTotalStep = 8;
+  std::vector<uint8_t> tensor_keys(4, 0);
+  std::map<const void *, MemPriority> mem_priority;
+  std::map<const void *, MemEventPtrList<const void *>> mem_events;
+  std::set<const void *> manual_offload_keys;
+  auto add_event = [&mem_events](const void *key, MemEventType type, size_t index, size_t mem_size) {
+    auto event = std::make_shared<MemEvent<const void *>>(type, index);
+    event->key = key;
+    event->mem_size = mem_size;
+    mem_events[key].emplace_back(event);
+  };
+  add_event(tensor_keys.data(), kMalloc, 0, 3);
+  add_event(tensor_keys.data(), kGet, 0, 3);
+  add_event(tensor_keys.data(), kGet, 7, 3);
+  for (size_t i = 1; i < tensor_keys.size(); ++i) {
+    add_event(tensor_keys.data() + i, kMalloc, i, 2);
+    add_event(tensor_keys.data() + i, kGet, i, 2);
+  }
+  auto plan = [&](size_t mem_size, double bandwidth) {
+    auto strategy = std::make_shared<MemOffloadStrategy<const void *>>(
+      mem_priority, mem_events, manual_offload_keys, kTotalStep,
+      std::make_shared<ContinuousMemInfoHelper<const void *>>());
+    strategy->set_mem_size(mem_size);
+    strategy->SetComputeTime(std::vector<double>(kTotalStep, 10));
+    strategy->set_transfer_bandwidth(bandwidth);
+    strategy->Execute();
+    return strategy;
+  };
+
+  // Enough memory, no swap.
+  auto no_swap = plan(kDeviceMemSize, 0.12);
+  ASSERT_FALSE(no_swap->need_swap());
+  ASSERT_EQ(no_swap->peak_mem_used(), 5);
+  ASSERT_EQ(no_swap->estimated_step_time(), 80);
+  ASSERT_EQ(no_swap->estimated_overlapped_step_time(), 80);
+
+  // The swap in of tensor 0 is planned before step 4, where the compute of step 4~6 could cover the transfer on a copy
+  // stream. On the compute stream the swap out and the swap in add to the step.
+  auto fast_swap = plan(4, 0.12);
+  ASSERT_TRUE(fast_swap->need_swap());
+  ASSERT_EQ(fast_swap->mem_used_without_swap(), 5);
+  ASSERT_EQ(fast_swap->peak_mem_used(), 3);
+  ASSERT_EQ(fast_swap->prefetch_count(), 1);
+  ASSERT_EQ(fast_swap->GetPreComputeEvents(4).size(), 1);
+  ASSERT_EQ(fast_swap->GetPreComputeEvents(4)[0]->type, kSwapIn);
+  ASSERT_DOUBLE_EQ(fast_swap->estimated_step_time(), 80 + 2 * 3 / 0.12);
+  ASSERT_EQ(fast_swap->estimated_overlapped_step_time(), 80);
+
+  // The low bandwidth can not be covered by the compute even on a copy stream.
+  auto slow_swap = plan(4, 0.03);
+  ASSERT_EQ(slow_swap->prefetch_count(), 1);
+  ASSERT_DOUBLE_EQ(slow_swap->estimated_step_time(), 80 + 2 * 3 / 0.03);
+  ASSERT_GT(slow_swap->estimated_overlapped_step_time(), fast_swap->estimated_overlapped_step_time());
+
+  // Without the bandwidth nothing is prefetched or estimated.
+  auto no_bandwidth = plan(4, 0);
+  ASSERT_TRUE(no_bandwidth->need_swap());
+  ASSERT_EQ(no_bandwidth->prefetch_count(), 0);
+  ASSERT_EQ(no_bandwidth->estimated_step_time(), 0);
+}
+
+/// Feature: OffloadedMemPool
+/// Description: Malloc host memory beyond the host memory limit with the file tier
+/// Expectation: The memory beyond the limit is mapped from file and can be reused after free
+TEST_F(TestMemScheduler, test_offloaded_mem_pool_file_tier) {
+  OffloadedMemPool mem_pool;
+  mem_pool.SetFileTier(".", 16);
+  auto host_ptr = mem_pool.MallocHost(8);
+  ASSERT_NE(host_ptr, nullptr);
+  ASSERT_FALSE(mem_pool.IsFileMem(host_ptr));
+  auto file_ptr = mem_pool.MallocHost(16);
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_TRUE(mem_pool.IsFileMem(file_ptr));
+  ASSERT_EQ(mem_pool.host_mem_size(), 8);
+  ASSERT_EQ(mem_pool.file_mem_size(), 16);
+  static_cast<uint8_t *>(file_ptr)[15] = 1;
+  mem_pool.FreeHost(file_ptr);
+  auto reused_ptr = mem_pool.MallocHost(16);
+  ASSERT_EQ(reused_ptr, file_ptr);
+  ASSERT_EQ(static_cast<uint8_t *>(reused_ptr)[15], 1);
+  mem_pool.FreeHost(reused_ptr);
+  mem_pool.FreeHost(host_ptr);
+}
 }  // namespace mindspore::device
\ No newline at end of file
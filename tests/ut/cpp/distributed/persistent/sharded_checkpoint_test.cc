@@ -0,0 +1,118 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/common_test.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "distributed/persistent/storage/sharded_checkpoint.h"
+#include "distributed/persistent/storage/constants.h"
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+class TestShardedCheckpoint : public UT::Common {
+ public:
+  TestShardedCheckpoint() = default;
+  virtual ~TestShardedCheckpoint() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+
+ protected:
+  std::vector<std::string> names_ = {"conv.weight", "fc.weight", "fc.bias", "global_step"};
+
+  std::vector<tensor::TensorPtr> CreateTensors() {
+    std::vector<tensor::TensorPtr> tensors = {
+      std::make_shared<tensor::Tensor>(kNumberTypeFloat32, ShapeVector{16, 3, 3, 3}),
+      std::make_shared<tensor::Tensor>(kNumberTypeFloat16, ShapeVector{1000, 37}),
+      std::make_shared<tensor::Tensor>(kNumberTypeFloat32, ShapeVector{37}),
+      std::make_shared<tensor::Tensor>(kNumberTypeInt32, ShapeVector{})};
+    for (size_t i = 0; i < tensors.size(); ++i) {
+      auto data = static_cast<uint8_t *>(tensors[i]->data_c());
+      for (ssize_t j = 0; j < tensors[i]->data().nbytes(); ++j) {
+        data[j] = static_cast<uint8_t>(i * 31 + j);
+      }
+    }
+    return tensors;
+  }
+
+  void CheckLoaded(const std::string &dir, const std::vector<tensor::TensorPtr> &expected) {
+    std::map<std::string, tensor::TensorPtr> loaded;
+    ASSERT_TRUE(ShardedCheckpoint::Load(dir, &loaded));
+    ASSERT_EQ(loaded.size(), names_.size());
+    for (size_t i = 0; i < names_.size(); ++i) {
+      auto tensor = loaded[names_[i]];
+      ASSERT_NE(tensor, nullptr);
+      EXPECT_EQ(tensor->data_type(), expected[i]->data_type());
+      EXPECT_EQ(tensor->shape(), expected[i]->shape());
+      ASSERT_EQ(tensor->data().nbytes(), expected[i]->data().nbytes());
+      EXPECT_EQ(memcmp(tensor->data_c(), expected[i]->data_c(), tensor->data().nbytes()), 0);
+    }
+  }
+};
+
+/// Feature: Sharded checkpoint.
+/// Description: save tensors into shards smaller than some of the tensors, then load them.
+/// Expectation: every tensor is loaded with its type, shape and data.
+TEST_F(TestShardedCheckpoint, test_save_and_load) {
+  std::string dir = "./sharded_checkpoint_sync";
+  auto tensors = CreateTensors();
+  ASSERT_TRUE(ShardedCheckpoint::GetInstance().Save(dir, names_, tensors, 1024, false));
+  EXPECT_TRUE(ShardedCheckpoint::IsShardedCheckpoint(dir));
+  CheckLoaded(dir, tensors);
+}
+
+/// Feature: Sharded checkpoint.
+/// Description: save asynchronously and modify the tensors before the shards are written.
+/// Expectation: the checkpoint holds the tensors as they were when the save returned.
+TEST_F(TestShardedCheckpoint, test_async_save_snapshot) {
+  std::string dir = "./sharded_checkpoint_async";
+  auto tensors = CreateTensors();
+  ASSERT_TRUE(ShardedCheckpoint::GetInstance().Save(dir, names_, tensors, 4096, true));
+  auto expected = CreateTensors();
+  for (auto &tensor : tensors) {
+    (void)memset(tensor->data_c(), 0, tensor->data().nbytes());
+  }
+  ASSERT_TRUE(ShardedCheckpoint::GetInstance().Wait());
+  CheckLoaded(dir, expected);
+}
+
+/// Feature: Sharded checkpoint.
+/// Description: modify a shard file after it is saved.
+/// Expectation: the sha256 check of the shard fails and the checkpoint is not loaded.
+TEST_F(TestShardedCheckpoint, test_tampered_shard) {
+  std::string dir = "./sharded_checkpoint_tampered";
+  auto tensors = CreateTensors();
+  ASSERT_TRUE(ShardedCheckpoint::GetInstance().Save(dir, names_, tensors, 1024, false));
+  std::string shard_file = dir + "/" + kBlockFilePrefix + "0";
+  ChangeFileMode(shard_file, S_IRUSR | S_IWUSR);
+  FILE *file = fopen(shard_file.c_str(), "r+b");
+  ASSERT_NE(file, nullptr);
+  (void)fputc(0x5a, file);
+  (void)fclose(file);
+  std::map<std::string, tensor::TensorPtr> loaded;
+  EXPECT_FALSE(ShardedCheckpoint::Load(dir, &loaded));
+}
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
@@ -18,8 +18,10 @@
 #include <sys/types.h>
 #include <dirent.h>
 #include <atomic>
+#include <chrono>
 #include <string>
 #include <thread>
+#include <vector>
 #include <csignal>
 
 #include <gtest/gtest.h>
@@ -35,7 +37,7 @@ namespace rpc {
 int g_recv_num = 0;
 int g_exit_msg_num = 0;
 
-static size_t g_data_msg_num = 0;
+static std::atomic<size_t> g_data_msg_num(0);
 
 static void Init() { g_data_msg_num = 0; }
 
@@ -329,6 +331,228 @@ TEST_F(TCPTest, SendLargeMessages) {
   server->Finalize();
 }
 
+/// Feature: test sending messages from many clients to a multi-reactor tcp server.
+/// Description: start a socket server with several receiving event loops and send messages from several clients.
+/// Expectation: the server received all the messages sented from these clients.
+TEST_F(TCPTest, SendMessagesFromManyClients) {
+  Init();
+
+  // Start the tcp server with 4 receiving event loops.
+  size_t recv_event_loop_num = 4;
+  std::unique_ptr<TCPServer> server = std::make_unique<TCPServer>(false, recv_event_loop_num);
+  bool ret = server->Initialize();
+  ASSERT_TRUE(ret);
+
+  server->SetMessageHandler([](MessageBase *const message) -> MessageBase *const {
+    IncrDataMsgNum(1);
+    delete message;
+    return NULL_MSG;
+  });
+
+  auto ip = server->GetIP();
+  auto port = server->GetPort();
+  auto server_url = ip + ":" + std::to_string(port);
+  auto client_url = "127.0.0.1:1234";
+
+  // Start the tcp clients, each of them owns one connection to the server.
+  size_t client_cnt = 8;
+  std::vector<std::unique_ptr<TCPClient>> clients;
+  for (size_t i = 0; i < client_cnt; ++i) {
+    auto client = std::make_unique<TCPClient>();
+    ret = client->Initialize();
+    ASSERT_TRUE(ret);
+    ASSERT_TRUE(client->Connect(server_url));
+    clients.push_back(std::move(client));
+  }
+
+  // Send the messages.
+  size_t msg_cnt_per_client = 200;
+  for (size_t i = 0; i < msg_cnt_per_client; ++i) {
+    for (auto &client : clients) {
+      client->SendAsync(CreateMessage(server_url, client_url, 1024));
+    }
+  }
+
+  // Wait timeout: 30s
+  size_t msg_cnt = client_cnt * msg_cnt_per_client;
+  WaitForDataMsg(msg_cnt, 30);
+
+  // Check result
+  EXPECT_EQ(msg_cnt, GetDataMsgNum());
+
+  // Destroy
+  for (auto &client : clients) {
+    client->Disconnect(server_url);
+    client->Finalize();
+  }
+  server->Finalize();
+}
+
+/// Feature: test replying messages from a multi-reactor tcp server.
+/// Description: start a socket server with several receiving event loops whose message handler returns a reply, and
+/// request from several clients concurrently.
+/// Expectation: every client receives the replies of all its requests.
+TEST_F(TCPTest, ReplyMessagesFromManyClients) {
+  Init();
+
+  // Start the tcp server with 4 receiving event loops.
+  size_t recv_event_loop_num = 4;
+  std::unique_ptr<TCPServer> server = std::make_unique<TCPServer>(false, recv_event_loop_num);
+  bool ret = server->Initialize();
+  ASSERT_TRUE(ret);
+
+  auto ip = server->GetIP();
+  auto port = server->GetPort();
+  auto server_url = ip + ":" + std::to_string(port);
+  auto client_url = "127.0.0.1:1234";
+
+  // The reply is sent back through the connection the request came from.
+  server->SetMessageHandler([this, server_url, client_url](MessageBase *const message) -> MessageBase *const {
+    IncrDataMsgNum(1);
+    delete message;
+    return CreateMessage(client_url, server_url).release();
+  });
+
+  size_t client_cnt = 4;
+  std::vector<std::unique_ptr<TCPClient>> clients;
+  for (size_t i = 0; i < client_cnt; ++i) {
+    auto client = std::make_unique<TCPClient>();
+    ret = client->Initialize();
+    ASSERT_TRUE(ret);
+    ASSERT_TRUE(client->Connect(server_url));
+    clients.push_back(std::move(client));
+  }
+
+  // Each client requests from its own thread.
+  size_t msg_cnt_per_client = 50;
+  std::atomic<size_t> reply_cnt(0);
+  std::vector<std::thread> threads;
+  for (auto &client : clients) {
+    threads.emplace_back([&, client_ptr = client.get()]() {
+      for (size_t i = 0; i < msg_cnt_per_client; ++i) {
+        auto reply = client_ptr->ReceiveSync(CreateMessage(server_url, client_url), 30);
+        if (reply == NULL_MSG) {
+          return;
+        }
+        ++reply_cnt;
+        delete reply;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // Check result
+  EXPECT_EQ(client_cnt * msg_cnt_per_client, reply_cnt.load());
+  EXPECT_EQ(client_cnt * msg_cnt_per_client, GetDataMsgNum());
+
+  // Destroy
+  for (auto &client : clients) {
+    client->Disconnect(server_url);
+    client->Finalize();
+  }
+  server->Finalize();
+}
+
+/// Feature: test the throughput of receiving messages from many clients.
+/// Description: send the same messages from many clients to tcp servers with one and with several receiving event
+/// loops, whose message handler costs some cpu time like deserializing the message.
+/// Expectation: both servers receive all the messages, and the throughput of them is logged for comparison.
+TEST_F(TCPTest, ReceiveThroughputFromManyClients) {
+  size_t client_cnt = 16;
+  size_t msg_cnt_per_client = 200;
+  size_t msg_size = 4096;
+  for (size_t recv_event_loop_num : {1, 4}) {
+    Init();
+    std::unique_ptr<TCPServer> server = std::make_unique<TCPServer>(false, recv_event_loop_num);
+    bool ret = server->Initialize();
+    ASSERT_TRUE(ret);
+
+    server->SetMessageHandler([](MessageBase *const message) -> MessageBase *const {
+      // Checksum the body to simulate the handling cost of a message.
+      size_t checksum = 0;
+      for (const auto c : message->body) {
+        checksum = checksum * 31 + static_cast<size_t>(c);
+      }
+      IncrDataMsgNum(checksum == 0 ? 0 : 1);
+      delete message;
+      return NULL_MSG;
+    });
+
+    auto server_url = server->GetIP() + ":" + std::to_string(server->GetPort());
+    auto client_url = "127.0.0.1:1234";
+    std::vector<std::unique_ptr<TCPClient>> clients;
+    for (size_t i = 0; i < client_cnt; ++i) {
+      auto client = std::make_unique<TCPClient>();
+      ret = client->Initialize();
+      ASSERT_TRUE(ret);
+      ASSERT_TRUE(client->Connect(server_url));
+      clients.push_back(std::move(client));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < msg_cnt_per_client; ++i) {
+      for (auto &client : clients) {
+        client->SendAsync(CreateMessage(server_url, client_url, msg_size));
+      }
+    }
+    size_t msg_cnt = client_cnt * msg_cnt_per_client;
+    WaitForDataMsg(msg_cnt, 60);
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(msg_cnt, GetDataMsgNum());
+    MS_LOG(WARNING) << "Received " << msg_cnt << " messages of " << msg_size << " bytes from " << client_cnt
+                    << " clients with " << recv_event_loop_num << " receiving event loops in " << cost
+                    << "s, throughput: " << (cost > 0 ? msg_cnt / cost : 0) << " messages/s.";
+
+    for (auto &client : clients) {
+      client->Disconnect(server_url);
+      client->Finalize();
+    }
+    server->Finalize();
+  }
+}
+
+/// Feature: test disconnecting in the message handler.
+/// Description: the message handler of the client disconnects the connection which the handled message comes from.
+/// Expectation: the deleted connection is not accessed after the message handler returns, and the client is
+/// disconnected.
+TEST_F(TCPTest, DisconnectInMessageHandler) {
+  Init();
+
+  std::unique_ptr<TCPServer> server = std::make_unique<TCPServer>();
+  bool ret = server->Initialize();
+  ASSERT_TRUE(ret);
+  auto server_url = server->GetIP() + ":" + std::to_string(server->GetPort());
+  auto client_url = "127.0.0.1:1234";
+  server->SetMessageHandler([this, server_url, client_url](MessageBase *const message) -> MessageBase *const {
+    delete message;
+    return CreateMessage(client_url, server_url).release();
+  });
+
+  auto client = std::make_unique<TCPClient>();
+  ret = client->Initialize();
+  ASSERT_TRUE(ret);
+  auto client_comm = client->tcp_comm_.get();
+  client_comm->SetMessageHandler([client_comm, server_url](MessageBase *const message) -> MessageBase *const {
+    delete message;
+    (void)client_comm->Disconnect(server_url);
+    IncrDataMsgNum(1);
+    return NULL_MSG;
+  });
+  ASSERT_TRUE(client->Connect(server_url));
+  client->SendAsync(CreateMessage(server_url, client_url));
+
+  // Wait timeout: 10s
+  WaitForDataMsg(1, 10);
+  EXPECT_EQ(1, GetDataMsgNum());
+  EXPECT_FALSE(client->IsConnected(server_url));
+
+  client->Finalize();
+  server->Finalize();
+}
+
 /// Feature: test delete invalid tcp connection used in connection pool in tcp client when some socket error happened.
 /// Description: start a socket server and tcp client pair and stop the tcp server.
 /// Expectation: the connection from the tcp client to the tcp server will be deleted automatically.
@@ -0,0 +1,127 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "plugin/device/cpu/kernel/mkldnn/mkl_tuning_db.h"
+
+namespace mindspore {
+namespace kernel {
+class MKLTuningDBTest : public UT::Common {
+ public:
+  MKLTuningDBTest() : db_path_("./mkl_tuning_db_test_" + std::to_string(getpid()) + ".json") {}
+
+  void SetUp() override { (void)std::remove(db_path_.c_str()); }
+  void TearDown() override {
+    (void)std::remove(db_path_.c_str());
+    (void)std::remove((db_path_ + ".lock").c_str());
+  }
+
+  std::string db_path_;
+};
+
+/// Feature: Kernel tuning database.
+/// Description: Build the key of a kernel.
+/// Expectation: The key contains the operator name, the shapes and the extra information in order.
+TEST_F(MKLTuningDBTest, build_key) {
+  auto key = MKLTuningDB::BuildKey("Conv2D", {{1, 3, 224, 224}, {64, 3, 7, 7}, {}}, "f32");
+  ASSERT_EQ(key, "Conv2D|1,3,224,224|64,3,7,7||f32");
+}
+
+/// Feature: Kernel tuning database.
+/// Description: Update the records in one database and load them by another database of the same file.
+/// Expectation: The records are persistent and the records of both databases are merged when saving.
+TEST_F(MKLTuningDBTest, persist_and_merge) {
+  MKLTuningDB first_db(db_path_);
+  ASSERT_TRUE(first_db.enabled());
+  MKLTuningRecord record;
+  ASSERT_FALSE(first_db.Find("conv", &record));
+  first_db.Update("conv", {"winograd", 8, 12.5});
+
+  MKLTuningDB second_db(db_path_);
+  ASSERT_TRUE(second_db.Find("conv", &record));
+  ASSERT_EQ(record.algorithm, "winograd");
+  ASSERT_EQ(record.thread_num, 8);
+  ASSERT_DOUBLE_EQ(record.cost_us, 12.5);
+  second_db.Update("matmul", {"matmul", 4, 3.0});
+
+  first_db.Update("conv", {"direct", 16, 10.0});
+  MKLTuningDB third_db(db_path_);
+  ASSERT_EQ(third_db.size(), 2);
+  ASSERT_TRUE(third_db.Find("conv", &record));
+  ASSERT_EQ(record.algorithm, "direct");
+  ASSERT_TRUE(third_db.Find("matmul", &record));
+  ASSERT_EQ(record.thread_num, 4);
+}
+
+/// Feature: Kernel tuning database.
+/// Description: Update different records of the same file in several processes at the same time.
+/// Expectation: The updates are serialized by the lock file, so no record is lost.
+TEST_F(MKLTuningDBTest, concurrent_processes) {
+  constexpr int kProcessNum = 4;
+  constexpr int kRecordNum = 20;
+  std::vector<pid_t> pids;
+  for (int i = 0; i < kProcessNum; ++i) {
+    auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+      MKLTuningDB db(db_path_);
+      for (int j = 0; j < kRecordNum; ++j) {
+        db.Update("conv_" + std::to_string(i) + "_" + std::to_string(j), {"direct", 1, 1.0});
+      }
+      _exit(0);
+    }
+    pids.push_back(pid);
+  }
+  for (auto pid : pids) {
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+  }
+  MKLTuningDB db(db_path_);
+  ASSERT_EQ(db.size(), kProcessNum * kRecordNum);
+}
+
+/// Feature: Kernel tuning database.
+/// Description: Load a database file which is not valid json.
+/// Expectation: The records are ignored and the file is rewritten by the next update.
+TEST_F(MKLTuningDBTest, invalid_file) {
+  {
+    std::ofstream ofs(db_path_);
+    ofs << "{invalid";
+  }
+  MKLTuningDB db(db_path_);
+  ASSERT_EQ(db.size(), 0);
+  db.Update("conv", {"direct", 0, 1.0});
+  MKLTuningDB reload_db(db_path_);
+  ASSERT_EQ(reload_db.size(), 1);
+}
+
+/// Feature: Kernel tuning database.
+/// Description: Create the database with an empty path.
+/// Expectation: The database is disabled and the update is ignored.
+TEST_F(MKLTuningDBTest, disabled) {
+  MKLTuningDB db("");
+  ASSERT_FALSE(db.enabled());
+  db.Update("conv", {"direct", 0, 1.0});
+  ASSERT_EQ(db.size(), 0);
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,208 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "include/common/utils/utils.h"
+#include "ops/base_operator.h"
+#define private public
+#define protected public
+#include "plugin/device/cpu/kernel/multi_tensor_optimizer_cpu_kernel.h"
+#undef private
+#undef protected
+
+namespace mindspore {
+namespace kernel {
+class MultiTensorOptimizerCpuKernelTest : public UT::Common {
+ public:
+  MultiTensorOptimizerCpuKernelTest() : optimizer_(std::make_shared<MultiTensorOptimizerCpuKernelMod>()) {}
+
+  void InitKernel(const std::string &optimizer_type, size_t input_num_per_param, size_t grad_index,
+                  const std::vector<size_t> &elem_nums) {
+    optimizer_->kernel_name_ = "MultiTensorOptimizerTest";
+    optimizer_->optimizer_type_ = optimizer_type;
+    optimizer_->param_num_ = elem_nums.size();
+    optimizer_->input_num_per_param_ = input_num_per_param;
+    optimizer_->grad_index_ = grad_index;
+    optimizer_->elem_nums_ = elem_nums;
+    optimizer_->InitChunks();
+    if (optimizer_->grad_accumulation_steps_ > 1) {
+      for (auto elem_num : elem_nums) {
+        optimizer_->accumulated_grads_.emplace_back(elem_num, 0.0f);
+      }
+    }
+  }
+
+  // Add an input filled with the value, and return the data of the input.
+  std::vector<float> *AddInput(size_t elem_num, float value) {
+    auto data = std::make_shared<std::vector<float>>(elem_num, value);
+    datas_.push_back(data);
+    auto address = std::make_shared<Address>();
+    address->addr = data->data();
+    address->size = elem_num * sizeof(float);
+    inputs_.push_back(address);
+    return data.get();
+  }
+
+  void Launch() {
+    auto address = std::make_shared<Address>();
+    address->addr = &global_norm_;
+    address->size = sizeof(float);
+    ASSERT_TRUE(optimizer_->Launch(inputs_, {}, {address}));
+  }
+
+  std::shared_ptr<MultiTensorOptimizerCpuKernelMod> optimizer_;
+  std::vector<std::shared_ptr<std::vector<float>>> datas_;
+  std::vector<AddressPtr> inputs_;
+  float global_norm_{-1.0f};
+};
+
+/// Feature: MultiTensorOptimizer
+/// Description: Update two parameters by Adam in one launch
+/// Expectation: The parameters are the same as the ones updated by Adam separately
+TEST_F(MultiTensorOptimizerCpuKernelTest, compute_adam) {
+  constexpr float lr = 0.01;
+  constexpr float beta1 = 0.9;
+  constexpr float beta2 = 0.999;
+  constexpr float epsilon = 1e-8;
+  constexpr float grad = 0.5;
+  std::vector<size_t> elem_nums = {20, 3};
+  std::vector<std::vector<float> *> vars;
+  for (auto elem_num : elem_nums) {
+    vars.push_back(AddInput(elem_num, 1.0f));
+    AddInput(elem_num, 0.0f);
+    AddInput(elem_num, 0.0f);
+    AddInput(1, beta1);
+    AddInput(1, beta2);
+    AddInput(1, lr);
+    AddInput(1, beta1);
+    AddInput(1, beta2);
+    AddInput(1, epsilon);
+    AddInput(elem_num, grad);
+  }
+  InitKernel("Adam", 10, 9, elem_nums);
+  Launch();
+
+  float m = (1 - beta1) * grad;
+  float v = (1 - beta2) * grad * grad;
+  float new_lr = lr * std::sqrt(1 - beta2) / (1 - beta1);
+  float expect = 1.0f - new_lr * m / (std::sqrt(v) + epsilon);
+  for (auto var : vars) {
+    for (auto value : *var) {
+      EXPECT_NEAR(value, expect, 1e-6);
+    }
+  }
+  EXPECT_EQ(global_norm_, 0.0f);
+}
+
+/// Feature: MultiTensorOptimizer
+/// Description: Update two parameters by AdamWeightDecay with the gradients clipped by the global norm
+/// Expectation: The gradients are scaled to the clip norm before the update
+TEST_F(MultiTensorOptimizerCpuKernelTest, compute_adam_weight_decay_with_clip) {
+  constexpr float lr = 0.01;
+  constexpr float beta1 = 0.9;
+  constexpr float beta2 = 0.999;
+  constexpr float epsilon = 1e-6;
+  constexpr float decay = 0.1;
+  constexpr float grad = 1.0;
+  constexpr float clip_norm = 1.0;
+  std::vector<size_t> elem_nums = {17, 3};
+  std::vector<std::vector<float> *> vars;
+  for (auto elem_num : elem_nums) {
+    vars.push_back(AddInput(elem_num, 1.0f));
+    AddInput(elem_num, 0.0f);
+    AddInput(elem_num, 0.0f);
+    AddInput(1, lr);
+    AddInput(1, beta1);
+    AddInput(1, beta2);
+    AddInput(1, epsilon);
+    AddInput(1, decay);
+    AddInput(elem_num, grad);
+  }
+  optimizer_->clip_global_norm_ = clip_norm;
+  InitKernel("AdamWeightDecay", 9, 8, elem_nums);
+  Launch();
+
+  float norm = std::sqrt(20.0f) * grad;
+  EXPECT_NEAR(global_norm_, norm, 1e-5);
+  float clipped_grad = grad * clip_norm / norm;
+  float m = (1 - beta1) * clipped_grad;
+  float v = (1 - beta2) * clipped_grad * clipped_grad;
+  float expect = 1.0f - lr * (m / (std::sqrt(v) + epsilon) + decay);
+  for (auto var : vars) {
+    for (auto value : *var) {
+      EXPECT_NEAR(value, expect, 1e-5);
+    }
+  }
+}
+
+/// Feature: MultiTensorOptimizer
+/// Description: Update two parameters by ApplyMomentum with the gradients accumulated for two steps
+/// Expectation: The parameters are updated by the mean gradient only in the second step
+TEST_F(MultiTensorOptimizerCpuKernelTest, compute_momentum_with_accumulation) {
+  constexpr float lr = 0.1;
+  constexpr float momentum = 0.9;
+  std::vector<size_t> elem_nums = {5, 40000};
+  std::vector<std::vector<float> *> vars;
+  std::vector<std::vector<float> *> grads;
+  for (auto elem_num : elem_nums) {
+    vars.push_back(AddInput(elem_num, 1.0f));
+    AddInput(elem_num, 0.0f);
+    AddInput(1, lr);
+    grads.push_back(AddInput(elem_num, 1.0f));
+    AddInput(1, momentum);
+  }
+  optimizer_->grad_accumulation_steps_ = 2;
+  InitKernel("ApplyMomentum", 5, 3, elem_nums);
+  Launch();
+  for (auto var : vars) {
+    for (auto value : *var) {
+      EXPECT_EQ(value, 1.0f);
+    }
+  }
+
+  for (auto grad : grads) {
+    std::fill(grad->begin(), grad->end(), 3.0f);
+  }
+  Launch();
+  for (auto var : vars) {
+    for (auto value : *var) {
+      EXPECT_NEAR(value, 1.0f - lr * 2.0f, 1e-6);
+    }
+  }
+  for (auto &accumulated_grad : optimizer_->accumulated_grads_) {
+    for (auto value : accumulated_grad) {
+      EXPECT_EQ(value, 0.0f);
+    }
+  }
+}
+
+/// Feature: MultiTensorOptimizer
+/// Description: Init the kernel of Adam with the gradients accumulated for two steps
+/// Expectation: The init fails because the beta powers of Adam can not follow the accumulation
+TEST_F(MultiTensorOptimizerCpuKernelTest, adam_with_accumulation_not_supported) {
+  auto base_operator = std::make_shared<ops::BaseOperator>(kMultiTensorOptimizerOpName);
+  auto prim = base_operator->GetPrim();
+  prim->AddAttr(kAttrN, MakeValue<int64_t>(2));
+  prim->AddAttr(kAttrOptimizerType, MakeValue<std::string>("Adam"));
+  prim->AddAttr(kAttrGradAccumulationSteps, MakeValue<int64_t>(2));
+  EXPECT_FALSE(optimizer_->Init(base_operator, {}, {}));
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,161 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/log_adapter.h"
+#include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_schema.h"
+#include "ut_common.h"
+
+namespace mindspore {
+namespace mindrecord {
+class TestShardColumn : public UT::Common {
+ public:
+  TestShardColumn() {}
+
+  std::shared_ptr<ShardColumn> BuildColumn() {
+    json schema_content = R"({"file_name": {"type": "string"},
+                              "label": {"type": "int32"},
+                              "id": {"type": "int64"},
+                              "score": {"type": "float32"},
+                              "ratio": {"type": "float64"},
+                              "data": {"type": "bytes"},
+                              "mask": {"type": "int32", "shape": [-1]}})"_json;
+    std::shared_ptr<Schema> schema = Schema::Build("test", schema_content);
+    EXPECT_NE(schema, nullptr);
+    return std::make_shared<ShardColumn>(schema->GetSchema());
+  }
+};
+
+TEST_F(TestShardColumn, TestRawRowRoundTrip) {
+  MS_LOG(INFO) << FormatInfo("Test ShardColumn: encode and decode raw row in typed layout");
+
+  auto column = BuildColumn();
+  json row = R"({"file_name": "001.jpg", "label": -3, "id": 1234567890123, "score": 0.5, "ratio": 0.1})"_json;
+  std::vector<uint8_t> bytes;
+  ASSERT_TRUE(column->EncodeRawRow(row, &bytes));
+  ASSERT_EQ(bytes[0], kTypedRawRowMarker);
+  ASSERT_LT(bytes.size(), json::to_msgpack(row).size());
+
+  json decoded;
+  ASSERT_TRUE(column->DecodeRawRow(bytes, {}, &decoded).IsOk());
+  ASSERT_EQ(decoded, row);
+  for (auto &[key, value] : row.items()) {
+    ASSERT_EQ(decoded[key].dump(), value.dump());
+  }
+
+  json selected;
+  ASSERT_TRUE(column->DecodeRawRow(bytes, {"label", "ratio"}, &selected).IsOk());
+  ASSERT_EQ(selected, R"({"label": -3, "ratio": 0.1})"_json);
+
+  bytes.pop_back();
+  ASSERT_FALSE(column->DecodeRawRow(bytes, {}, &decoded).IsOk());
+}
+
+TEST_F(TestShardColumn, TestRawRowFallback) {
+  MS_LOG(INFO) << FormatInfo("Test ShardColumn: raw row not matching schema falls back to msgpack");
+
+  auto column = BuildColumn();
+  std::vector<uint8_t> bytes;
+  // missing field
+  ASSERT_FALSE(column->EncodeRawRow(R"({"file_name": "a", "label": 1, "id": 2, "score": 0.5})"_json, &bytes));
+  // out of int32 range
+  ASSERT_FALSE(column->EncodeRawRow(
+    R"({"file_name": "a", "label": 4294967296, "id": 2, "score": 0.5, "ratio": 0.1})"_json, &bytes));
+  // not a number
+  ASSERT_FALSE(
+    column->EncodeRawRow(R"({"file_name": "a", "label": 1, "id": 2, "score": "0.5", "ratio": 0.1})"_json, &bytes));
+
+  json row = R"({"file_name": "a", "label": 1, "id": 2, "score": 0.1, "ratio": 0.1})"_json;
+  json decoded;
+  ASSERT_TRUE(column->DecodeRawRow(json::to_msgpack(row), {"file_name"}, &decoded).IsOk());
+  ASSERT_EQ(decoded, R"({"file_name": "a"})"_json);
+}
+TEST_F(TestShardColumn, TestRawRowNarrowFloat) {
+  MS_LOG(INFO) << FormatInfo("Test ShardColumn: float values of raw row are narrowed to the column type");
+
+  auto column = BuildColumn();
+  json row = R"({"file_name": "a", "label": 1, "id": 2, "score": 0.1, "ratio": 3})"_json;
+  std::vector<uint8_t> bytes;
+  ASSERT_TRUE(column->EncodeRawRow(row, &bytes));
+
+  json decoded;
+  ASSERT_TRUE(column->DecodeRawRow(bytes, {"score", "ratio"}, &decoded).IsOk());
+  ASSERT_EQ(decoded["score"].get<double>(), static_cast<double>(0.1f));
+  ASSERT_TRUE(decoded["ratio"].is_number_float());
+  ASSERT_EQ(decoded["ratio"].get<double>(), 3.0);
+}
+
+TEST_F(TestShardColumn, TestRawRowLittleEndian) {
+  MS_LOG(INFO) << FormatInfo("Test ShardColumn: numbers of raw row are stored in little-endian");
+
+  auto column = BuildColumn();
+  json row = R"({"file_name": "ab", "label": 258, "id": -2, "score": 1.0, "ratio": 0.5})"_json;
+  std::vector<uint8_t> bytes;
+  ASSERT_TRUE(column->EncodeRawRow(row, &bytes));
+  // marker, then file_name, id, label, ratio and score in the order of the schema json
+  std::vector<uint8_t> expected = {kTypedRawRowMarker,
+                                   0x02, 0x00, 0x00, 0x00, 'a', 'b',
+                                   0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                   0x02, 0x01, 0x00, 0x00,
+                                   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f,
+                                   0x00, 0x00, 0x80, 0x3f};
+  ASSERT_EQ(bytes, expected);
+}
+
+TEST_F(TestShardColumn, TestRawColumnDecode) {
+  MS_LOG(INFO) << FormatInfo("Test ShardColumn: decode a raw column of several rows into one buffer");
+
+  auto column = BuildColumn();
+  std::vector<std::vector<uint8_t>> rows;
+  for (int64_t i = 0; i < 3; i++) {
+    json row = {{"file_name", std::string(i, 'x')}, {"label", -i}, {"id", i}, {"score", 0.5 * i}, {"ratio", 0.1}};
+    std::vector<uint8_t> bytes;
+    ASSERT_TRUE(column->EncodeRawRow(row, &bytes));
+    rows.push_back(std::move(bytes));
+  }
+  // rows stored as msgpack are decoded as well
+  rows.push_back(json::to_msgpack(R"({"file_name": "a", "label": -3, "id": 3, "score": 1.5, "ratio": 0.1})"_json));
+
+  std::unique_ptr<unsigned char[]> data;
+  uint64_t n_bytes = 0;
+  ColumnDataType type = ColumnNoDataType;
+  ASSERT_TRUE(column->DecodeRawColumn(rows, "label", &data, &n_bytes, &type).IsOk());
+  ASSERT_EQ(type, ColumnInt32);
+  ASSERT_EQ(n_bytes, rows.size() * sizeof(int32_t));
+  auto labels = reinterpret_cast<const int32_t *>(data.get());
+  for (int32_t i = 0; i < 4; i++) {
+    ASSERT_EQ(labels[i], -i);
+  }
+
+  ASSERT_TRUE(column->DecodeRawColumn(rows, "score", &data, &n_bytes, &type).IsOk());
+  ASSERT_EQ(type, ColumnFloat32);
+  auto scores = reinterpret_cast<const float *>(data.get());
+  for (int32_t i = 0; i < 4; i++) {
+    ASSERT_EQ(scores[i], 0.5f * i);
+  }
+
+  ASSERT_FALSE(column->DecodeRawColumn(rows, "file_name", &data, &n_bytes, &type).IsOk());
+  ASSERT_FALSE(column->DecodeRawColumn(rows, "mask", &data, &n_bytes, &type).IsOk());
+  rows[1].resize(3);
+  ASSERT_FALSE(column->DecodeRawColumn(rows, "label", &data, &n_bytes, &type).IsOk());
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -188,6 +188,37 @@ TEST_F(TestShardReader, TestShardReaderColumnNotInSchema) {
   EXPECT_FALSE(status.IsOk());
 }
 
+TEST_F(TestShardReader, TestShardReaderRowGroupColumn) {
+  MS_LOG(INFO) << FormatInfo("Test read a raw column of row groups");
+  std::string file_name = "./imagenet.shard01";
+  ShardReader dataset;
+  auto status = dataset.Open({file_name}, true, 4);
+  EXPECT_TRUE(status.IsOk());
+
+  auto row_group_summary = dataset.ReadRowGroupSummary();
+  EXPECT_FALSE(row_group_summary.empty());
+  for (const auto &[shard_id, group_id, start_row, n_rows] : row_group_summary) {
+    std::shared_ptr<ROW_GROUP_BRIEF> row_group_brief;
+    EXPECT_TRUE(dataset.ReadRowGroupBrief(group_id, shard_id, {"label"}, &row_group_brief).IsOk());
+    const auto &labels = std::get<4>(*row_group_brief);
+
+    std::unique_ptr<unsigned char[]> data;
+    uint64_t n_bytes = 0;
+    ColumnDataType column_data_type = ColumnNoDataType;
+    EXPECT_TRUE(dataset.ReadRowGroupColumn(group_id, shard_id, "label", &data, &n_bytes, &column_data_type).IsOk());
+    EXPECT_EQ(column_data_type, ColumnInt32);
+    EXPECT_EQ(n_bytes, n_rows * sizeof(int32_t));
+    ASSERT_EQ(labels.size(), n_rows);
+    auto values = reinterpret_cast<const int32_t *>(data.get());
+    for (uint64_t i = 0; i < n_rows; i++) {
+      EXPECT_EQ(values[i], labels[i]["label"].get<int32_t>());
+    }
+    EXPECT_FALSE(
+      dataset.ReadRowGroupColumn(group_id, shard_id, "file_name", &data, &n_bytes, &column_data_type).IsOk());
+  }
+  dataset.Close();
+}
+
 TEST_F(TestShardReader, TestShardVersion) {
   MS_LOG(INFO) << FormatInfo("Test shard version");
   std::string file_name = "./imagenet.shard01";
@@ -0,0 +1,134 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/log_adapter.h"
+#include "minddata/mindrecord/include/shard_sorted_index.h"
+#include "ut_common.h"
+
+namespace mindspore {
+namespace mindrecord {
+class TestShardSortedIndex : public UT::Common {
+ public:
+  TestShardSortedIndex() {}
+
+  void WriteIndex(const std::string &file) {
+    std::vector<SortedIndexRow> rows;
+    std::vector<std::vector<std::string>> values(2);
+    for (uint64_t i = 0; i < 10; ++i) {
+      rows.push_back({i / 4, i / 4, i * 10, i * 10 + 9, 0, i * 3, i * 3 + 2});
+      values[0].push_back(std::to_string(i % 3));
+      values[1].push_back(i % 2 == 0 ? "dog" : "cat");
+    }
+    ASSERT_TRUE(ShardSortedIndex::Write(file, "test.mindrecord", {"label_0", "name_0"},
+                                        {SortedIndexFieldType::kInteger, SortedIndexFieldType::kText}, rows, values)
+                  .IsOk());
+  }
+};
+
+TEST_F(TestShardSortedIndex, TestWriteAndLoad) {
+  MS_LOG(INFO) << FormatInfo("Test ShardSortedIndex: write, load and query");
+
+  std::string file = "./sorted_index_test.mindrecord";
+  WriteIndex(file);
+  ASSERT_TRUE(ShardSortedIndex::Exists(file));
+
+  std::shared_ptr<ShardSortedIndex> index;
+  ASSERT_TRUE(ShardSortedIndex::Load(file, &index).IsOk());
+  ASSERT_EQ(index->GetShardName(), "test.mindrecord");
+  ASSERT_EQ(index->GetRowCount(), 10);
+  ASSERT_EQ(index->GetRow(7).page_offset_blob, 70);
+  ASSERT_EQ(index->GetRow(7).page_offset_raw_end, 23);
+  ASSERT_EQ(index->GetFieldId("name_0"), 1);
+  ASSERT_EQ(index->GetFieldId("data_0"), -1);
+  ASSERT_EQ(index->GetValue(1, 2), "dog");
+
+  ASSERT_EQ(index->FindRows(0, "1"), (std::vector<uint64_t>{1, 4, 7}));
+  ASSERT_EQ(index->FindRows(1, "cat"), (std::vector<uint64_t>{1, 3, 5, 7, 9}));
+  ASSERT_TRUE(index->FindRows(0, "3").empty());
+
+  std::set<std::string> values;
+  index->GetDistinctValues(0, &values);
+  ASSERT_EQ(values, (std::set<std::string>{"0", "1", "2"}));
+  (void)std::remove((file + kSortedIndexSuffix).c_str());
+}
+
+TEST_F(TestShardSortedIndex, TestNumericFields) {
+  MS_LOG(INFO) << FormatInfo("Test ShardSortedIndex: query numeric fields by number");
+
+  std::string file = "./sorted_index_numeric.mindrecord";
+  std::vector<SortedIndexRow> rows(6);
+  std::vector<std::vector<std::string>> values = {{"10", "9", "-3", "10", "100", "9"},
+                                                  {"0.5", "10.25", "9", "2.5", "0.5", "100"},
+                                                  {"10", "9", "-3", "10", "100", "9"}};
+  ASSERT_TRUE(ShardSortedIndex::Write(
+                file, "test.mindrecord", {"label_0", "score_0", "name_0"},
+                {SortedIndexFieldType::kInteger, SortedIndexFieldType::kReal, SortedIndexFieldType::kText}, rows, values)
+                .IsOk());
+  std::shared_ptr<ShardSortedIndex> index;
+  ASSERT_TRUE(ShardSortedIndex::Load(file, &index).IsOk());
+
+  // "10" sorts after "9" as a number, and a number matches whatever its text is
+  ASSERT_EQ(index->FindRows(0, "10"), (std::vector<uint64_t>{0, 3}));
+  ASSERT_EQ(index->FindRows(0, "10.0"), (std::vector<uint64_t>{0, 3}));
+  ASSERT_EQ(index->FindRows(0, "9"), (std::vector<uint64_t>{1, 5}));
+  ASSERT_TRUE(index->FindRows(0, "9.5").empty());
+  ASSERT_TRUE(index->FindRows(0, "dog").empty());
+  ASSERT_EQ(index->FindRows(1, "1e2"), (std::vector<uint64_t>{5}));
+  ASSERT_EQ(index->FindRows(1, "0.50"), (std::vector<uint64_t>{0, 4}));
+  // a text field is still matched by text
+  ASSERT_TRUE(index->FindRows(2, "10.0").empty());
+  ASSERT_EQ(index->FindRows(2, "10"), (std::vector<uint64_t>{0, 3}));
+
+  std::set<std::string> distinct;
+  index->GetDistinctValues(0, &distinct);
+  ASSERT_EQ(distinct, (std::set<std::string>{"-3", "9", "10", "100"}));
+  (void)std::remove((file + kSortedIndexSuffix).c_str());
+
+  // a numeric field with a value which is not a number is not indexed
+  values[0][1] = "dog";
+  ASSERT_FALSE(ShardSortedIndex::Write(file, "test.mindrecord", {"label_0"}, {SortedIndexFieldType::kInteger}, rows,
+                                       {values[0]})
+                 .IsOk());
+  ASSERT_FALSE(ShardSortedIndex::Exists(file));
+}
+
+TEST_F(TestShardSortedIndex, TestLoadTruncated) {
+  MS_LOG(INFO) << FormatInfo("Test ShardSortedIndex: load truncated index file");
+
+  std::string file = "./sorted_index_truncated.mindrecord";
+  WriteIndex(file);
+  std::string path = file + kSortedIndexSuffix;
+  FILE *fp = fopen(path.c_str(), "r+b");
+  ASSERT_NE(fp, nullptr);
+  (void)fseek(fp, 0, SEEK_END);
+  auto size = ftell(fp);
+  (void)fclose(fp);
+  ASSERT_EQ(truncate(path.c_str(), size - sizeof(uint64_t)), 0);
+
+  std::shared_ptr<ShardSortedIndex> index;
+  ASSERT_FALSE(ShardSortedIndex::Load(file, &index).IsOk());
+  (void)std::remove(path.c_str());
+}
+}  // namespace mindrecord
+}  // namespace mindspore
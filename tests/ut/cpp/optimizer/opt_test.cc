@@ -34,6 +34,7 @@
 #include "frontend/operator/ops.h"
 #include "include/common/utils/cse.h"
 #include "include/common/utils/convert_utils.h"
+#include "utils/ms_context.h"
 
 namespace mindspore {
 namespace opt {
@@ -90,6 +91,16 @@ class TestOptOpt : public UT::Common {
                                              "pynative_no_grad_eliminate", prim::kPrimMakeTuple);
   }
 
+  // Records the nodes on which the substitution is tried.
+  static SubstitutionPtr RecordTriedNodes(const SubstitutionPtr &substitution, std::vector<AnfNodePtr> *tried_nodes) {
+    auto predicate = substitution->predicate_;
+    substitution->predicate_ = [predicate, tried_nodes](const AnfNodePtr &node) {
+      tried_nodes->push_back(node);
+      return predicate(node);
+    };
+    return substitution;
+  }
+
   bool CheckTransform(FuncGraphPtr gbefore, FuncGraphPtr gafter, const SubstitutionList &transform) {
     FuncGraphPtr graph_after_trans = TransformGraph(gbefore, transform);
 
@@ -200,6 +211,39 @@ TEST_F(TestOptOpt, ConstantVariable) {
   ASSERT_TRUE(CheckOpt(before, after, std::vector<SubstitutionPtr>({Qct_to_P})));
 }
 
+/// Feature: substitutions indexed by primitive.
+/// Description: apply a substitution list which mixes substitutions restricted to different primitives.
+/// Expectation: the substitution of the matched primitive is still applied, and a substitution is only tried on the
+/// nodes of its primitive.
+TEST_F(TestOptOpt, PrimitiveIndexedSubstitutions) {
+  FuncGraphPtr before = getPyFun.CallAndParseRet("test_constant_variable", "before_1");
+  FuncGraphPtr after = getPyFun.CallAndParseRet("test_constant_variable", "after");
+
+  ASSERT_TRUE(nullptr != before);
+  ASSERT_TRUE(nullptr != after);
+  // The index is only used when the nodes are traversed first, which is not done in PyNative mode.
+  auto context = MsContext::GetInstance();
+  auto execution_mode = context->get_param<int>(MS_CTX_EXECUTION_MODE);
+  context->set_param<int>(MS_CTX_EXECUTION_MODE, kGraphMode);
+  std::vector<AnfNodePtr> q_tried_nodes;
+  std::vector<AnfNodePtr> r_tried_nodes;
+  auto indexed_Qct_to_P =
+    RecordTriedNodes(MakeSubstitution(std::make_shared<QctToP>(), "Qct_to_P", Q), &q_tried_nodes);
+  auto indexed_elim_R =
+    RecordTriedNodes(MakeSubstitution(std::make_shared<irpass::PrimEliminater>(R), "elim_R", R), &r_tried_nodes);
+  bool is_transformed =
+    CheckOpt(before, after, std::vector<SubstitutionPtr>({elim_Z, indexed_elim_R, indexed_Qct_to_P}));
+  context->set_param<int>(MS_CTX_EXECUTION_MODE, execution_mode);
+
+  ASSERT_TRUE(is_transformed);
+  // No node of R is in the graph, so elim_R is never tried.
+  ASSERT_TRUE(r_tried_nodes.empty());
+  ASSERT_FALSE(q_tried_nodes.empty());
+  for (const auto &node : q_tried_nodes) {
+    ASSERT_TRUE(IsPrimitiveCNode(node, Q));
+  }
+}
+
 TEST_F(TestOptOpt, CSE) {
   // test a simple cse testcase test_f1
   FuncGraphPtr test_graph1 = getPyFun.CallAndParseRet("test_cse", "test_f1");
@@ -18,8 +18,17 @@
 #include "frontend/parallel/auto_parallel/rec_core/rec_tensor.h"
 #include "frontend/parallel/auto_parallel/rec_core/rec_graph.h"
 #include "frontend/parallel/auto_parallel/rec_core/rec_partition.h"
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 #include "ir/value.h"
+#include "include/common/utils/parallel_context.h"
 
 namespace mindspore {
 namespace parallel {
@@ -35,8 +44,52 @@ class TestPartition : public UT::Common {
   void InitNode(std::shared_ptr<Graph> graph, int num_node);
   TensorParam *MakeTensor(int n, int c, int h, int w);
   std::shared_ptr<Graph> MakeMatMulData(int numNode);
+  std::string MakeStrategyCacheDir();
+  std::vector<std::string> ListStrategyCacheFiles() const;
+  void TearDown() override;
+
+ private:
+  std::string cache_dir_;
 };
 
+// The strategy cache files are written into a new temporary directory, which is removed in TearDown.
+std::string TestPartition::MakeStrategyCacheDir() {
+  char dir_template[] = "/tmp/rec_strategy_cache_XXXXXX";
+  auto dir = mkdtemp(dir_template);
+  if (dir == nullptr) {
+    return "";
+  }
+  cache_dir_ = dir;
+  return cache_dir_;
+}
+
+std::vector<std::string> TestPartition::ListStrategyCacheFiles() const {
+  std::vector<std::string> files;
+  DIR *dir = opendir(cache_dir_.c_str());
+  if (dir == nullptr) {
+    return files;
+  }
+  for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name != "." && name != "..") {
+      files.push_back(name);
+    }
+  }
+  (void)closedir(dir);
+  return files;
+}
+
+void TestPartition::TearDown() {
+  ParallelContext::GetInstance()->set_rec_strategy_cache_dir("");
+  if (!cache_dir_.empty()) {
+    for (const auto &file : ListStrategyCacheFiles()) {
+      (void)std::remove((cache_dir_ + "/" + file).c_str());
+    }
+    (void)rmdir(cache_dir_.c_str());
+    cache_dir_.clear();
+  }
+}
+
 // Local function to create test input graph with nodes
 void TestPartition::Create(std::shared_ptr<Graph> graph, int node_num, std::vector<int64_t> edge_head,
                            std::vector<int64_t> edge_tail) {
@@ -221,7 +274,7 @@ TEST_F(TestPartition, test_PartitionNode) {
   std::shared_ptr<Graph> graph = MakeMatMulData(9);
   // node 2 is the first kRecMatMul Operator
   Graph::NodeType node2 = graph->nodes[2];
-  std::vector<std::pair<std::string, StrategyRec>> nameToStrategy;
+  NodeNameToStrategy nameToStrategy;
   StrategyRec str = PartitionNode(node2, nameToStrategy, graph);
   ASSERT_EQ(str.outputTensor.str_h, 0.5);
   ASSERT_EQ(str.outputTensor.str_w, 1);
@@ -239,6 +292,68 @@ TEST_F(TestPartition, test_PartitionForAllDevices2) {
   ASSERT_EQ(PartitionForAllDevices(2, device_memory, graph), SUCCESS);
 }
 
+TEST_F(TestPartition, test_NodeNameToStrategyFind) {
+  NodeNameToStrategy nameToStrategy;
+  StrategyRec str;
+  nameToStrategy.push_back(std::make_pair("N1", str));
+  nameToStrategy.push_back(std::make_pair("N2", str));
+  nameToStrategy.push_back(std::make_pair("N1", str));
+  ASSERT_EQ(nameToStrategy.size(), 3);
+  ASSERT_EQ(nameToStrategy.Find("N1"), std::vector<size_t>({0, 2}));
+  ASSERT_EQ(nameToStrategy.Find("N2"), std::vector<size_t>({1}));
+  ASSERT_TRUE(nameToStrategy.Find("N3").empty());
+}
+
+// The strategies loaded from the cache file are the same as the searched ones.
+TEST_F(TestPartition, test_PartitionForAllDevicesWithStrategyCache) {
+  const std::string cache_dir = MakeStrategyCacheDir();
+  ASSERT_FALSE(cache_dir.empty());
+  ParallelContext::GetInstance()->set_rec_strategy_cache_dir(cache_dir);
+  double device_memory = 1024.0 * 1024.0 * 1024.0 * 16.0;
+  std::shared_ptr<Graph> searched_graph = MakeMatMulData(9);
+  ASSERT_EQ(PartitionForAllDevices(8, device_memory, searched_graph), SUCCESS);
+
+  // The cache file is named after the sha256 signature of the graph.
+  const std::string prefix = "rec_strategy_";
+  const std::string suffix = ".cache";
+  constexpr size_t kSha256HexLen = 64;
+  auto cache_files = ListStrategyCacheFiles();
+  ASSERT_EQ(cache_files.size(), 1);
+  const std::string cache_file = cache_dir + "/" + cache_files[0];
+  ASSERT_EQ(cache_files[0].size(), prefix.size() + kSha256HexLen + suffix.size());
+  ASSERT_EQ(cache_files[0].compare(0, prefix.size(), prefix), 0);
+
+  // Mark the costs of the cached strategies, so the second run is known to be served from the cache.
+  constexpr double kCachedCost = 12345.0;
+  std::ifstream input(cache_file);
+  std::string line;
+  std::ostringstream marked;
+  ASSERT_TRUE(static_cast<bool>(std::getline(input, line)));
+  marked << line << '\n';
+  while (std::getline(input, line)) {
+    marked << line.substr(0, line.rfind(' ') + 1) << kCachedCost << '\n';
+  }
+  input.close();
+  std::ofstream output(cache_file, std::ios::out | std::ios::trunc);
+  output << marked.str();
+  output.close();
+
+  std::shared_ptr<Graph> cached_graph = MakeMatMulData(9);
+  ASSERT_EQ(PartitionForAllDevices(8, device_memory, cached_graph), SUCCESS);
+  ASSERT_EQ(ListStrategyCacheFiles().size(), 1);
+
+  for (size_t i = 0; i < searched_graph->nodes.size(); i++) {
+    if (cached_graph->nodes[i].info == InfoType::kApplication) {
+      ASSERT_EQ(cached_graph->nodes[i].apply.str.cost, kCachedCost);
+    }
+    ASSERT_EQ(searched_graph->nodes[i].tensor_parm.tensor_str.str_h,
+              cached_graph->nodes[i].tensor_parm.tensor_str.str_h);
+    ASSERT_EQ(searched_graph->nodes[i].tensor_parm.tensor_str.str_w,
+              cached_graph->nodes[i].tensor_parm.tensor_str.str_w);
+    ASSERT_EQ(searched_graph->nodes[i].apply.str.cut_counter, cached_graph->nodes[i].apply.str.cut_counter);
+  }
+}
+
 // Negative case: partition on 0 device
 TEST_F(TestPartition, test_PartitionForAllDevices0) {
   std::shared_ptr<Graph> graph = MakeMatMulData(9);
@@ -249,7 +364,7 @@ TEST_F(TestPartition, test_PartitionForAllDevices0) {
 
 TEST_F(TestPartition, test_ApplyStrToTensor) {
   std::shared_ptr<Graph> graph = MakeMatMulData(9);
-  std::vector<std::pair<std::string, StrategyRec>> nameToStrategy;
+  NodeNameToStrategy nameToStrategy;
   graph->nodes[4].apply.str = PartitionNode(graph->nodes[4], nameToStrategy, graph);
   auto h_str = graph->nodes[4].apply.str.outputTensor.str_h;
   auto w_str = graph->nodes[4].apply.str.outputTensor.str_w;
@@ -0,0 +1,118 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/common_test.h"
+#include "pipeline/jit/static_analysis/async_eval_result.h"
+#include "pipeline/jit/static_analysis/static_analysis.h"
+#include "abstract/abstract_value.h"
+#include "ir/primitive.h"
+#include "ir/scalar.h"
+
+namespace mindspore {
+namespace abstract {
+namespace {
+constexpr size_t kThreadNum = 8;
+constexpr int64_t kKeyNumPerThread = 200;
+
+struct ValueHasher {
+  std::size_t operator()(const ValuePtr &value) const { return value->hash(); }
+};
+
+struct ValueEqual {
+  bool operator()(const ValuePtr &lhs, const ValuePtr &rhs) const { return *lhs == *rhs; }
+};
+}  // namespace
+
+class TestShardedCache : public UT::Common {
+ public:
+  TestShardedCache() {}
+};
+
+/// Feature: Sharded caches of static analysis.
+/// Description: Several threads insert and look up disjoint keys of a sharded cache at the same time.
+/// Expectation: Every inserted value is found and the size counts the keys of all shards.
+TEST_F(TestShardedCache, test_sharded_cache_concurrent_set_get) {
+  ShardedMultiThreadCache<ValuePtr, AbstractBasePtr, ValueHasher, ValueEqual> cache;
+  std::vector<std::thread> threads;
+  std::vector<size_t> miss_counts(kThreadNum, 0);
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    threads.emplace_back([&cache, &miss_counts, t]() {
+      for (int64_t i = 0; i < kKeyNumPerThread; ++i) {
+        int64_t key = static_cast<int64_t>(t) * kKeyNumPerThread + i;
+        cache.set(MakeValue(key), std::make_shared<AbstractScalar>(key));
+        auto abs = cache.get(MakeValue(key));
+        if (abs == nullptr || GetValue<int64_t>(abs->BuildValue()) != key) {
+          ++miss_counts[t];
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    ASSERT_EQ(miss_counts[t], 0);
+  }
+  ASSERT_EQ(cache.size(), kThreadNum * kKeyNumPerThread);
+  ASSERT_EQ(cache.get(MakeValue(static_cast<int64_t>(-1))), nullptr);
+  cache.clear();
+  ASSERT_TRUE(cache.empty());
+}
+
+/// Feature: Sharded caches of static analysis.
+/// Description: Several threads put and get the evaluation results of different primitives at the same time.
+/// Expectation: Every result is returned for its own primitive and arguments, and nothing is left after Clear.
+TEST_F(TestShardedCache, test_prim_eval_cache_concurrent_put_get) {
+  PrimitiveEvalCache cache;
+  std::vector<PrimitivePtr> prims;
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    prims.push_back(std::make_shared<Primitive>("TestPrim" + std::to_string(t)));
+  }
+  std::vector<std::thread> threads;
+  std::vector<size_t> miss_counts(kThreadNum, 0);
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    threads.emplace_back([&cache, &prims, &miss_counts, t]() {
+      const auto &prim = prims[t];
+      for (int64_t i = 0; i < kKeyNumPerThread; ++i) {
+        AbstractBasePtrList args{std::make_shared<AbstractScalar>(i)};
+        auto abs = std::make_shared<AbstractScalar>(static_cast<int64_t>(t));
+        AttrValueMap attrs = prim->attrs();
+        cache.Put(prim, std::move(attrs), args, std::make_shared<EvalResult>(abs, nullptr));
+        auto result = cache.Get(prim, args);
+        if (result == nullptr || GetValue<int64_t>(result->abstract()->BuildValue()) != static_cast<int64_t>(t)) {
+          ++miss_counts[t];
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    ASSERT_EQ(miss_counts[t], 0);
+    AbstractBasePtrList args{std::make_shared<AbstractScalar>(kKeyNumPerThread - 1)};
+    ASSERT_NE(cache.Get(prims[t], args), nullptr);
+  }
+  cache.Clear();
+  AbstractBasePtrList args{std::make_shared<AbstractScalar>(static_cast<int64_t>(0))};
+  ASSERT_EQ(cache.Get(prims[0], args), nullptr);
+}
+}  // namespace abstract
+}  // namespace mindspore
@@ -0,0 +1,167 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <utility>
+#include "common/common_test.h"
+#include "runtime/graph_scheduler/graph_scheduler_common_test.h"
+#include "plugin/device/cpu/hal/device/cpu_data_queue.h"
+#include "include/backend/data_queue/blocking_queue.h"
+#include "include/backend/data_queue/data_queue_mgr.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+using runtime::test::TestDeviceContext;
+
+class TestCpuDataQueue : public UT::Common {
+ protected:
+  void SetUp() override {
+    auto ms_context = MsContext::GetInstance();
+    last_device_target_ = ms_context->get_param<std::string>(MS_CTX_DEVICE_TARGET);
+    ms_context->set_param<std::string>(MS_CTX_DEVICE_TARGET, kCPUDevice);
+    MS_REGISTER_DEVICE(kCPUDevice, TestDeviceContext);
+  }
+  void TearDown() override {
+    MsContext::GetInstance()->set_param<std::string>(MS_CTX_DEVICE_TARGET, last_device_target_);
+  }
+
+  std::vector<DataQueueItem> MakeData(void *ptr, size_t len, int32_t worker_id) {
+    DataQueueItem item;
+    item.data_ptr = ptr;
+    item.data_len = len;
+    item.worker_id = worker_id;
+    return {item};
+  }
+
+  std::string last_device_target_;
+};
+
+/// Feature: CPU data queue.
+/// Description: push data, then front and pop it.
+/// Expectation: the front data shares the pushed buffer and the buffer is released only after it is popped.
+TEST_F(TestCpuDataQueue, PushFrontPopRelease) {
+  CpuDataQueue queue("cpu_queue_push_pop", 4);
+  std::vector<std::pair<void *, int32_t>> released;
+  queue.RegisterRelease([&released](void *addr, int32_t worker_id) { released.emplace_back(addr, worker_id); });
+
+  float buffer[4] = {1, 2, 3, 4};
+  ASSERT_EQ(queue.Push(MakeData(buffer, sizeof(buffer), 3)), DataQueueStatus::SUCCESS);
+  ASSERT_EQ(queue.Size(), 1);
+
+  std::vector<DataQueueItem> data;
+  ASSERT_EQ(queue.Front(&data), DataQueueStatus::SUCCESS);
+  ASSERT_EQ(data.size(), 1);
+  ASSERT_EQ(data[0].data_ptr, buffer);
+  ASSERT_EQ(data[0].device_addr, buffer);
+  ASSERT_EQ(data[0].data_len, sizeof(buffer));
+  ASSERT_TRUE(released.empty());
+
+  ASSERT_EQ(queue.Pop(), DataQueueStatus::SUCCESS);
+  ASSERT_EQ(released.size(), 1);
+  ASSERT_EQ(released[0].first, buffer);
+  ASSERT_EQ(released[0].second, 3);
+  ASSERT_TRUE(queue.IsEmpty());
+  ASSERT_EQ(queue.Front(&data), DataQueueStatus::INTERNAL_ERROR);
+  ASSERT_EQ(queue.Pop(), DataQueueStatus::INTERNAL_ERROR);
+}
+
+/// Feature: CPU data queue.
+/// Description: push and pop more items than the capacity of the ring buffer.
+/// Expectation: the items are popped in the order they are pushed.
+TEST_F(TestCpuDataQueue, RingBufferOrder) {
+  constexpr size_t kCapacity = 3;
+  constexpr size_t kItemNum = 10;
+  CpuDataQueue queue("cpu_queue_order", kCapacity);
+  std::vector<void *> released;
+  queue.RegisterRelease([&released](void *addr, int32_t) { released.push_back(addr); });
+
+  int buffers[kItemNum] = {0};
+  size_t pushed = 0;
+  size_t popped = 0;
+  while (popped < kItemNum) {
+    while (pushed < kItemNum && queue.Push(MakeData(&buffers[pushed], sizeof(int), 0)) == DataQueueStatus::SUCCESS) {
+      ++pushed;
+    }
+    std::vector<DataQueueItem> data;
+    ASSERT_EQ(queue.Front(&data), DataQueueStatus::SUCCESS);
+    ASSERT_EQ(data[0].data_ptr, &buffers[popped]);
+    ASSERT_EQ(queue.Pop(), DataQueueStatus::SUCCESS);
+    ++popped;
+  }
+  ASSERT_EQ(released.size(), kItemNum);
+  for (size_t i = 0; i < kItemNum; ++i) {
+    ASSERT_EQ(released[i], &buffers[i]);
+  }
+}
+
+/// Feature: CPU data queue.
+/// Description: limit the prefetch depth under the capacity and push until the queue is full.
+/// Expectation: the queue is full at the prefetch depth, and the invalid depths fall back to the capacity.
+TEST_F(TestCpuDataQueue, PrefetchDepthLimit) {
+  constexpr size_t kCapacity = 4;
+  CpuDataQueue queue("cpu_queue_depth", kCapacity);
+  ASSERT_EQ(queue.prefetch_depth(), kCapacity);
+
+  queue.set_prefetch_depth(2);
+  ASSERT_EQ(queue.prefetch_depth(), 2);
+  int buffers[3] = {0};
+  ASSERT_EQ(queue.Push(MakeData(&buffers[0], sizeof(int), 0)), DataQueueStatus::SUCCESS);
+  ASSERT_FALSE(queue.IsFull());
+  ASSERT_EQ(queue.Push(MakeData(&buffers[1], sizeof(int), 0)), DataQueueStatus::SUCCESS);
+  ASSERT_TRUE(queue.IsFull());
+  ASSERT_EQ(queue.Push(MakeData(&buffers[2], sizeof(int), 0)), DataQueueStatus::TIMEOUT);
+  ASSERT_EQ(queue.Size(), 2);
+
+  ASSERT_EQ(queue.Pop(), DataQueueStatus::SUCCESS);
+  ASSERT_EQ(queue.Push(MakeData(&buffers[2], sizeof(int), 0)), DataQueueStatus::SUCCESS);
+
+  queue.set_prefetch_depth(0);
+  ASSERT_EQ(queue.prefetch_depth(), kCapacity);
+  queue.set_prefetch_depth(kCapacity + 1);
+  ASSERT_EQ(queue.prefetch_depth(), kCapacity);
+}
+
+/// Feature: CPU data queue.
+/// Description: push an item with null data and a non-zero length.
+/// Expectation: the item is rejected.
+TEST_F(TestCpuDataQueue, InvalidInput) {
+  CpuDataQueue queue("cpu_queue_invalid", 2);
+  ASSERT_EQ(queue.Push(MakeData(nullptr, sizeof(int), 0)), DataQueueStatus::ERROR_INPUT);
+  ASSERT_TRUE(queue.IsEmpty());
+}
+
+/// Feature: CPU data queue.
+/// Description: create the data queue of a channel for the CPU runtime twice.
+/// Expectation: the queue is created once with the default prefetch depth.
+TEST_F(TestCpuDataQueue, InitCpuDataQueue) {
+  const std::string channel_name = "cpu_queue_init";
+  InitCpuDataQueue(channel_name);
+  auto &data_queue_mgr = DataQueueMgr::GetInstance();
+  ASSERT_TRUE(data_queue_mgr.IsCreated(channel_name));
+  auto queue = data_queue_mgr.GetDataQueue(channel_name);
+  ASSERT_NE(queue, nullptr);
+  InitCpuDataQueue(channel_name);
+  ASSERT_EQ(data_queue_mgr.GetDataQueue(channel_name), queue);
+  auto cpu_queue = std::dynamic_pointer_cast<CpuDataQueue>(queue->Queue());
+  ASSERT_NE(cpu_queue, nullptr);
+  ASSERT_EQ(cpu_queue->prefetch_depth(), 2);
+  ASSERT_GE(cpu_queue->Capacity(), cpu_queue->prefetch_depth());
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,196 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "plugin/device/cpu/hal/profiler/cpu_op_trace.h"
+
+namespace mindspore {
+namespace profiler {
+namespace cpu {
+namespace {
+constexpr uint32_t kPid = 1234;
+
+std::vector<uint32_t> PopOpIds(OpTraceRing *ring) {
+  std::vector<OpTraceRecord> records;
+  ring->PopAll(&records);
+  std::vector<uint32_t> op_ids;
+  for (const auto &record : records) {
+    op_ids.push_back(record.op_id);
+  }
+  return op_ids;
+}
+}  // namespace
+
+class TestCpuOpTrace : public UT::Common {
+ protected:
+  void SetUp() override {
+    char dir_template[] = "/tmp/cpu_op_trace_XXXXXX";
+    auto dir = mkdtemp(dir_template);
+    ASSERT_NE(dir, nullptr);
+    dir_ = dir;
+    trace_file_ = dir_ + "/cpu_op_trace.bin";
+    name_file_ = dir_ + "/cpu_op_trace_names.txt";
+  }
+
+  void TearDown() override {
+    CpuOpTraceRecorder::GetInstance().Stop();
+    (void)remove(trace_file_.c_str());
+    (void)remove(name_file_.c_str());
+    (void)rmdir(dir_.c_str());
+  }
+
+  void WriteTrace(const char *magic, uint32_t sample_interval, const std::vector<OpTraceRecord> &records) const {
+    OpTraceHeader header{};
+    (void)memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = 1;
+    header.sample_interval = sample_interval;
+    std::ofstream ofs(trace_file_, std::ios::binary);
+    (void)ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    (void)ofs.write(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(OpTraceRecord));
+  }
+
+  void WriteNames(const std::string &names) const {
+    std::ofstream ofs(name_file_);
+    ofs << names;
+  }
+
+  std::string dir_;
+  std::string trace_file_;
+  std::string name_file_;
+};
+
+/// Feature: CPU profiler op trace.
+/// Description: push records into a full ring, then pop them and push again so the indexes wrap around the ring.
+/// Expectation: the record beyond the capacity is dropped, the records are popped in the order they were pushed.
+TEST_F(TestCpuOpTrace, RingOverflowAndWrapAround) {
+  OpTraceRing ring(4);
+  for (uint32_t i = 0; i < 4; ++i) {
+    ASSERT_TRUE(ring.Push(OpTraceRecord{i, 0, i, 1}));
+  }
+  ASSERT_FALSE(ring.Push(OpTraceRecord{4, 0, 4, 1}));
+  ASSERT_EQ(PopOpIds(&ring), std::vector<uint32_t>({0, 1, 2, 3}));
+  ASSERT_TRUE(PopOpIds(&ring).empty());
+
+  for (uint32_t round = 0; round < 3; ++round) {
+    std::vector<uint32_t> expect;
+    for (uint32_t i = 0; i < 3; ++i) {
+      auto op_id = 10 * (round + 1) + i;
+      ASSERT_TRUE(ring.Push(OpTraceRecord{op_id, 0, op_id, 1}));
+      expect.push_back(op_id);
+    }
+    ASSERT_EQ(PopOpIds(&ring), expect);
+  }
+}
+
+/// Feature: CPU profiler op trace.
+/// Description: create a ring whose capacity is not a power of 2.
+/// Expectation: an exception is thrown.
+TEST_F(TestCpuOpTrace, RingCapacityNotPowerOfTwo) { ASSERT_ANY_THROW(OpTraceRing ring(3)); }
+
+/// Feature: CPU profiler op trace.
+/// Description: convert a trace of sample interval 4 with a record of an unknown op.
+/// Expectation: every record stands for 4 launches, the timestamps keep the order of the trace and the unknown op is
+/// skipped.
+TEST_F(TestCpuOpTrace, ConvertWeightsSampledLaunches) {
+  WriteNames("0,Default/Conv2D-op1\n1,Default/ReLU-op2\n");
+  WriteTrace("MSOPTRC", 4,
+             {{0, 1, 1000, 1000000}, {1, 2, 2000, 2000000}, {5, 0, 2500, 1000000}, {0, 3, 3000, 3000000}});
+  OpInfoMap op_info_map;
+  ASSERT_TRUE(CpuOpTraceRecorder::Convert(trace_file_, name_file_, kPid, &op_info_map));
+  ASSERT_EQ(op_info_map.size(), 2);
+
+  const auto &conv = op_info_map.at("Default/Conv2D-op1");
+  ASSERT_EQ(conv.op_name, "Default/Conv2D-op1");
+  ASSERT_EQ(conv.pid, kPid);
+  ASSERT_EQ(conv.op_count, 8);
+  ASSERT_FLOAT_EQ(conv.op_host_cost_time, 16);
+  ASSERT_EQ(conv.start_duration.size(), 2);
+  ASSERT_EQ(conv.start_duration[0].start_timestamp, 1000);
+  ASSERT_FLOAT_EQ(conv.start_duration[0].duration, 1);
+  ASSERT_EQ(conv.start_duration[0].tid, 1);
+  ASSERT_EQ(conv.start_duration[1].start_timestamp, 3000);
+  ASSERT_FLOAT_EQ(conv.start_duration[1].duration, 3);
+  ASSERT_EQ(conv.start_duration[1].tid, 3);
+
+  const auto &relu = op_info_map.at("Default/ReLU-op2");
+  ASSERT_EQ(relu.op_count, 4);
+  ASSERT_FLOAT_EQ(relu.op_host_cost_time, 8);
+}
+
+/// Feature: CPU profiler op trace.
+/// Description: convert a trace whose header is not an op trace header, and a trace without a name file.
+/// Expectation: the conversion fails and nothing is added.
+TEST_F(TestCpuOpTrace, ConvertInvalidTrace) {
+  WriteNames("0,Default/Conv2D-op1\n");
+  WriteTrace("INVALID", 1, {{0, 0, 1000, 1000000}});
+  OpInfoMap op_info_map;
+  ASSERT_FALSE(CpuOpTraceRecorder::Convert(trace_file_, name_file_, kPid, &op_info_map));
+  ASSERT_FALSE(CpuOpTraceRecorder::Convert(trace_file_, dir_ + "/not_exist.txt", kPid, &op_info_map));
+  ASSERT_TRUE(op_info_map.empty());
+}
+
+/// Feature: CPU profiler op trace.
+/// Description: record the launches of two kernels, stop the recorder and convert its trace.
+/// Expectation: a kernel is recorded by RecordNew at its first launch only, and all the launches are converted in
+/// order.
+TEST_F(TestCpuOpTrace, RecordAndConvert) {
+  auto &recorder = CpuOpTraceRecorder::GetInstance();
+  ASSERT_TRUE(recorder.Start(trace_file_, name_file_, 1));
+  ASSERT_TRUE(recorder.enabled());
+  int first_kernel = 0;
+  int second_kernel = 0;
+  ASSERT_FALSE(recorder.Record(&first_kernel, 100, 300));
+  recorder.RecordNew(&first_kernel, "Default/MatMul-op1", 100, 300);
+  ASSERT_TRUE(recorder.Record(&first_kernel, 400, 500));
+  ASSERT_FALSE(recorder.Record(&second_kernel, 600, 1600));
+  recorder.RecordNew(&second_kernel, "Default/Add-op2", 600, 1600);
+  recorder.Stop();
+  ASSERT_FALSE(recorder.enabled());
+
+  OpInfoMap op_info_map;
+  ASSERT_TRUE(CpuOpTraceRecorder::Convert(trace_file_, name_file_, kPid, &op_info_map));
+  ASSERT_EQ(op_info_map.size(), 2);
+  const auto &matmul = op_info_map.at("Default/MatMul-op1");
+  ASSERT_EQ(matmul.op_count, 2);
+  ASSERT_EQ(matmul.start_duration.size(), 2);
+  ASSERT_EQ(matmul.start_duration[0].start_timestamp, 100);
+  ASSERT_FLOAT_EQ(matmul.start_duration[0].duration, 200 / 1e6);
+  ASSERT_EQ(matmul.start_duration[1].start_timestamp, 400);
+  ASSERT_EQ(op_info_map.at("Default/Add-op2").op_count, 1);
+}
+
+/// Feature: CPU profiler op trace.
+/// Description: count the launches of a thread with sample interval 3.
+/// Expectation: one in 3 launches is sampled.
+TEST_F(TestCpuOpTrace, SampleInterval) {
+  auto &recorder = CpuOpTraceRecorder::GetInstance();
+  ASSERT_TRUE(recorder.Start(trace_file_, name_file_, 3));
+  size_t sampled_num = 0;
+  for (size_t i = 0; i < 9; ++i) {
+    sampled_num += recorder.Sample() ? 1 : 0;
+  }
+  ASSERT_EQ(sampled_num, 3);
+}
+}  // namespace cpu
+}  // namespace profiler
+}  // namespace mindspore
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "profiler/device/perf_counter.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace profiler {
+namespace {
+// Keeps the counted code from being optimized away.
+volatile uint64_t g_sink = 0;
+
+void BusyWork() {
+  uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    sum += i * i;
+  }
+  g_sink = sum;
+}
+
+// Perf events are not permitted in most containers, see /proc/sys/kernel/perf_event_paranoid.
+bool PerfEventAvailable() {
+  PerfCounterGroup group;
+  if (!group.Open()) {
+    MS_LOG(WARNING) << "Perf events are not available, skip the test.";
+    return false;
+  }
+  return true;
+}
+
+std::vector<std::string> ReadLines(const std::string &file_path) {
+  std::ifstream ifs(file_path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+std::vector<std::string> SplitCsv(const std::string &line) {
+  std::vector<std::string> fields;
+  std::stringstream ss(line);
+  std::string field;
+  while (std::getline(ss, field, ',')) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+}  // namespace
+
+class TestPerfCounter : public UT::Common {
+ protected:
+  void SetUp() override {
+    csv_file_ = "./perf_counter_test_" + std::to_string(getpid()) + ".csv";
+    KernelPerfCounter::GetInstance().Clear();
+  }
+
+  void TearDown() override {
+    KernelPerfCounter::GetInstance().Clear();
+    KernelPerfCounter::GetInstance().Enable(false);
+    (void)std::remove(csv_file_.c_str());
+  }
+
+  std::string csv_file_;
+};
+
+/// Feature: Hardware counters of kernel launches.
+/// Description: accumulate two counter values.
+/// Expectation: every counter and the time are summed.
+TEST_F(TestPerfCounter, AccumulateValues) {
+  PerfCounterValues total{1, 2, 3, 4, 5};
+  total += PerfCounterValues{10, 20, 30, 40, 50};
+  ASSERT_EQ(total.cycles, 11);
+  ASSERT_EQ(total.instructions, 22);
+  ASSERT_EQ(total.cache_misses, 33);
+  ASSERT_EQ(total.branch_misses, 44);
+  ASSERT_EQ(total.time_ns, 55);
+}
+
+/// Feature: Hardware counters of kernel launches.
+/// Description: count a busy loop by a perf event group, skipped if perf events are not available.
+/// Expectation: the cycles, instructions and time are counted.
+TEST_F(TestPerfCounter, CountGroup) {
+  PerfCounterGroup group;
+  if (!group.Open()) {
+    MS_LOG(WARNING) << "Perf events are not available, skip the test.";
+    return;
+  }
+  PerfCounterValues values;
+  group.Begin();
+  BusyWork();
+  ASSERT_TRUE(group.End(&values));
+  ASSERT_GT(values.cycles, 0);
+  ASSERT_GT(values.instructions, 0);
+  ASSERT_GT(values.time_ns, 0);
+}
+
+/// Feature: Hardware counters of kernel launches.
+/// Description: count the launches of two op types and save them, skipped if perf events are not available.
+/// Expectation: the csv file has a header and one row per op type with its launch count.
+TEST_F(TestPerfCounter, SaveOpTypes) {
+  if (!PerfEventAvailable()) {
+    return;
+  }
+  auto &perf_counter = KernelPerfCounter::GetInstance();
+  perf_counter.Enable(true);
+  for (size_t i = 0; i < 3; ++i) {
+    perf_counter.Begin();
+    BusyWork();
+    perf_counter.End("MatMul");
+  }
+  perf_counter.Begin();
+  BusyWork();
+  perf_counter.End("Add");
+  ASSERT_TRUE(perf_counter.Save(csv_file_));
+
+  auto lines = ReadLines(csv_file_);
+  ASSERT_EQ(lines.size(), 3);
+  ASSERT_EQ(lines[0],
+            "op_type,count,total_time(ms),launch_thread_cycles,launch_thread_instructions,IPC,"
+            "launch_thread_cache_misses,launch_thread_branch_misses,launch_thread_bandwidth(GB/s)");
+  auto add = SplitCsv(lines[1]);
+  ASSERT_EQ(add.size(), 9);
+  ASSERT_EQ(add[0], "Add");
+  ASSERT_EQ(add[1], "1");
+  auto matmul = SplitCsv(lines[2]);
+  ASSERT_EQ(matmul.size(), 9);
+  ASSERT_EQ(matmul[0], "MatMul");
+  ASSERT_EQ(matmul[1], "3");
+  ASSERT_GT(std::stoull(matmul[3]), 0);
+  ASSERT_GT(std::stoull(matmul[4]), 0);
+}
+
+/// Feature: Hardware counters of kernel launches.
+/// Description: clear the counted launches before saving.
+/// Expectation: nothing is counted, so no file is written.
+TEST_F(TestPerfCounter, ClearBeforeSave) {
+  auto &perf_counter = KernelPerfCounter::GetInstance();
+  perf_counter.Enable(true);
+  perf_counter.Begin();
+  BusyWork();
+  perf_counter.End("MatMul");
+  perf_counter.Clear();
+  ASSERT_TRUE(perf_counter.Save(csv_file_));
+  std::ifstream ifs(csv_file_);
+  ASSERT_FALSE(ifs.is_open());
+}
+}  // namespace profiler
+}  // namespace mindspore
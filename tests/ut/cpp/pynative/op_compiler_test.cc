@@ -0,0 +1,178 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#define private public
+#include "runtime/pynative/op_compiler.h"
+#undef private
+
+namespace mindspore {
+namespace pynative {
+namespace {
+constexpr char kOpCacheSizeEnv[] = "MS_DEV_PYNATIVE_OP_CACHE_SIZE";
+}  // namespace
+
+class TestOpCompiler : public UT::Common {
+ public:
+  TestOpCompiler() = default;
+
+  void SetUp() override {
+    auto &op_compiler = OpCompiler::GetInstance();
+    capacity_ = op_compiler.cache_capacity_;
+    op_compiler.ClearAllCache();
+  }
+
+  void TearDown() override {
+    (void)unsetenv(kOpCacheSizeEnv);
+    auto &op_compiler = OpCompiler::GetInstance();
+    op_compiler.cache_capacity_ = capacity_;
+    op_compiler.ClearAllCache();
+  }
+
+  static OpCompilerInfoPtr CacheOp(const GraphInfo &graph_info) {
+    auto op_compiler_info = std::make_shared<OpCompilerInfo>(graph_info, 0, nullptr, std::vector<KernelWithIndex>(),
+                                                             nullptr, false);
+    OpCompiler::GetInstance().CacheOpCompilerInfo(op_compiler_info);
+    return op_compiler_info;
+  }
+
+  // The cached graph infos from the most recently used to the least recently used.
+  static std::vector<GraphInfo> CachedOps() {
+    const auto &op_compiler = OpCompiler::GetInstance();
+    std::vector<GraphInfo> graph_infos;
+    for (const auto &op_compiler_info : op_compiler.op_compiler_info_list_) {
+      graph_infos.push_back(op_compiler_info->graph_info_);
+    }
+    EXPECT_EQ(graph_infos.size(), op_compiler.op_compiler_infos_.size());
+    return graph_infos;
+  }
+
+  size_t capacity_{0};
+};
+
+/// Feature: PyNative op cache.
+/// Description: cache more ops than the capacity.
+/// Expectation: the least recently cached ops are evicted, the evicted op stays alive while it is held.
+TEST_F(TestOpCompiler, EvictLeastRecentlyUsed) {
+  auto &op_compiler = OpCompiler::GetInstance();
+  op_compiler.cache_capacity_ = 3;
+  auto first = CacheOp("a");
+  (void)CacheOp("b");
+  (void)CacheOp("c");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"c", "b", "a"}));
+  (void)CacheOp("d");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"d", "c", "b"}));
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("a"), nullptr);
+  ASSERT_EQ(first->graph_info_, "a");
+}
+
+/// Feature: PyNative op cache.
+/// Description: hit a cached op before caching more ops than the capacity.
+/// Expectation: the hit op becomes the most recently used one and is not evicted.
+TEST_F(TestOpCompiler, HitRefreshesOp) {
+  auto &op_compiler = OpCompiler::GetInstance();
+  op_compiler.cache_capacity_ = 3;
+  auto first = CacheOp("a");
+  (void)CacheOp("b");
+  (void)CacheOp("c");
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("a"), first);
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"a", "c", "b"}));
+  (void)CacheOp("d");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"d", "a", "c"}));
+
+  // Caching an op again replaces the cached one and refreshes it.
+  auto second = CacheOp("c");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"c", "d", "a"}));
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("c"), second);
+}
+
+/// Feature: PyNative op cache.
+/// Description: set the capacity by env MS_DEV_PYNATIVE_OP_CACHE_SIZE.
+/// Expectation: a valid value is used, an invalid value falls back to the default, 0 means unlimited.
+TEST_F(TestOpCompiler, CacheCapacityEnv) {
+  (void)unsetenv(kOpCacheSizeEnv);
+  auto default_capacity = OpCompiler::GetCacheCapacity();
+  ASSERT_GT(default_capacity, 0);
+  (void)setenv(kOpCacheSizeEnv, "2", 1);
+  ASSERT_EQ(OpCompiler::GetCacheCapacity(), 2);
+  (void)setenv(kOpCacheSizeEnv, "invalid", 1);
+  ASSERT_EQ(OpCompiler::GetCacheCapacity(), default_capacity);
+  (void)setenv(kOpCacheSizeEnv, "0", 1);
+  ASSERT_EQ(OpCompiler::GetCacheCapacity(), 0);
+
+  auto &op_compiler = OpCompiler::GetInstance();
+  op_compiler.cache_capacity_ = 0;
+  for (size_t i = 0; i < default_capacity + 1; ++i) {
+    (void)CacheOp(std::to_string(i));
+  }
+  ASSERT_EQ(op_compiler.op_compiler_infos_.size(), default_capacity + 1);
+}
+
+/// Feature: PyNative op cache.
+/// Description: clear one cached op, an op which is not cached and all the ops.
+/// Expectation: the cleared op is removed from both the index and the recency list.
+TEST_F(TestOpCompiler, ClearOpCache) {
+  auto &op_compiler = OpCompiler::GetInstance();
+  op_compiler.cache_capacity_ = 3;
+  (void)CacheOp("a");
+  (void)CacheOp("b");
+  (void)CacheOp("c");
+  op_compiler.ClearOpCache("b");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"c", "a"}));
+  op_compiler.ClearOpCache("not_cached");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"c", "a"}));
+
+  // The cleared op no longer counts against the capacity.
+  (void)CacheOp("d");
+  ASSERT_EQ(CachedOps(), std::vector<GraphInfo>({"d", "c", "a"}));
+
+  op_compiler.ClearAllCache();
+  ASSERT_TRUE(CachedOps().empty());
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("d"), nullptr);
+}
+
+/// Feature: PyNative op cache.
+/// Description: look up cached and uncached ops and cache more ops than the capacity.
+/// Expectation: the hits, misses and evictions are counted, and each cached op carries the hash of its graph info.
+TEST_F(TestOpCompiler, CacheCounters) {
+  auto &op_compiler = OpCompiler::GetInstance();
+  op_compiler.cache_capacity_ = 2;
+  auto hit_count = op_compiler.cache_hit_count();
+  auto miss_count = op_compiler.cache_miss_count();
+  auto evict_count = op_compiler.cache_evict_count();
+  auto first = CacheOp("a");
+  ASSERT_EQ(first->graph_info_hash_, std::hash<GraphInfo>{}("a"));
+  (void)CacheOp("b");
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("a"), first);
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("not_cached"), nullptr);
+  (void)CacheOp("c");
+  (void)CacheOp("d");
+  ASSERT_EQ(op_compiler.cache_size(), 2);
+  ASSERT_EQ(op_compiler.cache_hit_count(), hit_count + 1);
+  ASSERT_EQ(op_compiler.cache_miss_count(), miss_count + 1);
+  ASSERT_EQ(op_compiler.cache_evict_count(), evict_count + 2);
+
+  // Replacing a cached op keeps a single entry for its graph info.
+  auto replaced = CacheOp("d");
+  ASSERT_EQ(op_compiler.cache_size(), 2);
+  ASSERT_EQ(op_compiler.FindOpCompilerInfo("d"), replaced);
+  ASSERT_EQ(op_compiler.cache_evict_count(), evict_count + 2);
+}
+}  // namespace pynative
+}  // namespace mindspore
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/common_test.h"
+#include "runtime/graph_scheduler/optimizer/cost_based_actor_fusion.h"
+
+namespace mindspore {
+namespace runtime {
+class CostBasedActorFusionTest : public UT::Common {
+ public:
+  CostBasedActorFusionTest() {}
+};
+
+/// Feature: Cost based actor fusion.
+/// Description: Partition a chain of cheap actors.
+/// Expectation: All the actors are in one segment in the execution order.
+TEST_F(CostBasedActorFusionTest, PartitionChain) {
+  constexpr size_t kActorNum = 10;
+  std::vector<double> costs(kActorNum, 300);
+  std::vector<std::vector<size_t>> outputs(kActorNum);
+  for (size_t i = 0; i + 1 < kActorNum; ++i) {
+    outputs[i] = {i + 1};
+  }
+  auto segments = CostBasedActorFusion::Partition(costs, outputs, 4);
+  ASSERT_EQ(segments.size(), 1);
+  std::vector<size_t> expect = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_EQ(segments[0], expect);
+}
+
+/// Feature: Cost based actor fusion.
+/// Description: Partition four parallel chains of cheap actors which are joined by one actor.
+/// Expectation: Each chain is a segment, and the parallel chains are not fused together.
+TEST_F(CostBasedActorFusionTest, PartitionParallelChains) {
+  constexpr size_t kBranchNum = 4;
+  constexpr size_t kBranchLength = 50;
+  constexpr size_t kJoinActor = kBranchNum * kBranchLength;
+  std::vector<double> costs(kJoinActor + 1, 300);
+  std::vector<std::vector<size_t>> outputs(kJoinActor + 1);
+  for (size_t branch = 0; branch < kBranchNum; ++branch) {
+    for (size_t i = 0; i + 1 < kBranchLength; ++i) {
+      outputs[branch * kBranchLength + i] = {branch * kBranchLength + i + 1};
+    }
+    outputs[branch * kBranchLength + kBranchLength - 1] = {kJoinActor};
+  }
+  auto segments = CostBasedActorFusion::Partition(costs, outputs, 4);
+  ASSERT_EQ(segments.size(), kBranchNum);
+  for (auto &segment : segments) {
+    size_t branch = segment.front() / kBranchLength;
+    for (auto actor : segment) {
+      ASSERT_TRUE(actor == kJoinActor || actor / kBranchLength == branch);
+    }
+  }
+}
+
+/// Feature: Cost based actor fusion.
+/// Description: Partition a chain of expensive actors with many threads.
+/// Expectation: No actor is fused.
+TEST_F(CostBasedActorFusionTest, PartitionExpensiveActors) {
+  constexpr size_t kActorNum = 5;
+  std::vector<double> costs(kActorNum, 1e6);
+  std::vector<std::vector<size_t>> outputs(kActorNum);
+  for (size_t i = 0; i + 1 < kActorNum; ++i) {
+    outputs[i] = {i + 1};
+  }
+  ASSERT_TRUE(CostBasedActorFusion::Partition(costs, outputs, 8).empty());
+}
+}  // namespace runtime
+}  // namespace mindspore
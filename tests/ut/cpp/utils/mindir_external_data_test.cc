@@ -0,0 +1,236 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "utils/hash_map.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "ir/func_graph.h"
+#include "ir/tensor.h"
+#include "proto/mind_ir.pb.h"
+#include "utils/crypto.h"
+#include "utils/ms_utils.h"
+#define private public
+#include "load_mindir/anf_model_parser.h"
+#undef private
+
+namespace mindspore {
+namespace {
+// An external data file starts with its byte order flag, the tensors follow it.
+constexpr size_t kDataOffset = 64;
+constexpr char kMindIRMmapEnv[] = "MS_MINDIR_MMAP";
+}  // namespace
+
+class TestMindIRExternalData : public UT::Common {
+ public:
+  TestMindIRExternalData() = default;
+
+  void SetUp() override {
+    char dir_template[] = "/tmp/mindir_external_data_XXXXXX";
+    auto dir = mkdtemp(dir_template);
+    ASSERT_NE(dir, nullptr);
+    dir_ = dir;
+  }
+
+  void TearDown() override {
+    (void)unsetenv(kMindIRMmapEnv);
+    MSANFModelParser::load_tensor_map_.clear();
+    for (const auto &file : files_) {
+      (void)remove((dir_ + "/" + file).c_str());
+    }
+    (void)rmdir(dir_.c_str());
+  }
+
+  // Writes the values at kDataOffset, the file is extended with zeros to file_size if it is larger.
+  void WriteDataFile(const std::string &location, const std::vector<float> &values, size_t file_size = 0) {
+    auto path = dir_ + "/" + location;
+    std::vector<char> header(kDataOffset, 0);
+    header[0] = common::IsLittleByteOrder() ? 1 : 0;
+    std::ofstream ofs(path, std::ios::out | std::ios::binary);
+    (void)ofs.write(header.data(), SizeToLong(header.size()));
+    (void)ofs.write(reinterpret_cast<const char *>(values.data()), SizeToLong(values.size() * sizeof(float)));
+    ofs.close();
+    if (file_size > kDataOffset + values.size() * sizeof(float)) {
+      ASSERT_EQ(truncate(path.c_str(), SizeToLong(file_size)), 0);
+    }
+    files_.push_back(location);
+  }
+
+  static void SetExternalTensorProto(const std::string &name, const std::string &location, size_t offset, size_t num,
+                                     mind_ir::TensorProto *tensor_proto) {
+    tensor_proto->set_name(name);
+    tensor_proto->set_data_type(mind_ir::TensorProto_DataType_FLOAT);
+    tensor_proto->add_dims(SizeToLong(num));
+    auto external_data = tensor_proto->mutable_external_data();
+    external_data->set_location(location);
+    external_data->set_offset(SizeToLong(offset));
+    external_data->set_length(SizeToLong(num * sizeof(float)));
+  }
+
+  static std::vector<float> TensorValues(const tensor::TensorPtr &tensor) {
+    auto data = static_cast<const float *>(tensor->data_c());
+    return std::vector<float>(data, data + tensor->DataSize());
+  }
+
+  std::string dir_;
+  std::vector<std::string> files_;
+};
+
+/// Feature: load MindIR external data by mapping.
+/// Description: build the tensors of two parameters in one external data file.
+/// Expectation: both tensors point into the single mapping of the file, writing them does not change the file.
+TEST_F(TestMindIRExternalData, BuildMappedTensor) {
+  std::vector<float> values = {1, 2, 3, 4, 5, 6};
+  WriteDataFile("data_0", values);
+  MSANFModelParser parser;
+  parser.SetMindIRPath(dir_);
+  mind_ir::TensorProto first;
+  mind_ir::TensorProto second;
+  SetExternalTensorProto("first", "data_0", kDataOffset, 2, &first);
+  SetExternalTensorProto("second", "data_0", kDataOffset + 2 * sizeof(float), 4, &second);
+
+  auto first_tensor = parser.BuildMappedTensor(first, kNumberTypeFloat32, {2});
+  auto second_tensor = parser.BuildMappedTensor(second, kNumberTypeFloat32, {4});
+  ASSERT_NE(first_tensor, nullptr);
+  ASSERT_NE(second_tensor, nullptr);
+  ASSERT_EQ(parser.mapped_files_.size(), 1);
+  ASSERT_EQ(TensorValues(first_tensor), std::vector<float>({1, 2}));
+  ASSERT_EQ(TensorValues(second_tensor), std::vector<float>({3, 4, 5, 6}));
+  ASSERT_EQ(first_tensor->data().nbytes(), 2 * sizeof(float));
+
+  // A tensor of the same data shares the mapping, but the mapping is private and the file keeps its data.
+  static_cast<float *>(second_tensor->data_c())[0] = -1;
+  mind_ir::TensorProto same;
+  SetExternalTensorProto("same", "data_0", kDataOffset + 2 * sizeof(float), 1, &same);
+  auto same_tensor = parser.BuildMappedTensor(same, kNumberTypeFloat32, {1});
+  ASSERT_NE(same_tensor, nullptr);
+  ASSERT_EQ(same_tensor->data_c(), second_tensor->data_c());
+  ASSERT_EQ(TensorValues(same_tensor), std::vector<float>({-1}));
+  std::ifstream ifs(dir_ + "/data_0", std::ios::in | std::ios::binary);
+  (void)ifs.seekg(kDataOffset + 2 * sizeof(float));
+  float value = 0;
+  (void)ifs.read(reinterpret_cast<char *>(&value), sizeof(value));
+  ASSERT_EQ(value, 3);
+}
+
+/// Feature: load MindIR external data by mapping.
+/// Description: release the parser and the mapping it holds while a mapped tensor is still in use.
+/// Expectation: the tensor keeps the mapping alive and its data stays readable.
+TEST_F(TestMindIRExternalData, MappedTensorOutlivesParser) {
+  WriteDataFile("data_0", {7, 8, 9});
+  tensor::TensorPtr tensor = nullptr;
+  {
+    MSANFModelParser parser;
+    parser.SetMindIRPath(dir_);
+    mind_ir::TensorProto tensor_proto;
+    SetExternalTensorProto("param", "data_0", kDataOffset, 3, &tensor_proto);
+    tensor = parser.BuildTensorFromTensorProto(tensor_proto);
+    ASSERT_NE(tensor, nullptr);
+    ASSERT_EQ(parser.mapped_files_.size(), 1);
+  }
+  ASSERT_EQ(TensorValues(tensor), std::vector<float>({7, 8, 9}));
+}
+
+/// Feature: load MindIR external data by mapping.
+/// Description: build tensors whose external data is not aligned, does not match the shape or exceeds the file.
+/// Expectation: they are not mapped, the unaligned one is copied and the one exceeding the file fails.
+TEST_F(TestMindIRExternalData, BuildMappedTensorRejected) {
+  std::vector<float> values = {1, 2, 3, 4};
+  WriteDataFile("data_0", values);
+  MSANFModelParser parser;
+  parser.SetMindIRPath(dir_);
+
+  mind_ir::TensorProto unaligned;
+  SetExternalTensorProto("unaligned", "data_0", kDataOffset + 2, 2, &unaligned);
+  ASSERT_EQ(parser.BuildMappedTensor(unaligned, kNumberTypeFloat32, {2}), nullptr);
+  auto copied = parser.BuildTensorFromTensorProto(unaligned);
+  ASSERT_NE(copied, nullptr);
+  auto expected = reinterpret_cast<const uint8_t *>(values.data()) + 2;
+  ASSERT_EQ(memcmp(copied->data_c(), expected, 2 * sizeof(float)), 0);
+
+  mind_ir::TensorProto mismatched;
+  SetExternalTensorProto("mismatched", "data_0", kDataOffset, 4, &mismatched);
+  ASSERT_EQ(parser.BuildMappedTensor(mismatched, kNumberTypeFloat32, {2}), nullptr);
+
+  mind_ir::TensorProto out_of_range;
+  SetExternalTensorProto("out_of_range", "data_0", kDataOffset, 8, &out_of_range);
+  ASSERT_EQ(parser.BuildMappedTensor(out_of_range, kNumberTypeFloat32, {8}), nullptr);
+  ASSERT_EQ(parser.BuildTensorFromTensorProto(out_of_range), nullptr);
+}
+
+/// Feature: load MindIR external data without mapping.
+/// Description: disable the mapping by MS_MINDIR_MMAP=0 and build a tensor from external data.
+/// Expectation: the file is read into memory and the tensor owns a copy of its data.
+TEST_F(TestMindIRExternalData, MmapDisabled) {
+  (void)setenv(kMindIRMmapEnv, "0", 1);
+  WriteDataFile("data_0", {1, 2, 3});
+  MSANFModelParser parser;
+  parser.SetMindIRPath(dir_);
+  mind_ir::TensorProto tensor_proto;
+  SetExternalTensorProto("param", "data_0", kDataOffset, 3, &tensor_proto);
+
+  ASSERT_EQ(parser.BuildMappedTensor(tensor_proto, kNumberTypeFloat32, {3}), nullptr);
+  auto tensor = parser.BuildTensorFromTensorProto(tensor_proto);
+  ASSERT_NE(tensor, nullptr);
+  ASSERT_TRUE(parser.mapped_files_.empty());
+  ASSERT_EQ(parser.tenor_data_.count("data_0"), 1);
+  ASSERT_EQ(TensorValues(tensor), std::vector<float>({1, 2, 3}));
+}
+
+/// Feature: build MindIR parameters in parallel.
+/// Description: prepare the parameters of a model whose external data reaches the parallel load threshold, and of a
+/// small model.
+/// Expectation: the parameters of the large model are built ahead and taken once by the graph parsing, those of the
+/// small model are left to the graph parsing.
+TEST_F(TestMindIRExternalData, PrepareParameterTensors) {
+  constexpr size_t kParamNum = 8 << 20;
+  // The file is sparse, only the first values are written.
+  WriteDataFile("data_0", {1, 2, 3, 4}, kDataOffset + 2 * kParamNum * sizeof(float));
+  mind_ir::ModelProto model_proto;
+  auto graph_proto = model_proto.mutable_graph();
+  SetExternalTensorProto("first", "data_0", kDataOffset, kParamNum, graph_proto->add_parameter());
+  SetExternalTensorProto("second", "data_0", kDataOffset + kParamNum * sizeof(float), kParamNum,
+                         graph_proto->add_parameter());
+
+  MSANFModelParser parser;
+  parser.SetMindIRPath(dir_);
+  parser.PrepareParameterTensors(model_proto);
+  ASSERT_EQ(parser.prepared_tensors_.size(), 2);
+  const auto &first = graph_proto->parameter(0);
+  auto prepared = parser.prepared_tensors_.at(&first);
+  ASSERT_EQ(static_cast<const float *>(prepared->data_c())[3], 4);
+  ASSERT_EQ(parser.GenerateTensorPtrFromTensorProto(first), prepared);
+  ASSERT_EQ(parser.prepared_tensors_.size(), 1);
+  ASSERT_NE(parser.GenerateTensorPtrFromTensorProto(first), prepared);
+
+  mind_ir::ModelProto small_model_proto;
+  auto small_graph_proto = small_model_proto.mutable_graph();
+  SetExternalTensorProto("first", "data_0", kDataOffset, 2, small_graph_proto->add_parameter());
+  SetExternalTensorProto("second", "data_0", kDataOffset + 2 * sizeof(float), 2, small_graph_proto->add_parameter());
+  MSANFModelParser small_parser;
+  small_parser.SetMindIRPath(dir_);
+  small_parser.PrepareParameterTensors(small_model_proto);
+  ASSERT_TRUE(small_parser.prepared_tensors_.empty());
+}
+}  // namespace mindspore
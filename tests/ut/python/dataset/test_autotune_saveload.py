@@ -459,3 +459,60 @@ class TestAutotuneSaveLoad:
 
         ds.config.set_seed(original_seed)
         ds.config.set_enable_autotune(original_autotune)
+
+    @staticmethod
+    def test_autotune_save_fingerprint(tmp_path):
+        """
+        Feature: Autotuning
+        Description: Test the final AutoTune config file is keyed by the fingerprint of the pipeline, and is loaded
+            as the initial config by the next run of the same pipeline
+        Expectation: The same pipeline gets the same fingerprint and starts from the saved workers and queue sizes,
+            a different pipeline gets another fingerprint
+        """
+        original_seed = ds.config.get_seed()
+        ds.config.set_seed(1)
+        original_autotune = ds.config.get_enable_autotune()
+        at_final_json_filename = "test_autotune_save_fingerprint_atfinal"
+        file = tmp_path / (at_final_json_filename + "_" + os.environ['RANK_ID'] + ".json")
+
+        def run_pipeline(num_samples, batch_size):
+            ds.config.set_enable_autotune(True, str(tmp_path / at_final_json_filename))
+            data1 = ds.MnistDataset(MNIST_DATA_DIR, num_samples=num_samples)
+            data1 = data1.map(operations=transforms.OneHot(10), input_columns="label", num_parallel_workers=2)
+            data1 = data1.batch(batch_size=batch_size, drop_remainder=True)
+            for _ in data1.create_dict_iterator(num_epochs=1, output_numpy=True):
+                pass
+            ds.config.set_enable_autotune(False)
+            assert validate_jsonfile(file)
+            with file.open() as f:
+                return json.load(f)
+
+        def find_node(tree, op_type):
+            if tree["op_type"] == op_type:
+                return tree
+            for child in tree.get("children", []):
+                node = find_node(child, op_type)
+                if node is not None:
+                    return node
+            return None
+
+        config1 = run_pipeline(1000, 10)
+        # Change the saved config of the map op, the first run is a warm-up epoch which is not tuned
+        map_node = find_node(config1["tree"], "Map")
+        assert map_node is not None
+        map_node["num_parallel_workers"] = 3
+        map_node["connector_queue_size"] = 5
+        with file.open("w") as f:
+            json.dump(config1, f)
+
+        # The second run starts from the config saved by the first run
+        config2 = run_pipeline(1000, 10)
+        map_node = find_node(config2["tree"], "Map")
+        assert map_node["num_parallel_workers"] == 3
+        assert map_node["connector_queue_size"] == 5
+        config3 = run_pipeline(1000, 20)
+        assert config1["fingerprint"] == config2["fingerprint"]
+        assert config1["fingerprint"] != config3["fingerprint"]
+
+        ds.config.set_seed(original_seed)
+        ds.config.set_enable_autotune(original_autotune)
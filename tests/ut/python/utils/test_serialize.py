@@ -548,6 +548,54 @@ def test_save_and_load_checkpoint_for_network_with_encryption():
         os.remove(ckpt_path)
 
 
+def test_save_and_load_sharded_checkpoint(tmp_path):
+    """ test save checkpoint into shard files and load it"""
+    parameter_list = [{"name": "small", "data": Tensor(np.random.rand(4, 8).astype(np.float32))},
+                      {"name": "large", "data": Tensor(np.random.rand(512, 1024).astype(np.float32))},
+                      {"name": "step", "data": Tensor(np.array([10], np.int32))}]
+    ckpt_dir = str(tmp_path / "sharded.ckpt")
+    save_checkpoint(parameter_list, ckpt_dir, shard_size=1)
+    assert os.path.isdir(ckpt_dir)
+    assert len(os.listdir(ckpt_dir)) > 2
+
+    param_dict = load_checkpoint(ckpt_dir, filter_prefix="small")
+    assert set(param_dict.keys()) == {"large", "step"}
+    for param in parameter_list[1:]:
+        loaded = param_dict[param["name"]]
+        assert loaded.dtype == param["data"].dtype
+        assert np.array_equal(loaded.asnumpy(), param["data"].asnumpy())
+
+
+def test_async_save_sharded_checkpoint_for_network(tmp_path):
+    """ test the parameters are staged when save checkpoint into shard files asynchronously"""
+    context.set_context(mode=context.GRAPH_MODE)
+    net = nn.Dense(64, 32)
+    expected = {param.name: param.asnumpy().copy() for param in net.get_parameters()}
+    ckpt_dir = str(tmp_path / "async_sharded.ckpt")
+    save_checkpoint(net, ckpt_dir, async_save=True, shard_size=1)
+    # the parameters may be updated as soon as save_checkpoint returns
+    for param in net.get_parameters():
+        param.set_data(Tensor(np.zeros(param.shape, np.float32)))
+
+    param_dict = load_checkpoint(ckpt_dir)
+    assert set(param_dict.keys()) == set(expected.keys())
+    for name, value in expected.items():
+        assert np.array_equal(param_dict[name].asnumpy(), value)
+
+
+def test_sharded_checkpoint_with_encryption(tmp_path):
+    """ test encryption is rejected for the checkpoint saved into shard files"""
+    parameter_list = [{"name": "param", "data": Tensor(np.ones([2, 3]).astype(np.float32))}]
+    ckpt_dir = str(tmp_path / "sharded.ckpt")
+    key = secrets.token_bytes(16)
+    with pytest.raises(ValueError):
+        save_checkpoint(parameter_list, ckpt_dir, enc_key=key, shard_size=1)
+
+    save_checkpoint(parameter_list, ckpt_dir, shard_size=1)
+    with pytest.raises(ValueError):
+        load_checkpoint(ckpt_dir, dec_key=key)
+
+
 class MYNET(nn.Cell):
     """ NET definition """
 